@@ -22,6 +22,7 @@ set(
 		ATTESTATION_SUPPORT_RSA_CHALLENGE
 		ATTESTATION_SUPPORT_RSA_UNSEAL
 		ATTESTATION_SUPPORT_SPDM
+		CMD_ENABLE_COMMAND_STATS
 		CMD_ENABLE_DEBUG_LOG
 		CMD_ENABLE_HEAP_STATS
 		CMD_ENABLE_INTRUSION
@@ -36,6 +37,7 @@ set(
 		HASH_ENABLE_SHA1
 		HASH_ENABLE_SHA384
 		HASH_ENABLE_SHA512
+		LOGGING_ENABLE_TRACE_RING
 		LOGGING_SUPPORT_DEBUG_LOG
 		RSA_ENABLE_DER_PUBLIC_KEY
 		RSA_ENABLE_PRIVATE_KEY
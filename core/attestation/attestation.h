@@ -115,6 +115,7 @@ enum {
 	ATTESTATION_UNEXPECTED_NUM_MEAS_BLOCKS = ATTESTATION_ERROR (0x23),		/**< Unexpected number of measurement blocks in response. */
 	ATTESTATION_CFM_VERSION_SET_SELECTOR_INVALID = ATTESTATION_ERROR (0x24),/**< CFM version set selector entry invalid. */
 	ATTESTATION_FAILED_TO_SELECT_VERSION_SET = ATTESTATION_ERROR (0x25),	/**< Failed to determine device version set using CFM version set selector entry. */
+	ATTESTATION_GET_MEAS_RSP_BAD_DIGEST_LEN = ATTESTATION_ERROR (0x26),	/**< Get Measurements response digest length does not match the hash algorithm. */
 };
 
 
@@ -168,7 +168,7 @@ static int attestation_requester_send_request_and_get_response (
  */
 static int attestation_requester_verify_digest_in_allowable_list (
 	const struct attestation_requester *attestation, struct cfm_digests *allowable_digests,
-	uint8_t *digest, enum hash_type digest_type)
+	const uint8_t *digest, enum hash_type digest_type)
 {
 	size_t offset = 0;
 	size_t digest_len;
@@ -234,6 +234,101 @@ static int attestation_requester_verify_pmr (const struct attestation_requester
 
 
 #if defined(ATTESTATION_SUPPORT_SPDM) || defined(ATTESTATION_SUPPORT_CERBERUS_CHALLENGE)
+/**
+ * Allocate the buffer used to aggregate a certificate chain received from a device.  If a
+ * certificate pool has been configured, the buffer will come from the pool when possible.
+ *
+ * @param attestation Attestation requester instance to utilize.
+ * @param length Size of the buffer to allocate.
+ *
+ * @return 0 if the buffer was allocated or ATTESTATION_NO_MEMORY.
+ */
+static int attestation_requester_allocate_cert_buffer (
+	const struct attestation_requester *attestation, size_t length)
+{
+	attestation->state->txn.cert_buffer =
+		object_pool_allocate (attestation->state->cert_pool, length);
+	if (attestation->state->txn.cert_buffer == NULL) {
+		return ATTESTATION_NO_MEMORY;
+	}
+
+	return 0;
+}
+
+/**
+ * Free the buffer used to aggregate a certificate chain received from a device.
+ *
+ * @param attestation Attestation requester instance to utilize.
+ */
+static void attestation_requester_free_cert_buffer (const struct attestation_requester *attestation)
+{
+	object_pool_free (attestation->state->cert_pool, attestation->state->txn.cert_buffer);
+	attestation->state->txn.cert_buffer = NULL;
+}
+
+/**
+ * Add a verified certificate chain to the certificate chain cache.  If there is already an entry
+ * for the same chain, that entry will be refreshed.  Otherwise, an unused or expired entry will be
+ * selected, falling back to replacing entries in round-robin order.
+ *
+ * @param attestation Attestation requester instance to utilize.
+ * @param component_id The component ID the chain was verified against.
+ * @param digest Digest of the verified certificate chain.
+ * @param digest_len Length of the certificate chain digest.
+ * @param key The leaf public key from the verified chain.
+ * @param key_len Length of the leaf public key.
+ * @param key_type Type of the leaf public key.
+ */
+static void attestation_requester_add_cert_chain_to_cache (
+	const struct attestation_requester *attestation, uint32_t component_id, const uint8_t *digest,
+	size_t digest_len, const uint8_t *key, size_t key_len, int key_type)
+{
+	struct attestation_requester_cert_cache_entry *entry = NULL;
+	size_t i;
+
+	if ((digest_len > sizeof (entry->digest)) || (key_len > sizeof (entry->leaf_key.key))) {
+		return;
+	}
+
+	for (i = 0; i < ATTESTATION_REQUESTER_CERT_CACHE_ENTRIES; ++i) {
+		struct attestation_requester_cert_cache_entry *current = &attestation->state->cert_cache[i];
+
+		if (current->valid && (current->component_id == component_id) &&
+			(current->slot_num == attestation->state->txn.slot_num) &&
+			(current->digest_len == digest_len) &&
+			(memcmp (current->digest, digest, digest_len) == 0)) {
+			entry = current;
+			break;
+		}
+
+		if ((entry == NULL) &&
+			(!current->valid || (platform_has_timeout_expired (&current->expiration) == 1))) {
+			entry = current;
+		}
+	}
+
+	if (entry == NULL) {
+		entry = &attestation->state->cert_cache[attestation->state->cert_cache_next];
+		attestation->state->cert_cache_next =
+			(attestation->state->cert_cache_next + 1) % ATTESTATION_REQUESTER_CERT_CACHE_ENTRIES;
+	}
+
+	if (platform_init_timeout (ATTESTATION_REQUESTER_CERT_CACHE_TIMEOUT_MS,
+		&entry->expiration) != 0) {
+		entry->valid = false;
+		return;
+	}
+
+	memcpy (entry->digest, digest, digest_len);
+	entry->digest_len = digest_len;
+	memcpy (entry->leaf_key.key, key, key_len);
+	entry->leaf_key.key_len = key_len;
+	entry->leaf_key.key_type = key_type;
+	entry->component_id = component_id;
+	entry->slot_num = attestation->state->txn.slot_num;
+	entry->valid = true;
+}
+
 /**
  * Verify certificate chain received from device and if successful store alias key.
  *
@@ -368,8 +463,7 @@ static int attestation_requester_verify_and_load_leaf_key (
 		goto release_leaf_cert;
 	}
 
-	platform_free (attestation->state->txn.cert_buffer);
-	attestation->state->txn.cert_buffer = NULL;
+	attestation_requester_free_cert_buffer (attestation);
 	attestation->state->txn.cert_buffer_len = 0;
 
 	status = attestation->x509->authenticate (attestation->x509, &cert, &certs_chain);
@@ -400,6 +494,12 @@ static int attestation_requester_verify_and_load_leaf_key (
 
 	status = device_manager_update_alias_key (attestation->device_mgr, eid, leaf_key, leaf_key_len,
 		leaf_key_type);
+	if ((status == 0) &&
+		(attestation->state->txn.protocol >= ATTESTATION_PROTOCOL_DMTF_SPDM_1_1)) {
+		attestation_requester_add_cert_chain_to_cache (attestation, component_id, digest,
+			transcript_hash_len, leaf_key, leaf_key_len, leaf_key_type);
+	}
+
 	platform_free (leaf_key);
 
 release_leaf_cert:
@@ -409,7 +509,7 @@ release_cert_store:
 	attestation->x509->release_ca_cert_store (attestation->x509, &certs_chain);
 
 release_cert_buffer:
-	platform_free (attestation->state->txn.cert_buffer);
+	attestation_requester_free_cert_buffer (attestation);
 	attestation->state->txn.cert_buffer_len = 0;
 
 	return status;
@@ -835,19 +935,15 @@ static int attestation_requester_get_certificate_rsp_post_processing (
 		 * TODO: Optimize cert chain retrieval, get one cert at a time. */
 		if (attestation->state->txn.cert_buffer_len == 0) {
 			attestation->state->txn.cert_total_len = rsp->portion_len + rsp->remainder_len;
-			attestation->state->txn.cert_buffer =
-				platform_malloc (attestation->state->txn.cert_total_len);
-			if (attestation->state->txn.cert_buffer == NULL) {
+			if (attestation_requester_allocate_cert_buffer (attestation,
+				attestation->state->txn.cert_total_len) != 0) {
 				return ATTESTATION_NO_MEMORY;
 			}
 		}
 
 		if ((rsp->portion_len + attestation->state->txn.cert_buffer_len) >
 			attestation->state->txn.cert_total_len) {
-			if (attestation->state->txn.cert_buffer != NULL) {
-				platform_free (attestation->state->txn.cert_buffer);
-				attestation->state->txn.cert_buffer = NULL;
-			}
+			attestation_requester_free_cert_buffer (attestation);
 
 			return ATTESTATION_NO_MEMORY;
 		}
@@ -1315,9 +1411,8 @@ void attestation_requester_on_cerberus_get_certificate_response (
 	}
 	else {
 		if (attestation->state->txn.cert_buffer_len == 0) {
-			attestation->state->txn.cert_buffer =
-				platform_malloc (CERBERUS_PROTOCOL_MAX_CERT_CHAIN_LEN);
-			if (attestation->state->txn.cert_buffer == NULL) {
+			if (attestation_requester_allocate_cert_buffer (attestation,
+				CERBERUS_PROTOCOL_MAX_CERT_CHAIN_LEN) != 0) {
 				goto fail;
 			}
 		}
@@ -1497,6 +1592,23 @@ void attestation_requester_on_mctp_get_routing_table_entries_response (
 	attestation->state->txn.msg_buffer_len = response->length;
 }
 
+/**
+ * Invalidate all entries in the certificate chain cache.
+ *
+ * @param attestation Attestation requester instance to utilize.
+ */
+static void attestation_requester_clear_cert_chain_cache (
+	const struct attestation_requester *attestation)
+{
+	size_t i;
+
+	for (i = 0; i < ATTESTATION_REQUESTER_CERT_CACHE_ENTRIES; ++i) {
+		attestation->state->cert_cache[i].valid = false;
+	}
+
+	attestation->state->cert_cache_next = 0;
+}
+
 /**
  * CFM activation request observer function. CFM activation requests are used to communicate to
  * device that component attestation states should be reset.
@@ -1508,6 +1620,10 @@ void attestation_requester_on_cfm_activation_request (const struct cfm_observer
 
 	device_manager_reset_authenticated_devices (attestation->device_mgr);
 
+	/* Root CA requirements come from the CFM, so chains verified against the previous CFM must be
+	 * checked again. */
+	attestation_requester_clear_cert_chain_cache (attestation);
+
 	platform_semaphore_post (&attestation->state->next_action);
 }
 #endif
@@ -1640,6 +1756,55 @@ void attestation_requester_deinit (const struct attestation_requester *attestati
 	}
 }
 
+/**
+ * Configure a memory pool for the buffer used to aggregate certificate chains received from
+ * devices.  Chains that do not fit in a pool block will be allocated from the system heap.  This
+ * must not be called while an attestation is in progress.
+ *
+ * @param attestation Attestation requester instance to configure.
+ * @param pool The pool to use for certificate chain buffers.  Null to always use the system heap.
+ *
+ * @return 0 if the configuration was updated successfully or an error code.
+ */
+int attestation_requester_set_cert_chain_pool (const struct attestation_requester *attestation,
+	const struct object_pool *pool)
+{
+	if (attestation == NULL) {
+		return ATTESTATION_INVALID_ARGUMENT;
+	}
+
+	attestation->state->cert_pool = pool;
+
+	return 0;
+}
+
+#ifdef ATTESTATION_SUPPORT_SPDM
+/**
+ * Configure how SPDM measurement blocks are retrieved when verifying individual measurement and
+ * measurement data entries from the CFM.  When batching is enabled, all measurement blocks are
+ * retrieved from the device with a single Get Measurements request and every CFM rule is checked
+ * against that response.  Otherwise, each measurement block is requested individually.
+ *
+ * Batching requires the full measurement record for a device to fit in a single response message.
+ *
+ * @param attestation Attestation requester instance to configure.
+ * @param enable Flag indicating whether measurement blocks should be retrieved in a single request.
+ *
+ * @return 0 if the configuration was updated successfully or an error code.
+ */
+int attestation_requester_set_batch_measurements (const struct attestation_requester *attestation,
+	bool enable)
+{
+	if (attestation == NULL) {
+		return ATTESTATION_INVALID_ARGUMENT;
+	}
+
+	attestation->state->batch_measurements = enable;
+
+	return 0;
+}
+#endif
+
 #ifdef ATTESTATION_SUPPORT_CERBERUS_CHALLENGE
 /**
  * Perform an attestation cycle on a provided device using Cerberus Protocol.
@@ -1957,6 +2122,64 @@ static int attestation_requester_setup_spdm_device (const struct attestation_req
 	return 0;
 }
 
+/**
+ * Build an index of the measurement blocks contained in a Get Measurements response.  The blocks
+ * are left in place in msg_buffer and the offset to each block header is recorded by block index.
+ *
+ * @param attestation Attestation requester instance to utilize.
+ * @param device_eid EID of device that sent the response.
+ *
+ * @return Completion status, 0 if success or an error code otherwise
+ */
+static int attestation_requester_index_spdm_measurement_blocks (
+	const struct attestation_requester *attestation, uint8_t device_eid)
+{
+	struct spdm_get_measurements_response *rsp =
+		(struct spdm_get_measurements_response*) attestation->state->txn.msg_buffer;
+	struct spdm_measurements_block_header *block;
+	size_t offset = sizeof (struct spdm_get_measurements_response);
+	size_t record_end = offset + spdm_get_measurements_resp_measurement_record_len (rsp);
+	uint8_t i_block;
+
+	memset (attestation->state->txn.measurement_block_offset, 0,
+		sizeof (attestation->state->txn.measurement_block_offset));
+
+	if (record_end > attestation->state->txn.msg_buffer_len) {
+		goto bad_length;
+	}
+
+	for (i_block = 0; i_block < rsp->number_of_blocks; ++i_block) {
+		if ((offset + sizeof (struct spdm_measurements_block_header)) > record_end) {
+			goto bad_length;
+		}
+
+		block =
+			(struct spdm_measurements_block_header*) &attestation->state->txn.msg_buffer[offset];
+
+		if ((offset + sizeof (struct spdm_measurements_block_header) +
+			block->dmtf.measurement_size) > record_end) {
+			goto bad_length;
+		}
+
+		if (block->index < SPDM_MEASUREMENT_OPERATION_GET_ALL_BLOCKS) {
+			attestation->state->txn.measurement_block_offset[block->index] = offset;
+		}
+
+		offset += sizeof (struct spdm_measurements_block_header) + block->dmtf.measurement_size;
+	}
+
+	attestation->state->txn.measurement_blocks_indexed = true;
+
+	return 0;
+
+bad_length:
+	debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_ATTESTATION,
+		ATTESTATION_LOGGING_UNEXPECTED_RSP_LEN, (device_eid << 8) | SPDM_RESPONSE_GET_MEASUREMENTS,
+		(((uint16_t) record_end) << 16) | ((uint16_t) attestation->state->txn.msg_buffer_len));
+
+	return ATTESTATION_BAD_LENGTH;
+}
+
 /**
  * SPDM get measurements response processing function.  For Get Measurements responses outside of
  *  device discovery, validating the transcript signature.
@@ -1994,6 +2217,10 @@ static int attestation_requester_spdm_process_get_measurements_response (
 		}
 	}
 
+	if (attestation->state->txn.index_measurement_blocks) {
+		return attestation_requester_index_spdm_measurement_blocks (attestation, device_eid);
+	}
+
 	attestation->state->txn.msg_buffer_len = 0;
 
 	for (i_block = 0; i_block < number_of_blocks; ++i_block) {
@@ -2026,6 +2253,16 @@ static int attestation_requester_spdm_process_get_measurements_response (
 				device_eid, block->index);
 			return ATTESTATION_GET_MEAS_RSP_NOT_RAW;
 		}
+		// If block is in digest form, the digest must match the negotiated hash algorithm
+		else if (!attestation->state->txn.raw_bitstream_requested &&
+			(block->dmtf.measurement_size !=
+				hash_get_hash_length (attestation->state->txn.measurement_hash_type))) {
+			debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_ATTESTATION,
+				ATTESTATION_LOGGING_UNEXPECTED_HASH_LEN_IN_RSP, device_eid,
+				(block->dmtf.measurement_size << 8) |
+					hash_get_hash_length (attestation->state->txn.measurement_hash_type));
+			return ATTESTATION_GET_MEAS_RSP_BAD_DIGEST_LEN;
+		}
 		else {
 			if ((block->dmtf.measurement_size + attestation->state->txn.msg_buffer_len) >
 				sizeof (attestation->state->txn.msg_buffer)) {
@@ -2067,6 +2304,8 @@ static int attestation_requester_send_and_receive_spdm_get_measurements (
 	int rq_len;
 	int status;
 
+	attestation->state->txn.measurement_blocks_indexed = false;
+
 	if (!attestation->state->txn.device_discovery) {
 		if (!attestation->state->txn.hash_finish) {
 			attestation->secondary_hash->cancel (attestation->secondary_hash);
@@ -2215,6 +2454,104 @@ free_pmr_digest:
 	return status;
 }
 
+/**
+ * Get a single SPDM measurement block from a device.  If batched measurement retrieval is enabled,
+ * all measurement blocks are retrieved with one Get Measurements request and indexed, and
+ * subsequent calls are served from that index as long as the same block form is requested.
+ * Otherwise, the block is requested individually from the device.
+ *
+ * @param attestation Attestation requester instance to utilize.
+ * @param eid EID of device being attested.
+ * @param device_addr Slave address of device.
+ * @param measurement_id Index of the measurement block to get.
+ * @param raw_bitstream_requested Flag indicating whether to get the raw form of the block.
+ * @param data Output for the measurement data from the block.  This points into msg_buffer.
+ * @param length Output for the length of the measurement data.
+ *
+ * @return Completion status, 0 if success or an error code otherwise
+ */
+static int attestation_requester_get_spdm_measurement_block (
+	const struct attestation_requester *attestation, uint8_t eid, int device_addr,
+	uint8_t measurement_id, bool raw_bitstream_requested, const uint8_t **data, size_t *length)
+{
+	struct spdm_measurements_block_header *block;
+	uint16_t offset;
+	int status;
+
+	if (!attestation->state->batch_measurements) {
+		status = attestation_requester_send_and_receive_spdm_get_measurements (attestation, eid,
+			device_addr, measurement_id, raw_bitstream_requested);
+		if (status != 0) {
+			return status;
+		}
+
+		*data = attestation->state->txn.msg_buffer;
+		*length = attestation->state->txn.msg_buffer_len;
+
+		return 0;
+	}
+
+	if (!attestation->state->txn.measurement_blocks_indexed ||
+		(attestation->state->txn.raw_bitstream_requested != raw_bitstream_requested)) {
+		attestation->state->txn.index_measurement_blocks = true;
+
+		status = attestation_requester_send_and_receive_spdm_get_measurements (attestation, eid,
+			device_addr, SPDM_MEASUREMENT_OPERATION_GET_ALL_BLOCKS, raw_bitstream_requested);
+
+		attestation->state->txn.index_measurement_blocks = false;
+
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	if (measurement_id >= SPDM_MEASUREMENT_OPERATION_GET_ALL_BLOCKS) {
+		offset = 0;
+	}
+	else {
+		offset = attestation->state->txn.measurement_block_offset[measurement_id];
+	}
+
+	if (offset == 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_ATTESTATION,
+			ATTESTATION_LOGGING_UNEXPECTED_NUM_MEASUREMENT_BLOCKS, eid,
+			(1 << 16) | (measurement_id << 8));
+
+		return ATTESTATION_UNEXPECTED_NUM_MEAS_BLOCKS;
+	}
+
+	block = (struct spdm_measurements_block_header*) &attestation->state->txn.msg_buffer[offset];
+
+	if (!raw_bitstream_requested && block->dmtf.raw_bit_stream) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_ATTESTATION,
+			ATTESTATION_LOGGING_UNEXPECTED_MEASUREMENT_BLOCK_RAW, eid,
+			(SPDM_MEASUREMENT_OPERATION_GET_ALL_BLOCKS << 8) | block->index);
+
+		return ATTESTATION_GET_MEAS_RSP_NOT_DIGEST;
+	}
+	else if (raw_bitstream_requested && !block->dmtf.raw_bit_stream) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_ATTESTATION,
+			ATTESTATION_LOGGING_UNEXPECTED_MEASUREMENT_BLOCK_DIGEST, eid, block->index);
+
+		return ATTESTATION_GET_MEAS_RSP_NOT_RAW;
+	}
+	else if (!raw_bitstream_requested && (block->dmtf.measurement_size !=
+		hash_get_hash_length (attestation->state->txn.measurement_hash_type))) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_ATTESTATION,
+			ATTESTATION_LOGGING_UNEXPECTED_HASH_LEN_IN_RSP, eid,
+			(block->dmtf.measurement_size << 8) |
+				hash_get_hash_length (attestation->state->txn.measurement_hash_type));
+
+		return ATTESTATION_GET_MEAS_RSP_BAD_DIGEST_LEN;
+	}
+
+	*data = &attestation->state->txn.msg_buffer[offset +
+		sizeof (struct spdm_measurements_block_header)];
+	*length = block->dmtf.measurement_size;
+
+	return 0;
+}
+
 /**
  * Get corresponding the SPDM measurement block for a measurement entry from the CFM, then compare
  * to allowable values.
@@ -2230,11 +2567,13 @@ static int attestation_requester_get_and_verify_spdm_measurement_block (
 	const struct attestation_requester *attestation, struct cfm_measurement_digest *measurement,
 	uint8_t eid, int device_addr)
 {
+	const uint8_t *digest;
+	size_t digest_len;
 	size_t i_allowable_digests;
 	int status = 0;
 
-	status = attestation_requester_send_and_receive_spdm_get_measurements (attestation, eid,
-		device_addr, measurement->measurement_id, false);
+	status = attestation_requester_get_spdm_measurement_block (attestation, eid, device_addr,
+		measurement->measurement_id, false, &digest, &digest_len);
 	if (status != 0) {
 		return status;
 	}
@@ -2266,7 +2605,7 @@ static int attestation_requester_get_and_verify_spdm_measurement_block (
 		}
 
 		status = attestation_requester_verify_digest_in_allowable_list (attestation,
-			&measurement->allowable_digests[i_allowable_digests].digests, NULL,
+			&measurement->allowable_digests[i_allowable_digests].digests, digest,
 			attestation->state->txn.measurement_hash_type);
 		if (status == 0) {
 			// If device version set still not selected, then set it
@@ -2364,9 +2703,11 @@ static int attestation_requester_compare_data (enum cfm_check check, const uint8
 }
 
 /**
- * Check if data in msg_buffer matches all checks in allowable data list from CFM entry.
+ * Check if measurement data matches all checks in allowable data list from CFM entry.
  *
  * @param attestation Attestation requester instance to utilize.
+ * @param data Measurement data to check.
+ * @param data_len Length of the measurement data.
  * @param check List of allowable data checks to utilize.
  * @param num_check Number of allowable data checks.
  * @param pmr_id PMR ID for CFM measurement data entry.
@@ -2376,7 +2717,8 @@ static int attestation_requester_compare_data (enum cfm_check check, const uint8
  * @return Completion status, 0 if success or an error code otherwise
  */
 static int attestation_requester_verify_data_in_allowable_list (
-	const struct attestation_requester *attestation, struct cfm_allowable_data *check,
+	const struct attestation_requester *attestation, const uint8_t *data, size_t data_len,
+	struct cfm_allowable_data *check,
 	size_t num_check, uint8_t pmr_id, uint8_t measurement_id, uint8_t eid)
 {
 	size_t i_checks_in_version_set = 0;
@@ -2408,8 +2750,7 @@ static int attestation_requester_verify_data_in_allowable_list (
 				return ATTESTATION_CFM_VERSION_SET_SELECTOR_INVALID;
 			}
 
-			if ((check->allowable_data[i_data].data_len !=
-				attestation->state->txn.msg_buffer_len)) {
+			if (check->allowable_data[i_data].data_len != data_len) {
 				return ATTESTATION_CFM_INVALID_ATTESTATION;
 			}
 
@@ -2422,9 +2763,9 @@ static int attestation_requester_verify_data_in_allowable_list (
 
 			++i_checks_in_version_set;
 
-			status = attestation_requester_compare_data (check->check,
-				attestation->state->txn.msg_buffer, check->allowable_data[i_data].data,
-				check->allowable_data[i_data].data_len, check->bitmask, check->big_endian);
+			status = attestation_requester_compare_data (check->check, data,
+				check->allowable_data[i_data].data, check->allowable_data[i_data].data_len,
+				check->bitmask, check->big_endian);
 			if (status == 0) {
 				// If device version set still not selected, then set it
 				if (!attestation_requester_is_version_set_selected (attestation)) {
@@ -2473,16 +2814,19 @@ static int attestation_requester_get_and_verify_spdm_measurement_data_block (
 	const struct attestation_requester *attestation, struct cfm_measurement_data *data,
 	uint8_t eid, int device_addr)
 {
+	const uint8_t *measurement;
+	size_t measurement_len;
 	int status;
 
-	status = attestation_requester_send_and_receive_spdm_get_measurements (attestation, eid,
-		device_addr, data->measurement_id, true);
+	status = attestation_requester_get_spdm_measurement_block (attestation, eid, device_addr,
+		data->measurement_id, true, &measurement, &measurement_len);
 	if (status != 0) {
 		return status;
 	}
 
-	status = attestation_requester_verify_data_in_allowable_list (attestation, data->data_checks,
-		data->data_checks_count, data->pmr_id, data->measurement_id, eid);
+	status = attestation_requester_verify_data_in_allowable_list (attestation, measurement,
+		measurement_len, data->data_checks, data->data_checks_count, data->pmr_id,
+		data->measurement_id, eid);
 
 	// If device version set not selected, then report error
 	if (!attestation_requester_is_version_set_selected (attestation)) {
@@ -2583,6 +2927,47 @@ static int attestation_requester_spdm_process_challenge_response (
 	return 0;
 }
 
+/**
+ * Load the alias key for a device from the certificate chain cache.  The cache is searched for a
+ * verified chain that matches the certificate chain digest most recently reported by the device
+ * through GET_DIGESTS.  Expired entries are invalidated as they are encountered.
+ *
+ * @param attestation Attestation requester instance to utilize.
+ * @param eid EID of the device being attested.
+ * @param component_id The component ID of the device.
+ *
+ * @return 0 if the alias key was loaded from the cache, ATTESTATION_CERT_NOT_AVAILABLE if there is
+ * no valid cached chain for the device, or an error code.
+ */
+static int attestation_requester_load_cached_leaf_key (
+	const struct attestation_requester *attestation, uint8_t eid, uint32_t component_id)
+{
+	struct attestation_requester_cert_cache_entry *entry;
+	size_t i;
+
+	for (i = 0; i < ATTESTATION_REQUESTER_CERT_CACHE_ENTRIES; ++i) {
+		entry = &attestation->state->cert_cache[i];
+
+		if (!entry->valid || (entry->component_id != component_id) ||
+			(entry->slot_num != attestation->state->txn.slot_num)) {
+			continue;
+		}
+
+		if (platform_has_timeout_expired (&entry->expiration) != 0) {
+			entry->valid = false;
+			continue;
+		}
+
+		if (device_manager_compare_cert_chain_digest (attestation->device_mgr, eid, entry->digest,
+			entry->digest_len) == 0) {
+			return device_manager_update_alias_key (attestation->device_mgr, eid,
+				entry->leaf_key.key, entry->leaf_key.key_len, entry->leaf_key.key_type);
+		}
+	}
+
+	return ATTESTATION_CERT_NOT_AVAILABLE;
+}
+
 /**
  * Perform an attestation cycle on a provided device using SPDM.
  *
@@ -2635,9 +3020,11 @@ static int attestation_requester_attest_device_spdm (
 		goto hash_cancel;
 	}
 
-	// If certificate chain digest retrieved does not match cached certificate, refresh chain
+	/* If certificate chain digest retrieved does not match cached certificate, check for a matching
+	 * chain that has already been verified before refreshing the chain from the device. */
 	alias_key = device_manager_get_alias_key (attestation->device_mgr, eid);
-	if (alias_key == NULL) {
+	if ((alias_key == NULL) &&
+		(attestation_requester_load_cached_leaf_key (attestation, eid, component_id) != 0)) {
 		attestation->state->txn.cert_buffer_len = 0;
 		attestation->state->txn.cert_total_len = SPDM_GET_CERTIFICATE_MAX_CERT_BUFFER;
 
@@ -2655,7 +3042,7 @@ static int attestation_requester_attest_device_spdm (
 			status = attestation_requester_send_spdm_request_and_get_response (attestation, rq_len,
 				device_addr, eid, true, SPDM_REQUEST_GET_CERTIFICATE);
 			if (status != 0) {
-				platform_free (attestation->state->txn.cert_buffer);
+				attestation_requester_free_cert_buffer (attestation);
 				goto clear_cert_chain;
 			}
 		}
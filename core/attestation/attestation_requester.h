@@ -16,12 +16,24 @@
 #include "manifest/cfm/cfm_observer.h"
 #include "mctp/mctp_base_protocol.h"
 #include "mctp/mctp_control_protocol_observer.h"
+#include "memory_mgmt/object_pool.h"
+#include "spdm/spdm_commands.h"
 #include "spdm/spdm_protocol_observer.h"
 #include "riot/riot_key_manager.h"
 #include "attestation.h"
 #include "pcr_store.h"
 
 
+/* Configurable verified certificate chain cache parameters.  Defaults can be overridden in
+ * platform_config.h. */
+#ifndef ATTESTATION_REQUESTER_CERT_CACHE_ENTRIES
+#define ATTESTATION_REQUESTER_CERT_CACHE_ENTRIES					4
+#endif
+#ifndef ATTESTATION_REQUESTER_CERT_CACHE_TIMEOUT_MS
+#define ATTESTATION_REQUESTER_CERT_CACHE_TIMEOUT_MS					86400000
+#endif
+
+
 /**
  * Attestation requester request transaction state
  */
@@ -56,6 +68,22 @@ struct attestation_requester_transaction_state {
 	bool challenge_supported;									/**< Challenge command supported. */
 	bool raw_bitstream_requested;								/**< Requested raw measurement data from device. */
 	bool device_discovery;										/**< Performing device discovery. */
+	bool index_measurement_blocks;								/**< Index measurement blocks in the next Get Measurements response instead of combining them. */
+	bool measurement_blocks_indexed;							/**< Measurement blocks in the message buffer have been indexed. */
+	uint16_t measurement_block_offset[SPDM_MEASUREMENT_OPERATION_GET_ALL_BLOCKS];	/**< Message buffer offset of each indexed measurement block, or 0 if not present. */
+};
+
+/**
+ * A certificate chain that has already been verified, along with the leaf key extracted from it.
+ */
+struct attestation_requester_cert_cache_entry {
+	uint8_t digest[HASH_MAX_HASH_LEN];							/**< Digest of the verified certificate chain. */
+	size_t digest_len;											/**< Length of the certificate chain digest. */
+	struct device_manager_key leaf_key;							/**< Public key from the verified leaf certificate. */
+	uint32_t component_id;										/**< Component ID the certificate chain was verified against. */
+	uint8_t slot_num;											/**< Slot number the certificate chain was read from. */
+	platform_clock expiration;									/**< Time at which the cached chain must be verified again. */
+	bool valid;													/**< Flag indicating the cache entry is in use. */
 };
 
 /**
@@ -63,8 +91,12 @@ struct attestation_requester_transaction_state {
  */
 struct attestation_requester_state {
 	struct attestation_requester_transaction_state txn;			/**< Current transaction context. */
+	struct attestation_requester_cert_cache_entry cert_cache[ATTESTATION_REQUESTER_CERT_CACHE_ENTRIES];	/**< Cache of verified certificate chains. */
+	uint8_t cert_cache_next;									/**< Next cache entry to replace when the cache is full. */
 	bool get_routing_table;										/**< Flag indicating that MCTP routing table should be updated. */
 	bool mctp_bridge_wait;										/**< Flag indicating Cerberus is waiting on MCTP bridge to start discovery flow */
+	bool batch_measurements;									/**< Flag indicating all SPDM measurement blocks should be retrieved with a single request. */
+	const struct object_pool *cert_pool;						/**< Optional pool for certificate chain buffers. */
 	platform_semaphore next_action;								/**< Semaphore used to indicate attestation requester has a pending action. */
 };
 
@@ -117,6 +149,14 @@ int attestation_requester_discover_device (const struct attestation_requester *a
 int attestation_requester_get_mctp_routing_table (const struct attestation_requester *attestation);
 #endif
 
+int attestation_requester_set_cert_chain_pool (const struct attestation_requester *attestation,
+	const struct object_pool *pool);
+
+#ifdef ATTESTATION_SUPPORT_SPDM
+int attestation_requester_set_batch_measurements (const struct attestation_requester *attestation,
+	bool enable);
+#endif
+
 void attestation_requester_discovery_and_attestation_loop (
 	const struct attestation_requester *attestation, struct pcr_store *pcr, uint16_t measurement,
 	uint8_t measurement_version);
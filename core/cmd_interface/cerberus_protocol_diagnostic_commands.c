@@ -36,3 +36,59 @@ int cerberus_protocol_heap_stats (const struct cmd_device *device,
 	return CMD_HANDLER_UNSUPPORTED_COMMAND;
 #endif
 }
+
+/**
+ * Process request to get execution statistics for supported commands.  If there are more commands
+ * than will fit in a single response, the request offset can be used to retrieve the remaining
+ * entries.
+ *
+ * @param stats The list of statistics for each command.
+ * @param num_commands The number of commands in the statistics list.
+ * @param request Command statistics request to process.
+ *
+ * @return 0 if request completed successfully or an error code.
+ */
+int cerberus_protocol_command_stats (const struct cmd_interface_stats_entry *stats,
+	size_t num_commands, struct cmd_interface_msg *request)
+{
+	struct cerberus_protocol_command_stats *rq =
+		(struct cerberus_protocol_command_stats*) request->data;
+	struct cerberus_protocol_command_stats_response *rsp =
+		(struct cerberus_protocol_command_stats_response*) request->data;
+	size_t offset;
+	size_t count = 0;
+
+	if (request->length != sizeof (struct cerberus_protocol_command_stats)) {
+		return CMD_HANDLER_BAD_LENGTH;
+	}
+
+	if (request->max_response < sizeof (struct cerberus_protocol_command_stats_response)) {
+		return CMD_HANDLER_RESPONSE_TOO_SMALL;
+	}
+
+	if (stats == NULL) {
+		num_commands = 0;
+	}
+	else if (num_commands > 0xff) {
+		/* Only 255 commands can be reported through the response format. */
+		num_commands = 0xff;
+	}
+
+	offset = rq->offset;
+	if (offset < num_commands) {
+		count = (request->max_response - sizeof (struct cerberus_protocol_command_stats_response)) /
+			sizeof (struct cmd_interface_stats_entry);
+		if (count > (num_commands - offset)) {
+			count = num_commands - offset;
+		}
+
+		memcpy (cerberus_protocol_command_stats_entries (rsp), &stats[offset],
+			count * sizeof (struct cmd_interface_stats_entry));
+	}
+
+	rsp->num_commands = num_commands;
+	request->length = sizeof (struct cerberus_protocol_command_stats_response) +
+		(count * sizeof (struct cmd_interface_stats_entry));
+
+	return 0;
+}
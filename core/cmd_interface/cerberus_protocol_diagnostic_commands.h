@@ -7,6 +7,7 @@
 #include "cmd_interface/cerberus_protocol.h"
 #include "cmd_interface/cmd_device.h"
 #include "cmd_interface/cmd_interface.h"
+#include "cmd_interface/cmd_interface_stats.h"
 
 
 #pragma pack(push, 1)
@@ -24,11 +25,37 @@ struct cerberus_protocol_heap_stats_response {
 	struct cerberus_protocol_header header;					/**< Message header */
 	struct cmd_device_heap_stats heap;						/**< Current heap statistics */
 };
+
+/**
+ * Cerberus protocol command statistics diagnostic request format
+ */
+struct cerberus_protocol_command_stats {
+	struct cerberus_protocol_header header;					/**< Message header */
+	uint8_t offset;											/**< Index of the first command to report */
+};
+
+/**
+ * Cerberus protocol command statistics diagnostic response format
+ */
+struct cerberus_protocol_command_stats_response {
+	struct cerberus_protocol_header header;					/**< Message header */
+	uint8_t num_commands;									/**< Total number of commands with statistics */
+};
+
+/**
+ * Get the buffer containing the command statistics entries.
+ *
+ * @param resp Pointer to a command statistics response message.
+ */
+#define	cerberus_protocol_command_stats_entries(resp)	\
+	((struct cmd_interface_stats_entry*) (((uint8_t*) resp) + sizeof (*resp)))
 #pragma pack(pop)
 
 
 int cerberus_protocol_heap_stats (const struct cmd_device *device,
 	struct cmd_interface_msg *request);
+int cerberus_protocol_command_stats (const struct cmd_interface_stats_entry *stats,
+	size_t num_commands, struct cmd_interface_msg *request);
 
 
 #endif /* CERBERUS_PROTOCOL_DIAGNOSTIC_COMMANDS_H_ */
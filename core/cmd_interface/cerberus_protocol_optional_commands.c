@@ -206,7 +206,9 @@ int cerberus_protocol_get_log_info (struct pcr_store *pcr_store,
 }
 
 /**
- * Process log read request
+ * Process log read request.  For the debug log, the request can optionally include the ID of the
+ * last entry the requester has already read.  In this case, the offset is relative to the first
+ * entry newer than the specified entry.
  *
  * @param pcr_store PCR store instance to utilize
  * @param hash Hash engine to utilize
@@ -217,25 +219,44 @@ int cerberus_protocol_get_log_info (struct pcr_store *pcr_store,
 int cerberus_protocol_log_read (struct pcr_store *pcr_store, struct hash_engine *hash,
 	struct cmd_interface_msg *request)
 {
-	struct cerberus_protocol_get_log *rq = (struct cerberus_protocol_get_log*) request->data;
+	struct cerberus_protocol_get_log_after_entry *rq =
+		(struct cerberus_protocol_get_log_after_entry*) request->data;
 	struct cerberus_protocol_get_log_response *rsp =
 		(struct cerberus_protocol_get_log_response*) request->data;
+	uint32_t offset = rq->offset;
 	int log_length;
 
-	if (request->length != sizeof (struct cerberus_protocol_get_log)) {
+	if (request->length == sizeof (struct cerberus_protocol_get_log_after_entry)) {
+		if (rq->log_type != CERBERUS_PROTOCOL_DEBUG_LOG) {
+			return CMD_HANDLER_BAD_LENGTH;
+		}
+
+		log_length = debug_log_get_entry_offset (rq->entry_id);
+		if (ROT_IS_ERROR (log_length)) {
+			return log_length;
+		}
+
+		if (offset > (UINT32_MAX - log_length)) {
+			offset = UINT32_MAX;
+		}
+		else {
+			offset += log_length;
+		}
+	}
+	else if (request->length != sizeof (struct cerberus_protocol_get_log)) {
 		return CMD_HANDLER_BAD_LENGTH;
 	}
 
 	if (rq->log_type == CERBERUS_PROTOCOL_DEBUG_LOG) {
-		log_length = debug_log_read_contents (rq->offset, cerberus_protocol_log_data (rsp),
+		log_length = debug_log_read_contents (offset, cerberus_protocol_log_data (rsp),
 			CERBERUS_PROTOCOL_MAX_LOG_DATA (request));
 	}
 	else if (rq->log_type == CERBERUS_PROTOCOL_ATTESTATION_LOG) {
-		log_length = pcr_store_get_attestation_log (pcr_store, hash, rq->offset,
+		log_length = pcr_store_get_attestation_log (pcr_store, hash, offset,
 			cerberus_protocol_log_data (rsp), CERBERUS_PROTOCOL_MAX_LOG_DATA (request));
 	}
 	else if (rq->log_type == CERBERUS_PROTOCOL_TCG_LOG) {
-		log_length = pcr_store_get_tcg_log (pcr_store, cerberus_protocol_log_data (rsp), rq->offset,
+		log_length = pcr_store_get_tcg_log (pcr_store, cerberus_protocol_log_data (rsp), offset,
 			CERBERUS_PROTOCOL_MAX_LOG_DATA (request));
 	}
 	else {
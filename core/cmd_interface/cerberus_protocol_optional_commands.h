@@ -626,6 +626,17 @@ struct cerberus_protocol_get_log {
 	uint32_t offset;										/**< Offset to start reding the log */
 };
 
+/**
+ * Cerberus protocol get log request format for reading only debug log entries that are newer than a
+ * known entry
+ */
+struct cerberus_protocol_get_log_after_entry {
+	struct cerberus_protocol_header header;					/**< Message header */
+	uint8_t log_type;										/**< Log identifier to read */
+	uint32_t offset;										/**< Offset from the first newer entry */
+	uint32_t entry_id;										/**< ID of the last entry already read */
+};
+
 /**
  * Cerberus protocol get log response format
  */
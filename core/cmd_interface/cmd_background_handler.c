@@ -439,9 +439,12 @@ void cmd_background_handler_execute (const struct event_task_handler *handler,
 			/* This command assumes logging to flash.  To implement a more portable command would
 			 * require an API from the logging interface to indicate the maximum number of entries
 			 * or a direct API to fill the log with data.  It's not worth that flexibility for a
-			 * seldom used debug command. */
+			 * seldom used debug command.
+			 *
+			 * The entry length is not fixed when compact entries are used, so the count is based on
+			 * the length of the entries being added. */
 			int max_count =
-				(FLASH_SECTOR_SIZE / sizeof (struct debug_log_entry)) * LOGGING_FLASH_SECTORS;
+				(FLASH_SECTOR_SIZE / debug_log_get_entry_length (0, 0)) * LOGGING_FLASH_SECTORS;
 			int i_entry;
 
 			debug_log_clear ();
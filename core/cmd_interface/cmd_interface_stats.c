@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "cmd_interface_stats.h"
+
+
+/**
+ * Initialize the statistics for a command.  All counters will be cleared.
+ *
+ * @param entry The command statistics to initialize.
+ * @param command_id The command the statistics will be tracking.
+ */
+void cmd_interface_stats_init (struct cmd_interface_stats_entry *entry, uint8_t command_id)
+{
+	if (entry != NULL) {
+		memset (entry, 0, sizeof (struct cmd_interface_stats_entry));
+		entry->command_id = command_id;
+	}
+}
+
+/**
+ * Determine the histogram bucket for a request processing time.
+ *
+ * @param latency_ms The time spent processing the request, in milliseconds.
+ *
+ * @return The index of the latency bucket.
+ */
+int cmd_interface_stats_get_latency_bucket (uint32_t latency_ms)
+{
+	int bucket = 0;
+
+	while ((latency_ms != 0) && (bucket < (CMD_INTERFACE_STATS_LATENCY_BUCKETS - 1))) {
+		latency_ms >>= 2;
+		bucket++;
+	}
+
+	return bucket;
+}
+
+/**
+ * Update the statistics for a command with the results of a processed request.
+ *
+ * @param entry The statistics for the command that was processed.
+ * @param latency_ms The time spent processing the request, in milliseconds.
+ * @param status The result of processing the request.  Any non-zero value is counted as a failure.
+ */
+void cmd_interface_stats_record (struct cmd_interface_stats_entry *entry, uint32_t latency_ms,
+	int status)
+{
+	if (entry == NULL) {
+		return;
+	}
+
+	entry->requests++;
+	if (status != 0) {
+		entry->failures++;
+	}
+
+	entry->total_ms += latency_ms;
+	if (latency_ms > entry->max_ms) {
+		entry->max_ms = latency_ms;
+	}
+
+	entry->latency[cmd_interface_stats_get_latency_bucket (latency_ms)]++;
+}
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef CMD_INTERFACE_STATS_H_
+#define CMD_INTERFACE_STATS_H_
+
+#include <stdint.h>
+
+
+/**
+ * The number of latency buckets tracked for each command.  Each bucket covers four times the range
+ * of the previous one:  0 ms, 1-3 ms, 4-15 ms, 16-63 ms, 64-255 ms, 256-1023 ms, 1024-4095 ms, and
+ * 4096 ms or more.
+ */
+#define	CMD_INTERFACE_STATS_LATENCY_BUCKETS		8
+
+
+#pragma pack(push, 1)
+/**
+ * Execution statistics for a single command.
+ *
+ * Counters will wrap if they overflow.
+ */
+struct cmd_interface_stats_entry {
+	uint8_t command_id;											/**< The command the statistics apply to. */
+	uint32_t requests;											/**< Number of requests processed for the command. */
+	uint32_t failures;											/**< Number of requests that returned an error. */
+	uint32_t total_ms;											/**< Total time spent processing the command. */
+	uint32_t max_ms;											/**< Longest time spent processing a single request. */
+	uint32_t latency[CMD_INTERFACE_STATS_LATENCY_BUCKETS];		/**< Histogram of request processing times. */
+};
+#pragma pack(pop)
+
+
+void cmd_interface_stats_init (struct cmd_interface_stats_entry *entry, uint8_t command_id);
+void cmd_interface_stats_record (struct cmd_interface_stats_entry *entry, uint32_t latency_ms,
+	int status);
+
+int cmd_interface_stats_get_latency_bucket (uint32_t latency_ms);
+
+
+#endif /* CMD_INTERFACE_STATS_H_ */
@@ -6,6 +6,7 @@
 #include <stdbool.h>
 #include <string.h>
 #include <math.h>
+#include "platform_api.h"
 #include "cmd_logging.h"
 #include "cmd_interface.h"
 #include "cerberus_protocol.h"
@@ -15,264 +16,507 @@
 #include "cerberus_protocol_debug_commands.h"
 #include "cerberus_protocol_diagnostic_commands.h"
 #include "cmd_interface_system.h"
+#include "common/array_size.h"
 #include "common/unused.h"
+#include "logging/trace_ring.h"
 
 
-int cmd_interface_system_process_request (struct cmd_interface *intf,
+/**
+ * Handler for a request supported by the system command interface.
+ */
+struct cmd_interface_system_command {
+	uint8_t command_id;				/**< The command processed by the handler. */
+	bool raw_response;				/**< Flag to indicate the handler generates the complete response. */
+
+	/**
+	 * Process a received request.
+	 *
+	 * @param interface The system command interface processing the request.
+	 * @param request The request to process.  This will be updated with the response data.
+	 *
+	 * @return 0 if the request was successfully processed or an error code.
+	 */
+	int (*process) (struct cmd_interface_system *interface, struct cmd_interface_msg *request);
+};
+
+static int cmd_interface_system_get_fw_version (struct cmd_interface_system *interface,
 	struct cmd_interface_msg *request)
 {
-	struct cmd_interface_system *interface = (struct cmd_interface_system*) intf;
-	uint8_t command_id;
-	uint8_t command_set;
-	int status;
+	return cerberus_protocol_get_fw_version (interface->fw_version, request);
+}
 
-	status = cmd_interface_process_cerberus_protocol_message (&interface->base, request,
-		&command_id, &command_set, true, true);
-	if (status != 0) {
-		return status;
-	}
+static int cmd_interface_system_get_device_capabilities (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_device_capabilities (interface->device_manager, request);
+}
 
-	switch (command_id) {
-		case CERBERUS_PROTOCOL_GET_FW_VERSION:
-			status = cerberus_protocol_get_fw_version (interface->fw_version, request);
-			break;
+static int cmd_interface_system_get_device_id (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_device_id (&interface->device_id, request);
+}
 
-		case CERBERUS_PROTOCOL_GET_DIGEST:
-			status = cerberus_protocol_get_certificate_digest (interface->attestation,
-				interface->base.session, request);
-			break;
+static int cmd_interface_system_get_device_info (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_device_info (interface->cmd_device, request);
+}
 
-		case CERBERUS_PROTOCOL_GET_CERTIFICATE:
-			status = cerberus_protocol_get_certificate (interface->attestation, request);
-			break;
+static int cmd_interface_system_export_csr (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_export_csr (interface->riot, request);
+}
 
-		case CERBERUS_PROTOCOL_ATTESTATION_CHALLENGE:
-			status = cerberus_protocol_get_challenge_response (interface->attestation,
-				interface->base.session, request);
-			break;
+static int cmd_interface_system_import_ca_signed_cert (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_import_ca_signed_cert (interface->riot, interface->background,
+		request);
+}
 
-		case CERBERUS_PROTOCOL_GET_LOG_INFO:
-			status = cerberus_protocol_get_log_info (interface->pcr_store, request);
-			break;
+static int cmd_interface_system_get_signed_cert_state (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_signed_cert_state (interface->background, request);
+}
 
-		case CERBERUS_PROTOCOL_READ_LOG:
-			status = cerberus_protocol_log_read (interface->pcr_store, interface->hash, request);
-			break;
+static int cmd_interface_system_get_host_state (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_host_reset_status (interface->host_0_ctrl,
+		interface->host_1_ctrl, request);
+}
 
-		case CERBERUS_PROTOCOL_CLEAR_LOG:
-			status = cerberus_protocol_log_clear (interface->background, request);
-			break;
+static int cmd_interface_system_get_log_info (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_log_info (interface->pcr_store, request);
+}
 
-		case CERBERUS_PROTOCOL_GET_PFM_ID:{
-			const struct pfm_manager* pfm_mgr[2] = {
-				interface->pfm_manager_0, interface->pfm_manager_1
-			};
+static int cmd_interface_system_read_log (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_log_read (interface->pcr_store, interface->hash, request);
+}
 
-			status = cerberus_protocol_get_pfm_id (pfm_mgr, 2, request);
-			break;
-		}
+static int cmd_interface_system_clear_log (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_log_clear (interface->background, request);
+}
 
-		case CERBERUS_PROTOCOL_GET_PFM_SUPPORTED_FW: {
-			const struct pfm_manager* pfm_mgr[2] = {
-				interface->pfm_manager_0, interface->pfm_manager_1
-			};
+static int cmd_interface_system_get_attestation_data (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_attestation_data (interface->pcr_store, request);
+}
 
-			status = cerberus_protocol_get_pfm_fw (pfm_mgr, 2, request);
-			break;
-		}
+static int cmd_interface_system_get_pfm_id (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	const struct pfm_manager* pfm_mgr[2] = {interface->pfm_manager_0, interface->pfm_manager_1};
 
-		case CERBERUS_PROTOCOL_INIT_PFM_UPDATE: {
-			const struct manifest_cmd_interface* pfm_cmd[2] = {interface->pfm_0, interface->pfm_1};
+	return cerberus_protocol_get_pfm_id (pfm_mgr, 2, request);
+}
 
-			status = cerberus_protocol_pfm_update_init (pfm_cmd, 2, request);
-			break;
-		}
+static int cmd_interface_system_get_pfm_supported_fw (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	const struct pfm_manager* pfm_mgr[2] = {interface->pfm_manager_0, interface->pfm_manager_1};
 
-		case CERBERUS_PROTOCOL_PFM_UPDATE: {
-			const struct manifest_cmd_interface* pfm_cmd[2] = {interface->pfm_0, interface->pfm_1};
+	return cerberus_protocol_get_pfm_fw (pfm_mgr, 2, request);
+}
 
-			status = cerberus_protocol_pfm_update (pfm_cmd, 2, request);
-			break;
-		}
+static int cmd_interface_system_init_pfm_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	const struct manifest_cmd_interface* pfm_cmd[2] = {interface->pfm_0, interface->pfm_1};
 
-		case CERBERUS_PROTOCOL_COMPLETE_PFM_UPDATE: {
-			const struct manifest_cmd_interface* pfm_cmd[2] = {interface->pfm_0, interface->pfm_1};
+	return cerberus_protocol_pfm_update_init (pfm_cmd, 2, request);
+}
 
-			status = cerberus_protocol_pfm_update_complete (pfm_cmd, 2,	request);
-			break;
-		}
+static int cmd_interface_system_pfm_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	const struct manifest_cmd_interface* pfm_cmd[2] = {interface->pfm_0, interface->pfm_1};
 
-		case CERBERUS_PROTOCOL_GET_CFM_ID:
-			status = cerberus_protocol_get_cfm_id (interface->cfm_manager, request);
-			break;
+	return cerberus_protocol_pfm_update (pfm_cmd, 2, request);
+}
 
-		case CERBERUS_PROTOCOL_INIT_CFM_UPDATE:
-			status = cerberus_protocol_cfm_update_init (interface->cfm, request);
-			break;
+static int cmd_interface_system_complete_pfm_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	const struct manifest_cmd_interface* pfm_cmd[2] = {interface->pfm_0, interface->pfm_1};
 
-		case CERBERUS_PROTOCOL_CFM_UPDATE:
-			status = cerberus_protocol_cfm_update (interface->cfm, request);
-			break;
+	return cerberus_protocol_pfm_update_complete (pfm_cmd, 2, request);
+}
 
-		case CERBERUS_PROTOCOL_COMPLETE_CFM_UPDATE:
-			status = cerberus_protocol_cfm_update_complete (interface->cfm, request);
-			break;
+static int cmd_interface_system_get_cfm_id (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_cfm_id (interface->cfm_manager, request);
+}
 
-		case CERBERUS_PROTOCOL_GET_PCD_ID:
-			status = cerberus_protocol_get_pcd_id (interface->pcd_manager, request);
-			break;
+static int cmd_interface_system_init_cfm_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_cfm_update_init (interface->cfm, request);
+}
+
+static int cmd_interface_system_cfm_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_cfm_update (interface->cfm, request);
+}
 
-		case CERBERUS_PROTOCOL_INIT_PCD_UPDATE:
-			status = cerberus_protocol_pcd_update_init (interface->pcd, request);
-			break;
+static int cmd_interface_system_complete_cfm_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_cfm_update_complete (interface->cfm, request);
+}
+
+static int cmd_interface_system_get_pcd_id (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_pcd_id (interface->pcd_manager, request);
+}
 
-		case CERBERUS_PROTOCOL_PCD_UPDATE:
-			status = cerberus_protocol_pcd_update (interface->pcd, request);
-			break;
+static int cmd_interface_system_init_pcd_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_pcd_update_init (interface->pcd, request);
+}
 
-		case CERBERUS_PROTOCOL_COMPLETE_PCD_UPDATE:
-			status = cerberus_protocol_pcd_update_complete (interface->pcd, request);
-			break;
+static int cmd_interface_system_pcd_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_pcd_update (interface->pcd, request);
+}
 
-		case CERBERUS_PROTOCOL_GET_CFM_SUPPORTED_COMPONENT_IDS:
-			status = cerberus_protocol_get_cfm_component_ids (interface->cfm_manager, request);
-			break;
+static int cmd_interface_system_complete_pcd_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_pcd_update_complete (interface->pcd, request);
+}
 
-		case CERBERUS_PROTOCOL_INIT_FW_UPDATE:
-			status = cerberus_protocol_fw_update_init (interface->control, request);
-			break;
+static int cmd_interface_system_init_fw_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_fw_update_init (interface->control, request);
+}
 
-		case CERBERUS_PROTOCOL_FW_UPDATE:
-			status = cerberus_protocol_fw_update (interface->control, request);
-			break;
+static int cmd_interface_system_fw_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_fw_update (interface->control, request);
+}
 
-		case CERBERUS_PROTOCOL_COMPLETE_FW_UPDATE:
-			status = cerberus_protocol_fw_update_start (interface->control, request);
-			break;
+static int cmd_interface_system_get_update_status (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	const struct manifest_cmd_interface* pfm_cmd[2] = {interface->pfm_0, interface->pfm_1};
+	struct host_processor* host[2] = {interface->host_0, interface->host_1};
 
-		case CERBERUS_PROTOCOL_GET_UPDATE_STATUS: {
-			const struct manifest_cmd_interface* pfm_cmd[2] = {interface->pfm_0, interface->pfm_1};
-			struct host_processor* host[2] = {interface->host_0, interface->host_1};
+	return cerberus_protocol_get_update_status (interface->control, 2, pfm_cmd, interface->cfm,
+		interface->pcd, host, interface->recovery_cmd_0, interface->recovery_cmd_1,
+		interface->background, request);
+}
 
-			status = cerberus_protocol_get_update_status (interface->control, 2, pfm_cmd,
-				interface->cfm, interface->pcd, host, interface->recovery_cmd_0,
-				interface->recovery_cmd_1, interface->background, request);
-			break;
-		}
+static int cmd_interface_system_complete_fw_update (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_fw_update_start (interface->control, request);
+}
 
-		case CERBERUS_PROTOCOL_GET_EXT_UPDATE_STATUS:
-			status = cerberus_protocol_get_extended_update_status (interface->control,
-				interface->recovery_manager_0, interface->recovery_manager_1,
-				interface->recovery_cmd_0, interface->recovery_cmd_1, request);
-			break;
+static int cmd_interface_system_reset_config (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_reset_config (interface->auth, interface->background, request);
+}
 
-		case CERBERUS_PROTOCOL_GET_DEVICE_CAPABILITIES:
-			status = cerberus_protocol_get_device_capabilities (interface->device_manager,
-				request);
-			break;
-
-		case CERBERUS_PROTOCOL_RESET_COUNTER:
-			status = cerberus_protocol_reset_counter (interface->cmd_device, request);
-			break;
-
-		case CERBERUS_PROTOCOL_UNSEAL_MESSAGE:
-			status = cerberus_protocol_unseal_message (interface->background, request);
-			break;
-
-		case CERBERUS_PROTOCOL_UNSEAL_MESSAGE_RESULT:
-			status = cerberus_protocol_unseal_message_result (interface->background, request);
-			break;
-
-		case CERBERUS_PROTOCOL_EXPORT_CSR:
-			status = cerberus_protocol_export_csr (interface->riot, request);
-			break;
-
-		case CERBERUS_PROTOCOL_IMPORT_CA_SIGNED_CERT:
-			status = cerberus_protocol_import_ca_signed_cert (interface->riot,
-				interface->background, request);
-			break;
-
-		case CERBERUS_PROTOCOL_GET_SIGNED_CERT_STATE:
-			status = cerberus_protocol_get_signed_cert_state (interface->background, request);
-			break;
-
-		case CERBERUS_PROTOCOL_RESET_CONFIG:
-			status = cerberus_protocol_reset_config (interface->auth, interface->background,
-				request);
-			break;
-
-		case CERBERUS_PROTOCOL_PREPARE_RECOVERY_IMAGE:
-			status = cerberus_protocol_prepare_recovery_image (interface->recovery_cmd_0,
-				interface->recovery_cmd_1, request);
-			break;
-
-		case CERBERUS_PROTOCOL_UPDATE_RECOVERY_IMAGE:
-			status = cerberus_protocol_update_recovery_image (interface->recovery_cmd_0,
-				interface->recovery_cmd_1, request);
-			break;
-
-		case CERBERUS_PROTOCOL_ACTIVATE_RECOVERY_IMAGE:
-			status = cerberus_protocol_activate_recovery_image (interface->recovery_cmd_0,
-				interface->recovery_cmd_1, request);
-			break;
-
-		case CERBERUS_PROTOCOL_GET_RECOVERY_IMAGE_VERSION:
-			status = cerberus_protocol_get_recovery_image_id (interface->recovery_manager_0,
-				interface->recovery_manager_1, request);
-			break;
-
-		case CERBERUS_PROTOCOL_GET_HOST_STATE:
-			status = cerberus_protocol_get_host_reset_status (interface->host_0_ctrl,
-				interface->host_1_ctrl, request);
-			break;
-
-		case CERBERUS_PROTOCOL_GET_DEVICE_INFO:
-			status = cerberus_protocol_get_device_info (interface->cmd_device, request);
-			break;
-
-		case CERBERUS_PROTOCOL_GET_DEVICE_ID:
-			status = cerberus_protocol_get_device_id (&interface->device_id, request);
-			break;
-
-		case CERBERUS_PROTOCOL_GET_ATTESTATION_DATA:
-			status = cerberus_protocol_get_attestation_data (interface->pcr_store, request);
-			break;
+static int cmd_interface_system_prepare_recovery_image (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_prepare_recovery_image (interface->recovery_cmd_0,
+		interface->recovery_cmd_1, request);
+}
+
+static int cmd_interface_system_update_recovery_image (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_update_recovery_image (interface->recovery_cmd_0,
+		interface->recovery_cmd_1, request);
+}
+
+static int cmd_interface_system_activate_recovery_image (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_activate_recovery_image (interface->recovery_cmd_0,
+		interface->recovery_cmd_1, request);
+}
+
+static int cmd_interface_system_get_recovery_image_version (
+	struct cmd_interface_system *interface, struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_recovery_image_id (interface->recovery_manager_0,
+		interface->recovery_manager_1, request);
+}
+
+static int cmd_interface_system_get_digest (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_certificate_digest (interface->attestation,
+		interface->base.session, request);
+}
+
+static int cmd_interface_system_get_certificate (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_certificate (interface->attestation, request);
+}
+
+static int cmd_interface_system_attestation_challenge (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_challenge_response (interface->attestation,
+		interface->base.session, request);
+}
+
+#ifdef CMD_SUPPORT_ENCRYPTED_SESSIONS
+static int cmd_interface_system_exchange_keys (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_key_exchange (interface->base.session, request,
+		interface->base.curr_txn_encrypted);
+}
+
+static int cmd_interface_system_session_sync (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_session_sync (interface->base.session, request,
+		interface->base.curr_txn_encrypted);
+}
+#endif
+
+static int cmd_interface_system_reset_counter (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_reset_counter (interface->cmd_device, request);
+}
+
+static int cmd_interface_system_unseal_message (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_unseal_message (interface->background, request);
+}
+
+static int cmd_interface_system_unseal_message_result (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_unseal_message_result (interface->background, request);
+}
+
+static int cmd_interface_system_get_cfm_component_ids (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_cfm_component_ids (interface->cfm_manager, request);
+}
+
+static int cmd_interface_system_get_ext_update_status (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_extended_update_status (interface->control,
+		interface->recovery_manager_0, interface->recovery_manager_1, interface->recovery_cmd_0,
+		interface->recovery_cmd_1, request);
+}
 
 #ifdef CMD_ENABLE_HEAP_STATS
-		case CERBERUS_PROTOCOL_DIAG_HEAP_USAGE:
-			return cerberus_protocol_heap_stats (interface->cmd_device, request);
+static int cmd_interface_system_heap_stats (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_heap_stats (interface->cmd_device, request);
+}
 #endif
 
-#ifdef CMD_SUPPORT_ENCRYPTED_SESSIONS
-		case CERBERUS_PROTOCOL_EXCHANGE_KEYS:
-			status = cerberus_protocol_key_exchange (interface->base.session, request,
-				intf->curr_txn_encrypted);
-			break;
-
-		case CERBERUS_PROTOCOL_SESSION_SYNC:
-			status = cerberus_protocol_session_sync (interface->base.session, request,
-				intf->curr_txn_encrypted);
-			break;
+#ifdef CMD_ENABLE_COMMAND_STATS
+static int cmd_interface_system_command_stats (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_command_stats (interface->cmd_stats, interface->num_cmd_stats,
+		request);
+}
 #endif
 
 #ifdef CMD_SUPPORT_DEBUG_COMMANDS
-		case CERBERUS_PROTOCOL_DEBUG_GET_ATTESTATION_STATE:
-			status = cerberus_protocol_get_attestation_state (interface->device_manager, request);
-			break;
+static int cmd_interface_system_debug_get_attestation_state (
+	struct cmd_interface_system *interface, struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_get_attestation_state (interface->device_manager, request);
+}
 
-		case CERBERUS_PROTOCOL_DEBUG_FILL_LOG:
-			status = cerberus_protocol_debug_fill_log (interface->background, request);
-			break;
+static int cmd_interface_system_debug_fill_log (struct cmd_interface_system *interface,
+	struct cmd_interface_msg *request)
+{
+	return cerberus_protocol_debug_fill_log (interface->background, request);
+}
 #endif
 
-		default:
-			return CMD_HANDLER_UNKNOWN_REQUEST;
+/**
+ * The list of requests supported by the system command interface.  The list must be sorted by
+ * command ID.
+ */
+static const struct cmd_interface_system_command cmd_interface_system_commands[] = {
+	{CERBERUS_PROTOCOL_GET_FW_VERSION, false, cmd_interface_system_get_fw_version},
+	{
+		CERBERUS_PROTOCOL_GET_DEVICE_CAPABILITIES, false,
+		cmd_interface_system_get_device_capabilities
+	},
+	{CERBERUS_PROTOCOL_GET_DEVICE_ID, false, cmd_interface_system_get_device_id},
+	{CERBERUS_PROTOCOL_GET_DEVICE_INFO, false, cmd_interface_system_get_device_info},
+	{CERBERUS_PROTOCOL_EXPORT_CSR, false, cmd_interface_system_export_csr},
+	{CERBERUS_PROTOCOL_IMPORT_CA_SIGNED_CERT, false, cmd_interface_system_import_ca_signed_cert},
+	{CERBERUS_PROTOCOL_GET_SIGNED_CERT_STATE, false, cmd_interface_system_get_signed_cert_state},
+	{CERBERUS_PROTOCOL_GET_HOST_STATE, false, cmd_interface_system_get_host_state},
+	{CERBERUS_PROTOCOL_GET_LOG_INFO, false, cmd_interface_system_get_log_info},
+	{CERBERUS_PROTOCOL_READ_LOG, false, cmd_interface_system_read_log},
+	{CERBERUS_PROTOCOL_CLEAR_LOG, false, cmd_interface_system_clear_log},
+	{CERBERUS_PROTOCOL_GET_ATTESTATION_DATA, false, cmd_interface_system_get_attestation_data},
+	{CERBERUS_PROTOCOL_GET_PFM_ID, false, cmd_interface_system_get_pfm_id},
+	{CERBERUS_PROTOCOL_GET_PFM_SUPPORTED_FW, false, cmd_interface_system_get_pfm_supported_fw},
+	{CERBERUS_PROTOCOL_INIT_PFM_UPDATE, false, cmd_interface_system_init_pfm_update},
+	{CERBERUS_PROTOCOL_PFM_UPDATE, false, cmd_interface_system_pfm_update},
+	{CERBERUS_PROTOCOL_COMPLETE_PFM_UPDATE, false, cmd_interface_system_complete_pfm_update},
+	{CERBERUS_PROTOCOL_GET_CFM_ID, false, cmd_interface_system_get_cfm_id},
+	{CERBERUS_PROTOCOL_INIT_CFM_UPDATE, false, cmd_interface_system_init_cfm_update},
+	{CERBERUS_PROTOCOL_CFM_UPDATE, false, cmd_interface_system_cfm_update},
+	{CERBERUS_PROTOCOL_COMPLETE_CFM_UPDATE, false, cmd_interface_system_complete_cfm_update},
+	{CERBERUS_PROTOCOL_GET_PCD_ID, false, cmd_interface_system_get_pcd_id},
+	{CERBERUS_PROTOCOL_INIT_PCD_UPDATE, false, cmd_interface_system_init_pcd_update},
+	{CERBERUS_PROTOCOL_PCD_UPDATE, false, cmd_interface_system_pcd_update},
+	{CERBERUS_PROTOCOL_COMPLETE_PCD_UPDATE, false, cmd_interface_system_complete_pcd_update},
+	{CERBERUS_PROTOCOL_INIT_FW_UPDATE, false, cmd_interface_system_init_fw_update},
+	{CERBERUS_PROTOCOL_FW_UPDATE, false, cmd_interface_system_fw_update},
+	{CERBERUS_PROTOCOL_GET_UPDATE_STATUS, false, cmd_interface_system_get_update_status},
+	{CERBERUS_PROTOCOL_COMPLETE_FW_UPDATE, false, cmd_interface_system_complete_fw_update},
+	{CERBERUS_PROTOCOL_RESET_CONFIG, false, cmd_interface_system_reset_config},
+	{CERBERUS_PROTOCOL_PREPARE_RECOVERY_IMAGE, false, cmd_interface_system_prepare_recovery_image},
+	{CERBERUS_PROTOCOL_UPDATE_RECOVERY_IMAGE, false, cmd_interface_system_update_recovery_image},
+	{
+		CERBERUS_PROTOCOL_ACTIVATE_RECOVERY_IMAGE, false,
+		cmd_interface_system_activate_recovery_image
+	},
+	{
+		CERBERUS_PROTOCOL_GET_RECOVERY_IMAGE_VERSION, false,
+		cmd_interface_system_get_recovery_image_version
+	},
+	{CERBERUS_PROTOCOL_GET_DIGEST, false, cmd_interface_system_get_digest},
+	{CERBERUS_PROTOCOL_GET_CERTIFICATE, false, cmd_interface_system_get_certificate},
+	{CERBERUS_PROTOCOL_ATTESTATION_CHALLENGE, false, cmd_interface_system_attestation_challenge},
+#ifdef CMD_SUPPORT_ENCRYPTED_SESSIONS
+	{CERBERUS_PROTOCOL_EXCHANGE_KEYS, false, cmd_interface_system_exchange_keys},
+	{CERBERUS_PROTOCOL_SESSION_SYNC, false, cmd_interface_system_session_sync},
+#endif
+	{CERBERUS_PROTOCOL_RESET_COUNTER, false, cmd_interface_system_reset_counter},
+	{CERBERUS_PROTOCOL_UNSEAL_MESSAGE, false, cmd_interface_system_unseal_message},
+	{CERBERUS_PROTOCOL_UNSEAL_MESSAGE_RESULT, false, cmd_interface_system_unseal_message_result},
+	{
+		CERBERUS_PROTOCOL_GET_CFM_SUPPORTED_COMPONENT_IDS, false,
+		cmd_interface_system_get_cfm_component_ids
+	},
+	{CERBERUS_PROTOCOL_GET_EXT_UPDATE_STATUS, false, cmd_interface_system_get_ext_update_status},
+#ifdef CMD_ENABLE_HEAP_STATS
+	{CERBERUS_PROTOCOL_DIAG_HEAP_USAGE, true, cmd_interface_system_heap_stats},
+#endif
+#ifdef CMD_ENABLE_COMMAND_STATS
+	{CERBERUS_PROTOCOL_DIAG_COMMAND_STATS, false, cmd_interface_system_command_stats},
+#endif
+#ifdef CMD_SUPPORT_DEBUG_COMMANDS
+	{
+		CERBERUS_PROTOCOL_DEBUG_GET_ATTESTATION_STATE, false,
+		cmd_interface_system_debug_get_attestation_state
+	},
+	{CERBERUS_PROTOCOL_DEBUG_FILL_LOG, false, cmd_interface_system_debug_fill_log},
+#endif
+};
+
+/**
+ * Find the handler for a request.
+ *
+ * @param command_id The command being requested.
+ *
+ * @return Index of the command handler or an error code if the command is not supported.
+ */
+static int cmd_interface_system_find_command (uint8_t command_id)
+{
+	int low = 0;
+	int high = ARRAY_SIZE (cmd_interface_system_commands) - 1;
+	int mid;
+
+	while (low <= high) {
+		mid = (low + high) / 2;
+		if (cmd_interface_system_commands[mid].command_id == command_id) {
+			return mid;
+		}
+		else if (cmd_interface_system_commands[mid].command_id < command_id) {
+			low = mid + 1;
+		}
+		else {
+			high = mid - 1;
+		}
+	}
+
+	return CMD_HANDLER_UNKNOWN_REQUEST;
+}
+
+int cmd_interface_system_process_request (struct cmd_interface *intf,
+	struct cmd_interface_msg *request)
+{
+	struct cmd_interface_system *interface = (struct cmd_interface_system*) intf;
+	const struct cmd_interface_system_command *command;
+	uint8_t command_id;
+	uint8_t command_set;
+	int index;
+	int status;
+#ifdef CMD_ENABLE_COMMAND_STATS
+	platform_clock start;
+	platform_clock end;
+#endif
+
+	status = cmd_interface_process_cerberus_protocol_message (&interface->base, request,
+		&command_id, &command_set, true, true);
+	if (status != 0) {
+		return status;
 	}
 
-	if (status == 0) {
+	index = cmd_interface_system_find_command (command_id);
+	if (ROT_IS_ERROR (index)) {
+		return index;
+	}
+
+	command = &cmd_interface_system_commands[index];
+
+#ifdef CMD_ENABLE_COMMAND_STATS
+	platform_init_current_tick (&start);
+#endif
+	TRACE_RING_BEGIN (TRACE_RING_POINT_CMD_PROCESS_REQUEST, command_id);
+
+	status = command->process (interface, request);
+	if ((status == 0) && !command->raw_response) {
 		status = cmd_interface_prepare_response (&interface->base, request);
 	}
 
+	TRACE_RING_END (TRACE_RING_POINT_CMD_PROCESS_REQUEST, status);
+
+#ifdef CMD_ENABLE_COMMAND_STATS
+	if ((size_t) index < interface->num_cmd_stats) {
+		platform_init_current_tick (&end);
+		cmd_interface_stats_record (&interface->cmd_stats[index],
+			platform_get_duration (&start, &end), status);
+	}
+#endif
+
 	return status;
 }
 
@@ -402,6 +646,9 @@ int cmd_interface_system_init (struct cmd_interface_system *intf,
 	uint16_t vendor_id, uint16_t device_id, uint16_t subsystem_vid, uint16_t subsystem_id,
 	struct session_manager *session)
 {
+#ifdef CMD_ENABLE_COMMAND_STATS
+	size_t i;
+#endif
 	int status;
 
 	if ((intf == NULL) || (control == NULL) || (store == NULL) || (background == NULL) ||
@@ -449,6 +696,17 @@ int cmd_interface_system_init (struct cmd_interface_system *intf,
 	intf->device_id.subsystem_vid = subsystem_vid;
 	intf->device_id.subsystem_id = subsystem_id;
 
+#ifdef CMD_ENABLE_COMMAND_STATS
+	intf->num_cmd_stats = ARRAY_SIZE (cmd_interface_system_commands);
+	if (intf->num_cmd_stats > CMD_INTERFACE_SYSTEM_MAX_COMMAND_STATS) {
+		intf->num_cmd_stats = CMD_INTERFACE_SYSTEM_MAX_COMMAND_STATS;
+	}
+
+	for (i = 0; i < intf->num_cmd_stats; i++) {
+		cmd_interface_stats_init (&intf->cmd_stats[i], cmd_interface_system_commands[i].command_id);
+	}
+#endif
+
 	intf->base.process_request = cmd_interface_system_process_request;
 #ifdef CMD_ENABLE_ISSUE_REQUEST
 	intf->base.process_response = cmd_interface_system_process_response;
@@ -24,10 +24,21 @@
 #include "recovery/recovery_image_manager.h"
 #include "recovery/recovery_image_cmd_interface.h"
 #include "cmd_device.h"
+#include "cmd_interface_stats.h"
 #include "common/observable.h"
 #include "cerberus_protocol_observer.h"
 
 
+/**
+ * The maximum number of commands that will have execution statistics tracked when command
+ * statistics are enabled.  Commands beyond this limit will still be processed, but no statistics
+ * will be kept for them.
+ */
+#ifndef CMD_INTERFACE_SYSTEM_MAX_COMMAND_STATS
+#define	CMD_INTERFACE_SYSTEM_MAX_COMMAND_STATS		48
+#endif
+
+
 /**
  * Command interface for processing received requests from system.
  */
@@ -61,6 +72,10 @@ struct cmd_interface_system {
 	const struct cmd_device *cmd_device;						/**< Device command handler instance */
 	struct cmd_interface_device_id device_id;					/**< Device ID information */
 	struct observable observable;								/**< Observer manager for the interface. */
+#ifdef CMD_ENABLE_COMMAND_STATS
+	struct cmd_interface_stats_entry cmd_stats[CMD_INTERFACE_SYSTEM_MAX_COMMAND_STATS];	/**< Execution statistics for supported commands. */
+	size_t num_cmd_stats;										/**< Number of commands with execution statistics. */
+#endif
 };
 
 
@@ -16,7 +16,7 @@
 
 
 /**
- * Search session manager's active sessions table and find entry for requested EID if it exists.
+ * Find the active session entry for requested EID if it exists.
  *
  * @param session Session manager instance to utilize.
  * @param eid Requested EID for device in session.
@@ -26,31 +26,37 @@
 struct session_manager_entry* session_manager_get_session (struct session_manager *session,
 	uint8_t eid)
 {
-	size_t i_session;
+	struct session_manager_entry *entry;
+	uint8_t slot = session->session_index[eid];
 
-	for (i_session = 0; i_session < session->num_sessions; ++i_session) {
-		if ((session->sessions_table[i_session].eid == eid) &&
-			(session->sessions_table[i_session].session_state != SESSION_STATE_UNUSED)) {
-			return &session->sessions_table[i_session];
-		}
+	if (slot == 0) {
+		return NULL;
 	}
 
-	return NULL;
+	entry = &session->sessions_table[slot - 1];
+	if ((entry->eid != eid) || (entry->session_state == SESSION_STATE_UNUSED)) {
+		return NULL;
+	}
+
+	return entry;
 }
 
 /**
- * Search session manager's sessions table and find first unused entry.
+ * Search session manager's sessions table and claim the first unused entry for a device.
  *
  * @param session Session manager instance to utilize.
+ * @param eid EID of the device that will use the session.
  *
  * @return Free session container if exists, NULL otherwise.
  */
-struct session_manager_entry* session_manager_get_free_session (struct session_manager *session)
+struct session_manager_entry* session_manager_get_free_session (struct session_manager *session,
+	uint8_t eid)
 {
 	size_t i_session;
 
 	for (i_session = 0; i_session < session->num_sessions; ++i_session) {
 		if (session->sessions_table[i_session].session_state == SESSION_STATE_UNUSED) {
+			session->session_index[eid] = i_session + 1;
 			return &session->sessions_table[i_session];
 		}
 	}
@@ -63,11 +69,11 @@ struct session_manager_entry* session_manager_get_free_session (struct session_m
  * exists.
  *
  * @param session Session manager instance to utilize.
- * @param eid Requested EID for device in session.
+ * @param eid Requested EID for device.
  *
  * @return Requested keystore index if exists, or an error code.
  */
-static int session_manager_get_paired_key_index (struct session_manager *session, uint8_t eid)
+static int session_manager_find_paired_key_index (struct session_manager *session, uint8_t eid)
 {
 	size_t i_key;
 
@@ -81,7 +87,29 @@ static int session_manager_get_paired_key_index (struct session_manager *session
 }
 
 /**
- * Find AES session key for requested EID then set it in the AES engine
+ * Get the keystore index for the pairing key of the requested EID.  If there is a session with the
+ * device, the index determined when the session was created is used.
+ *
+ * @param session Session manager instance to utilize.
+ * @param eid Requested EID for device in session.
+ *
+ * @return Requested keystore index if exists, or an error code.
+ */
+static int session_manager_get_paired_key_index (struct session_manager *session, uint8_t eid)
+{
+	struct session_manager_entry *req_session;
+
+	req_session = session_manager_get_session (session, eid);
+	if (req_session != NULL) {
+		return req_session->pairing_key_id;
+	}
+
+	return session_manager_find_paired_key_index (session, eid);
+}
+
+/**
+ * Find AES session key for requested EID then set it in the AES engine, if it is not already the
+ * active key.
  *
  * @param session Session manager instance to utilize.
  * @param eid Device EID.
@@ -103,8 +131,22 @@ static int session_manager_set_key (struct session_manager *session, uint8_t eid
 		return SESSION_MANAGER_SESSION_NOT_ESTABLISHED;
 	}
 
-	status = session->aes->set_key (session->aes, curr_session->session_key,
-		sizeof (curr_session->session_key));
+	/* Expanding the AES key is only necessary when switching between sessions or after the session
+	 * key has changed.  The AES engine keeps the key state from the last session that used it. */
+	if (session->aes_key_session != curr_session) {
+		session->aes_key_session = NULL;
+
+		status = session->aes->set_key (session->aes, curr_session->session_key,
+			sizeof (curr_session->session_key));
+		if (status != 0) {
+			return status;
+		}
+
+		session->aes_key_session = curr_session;
+	}
+	else {
+		status = 0;
+	}
 
 	if (entry) {
 		*entry = curr_session;
@@ -315,18 +357,23 @@ int session_manager_add_session (struct session_manager *session, uint8_t eid,
 
 	curr_session = session_manager_get_session (session, eid);
 	if (curr_session == NULL) {
-		curr_session = session_manager_get_free_session (session);
+		curr_session = session_manager_get_free_session (session, eid);
 		if (curr_session == NULL) {
 			return SESSION_MANAGER_FULL;
 		}
 	}
 
+	if (session->aes_key_session == curr_session) {
+		session->aes_key_session = NULL;
+	}
+
 	memcpy (curr_session->device_nonce, device_nonce, SESSION_MANAGER_NONCE_LEN);
 	memcpy (curr_session->cerberus_nonce, cerberus_nonce, SESSION_MANAGER_NONCE_LEN);
 	memset (curr_session->aes_init_vector, 0, CERBERUS_PROTOCOL_AES_IV_LEN);
 	curr_session->session_state = SESSION_STATE_SETUP;
 	curr_session->eid = eid;
 	curr_session->aes_init_vector[CERBERUS_PROTOCOL_AES_IV_LEN - 1] = 0x80;
+	curr_session->pairing_key_id = session_manager_find_paired_key_index (session, eid);
 
 	return 0;
 }
@@ -403,9 +450,14 @@ int session_manager_reset_session (struct session_manager *session, uint8_t eid,
 		}
 	}
 
+	if (session->aes_key_session == req_session) {
+		session->aes_key_session = NULL;
+	}
+
 	memset (req_session, 0, sizeof (struct session_manager_entry));
 
 	req_session->session_state = SESSION_STATE_UNUSED;
+	session->session_index[eid] = 0;
 
 	return 0;
 }
@@ -535,6 +587,10 @@ int session_manager_setup_paired_session (struct session_manager *session, uint8
 
 	memcpy (label, req_session->session_key, sizeof (label));
 
+	if (session->aes_key_session == req_session) {
+		session->aes_key_session = NULL;
+	}
+
 	status = kdf_nist800_108_counter_mode (session->hash, HMAC_SHA256, pairing_key,
 		sizeof (pairing_key), label, sizeof (label), NULL, 0, req_session->session_key,
 		sizeof (req_session->session_key));
@@ -601,12 +657,14 @@ int session_manager_session_sync (struct session_manager *session, uint8_t eid,
  * Initialize session manager instance
  *
  * @param session Session manager instance to initialize.
- * @param aes AES engine to utilize for packet encryption/decryption.
+ * @param aes AES engine to utilize for packet encryption/decryption.  The AES engine must not be
+ * 	shared with other modules.
  * @param hash Hash engine to utilize for AES key generation.
  * @param riot RIoT key manager to utilize to get alias key for AES key generation.
  * @param sessions_table Preallocated table to use to store session manager entries. Set to NULL to
  * 	dynamically allocate from heap.
- * @param num_sessions Number of sessions to support.
+ * @param num_sessions Number of sessions to support.  This cannot be more than
+ * 	SESSION_MANAGER_MAX_SESSIONS.
  * @param pairing_eids List of supported devices for pairing mode. Each element corresponds to a
  * 	device EID, with the element index corresponding to the keystore key ID. The keystore needs to
  * 	be initialized to support storing a key for each device in this array.
@@ -620,7 +678,8 @@ int session_manager_init (struct session_manager *session, struct aes_engine *ae
 	struct session_manager_entry *sessions_table, size_t num_sessions, const uint8_t *pairing_eids,
 	size_t num_pairing_eids, const struct keystore *store)
 {
-	if ((session == NULL) || (aes == NULL) || (hash == NULL) || (riot == NULL)) {
+	if ((session == NULL) || (aes == NULL) || (hash == NULL) || (riot == NULL) ||
+		(num_sessions > SESSION_MANAGER_MAX_SESSIONS)) {
 		return SESSION_MANAGER_INVALID_ARGUMENT;
 	}
 
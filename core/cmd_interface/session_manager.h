@@ -24,6 +24,9 @@
 #define SESSION_MANAGER_TRAILER_LEN						(CERBERUS_PROTOCOL_AES_GCM_TAG_LEN + CERBERUS_PROTOCOL_AES_IV_LEN)
 #define SESSION_MANAGER_PAIRING_KEY_LEN 				32
 
+#define SESSION_MANAGER_MAX_SESSIONS					255
+#define SESSION_MANAGER_EID_INDEX_LEN					256
+
 
 enum {
 	SESSION_STATE_UNUSED = 0,							/**< Session slot not used currently */
@@ -51,6 +54,7 @@ struct session_manager_entry {
 	uint8_t session_state;									/**< Current session state */
 	enum hmac_hash hmac_hash_type;							/**< HMAC hash type to utilize */
 	uint8_t aes_init_vector[CERBERUS_PROTOCOL_AES_IV_LEN];	/**< AES Initialization vector used in encryption */
+	int pairing_key_id;										/**< Keystore ID of the pairing key for the device or an error code */
 };
 
 /**
@@ -166,7 +170,7 @@ struct session_manager {
 	int (*session_sync) (struct session_manager *session, uint8_t eid, uint32_t rn_req,
 		uint8_t *hmac, size_t hmac_len);
 
-	struct aes_engine *aes;								/**< AES engine used to encrypt/decrypt session data */
+	struct aes_engine *aes;								/**< AES engine used to encrypt/decrypt session data.  This must be dedicated to the session manager. */
 	struct hash_engine *hash;							/**< Hashing engine used to generate AES shared key */
 	struct rng_engine *rng;								/**< RNG engine used to generate IV buffers */
 	struct riot_key_manager *riot;						/**< RIoT key manager containing alias key */
@@ -176,6 +180,8 @@ struct session_manager {
 	const uint8_t *pairing_eids;						/**< List of supported devices for pairing mode */
 	bool sessions_table_preallocated;					/**< Flag indicating if session tables were provided by caller */
 	const struct keystore *store;						/**< Keystore used to persist pairing keys */
+	uint8_t session_index[SESSION_MANAGER_EID_INDEX_LEN];	/**< Sessions table slot, offset by 1, for each device EID */
+	const struct session_manager_entry *aes_key_session;	/**< Session whose key is currently loaded in the AES engine */
 };
 
 
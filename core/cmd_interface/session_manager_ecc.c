@@ -214,13 +214,15 @@ free_device_key:
  * Initialize session manager instance
  *
  * @param session Session manager instance to initialize.
- * @param aes AES engine to utilize for packet encryption/decryption.
+ * @param aes AES engine to utilize for packet encryption/decryption.  The AES engine must not be
+ * 	shared with other modules.
  * @param ecc ECC engine to utilize for AES key generation.
  * @param hash Hash engine to utilize for AES key generation.
  * @param riot RIoT key manager to utilize to get alias key for AES key generation.
  * @param sessions_table Preallocated table to use to store session manager entries. Set to NULL to
  * 	dynamically allocate from heap.
- * @param num_sessions Number of sessions to support.
+ * @param num_sessions Number of sessions to support.  This cannot be more than
+ * 	SESSION_MANAGER_MAX_SESSIONS.
  * @param pairing_eids List of supported devices for pairing mode.
  * @param num_pairing_eids Total number of supported devices for pairing mode.
  * @param store Keystore used to persist pairing keys.
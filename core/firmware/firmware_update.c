@@ -153,6 +153,57 @@ void firmware_update_set_image_offset (const struct firmware_update *updater, in
 	}
 }
 
+/**
+ * Configure the firmware updater to only rewrite flash sectors that have changed when writing
+ * images to flash.  Before any sector is erased, the existing contents are compared against the
+ * image being written and identical sectors are left untouched.  This applies to image backups,
+ * updates, and restore operations.  Since the whole region is not erased, any data in the region
+ * after the end of the image is erased once the image has been written, with sectors that are
+ * already blank left untouched.
+ *
+ * This is disabled by default, in which case the entire image region is always erased and
+ * programmed.
+ *
+ * @param updater The firmware updater to configure.
+ * @param enable Flag indicating if differential writes should be used.
+ */
+void firmware_update_set_differential_write (const struct firmware_update *updater, bool enable)
+{
+	if (updater != NULL) {
+		updater->state->differential = enable;
+	}
+}
+
+/**
+ * Configure the firmware updater to accept delta updates.  A delta update describes the new image
+ * as a set of operations against the current active image.  When the data written to staging flash
+ * starts with a delta header, the full image is reconstructed in staging flash as the delta is
+ * received, and the update then proceeds as it would for a full image.
+ *
+ * Each delta is signed.  The signature of the delta header and operations is checked once all the
+ * delta data has been received, and the reconstructed image will not be used for an update unless
+ * the signature is valid.  The reconstructed image is then verified against its own signature,
+ * like any full image.
+ *
+ * When delta updates are enabled, staging flash is not erased until the first write, once it is
+ * known how large the image being staged will be.  The first write of a delta update must contain
+ * the entire delta header, and the delta cannot be longer than the size provided when preparing
+ * staging flash.  Data that does not start with the delta marker is always handled as a full image.
+ *
+ * This is disabled by default.
+ *
+ * @param updater The firmware updater to configure.
+ * @param verification Verification context to use for delta signatures.  This must be configured
+ * with the key used to verify firmware updates.  Set this to null to stop accepting delta updates.
+ */
+void firmware_update_set_delta_support (const struct firmware_update *updater,
+	const struct signature_verification *verification)
+{
+	if (updater != NULL) {
+		updater->state->delta_verification = verification;
+	}
+}
+
 /**
  * Provide the firmware updater with the image ID of the current recovery image.  This ID will be
  * checked during updates to see if the recovery image also needs updating.
@@ -205,6 +256,33 @@ static void firmware_update_status_change (const struct firmware_update_notifica
 	}
 }
 
+/**
+ * Check if staging flash contains all the data that was expected for the update.
+ *
+ * @param updater The updater to check.
+ *
+ * @return true if all data for the update has been written to staging flash.
+ */
+static bool firmware_update_is_staging_complete (const struct firmware_update *updater)
+{
+	const struct firmware_update_delta_state *delta = &updater->state->delta;
+
+	if (delta->pending) {
+		/* Nothing has been written for the update. */
+		return false;
+	}
+
+	if (delta->active) {
+		/* The delta must be authentic, and the reconstructed image must be exactly the length
+		 * declared by the delta. */
+		return delta->verified &&
+			(flash_updater_get_bytes_written (&updater->state->update_mgr) ==
+				delta->image_length);
+	}
+
+	return (flash_updater_get_remaining_bytes (&updater->state->update_mgr) <= 0);
+}
+
 /**
  * Load an image context from flash and check if the image is valid.
  *
@@ -237,7 +315,7 @@ static int firmware_update_load_and_verify_image (const struct firmware_update *
 	firmware_update_status_change (callback, UPDATE_STATUS_VERIFYING_IMAGE);
 
 	if (check_bytes) {
-		if (flash_updater_get_remaining_bytes (&updater->state->update_mgr) > 0) {
+		if (!firmware_update_is_staging_complete (updater)) {
 			firmware_update_status_change (callback, UPDATE_STATUS_INCOMPLETE_IMAGE);
 			return FIRMWARE_UPDATE_INCOMPLETE_IMAGE;
 		}
@@ -393,6 +471,228 @@ static int firmware_update_program_bootable (const struct firmware_update *updat
 	return status;
 }
 
+/**
+ * Determine how much of the last sector of an image is unused by the image.
+ *
+ * @param addr The address of the end of the image.
+ * @param space Space in the region after the end of the image.
+ * @param sector The sector size of the flash.
+ *
+ * @return The number of bytes in the last sector of the image after the end of the image.
+ */
+static size_t firmware_update_get_sector_tail (uint32_t addr, size_t space, uint32_t sector)
+{
+	size_t tail = FLASH_REGION_OFFSET (addr, sector);
+
+	if (tail != 0) {
+		tail = sector - tail;
+		tail = (tail > space) ? space : tail;
+	}
+
+	return tail;
+}
+
+/**
+ * Copy a new image to a bootable region of flash, only erasing and programming sectors whose
+ * contents differ from the new image.
+ *
+ * If any part of the image is different, the sector containing the start of the image is erased
+ * before any other sector is modified and programmed last, with the first page written after the
+ * rest of the sector.  This ensures an incomplete image is never left in a bootable state.
+ *
+ * Any data in the region after the new image, such as from a longer image that was previously in
+ * the region, is erased once the new image has been written.
+ *
+ * @param updater The updater instance.
+ * @param dest The bootable flash device to program.
+ * @param dest_addr The address program the image to.
+ * @param src The flash device with the image to copy to the bootable region.
+ * @param src_addr The starting address of the new image.
+ * @param length The length of the new image.
+ * @param region_len The amount of space in the region, starting at the image address.
+ * @param page The page size of flash being written.
+ *
+ * @return 0 if the new image was copied successfully to the active region or an error code.
+ */
+static int firmware_update_program_bootable_differential (const struct firmware_update *updater,
+	const struct flash *dest, uint32_t dest_addr, const struct flash *src, uint32_t src_addr,
+	size_t length, size_t region_len, uint32_t page)
+{
+	uint32_t sector;
+	size_t first;
+	size_t space;
+	size_t last;
+	size_t tail;
+	bool match;
+	bool stale = false;
+	int status;
+
+	status = flash_verify_copy_ext (dest, dest_addr, src, src_addr, length);
+	if ((status != 0) && (status != FLASH_UTIL_DATA_MISMATCH)) {
+		return status;
+	}
+
+	match = (status == 0);
+
+	status = dest->get_sector_size (dest, &sector);
+	if (status != 0) {
+		return status;
+	}
+
+	/* The part of the last sector after the image can only be cleared by rewriting the sector. */
+	space = (region_len > length) ? (region_len - length) : 0;
+	last = FLASH_REGION_OFFSET (dest_addr + length, sector);
+	tail = firmware_update_get_sector_tail (dest_addr + length, space, sector);
+	if (tail != 0) {
+		status = flash_blank_check (dest, dest_addr + length, tail);
+		if (status == FLASH_UTIL_NOT_BLANK) {
+			stale = true;
+		}
+		else if (status != 0) {
+			return status;
+		}
+	}
+
+	if (!match || stale) {
+		first = sector - FLASH_REGION_OFFSET (dest_addr, sector);
+		first = (length > first) ? first : length;
+
+		status = flash_sector_erase_region_and_verify (dest, dest_addr, first);
+		if (status != 0) {
+			return status;
+		}
+
+		if (length > first) {
+			if (stale) {
+				/* The last sector is not the first sector, so it needs to be erased separately. */
+				status = flash_sector_erase_region_and_verify (dest, dest_addr + length - last,
+					last);
+			}
+			if (status == 0) {
+				status = flash_sector_copy_ext_differential_and_verify (dest, dest_addr + first,
+					src, src_addr + first, length - first, NULL);
+			}
+			if (status != 0) {
+				return status;
+			}
+		}
+
+		status = firmware_update_program_bootable (updater, dest, dest_addr, src, src_addr, first,
+			page);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	return flash_sector_erase_region_differential (dest, dest_addr + length + tail, space - tail,
+		NULL);
+}
+
+/**
+ * Copy an image to a region of flash that will not be booted, only erasing and programming sectors
+ * whose contents differ from the image.  Any data in the region after the image, such as from a
+ * longer image that was previously in the region, is erased.
+ *
+ * @param dest The flash device to copy the image to.
+ * @param dest_addr The address to copy the image to.
+ * @param src The flash device with the image to copy.
+ * @param src_addr The starting address of the image.
+ * @param length The length of the image.
+ * @param region_len The amount of space in the region, starting at the image address.
+ *
+ * @return 0 if the image was copied successfully or an error code.
+ */
+static int firmware_update_copy_image_differential (const struct flash *dest, uint32_t dest_addr,
+	const struct flash *src, uint32_t src_addr, size_t length, size_t region_len)
+{
+	uint32_t sector;
+	size_t space;
+	size_t last;
+	size_t tail;
+	int status;
+
+	status = dest->get_sector_size (dest, &sector);
+	if (status != 0) {
+		return status;
+	}
+
+	/* The part of the last sector after the image can only be cleared by rewriting the sector. */
+	space = (region_len > length) ? (region_len - length) : 0;
+	last = FLASH_REGION_OFFSET (dest_addr + length, sector);
+	last = (length > last) ? last : length;
+	tail = firmware_update_get_sector_tail (dest_addr + length, space, sector);
+	if (tail != 0) {
+		status = flash_blank_check (dest, dest_addr + length, tail);
+		if (status == FLASH_UTIL_NOT_BLANK) {
+			status = flash_sector_erase_region_and_verify (dest, dest_addr + length - last, last);
+		}
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	status = flash_sector_copy_ext_differential_and_verify (dest, dest_addr, src, src_addr, length,
+		NULL);
+	if (status != 0) {
+		return status;
+	}
+
+	return flash_sector_erase_region_differential (dest, dest_addr + length + tail, space - tail,
+		NULL);
+}
+
+/**
+ * Prepare a region of flash for a new image.  If differential writes are enabled, only the part of
+ * the region before the image offset is erased, and only if it is not already blank.
+ *
+ * @param updater The updater instance.
+ * @param dest The flash device to prepare.
+ * @param dest_addr The base address of the image region.
+ * @param length The length of the image that will be written.
+ *
+ * @return 0 if the region was prepared successfully or an error code.
+ */
+static int firmware_update_erase_image_region (const struct firmware_update *updater,
+	const struct flash *dest, uint32_t dest_addr, size_t length)
+{
+	if (updater->state->differential) {
+		return flash_sector_erase_region_differential (dest, dest_addr, updater->state->img_offset,
+			NULL);
+	}
+
+	return flash_mixed_erase_region_and_verify (dest, dest_addr,
+		length + updater->state->img_offset);
+}
+
+/**
+ * Program an image to a region of flash that has been prepared with
+ * firmware_update_erase_image_region.
+ *
+ * @param updater The updater instance.
+ * @param dest The bootable flash device to program.
+ * @param dest_addr The base address of the image region.
+ * @param src The flash device with the image to copy.
+ * @param src_addr The base address of the region containing the image to copy.
+ * @param length The length of the image.
+ * @param region_len The size of the image region being programmed.
+ * @param page The page size of flash being written.
+ *
+ * @return 0 if the image was copied successfully or an error code.
+ */
+static int firmware_update_program_image (const struct firmware_update *updater,
+	const struct flash *dest, uint32_t dest_addr, const struct flash *src, uint32_t src_addr,
+	size_t length, size_t region_len, uint32_t page)
+{
+	if (updater->state->differential) {
+		return firmware_update_program_bootable_differential (updater, dest,
+			dest_addr + updater->state->img_offset, src, src_addr + updater->state->img_offset,
+			length, region_len - updater->state->img_offset, page);
+	}
+
+	return firmware_update_program_bootable (updater, dest, dest_addr + updater->state->img_offset,
+		src, src_addr + updater->state->img_offset, length, page);
+}
+
 /**
  * Call the internal updater function to finalize an image installation.
  *
@@ -422,8 +722,10 @@ static int firmware_update_finalize_image (const struct firmware_update *updater
  * @param callback The updated notification handlers.
  * @param dest The destination flash device for the new image.
  * @param dest_addr The destination address for the new image.
+ * @param dest_size The size of the destination region.
  * @param backup The backup flash device.  This can be null to not create a backup.
  * @param backup_addr The address to store the backup.
+ * @param backup_size The size of the backup region.
  * @param src The source flash device that contains the new image.
  * @param src_addr The source address of the new image.
  * @param update_len The length of the new image.
@@ -439,10 +741,11 @@ static int firmware_update_finalize_image (const struct firmware_update *updater
  */
 static int firmware_update_write_image (const struct firmware_update *updater,
 	const struct firmware_update_notification *callback, const struct flash *dest,
-	uint32_t dest_addr, const struct flash *backup, uint32_t backup_addr, const struct flash *src,
-	uint32_t src_addr, size_t update_len, enum firmware_update_status backup_start,
-	enum firmware_update_status backup_fail, enum firmware_update_status update_start,
-	enum firmware_update_status update_fail, bool *img_good)
+	uint32_t dest_addr, size_t dest_size, const struct flash *backup, uint32_t backup_addr,
+	size_t backup_size, const struct flash *src, uint32_t src_addr, size_t update_len,
+	enum firmware_update_status backup_start, enum firmware_update_status backup_fail,
+	enum firmware_update_status update_start, enum firmware_update_status update_fail,
+	bool *img_good)
 {
 	int backup_len = 0;
 	uint32_t page;
@@ -467,8 +770,16 @@ static int firmware_update_write_image (const struct firmware_update *updater,
 			return backup_len;
 		}
 
-		status = flash_copy_ext_and_verify (backup, backup_addr + updater->state->img_offset, dest,
-			dest_addr + updater->state->img_offset, backup_len);
+		if (updater->state->differential) {
+			status = firmware_update_copy_image_differential (backup,
+				backup_addr + updater->state->img_offset, dest,
+				dest_addr + updater->state->img_offset, backup_len,
+				backup_size - updater->state->img_offset);
+		}
+		else {
+			status = flash_copy_ext_and_verify (backup, backup_addr + updater->state->img_offset,
+				dest, dest_addr + updater->state->img_offset, backup_len);
+		}
 		if (status != 0) {
 			firmware_update_status_change (callback, backup_fail);
 			return status;
@@ -488,16 +799,14 @@ static int firmware_update_write_image (const struct firmware_update *updater,
 		*img_good = false;
 	}
 
-	status = flash_erase_region_and_verify (dest, dest_addr,
-		update_len + updater->state->img_offset);
+	status = firmware_update_erase_image_region (updater, dest, dest_addr, update_len);
 	if (status != 0) {
 		firmware_update_status_change (callback, update_fail);
 		return status;
 	}
 
-	status = firmware_update_program_bootable (updater, dest,
-		dest_addr + updater->state->img_offset, src, src_addr + updater->state->img_offset,
-		update_len, page);
+	status = firmware_update_program_image (updater, dest, dest_addr, src, src_addr, update_len,
+		dest_size, page);
 	if (status == 0) {
 		status = firmware_update_finalize_image (updater, dest, dest_addr);
 	}
@@ -505,11 +814,9 @@ static int firmware_update_write_image (const struct firmware_update *updater,
 	if (status != 0) {
 		if (backup) {
 			/* Try to restore the image that was backed up. */
-			if (flash_erase_region_and_verify (dest, dest_addr,
-				backup_len + updater->state->img_offset) == 0) {
-				if (firmware_update_program_bootable (updater, dest,
-					dest_addr + updater->state->img_offset, backup,
-					backup_addr + updater->state->img_offset, backup_len, page) == 0) {
+			if (firmware_update_erase_image_region (updater, dest, dest_addr, backup_len) == 0) {
+				if (firmware_update_program_image (updater, dest, dest_addr, backup, backup_addr,
+					backup_len, dest_size, page) == 0) {
 					if (firmware_update_finalize_image (updater, dest, dest_addr) == 0) {
 						*img_good = true;
 					}
@@ -533,6 +840,7 @@ static int firmware_update_write_image (const struct firmware_update *updater,
  * @param updater The updater to use for image restoration.
  * @param dest The flash device to restore to.
  * @param dest_addr The address to restore the image to.
+ * @param dest_size The size of the region being restored.
  * @param src The flash device with the image to restore from.
  * @param src_addr The address to restore from.
  * @param src_valid Optional output parameter indicating if the failure was due to an invalid source
@@ -543,8 +851,8 @@ static int firmware_update_write_image (const struct firmware_update *updater,
  * @return 0 if image was successfully restored or an error code.
  */
 static int firmware_update_restore_image (const struct firmware_update *updater,
-	const struct flash *dest, uint32_t dest_addr, const struct flash *src, uint32_t src_addr,
-	bool *src_invalid, int *recovery_rev)
+	const struct flash *dest, uint32_t dest_addr, size_t dest_size, const struct flash *src,
+	uint32_t src_addr, bool *src_invalid, int *recovery_rev)
 {
 	size_t img_len = 0;
 	int status;
@@ -565,8 +873,8 @@ static int firmware_update_restore_image (const struct firmware_update *updater,
 
 	/* Enum values for the firmware_update_status are not relevant since the callback will always be
 	 * null for this call. */
-	return firmware_update_write_image (updater, NULL, dest, dest_addr, NULL, 0, src, src_addr,
-		img_len, UPDATE_STATUS_SUCCESS, UPDATE_STATUS_SUCCESS, UPDATE_STATUS_SUCCESS,
+	return firmware_update_write_image (updater, NULL, dest, dest_addr, dest_size, NULL, 0, 0, src,
+		src_addr, img_len, UPDATE_STATUS_SUCCESS, UPDATE_STATUS_SUCCESS, UPDATE_STATUS_SUCCESS,
 		UPDATE_STATUS_SUCCESS, NULL);
 }
 
@@ -597,8 +905,9 @@ static int firmware_update_restore_recovery_image_error_detail (
 				FIRMWARE_LOGGING_RECOVERY_RESTORE_START, 0, 0);
 
 			status = firmware_update_restore_image (updater, updater->flash->recovery_flash,
-				updater->flash->recovery_addr, updater->flash->active_flash,
-				updater->flash->active_addr, active_invalid, &recovery_rev);
+				updater->flash->recovery_addr, updater->flash->recovery_size,
+				updater->flash->active_flash, updater->flash->active_addr, active_invalid,
+				&recovery_rev);
 			if (status == 0) {
 				updater->state->recovery_bad = false;
 				updater->state->recovery_rev = recovery_rev;
@@ -651,8 +960,8 @@ int firmware_update_restore_active_image (const struct firmware_update *updater)
 
 	if (updater->flash->recovery_flash) {
 		status = firmware_update_restore_image (updater, updater->flash->active_flash,
-			updater->flash->active_addr, updater->flash->recovery_flash,
-			updater->flash->recovery_addr, NULL, NULL);
+			updater->flash->active_addr, updater->flash->active_size,
+			updater->flash->recovery_flash, updater->flash->recovery_addr, NULL, NULL);
 	}
 
 	return status;
@@ -796,10 +1105,10 @@ static int firmware_update_apply_update (const struct firmware_update *updater,
 		debug_log_flush ();
 
 		status = firmware_update_write_image (updater, callback, updater->flash->recovery_flash,
-			updater->flash->recovery_addr, NULL, 0, updater->flash->staging_flash,
-			updater->flash->staging_addr, img_length, UPDATE_STATUS_BACKUP_RECOVERY,
-			UPDATE_STATUS_BACKUP_REC_FAIL, UPDATE_STATUS_UPDATE_RECOVERY,
-			UPDATE_STATUS_UPDATE_REC_FAIL, &img_good);
+			updater->flash->recovery_addr, updater->flash->recovery_size, NULL, 0, 0,
+			updater->flash->staging_flash, updater->flash->staging_addr, img_length,
+			UPDATE_STATUS_BACKUP_RECOVERY, UPDATE_STATUS_BACKUP_REC_FAIL,
+			UPDATE_STATUS_UPDATE_RECOVERY, UPDATE_STATUS_UPDATE_REC_FAIL, &img_good);
 		if (status != 0) {
 			return status;
 		}
@@ -812,10 +1121,11 @@ static int firmware_update_apply_update (const struct firmware_update *updater,
 
 	/* Update the active image from staging flash. */
 	return firmware_update_write_image (updater, callback, updater->flash->active_flash,
-		updater->flash->active_addr, updater->flash->backup_flash, updater->flash->backup_addr,
-		updater->flash->staging_flash, updater->flash->staging_addr, img_length,
-		UPDATE_STATUS_BACKUP_ACTIVE, UPDATE_STATUS_BACKUP_FAILED, UPDATE_STATUS_UPDATING_IMAGE,
-		UPDATE_STATUS_UPDATE_FAILED, &img_good);
+		updater->flash->active_addr, updater->flash->active_size, updater->flash->backup_flash,
+		updater->flash->backup_addr, updater->flash->backup_size, updater->flash->staging_flash,
+		updater->flash->staging_addr, img_length, UPDATE_STATUS_BACKUP_ACTIVE,
+		UPDATE_STATUS_BACKUP_FAILED, UPDATE_STATUS_UPDATING_IMAGE, UPDATE_STATUS_UPDATE_FAILED,
+		&img_good);
 }
 
 /**
@@ -864,15 +1174,18 @@ static int firmware_update_process_manifest_revocation (const struct firmware_up
 		if (updater->flash->recovery_flash && !recovery_updated) {
 			const struct flash *backup = NULL;
 			uint32_t backup_addr = 0;
+			size_t backup_size = 0;
 
 			if (!updater->state->recovery_bad) {
 				if (updater->flash->rec_backup_flash) {
 					backup = updater->flash->rec_backup_flash;
 					backup_addr = updater->flash->rec_backup_addr;
+					backup_size = updater->flash->rec_backup_size;
 				}
 				else {
 					backup = updater->flash->backup_flash;
 					backup_addr = updater->flash->backup_addr;
+					backup_size = updater->flash->backup_size;
 				}
 			}
 
@@ -882,9 +1195,10 @@ static int firmware_update_process_manifest_revocation (const struct firmware_up
 			debug_log_flush ();
 
 			status = firmware_update_write_image (updater, callback, updater->flash->recovery_flash,
-				updater->flash->recovery_addr, backup, backup_addr, flash, address, img_length,
-				UPDATE_STATUS_BACKUP_RECOVERY, UPDATE_STATUS_BACKUP_REC_FAIL,
-				UPDATE_STATUS_UPDATE_RECOVERY, UPDATE_STATUS_UPDATE_REC_FAIL, &img_good);
+				updater->flash->recovery_addr, updater->flash->recovery_size, backup, backup_addr,
+				backup_size, flash, address, img_length, UPDATE_STATUS_BACKUP_RECOVERY,
+				UPDATE_STATUS_BACKUP_REC_FAIL, UPDATE_STATUS_UPDATE_RECOVERY,
+				UPDATE_STATUS_UPDATE_REC_FAIL, &img_good);
 
 			updater->state->recovery_bad = !img_good;
 			if (status != 0) {
@@ -1116,7 +1430,23 @@ int firmware_update_prepare_staging (const struct firmware_update *updater,
 
 	firmware_update_status_change (callback, UPDATE_STATUS_STAGING_PREP);
 
-	status = flash_updater_prepare_for_update (&updater->state->update_mgr, size);
+	if (updater->state->delta.hashing) {
+		/* A previous delta was not completely received. */
+		updater->hash->cancel (updater->hash);
+	}
+
+	memset (&updater->state->delta, 0, sizeof (updater->state->delta));
+	updater->state->delta.expected = size;
+
+	if (updater->state->delta_verification) {
+		/* The size of the image is not known until the first write, which indicates if this is a
+		 * delta update.  Staging flash will be prepared at that point. */
+		status = flash_updater_check_update_size (&updater->state->update_mgr, size);
+		updater->state->delta.pending = (status == 0);
+	}
+	else {
+		status = flash_updater_prepare_for_update (&updater->state->update_mgr, size);
+	}
 	if (status != 0) {
 		firmware_update_status_change (callback, UPDATE_STATUS_STAGING_PREP_FAIL);
 	}
@@ -1124,6 +1454,337 @@ int firmware_update_prepare_staging (const struct firmware_update *updater,
 	return status;
 }
 
+/**
+ * Determine if the first data written to staging flash is the start of a delta update.
+ *
+ * @param updater The updater receiving the data.
+ * @param buf The data being written.
+ * @param buf_len Length of the data.
+ *
+ * @return true if a delta update is starting.
+ */
+static bool firmware_update_is_delta_start (const struct firmware_update *updater,
+	const uint8_t *buf, size_t buf_len)
+{
+	const struct firmware_update_delta_header *header =
+		(const struct firmware_update_delta_header*) buf;
+
+	return (updater->state->delta_verification != NULL) && (buf_len >= sizeof (header->marker)) &&
+		(header->marker == FIRMWARE_UPDATE_DELTA_MARKER);
+}
+
+/**
+ * Write reconstructed image data to staging flash.
+ *
+ * @param updater The updater reconstructing the image.
+ * @param data The image data to write.
+ * @param length Length of the image data.
+ *
+ * @return 0 if the data was written successfully or an error code.
+ */
+static int firmware_update_write_delta_output (const struct firmware_update *updater,
+	const uint8_t *data, size_t length)
+{
+	int remaining = flash_updater_get_remaining_bytes (&updater->state->update_mgr);
+
+	if ((remaining < 0) || ((size_t) remaining < length)) {
+		return FIRMWARE_UPDATE_DELTA_MALFORMED;
+	}
+
+	return flash_updater_write_update_data (&updater->state->update_mgr, data, length);
+}
+
+/**
+ * Copy data from the active image to the reconstructed image in staging flash.
+ *
+ * @param updater The updater reconstructing the image.
+ * @param offset Offset in the active image of the data to copy.
+ * @param length Number of bytes to copy.
+ *
+ * @return 0 if the data was copied successfully or an error code.
+ */
+static int firmware_update_delta_copy_base (const struct firmware_update *updater,
+	uint32_t offset, uint32_t length)
+{
+	uint8_t data[FLASH_VERIFICATION_BLOCK];
+	uint32_t addr;
+	size_t read_len;
+	int status;
+
+	if ((offset > updater->state->delta.base_length) ||
+		(length > (updater->state->delta.base_length - offset))) {
+		return FIRMWARE_UPDATE_DELTA_MALFORMED;
+	}
+
+	addr = updater->flash->active_addr + updater->state->img_offset + offset;
+	while (length != 0) {
+		read_len = (length > sizeof (data)) ? sizeof (data) : length;
+
+		status = updater->flash->active_flash->read (updater->flash->active_flash, addr, data,
+			read_len);
+		if (status != 0) {
+			return status;
+		}
+
+		status = firmware_update_write_delta_output (updater, data, read_len);
+		if (status != 0) {
+			return status;
+		}
+
+		addr += read_len;
+		length -= read_len;
+	}
+
+	return 0;
+}
+
+/**
+ * Start reconstructing an image from a delta update.  The active image is checked against the
+ * base of the delta and staging flash is prepared for the full image.
+ *
+ * If the active image does not match the base of the delta, the delta can't be used.  Staging
+ * flash will instead be prepared to receive the full image, so the update can continue with the
+ * full image without needing to prepare staging flash again.
+ *
+ * @param updater The updater receiving the delta.
+ * @param header The header for the delta update.
+ *
+ * @return 0 if the delta update was started or an error code.
+ */
+static int firmware_update_start_delta (const struct firmware_update *updater,
+	const struct firmware_update_delta_header *header)
+{
+	struct firmware_update_delta_state *delta = &updater->state->delta;
+	uint8_t digest[SHA256_HASH_LENGTH];
+	int status;
+
+	if ((header->image_length == 0) || (header->base_length == 0) ||
+		(header->base_length > (updater->flash->active_size - updater->state->img_offset)) ||
+		(header->sig_length == 0) || (header->sig_length > sizeof (delta->signature)) ||
+		(header->sig_length > (delta->expected - sizeof (*header)))) {
+		return FIRMWARE_UPDATE_DELTA_MALFORMED;
+	}
+
+	status = flash_hash_contents (updater->flash->active_flash,
+		updater->flash->active_addr + updater->state->img_offset, header->base_length,
+		updater->hash, HASH_TYPE_SHA256, digest, sizeof (digest));
+	if (status != 0) {
+		return status;
+	}
+
+	status = flash_updater_prepare_for_update (&updater->state->update_mgr,
+		header->image_length);
+	if (status != 0) {
+		return status;
+	}
+
+	delta->pending = false;
+
+	if (memcmp (digest, header->base_hash, sizeof (digest)) != 0) {
+		/* Fall back to a full image update. */
+		return FIRMWARE_UPDATE_DELTA_BASE_MISMATCH;
+	}
+
+	/* Start the delta digest with the header.  The operations are added as they are received. */
+	status = updater->hash->start_sha256 (updater->hash);
+	if (status != 0) {
+		return status;
+	}
+
+	status = updater->hash->update (updater->hash, (const uint8_t*) header, sizeof (*header));
+	if (status != 0) {
+		updater->hash->cancel (updater->hash);
+		return status;
+	}
+
+	delta->active = true;
+	delta->hashing = true;
+	delta->image_length = header->image_length;
+	delta->base_length = header->base_length;
+	delta->sig_length = header->sig_length;
+	delta->payload_length = delta->expected - header->sig_length;
+	delta->op_bytes = 0;
+	delta->insert_remaining = 0;
+
+	return 0;
+}
+
+/**
+ * Apply delta operations to reconstruct the image in staging flash.  Each operation is applied as
+ * soon as it is received, so the full image is reconstructed in staging flash as the delta is
+ * streamed in.
+ *
+ * @param updater The updater receiving the delta.
+ * @param buf The delta operations to apply.
+ * @param buf_len Length of the operation data.
+ *
+ * @return 0 if the operations were applied successfully or an error code.
+ */
+static int firmware_update_apply_delta_ops (const struct firmware_update *updater,
+	const uint8_t *buf, size_t buf_len)
+{
+	struct firmware_update_delta_state *delta = &updater->state->delta;
+	size_t length;
+	int status;
+
+	while (buf_len != 0) {
+		if (delta->insert_remaining != 0) {
+			length = (buf_len > delta->insert_remaining) ? delta->insert_remaining : buf_len;
+
+			status = firmware_update_write_delta_output (updater, buf, length);
+			if (status != 0) {
+				return status;
+			}
+
+			delta->insert_remaining -= length;
+		}
+		else {
+			length = sizeof (delta->op) - delta->op_bytes;
+			length = (buf_len > length) ? length : buf_len;
+
+			memcpy (((uint8_t*) &delta->op) + delta->op_bytes, buf, length);
+			delta->op_bytes += length;
+
+			if (delta->op_bytes == sizeof (delta->op)) {
+				delta->op_bytes = 0;
+
+				switch (delta->op.type) {
+					case FIRMWARE_UPDATE_DELTA_OP_COPY:
+						status = firmware_update_delta_copy_base (updater, delta->op.offset,
+							delta->op.length);
+						if (status != 0) {
+							return status;
+						}
+						break;
+
+					case FIRMWARE_UPDATE_DELTA_OP_INSERT:
+						delta->insert_remaining = delta->op.length;
+						break;
+
+					default:
+						return FIRMWARE_UPDATE_DELTA_MALFORMED;
+				}
+			}
+		}
+
+		buf += length;
+		buf_len -= length;
+		delta->received += length;
+	}
+
+	return 0;
+}
+
+/**
+ * Check the signature of a delta update after all delta data has been received.
+ *
+ * @param updater The updater that received the delta.
+ *
+ * @return 0 if the delta is valid or an error code.
+ */
+static int firmware_update_verify_delta (const struct firmware_update *updater)
+{
+	struct firmware_update_delta_state *delta = &updater->state->delta;
+	uint8_t digest[SHA256_HASH_LENGTH];
+	int status;
+
+	delta->hashing = false;
+	status = updater->hash->finish (updater->hash, digest, sizeof (digest));
+	if (status != 0) {
+		updater->hash->cancel (updater->hash);
+		return status;
+	}
+
+	if ((delta->op_bytes != 0) || (delta->insert_remaining != 0)) {
+		/* The signature must follow a complete operation. */
+		return FIRMWARE_UPDATE_DELTA_MALFORMED;
+	}
+
+	status = updater->state->delta_verification->verify_signature (
+		updater->state->delta_verification, digest, sizeof (digest), delta->signature,
+		delta->sig_length);
+	if (status != 0) {
+		return status;
+	}
+
+	delta->verified = true;
+
+	return 0;
+}
+
+/**
+ * Process delta update data written to staging flash.  Operations are added to the delta digest
+ * and applied as they are received.  The signature at the end of the delta is saved and checked
+ * once it has been received.
+ *
+ * @param updater The updater receiving the delta.
+ * @param buf The delta data to process.
+ * @param buf_len Length of the delta data.
+ *
+ * @return 0 if the data was processed successfully or an error code.
+ */
+static int firmware_update_write_delta (const struct firmware_update *updater, const uint8_t *buf,
+	size_t buf_len)
+{
+	struct firmware_update_delta_state *delta = &updater->state->delta;
+	size_t length;
+	int status;
+
+	if (buf_len > (delta->expected - delta->received)) {
+		return FIRMWARE_UPDATE_DELTA_TOO_LARGE;
+	}
+
+	if (!delta->active) {
+		if (buf_len < sizeof (struct firmware_update_delta_header)) {
+			return FIRMWARE_UPDATE_DELTA_MALFORMED;
+		}
+
+		status = firmware_update_start_delta (updater,
+			(const struct firmware_update_delta_header*) buf);
+		if (status != 0) {
+			return status;
+		}
+
+		buf += sizeof (struct firmware_update_delta_header);
+		buf_len -= sizeof (struct firmware_update_delta_header);
+		delta->received = sizeof (struct firmware_update_delta_header);
+	}
+	else if (!delta->hashing) {
+		/* A previous failure stopped processing of the delta. */
+		return FIRMWARE_UPDATE_DELTA_MALFORMED;
+	}
+
+	if (delta->received < delta->payload_length) {
+		length = delta->payload_length - delta->received;
+		length = (buf_len > length) ? length : buf_len;
+
+		status = updater->hash->update (updater->hash, buf, length);
+		if (status == 0) {
+			status = firmware_update_apply_delta_ops (updater, buf, length);
+		}
+		if (status != 0) {
+			updater->hash->cancel (updater->hash);
+			delta->hashing = false;
+
+			return status;
+		}
+
+		buf += length;
+		buf_len -= length;
+	}
+
+	if (buf_len != 0) {
+		memcpy (&delta->signature[delta->received - delta->payload_length], buf, buf_len);
+		delta->received += buf_len;
+	}
+
+	if (delta->received == delta->expected) {
+		return firmware_update_verify_delta (updater);
+	}
+
+	return 0;
+}
+
 /**
  * Program FW update data to staging area
  *
@@ -1148,7 +1809,24 @@ int firmware_update_write_to_staging (const struct firmware_update *updater,
 
 	firmware_update_status_change (callback, UPDATE_STATUS_STAGING_WRITE);
 
-	status = flash_updater_write_update_data (&updater->state->update_mgr, buf, buf_len);
+	if (updater->state->delta.pending && !firmware_update_is_delta_start (updater, buf, buf_len)) {
+		/* This is a full image, so prepare staging flash for the size provided by the host. */
+		status = flash_updater_prepare_for_update (&updater->state->update_mgr,
+			updater->state->delta.expected);
+		if (status != 0) {
+			firmware_update_status_change (callback, UPDATE_STATUS_STAGING_WRITE_FAIL);
+			return status;
+		}
+
+		updater->state->delta.pending = false;
+	}
+
+	if (updater->state->delta.pending || updater->state->delta.active) {
+		status = firmware_update_write_delta (updater, buf, buf_len);
+	}
+	else {
+		status = flash_updater_write_update_data (&updater->state->update_mgr, buf, buf_len);
+	}
 	if (status != 0) {
 		firmware_update_status_change (callback, UPDATE_STATUS_STAGING_WRITE_FAIL);
 	}
@@ -1170,5 +1848,9 @@ int firmware_update_get_update_remaining (const struct firmware_update *updater)
 		return 0;
 	}
 
+	if (updater->state->delta.pending || updater->state->delta.active) {
+		return updater->state->delta.expected - updater->state->delta.received;
+	}
+
 	return flash_updater_get_remaining_bytes (&updater->state->update_mgr);
 }
@@ -14,6 +14,7 @@
 #include "flash/flash.h"
 #include "flash/flash_updater.h"
 #include "crypto/hash.h"
+#include "crypto/signature_verification.h"
 #include "common/observable.h"
 
 
@@ -115,6 +116,72 @@ struct firmware_update_hooks {
 		uint32_t address);
 };
 
+/**
+ * Marker at the start of a delta update stream.  This is "DLTA" in little endian byte order.
+ */
+#define	FIRMWARE_UPDATE_DELTA_MARKER	0x41544c44
+
+/**
+ * Maximum length of the signature at the end of a delta update.  This is large enough for a
+ * 4096-bit RSA signature.
+ */
+#define	FIRMWARE_UPDATE_DELTA_MAX_SIG_LENGTH	512
+
+#pragma pack(push, 1)
+/**
+ * Header at the start of a delta update.  A delta update describes a new firmware image as a
+ * sequence of operations that either copy data from the current active image or insert new data.
+ * The header is followed immediately by the first operation.  The last operation is followed by a
+ * signature of the SHA-256 digest of the header and all operations.
+ *
+ * All multi-byte fields are little endian.
+ */
+struct firmware_update_delta_header {
+	uint32_t marker;						/**< Must be FIRMWARE_UPDATE_DELTA_MARKER. */
+	uint32_t image_length;					/**< Total length of the reconstructed image. */
+	uint32_t base_length;					/**< Length of the active image used as the base. */
+	uint32_t sig_length;					/**< Length of the signature at the end of the delta. */
+	uint8_t base_hash[SHA256_HASH_LENGTH];	/**< SHA-256 digest of the base image data. */
+};
+
+/**
+ * A single operation in a delta update.  Insert operations are followed by the data to insert.
+ */
+struct firmware_update_delta_op {
+	uint8_t type;							/**< The type of operation. */
+	uint32_t offset;						/**< Offset in the base image for copy operations. */
+	uint32_t length;						/**< Number of bytes to copy or insert. */
+};
+#pragma pack(pop)
+
+/**
+ * Operations supported in a delta update.
+ */
+enum firmware_update_delta_op_type {
+	FIRMWARE_UPDATE_DELTA_OP_COPY = 1,		/**< Copy bytes from the base image. */
+	FIRMWARE_UPDATE_DELTA_OP_INSERT = 2,	/**< Insert bytes that follow the operation. */
+};
+
+/**
+ * Variable context for reconstructing an image from a delta update.
+ */
+struct firmware_update_delta_state {
+	bool pending;							/**< Flag indicating staging flash has not been prepared yet. */
+	bool active;							/**< Flag indicating the current update is a delta. */
+	bool hashing;							/**< Flag indicating the delta digest is being calculated. */
+	bool verified;							/**< Flag indicating the delta signature is valid. */
+	size_t expected;						/**< Total number of delta bytes expected. */
+	size_t received;						/**< Number of delta bytes received. */
+	size_t payload_length;					/**< Number of delta bytes covered by the signature. */
+	uint32_t image_length;					/**< Length of the reconstructed image. */
+	uint32_t base_length;					/**< Length of the base image data. */
+	struct firmware_update_delta_op op;		/**< The current delta operation. */
+	size_t op_bytes;						/**< Bytes received for the current operation. */
+	uint32_t insert_remaining;				/**< Data bytes remaining for the current insert. */
+	size_t sig_length;						/**< Length of the delta signature. */
+	uint8_t signature[FIRMWARE_UPDATE_DELTA_MAX_SIG_LENGTH];	/**< Signature of the delta. */
+};
+
 /**
  * Variable context for a firmware updater.
  */
@@ -125,6 +192,9 @@ struct firmware_update_state {
 	int recovery_rev;						/**< Revision ID of the current recovery image. */
 	int min_rev;							/**< Minimum revision ID allowed for update. */
 	int img_offset;							/**< Offset to apply to FW image regions. */
+	bool differential;						/**< Only rewrite flash sectors that have changed. */
+	const struct signature_verification *delta_verification;	/**< Verification for delta updates. */
+	struct firmware_update_delta_state delta;	/**< Context for the current delta update. */
 };
 
 /**
@@ -166,6 +236,9 @@ int firmware_update_init_state (const struct firmware_update *updater, int allow
 void firmware_update_release (const struct firmware_update *updater);
 
 void firmware_update_set_image_offset (const struct firmware_update *updater, int offset);
+void firmware_update_set_differential_write (const struct firmware_update *updater, bool enable);
+void firmware_update_set_delta_support (const struct firmware_update *updater,
+	const struct signature_verification *verification);
 
 void firmware_update_set_recovery_revision (const struct firmware_update *updater, int revision);
 void firmware_update_set_recovery_good (const struct firmware_update *updater, bool img_good);
@@ -222,6 +295,9 @@ enum {
 	FIRMWARE_UPDATE_RESTORE_NOT_NEEDED = FIRMWARE_UPDATE_ERROR (0x10),	/**< An image restore operation was not necessary. */
 	FIRMWARE_UPDATE_INVALID_BOOT_IMAGE = FIRMWARE_UPDATE_ERROR (0x11),	/**< The boot image is not valid based on additional verification. */
 	FIRMWARE_UPDATE_TOO_MUCH_DATA = FIRMWARE_UPDATE_ERROR (0x12),		/**< Too much data was sent in a single request. */
+	FIRMWARE_UPDATE_DELTA_BASE_MISMATCH = FIRMWARE_UPDATE_ERROR (0x13),	/**< The active image does not match the base of a delta update. */
+	FIRMWARE_UPDATE_DELTA_MALFORMED = FIRMWARE_UPDATE_ERROR (0x14),		/**< A delta update contains invalid operations. */
+	FIRMWARE_UPDATE_DELTA_TOO_LARGE = FIRMWARE_UPDATE_ERROR (0x15),		/**< More delta data was received than was expected. */
 };
 
 
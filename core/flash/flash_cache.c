@@ -0,0 +1,487 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "flash_cache.h"
+#include "flash_cache_static.h"
+
+
+int flash_cache_get_device_size (const struct flash *flash, uint32_t *bytes)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	return cache->flash->get_device_size (cache->flash, bytes);
+}
+
+/**
+ * Find the cache line that contains data for a flash address.
+ *
+ * @param cache The cache to search.
+ * @param line_addr The aligned flash address for the line.
+ *
+ * @return The cache line containing the data or null if the data is not cached.
+ */
+static struct flash_cache_line* flash_cache_find_line (const struct flash_cache *cache,
+	uint32_t line_addr)
+{
+	size_t i;
+
+	for (i = 0; i < cache->line_count; i++) {
+		if ((cache->lines[i].length != 0) && (cache->lines[i].addr == line_addr)) {
+			return &cache->lines[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Select the cache line that should be replaced with new data.  An empty line will be used if there
+ * is one, otherwise the least recently used line will be replaced.
+ *
+ * @param cache The cache to search.
+ *
+ * @return The cache line to replace.
+ */
+static struct flash_cache_line* flash_cache_get_victim_line (const struct flash_cache *cache)
+{
+	struct flash_cache_line *victim = &cache->lines[0];
+	size_t i;
+
+	for (i = 0; i < cache->line_count; i++) {
+		if (cache->lines[i].length == 0) {
+			return &cache->lines[i];
+		}
+
+		/* Compare ages instead of raw sequence numbers so counter wrap doesn't matter. */
+		if ((cache->state->access_count - cache->lines[i].last_used) >
+			(cache->state->access_count - victim->last_used)) {
+			victim = &cache->lines[i];
+		}
+	}
+
+	return victim;
+}
+
+/**
+ * Get the storage for the data of a cache line.
+ *
+ * @param cache The cache that contains the line.
+ * @param line The line to get data storage for.
+ *
+ * @return The data buffer for the line.
+ */
+static uint8_t* flash_cache_get_line_data (const struct flash_cache *cache,
+	const struct flash_cache_line *line)
+{
+	return &cache->data[(line - cache->lines) * cache->line_size];
+}
+
+/**
+ * Read a full line of data from flash into the cache.  The lock must be held by the caller.
+ *
+ * @param cache The cache to update.
+ * @param line_addr The aligned flash address for the line.
+ * @param line Output for the cache line that contains the data.
+ *
+ * @return 0 if the line was read successfully or an error code.
+ */
+static int flash_cache_fill_line (const struct flash_cache *cache, uint32_t line_addr,
+	struct flash_cache_line **line)
+{
+	struct flash_cache_line *fill;
+	size_t fill_len = cache->line_size;
+	int status;
+
+	if (cache->state->device_size == 0) {
+		status = cache->flash->get_device_size (cache->flash, &cache->state->device_size);
+		if (status != 0) {
+			cache->state->device_size = 0;
+			return status;
+		}
+	}
+
+	if (line_addr >= cache->state->device_size) {
+		return FLASH_ADDRESS_OUT_OF_RANGE;
+	}
+
+	if ((cache->state->device_size - line_addr) < fill_len) {
+		fill_len = cache->state->device_size - line_addr;
+	}
+
+	fill = flash_cache_get_victim_line (cache);
+	fill->length = 0;
+
+	status = cache->flash->read (cache->flash, line_addr, flash_cache_get_line_data (cache, fill),
+		fill_len);
+	if (status != 0) {
+		return status;
+	}
+
+	fill->addr = line_addr;
+	fill->length = fill_len;
+	*line = fill;
+
+	return 0;
+}
+
+int flash_cache_read (const struct flash *flash, uint32_t address, uint8_t *data, size_t length)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+	struct flash_cache_line *line;
+	uint32_t line_addr;
+	size_t line_offset;
+	size_t read_len;
+	int status = 0;
+
+	if ((cache == NULL) || (data == NULL)) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&cache->state->lock);
+
+	if (length >= cache->line_size) {
+		/* Large reads are already efficient and would evict useful data from the cache. */
+		cache->state->stats.uncached++;
+		status = cache->flash->read (cache->flash, address, data, length);
+		goto exit;
+	}
+
+	while (length != 0) {
+		line_addr = FLASH_REGION_BASE (address, cache->line_size);
+		line_offset = address - line_addr;
+		read_len = cache->line_size - line_offset;
+		if (length < read_len) {
+			read_len = length;
+		}
+
+		line = flash_cache_find_line (cache, line_addr);
+		if (line != NULL) {
+			cache->state->stats.hits++;
+		}
+		else {
+			cache->state->stats.misses++;
+
+			status = flash_cache_fill_line (cache, line_addr, &line);
+			if (status != 0) {
+				goto exit;
+			}
+		}
+
+		if ((line_offset + read_len) > line->length) {
+			status = FLASH_ADDRESS_OUT_OF_RANGE;
+			goto exit;
+		}
+
+		line->last_used = ++cache->state->access_count;
+		memcpy (data, &flash_cache_get_line_data (cache, line)[line_offset], read_len);
+
+		address += read_len;
+		data += read_len;
+		length -= read_len;
+	}
+
+exit:
+	platform_mutex_unlock (&cache->state->lock);
+	return status;
+}
+
+int flash_cache_get_page_size (const struct flash *flash, uint32_t *bytes)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	return cache->flash->get_page_size (cache->flash, bytes);
+}
+
+int flash_cache_minimum_write_per_page (const struct flash *flash, uint32_t *bytes)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	return cache->flash->minimum_write_per_page (cache->flash, bytes);
+}
+
+/**
+ * Remove any cached data for a region of flash.  The lock must be held by the caller.
+ *
+ * @param cache The cache to update.
+ * @param address The first address in the region.
+ * @param length The length of the region.
+ */
+static void flash_cache_invalidate_region (const struct flash_cache *cache, uint32_t address,
+	size_t length)
+{
+	size_t i;
+
+	for (i = 0; i < cache->line_count; i++) {
+		if ((cache->lines[i].length != 0) && (cache->lines[i].addr < (address + length)) &&
+			(address < (cache->lines[i].addr + cache->lines[i].length))) {
+			cache->lines[i].length = 0;
+		}
+	}
+}
+
+/**
+ * Remove all cached data.  The lock must be held by the caller.
+ *
+ * @param cache The cache to update.
+ */
+static void flash_cache_invalidate_all (const struct flash_cache *cache)
+{
+	size_t i;
+
+	for (i = 0; i < cache->line_count; i++) {
+		cache->lines[i].length = 0;
+	}
+}
+
+int flash_cache_write (const struct flash *flash, uint32_t address, const uint8_t *data,
+	size_t length)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+	int status;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&cache->state->lock);
+
+	/* Even a failed write may have changed some of the data on flash. */
+	status = cache->flash->write (cache->flash, address, data, length);
+	flash_cache_invalidate_region (cache, address, length);
+
+	platform_mutex_unlock (&cache->state->lock);
+
+	return status;
+}
+
+int flash_cache_get_sector_size (const struct flash *flash, uint32_t *bytes)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	return cache->flash->get_sector_size (cache->flash, bytes);
+}
+
+/**
+ * Erase a region of flash and remove any cached data for the erased region.
+ *
+ * @param cache The cache to use for the erase.
+ * @param address An address within the region to erase.
+ * @param get_size Function to determine the size of the erase region.
+ * @param erase Function to erase the region.
+ *
+ * @return 0 if the region was erased or an error code.
+ */
+static int flash_cache_erase_region (const struct flash_cache *cache, uint32_t address,
+	int (*get_size) (const struct flash*, uint32_t*), int (*erase) (const struct flash*, uint32_t))
+{
+	uint32_t erase_size;
+	int status;
+
+	platform_mutex_lock (&cache->state->lock);
+
+	status = erase (cache->flash, address);
+
+	if (get_size (cache->flash, &erase_size) == 0) {
+		flash_cache_invalidate_region (cache, FLASH_REGION_BASE (address, erase_size), erase_size);
+	}
+	else {
+		flash_cache_invalidate_all (cache);
+	}
+
+	platform_mutex_unlock (&cache->state->lock);
+
+	return status;
+}
+
+int flash_cache_sector_erase (const struct flash *flash, uint32_t sector_addr)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	return flash_cache_erase_region (cache, sector_addr, cache->flash->get_sector_size,
+		cache->flash->sector_erase);
+}
+
+int flash_cache_get_block_size (const struct flash *flash, uint32_t *bytes)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	return cache->flash->get_block_size (cache->flash, bytes);
+}
+
+int flash_cache_block_erase (const struct flash *flash, uint32_t block_addr)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	return flash_cache_erase_region (cache, block_addr, cache->flash->get_block_size,
+		cache->flash->block_erase);
+}
+
+int flash_cache_chip_erase (const struct flash *flash)
+{
+	const struct flash_cache *cache = (const struct flash_cache*) flash;
+	int status;
+
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&cache->state->lock);
+
+	status = cache->flash->chip_erase (cache->flash);
+	flash_cache_invalidate_all (cache);
+
+	platform_mutex_unlock (&cache->state->lock);
+
+	return status;
+}
+
+/**
+ * Initialize a cache for reading data from a flash device.
+ *
+ * @param cache The flash cache to initialize.
+ * @param state Variable context for the cache.  This must be uninitialized.
+ * @param flash The flash device to cache.
+ * @param lines Metadata storage for the cache lines.  There must be one entry for each line.
+ * @param data Storage for the cached data.  This must be line_count * line_size bytes.
+ * @param line_count The number of cache lines.
+ * @param line_size The number of bytes in each cache line.  This must be a power of 2.
+ *
+ * @return 0 if the cache was successfully initialized or an error code.
+ */
+int flash_cache_init (struct flash_cache *cache, struct flash_cache_state *state,
+	const struct flash *flash, struct flash_cache_line *lines, uint8_t *data, size_t line_count,
+	size_t line_size)
+{
+	if (cache == NULL) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	memset (cache, 0, sizeof (struct flash_cache));
+
+	cache->base.get_device_size = flash_cache_get_device_size;
+	cache->base.read = flash_cache_read;
+	cache->base.get_page_size = flash_cache_get_page_size;
+	cache->base.minimum_write_per_page = flash_cache_minimum_write_per_page;
+	cache->base.write = flash_cache_write;
+	cache->base.get_sector_size = flash_cache_get_sector_size;
+	cache->base.sector_erase = flash_cache_sector_erase;
+	cache->base.get_block_size = flash_cache_get_block_size;
+	cache->base.block_erase = flash_cache_block_erase;
+	cache->base.chip_erase = flash_cache_chip_erase;
+
+	cache->state = state;
+	cache->flash = flash;
+	cache->lines = lines;
+	cache->data = data;
+	cache->line_count = line_count;
+	cache->line_size = line_size;
+
+	return flash_cache_init_state (cache);
+}
+
+/**
+ * Initialize only the variable state for a flash cache.  The rest of the cache instance is assumed
+ * to have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param cache The flash cache that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int flash_cache_init_state (const struct flash_cache *cache)
+{
+	if ((cache == NULL) || (cache->state == NULL) || (cache->flash == NULL) ||
+		(cache->lines == NULL) || (cache->data == NULL) || (cache->line_count == 0) ||
+		(cache->line_size == 0)) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	if ((cache->line_size & (cache->line_size - 1)) != 0) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	memset (cache->state, 0, sizeof (struct flash_cache_state));
+	memset (cache->lines, 0, sizeof (struct flash_cache_line) * cache->line_count);
+
+	return platform_mutex_init (&cache->state->lock);
+}
+
+/**
+ * Release the resources used by a flash cache.
+ *
+ * @param cache The flash cache to release.
+ */
+void flash_cache_release (const struct flash_cache *cache)
+{
+	if (cache) {
+		platform_mutex_free (&cache->state->lock);
+	}
+}
+
+/**
+ * Remove all cached data.  This must be called if the contents of the flash device could have been
+ * changed without using the cache.
+ *
+ * @param cache The flash cache to invalidate.
+ */
+void flash_cache_invalidate (const struct flash_cache *cache)
+{
+	if (cache) {
+		platform_mutex_lock (&cache->state->lock);
+		flash_cache_invalidate_all (cache);
+		platform_mutex_unlock (&cache->state->lock);
+	}
+}
+
+/**
+ * Get the read statistics for a flash cache.
+ *
+ * @param cache The flash cache to query.
+ * @param stats Output for the cache statistics.
+ *
+ * @return 0 if the statistics were retrieved or an error code.
+ */
+int flash_cache_get_stats (const struct flash_cache *cache, struct flash_cache_stats *stats)
+{
+	if ((cache == NULL) || (stats == NULL)) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&cache->state->lock);
+	*stats = cache->state->stats;
+	platform_mutex_unlock (&cache->state->lock);
+
+	return 0;
+}
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef FLASH_CACHE_H_
+#define FLASH_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "platform_api.h"
+#include "flash.h"
+
+
+/**
+ * Metadata for a single line of cached flash data.
+ */
+struct flash_cache_line {
+	uint32_t addr;					/**< Flash address of the first byte in the line. */
+	uint32_t last_used;				/**< Access sequence number when the line was last used. */
+	size_t length;					/**< Number of valid bytes in the line.  0 if the line is empty. */
+};
+
+/**
+ * Read statistics for a flash cache.
+ */
+struct flash_cache_stats {
+	uint32_t hits;					/**< Number of line accesses served from the cache. */
+	uint32_t misses;				/**< Number of line accesses that required a read from flash. */
+	uint32_t uncached;				/**< Number of reads large enough to bypass the cache. */
+};
+
+/**
+ * Variable context for a flash cache.
+ */
+struct flash_cache_state {
+	platform_mutex lock;			/**< Synchronization for cache accesses. */
+	uint32_t access_count;			/**< Sequence number for tracking line usage. */
+	uint32_t device_size;			/**< Size of the flash device.  0 if not yet known. */
+	struct flash_cache_stats stats;	/**< Read statistics for the cache. */
+};
+
+/**
+ * A flash wrapper that caches data read from another flash device.  Small reads are served from a
+ * set of aligned lines that are read from flash in a single transfer and replaced in least recently
+ * used order.  This reduces the number of flash transactions for consumers that parse data with
+ * many small reads at nearby addresses.
+ *
+ * Reads that are at least as large as a cache line are passed directly to the flash device.  Writes
+ * and erases are passed to the flash device and invalidate any affected cache lines.
+ *
+ * Changes made to the flash device without going through the cache will not be detected.  The
+ * cache must be invalidated in that case.
+ */
+struct flash_cache {
+	struct flash base;				/**< Base flash API. */
+	struct flash_cache_state *state;	/**< Variable context for the cache. */
+	const struct flash *flash;		/**< The flash device being cached. */
+	struct flash_cache_line *lines;	/**< Metadata for each cache line. */
+	uint8_t *data;					/**< Storage for cached data.  Holds line_count * line_size bytes. */
+	size_t line_count;				/**< Number of cache lines. */
+	size_t line_size;				/**< Number of bytes in each cache line.  This must be a power of 2. */
+};
+
+
+int flash_cache_init (struct flash_cache *cache, struct flash_cache_state *state,
+	const struct flash *flash, struct flash_cache_line *lines, uint8_t *data, size_t line_count,
+	size_t line_size);
+int flash_cache_init_state (const struct flash_cache *cache);
+void flash_cache_release (const struct flash_cache *cache);
+
+void flash_cache_invalidate (const struct flash_cache *cache);
+int flash_cache_get_stats (const struct flash_cache *cache, struct flash_cache_stats *stats);
+
+
+#endif /* FLASH_CACHE_H_ */
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef FLASH_CACHE_STATIC_H_
+#define FLASH_CACHE_STATIC_H_
+
+#include "flash_cache.h"
+
+
+/* Internal functions declared to allow for static initialization. */
+int flash_cache_get_device_size (const struct flash *flash, uint32_t *bytes);
+int flash_cache_read (const struct flash *flash, uint32_t address, uint8_t *data, size_t length);
+int flash_cache_get_page_size (const struct flash *flash, uint32_t *bytes);
+int flash_cache_minimum_write_per_page (const struct flash *flash, uint32_t *bytes);
+int flash_cache_write (const struct flash *flash, uint32_t address, const uint8_t *data,
+	size_t length);
+int flash_cache_get_sector_size (const struct flash *flash, uint32_t *bytes);
+int flash_cache_sector_erase (const struct flash *flash, uint32_t sector_addr);
+int flash_cache_get_block_size (const struct flash *flash, uint32_t *bytes);
+int flash_cache_block_erase (const struct flash *flash, uint32_t block_addr);
+int flash_cache_chip_erase (const struct flash *flash);
+
+
+/**
+ * Constant initializer for the flash API.
+ */
+#define	FLASH_CACHE_API_INIT  { \
+		.get_device_size = flash_cache_get_device_size, \
+		.read = flash_cache_read, \
+		.get_page_size = flash_cache_get_page_size, \
+		.minimum_write_per_page = flash_cache_minimum_write_per_page, \
+		.write = flash_cache_write, \
+		.get_sector_size = flash_cache_get_sector_size, \
+		.sector_erase = flash_cache_sector_erase, \
+		.get_block_size = flash_cache_get_block_size, \
+		.block_erase = flash_cache_block_erase, \
+		.chip_erase = flash_cache_chip_erase \
+	}
+
+
+/**
+ * Initialize a static instance of a flash cache.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the cache.
+ * @param flash_ptr The flash device to cache.
+ * @param lines_ptr Metadata storage for the cache lines.  There must be one entry for each line.
+ * @param data_ptr Storage for the cached data.  This must be num_lines * size_line bytes.
+ * @param num_lines The number of cache lines.
+ * @param size_line The number of bytes in each cache line.  This must be a power of 2.
+ */
+#define	flash_cache_static_init(state_ptr, flash_ptr, lines_ptr, data_ptr, num_lines, \
+	size_line)	{ \
+		.base = FLASH_CACHE_API_INIT, \
+		.state = state_ptr, \
+		.flash = flash_ptr, \
+		.lines = lines_ptr, \
+		.data = data_ptr, \
+		.line_count = num_lines, \
+		.line_size = size_line \
+	}
+
+
+#endif /* FLASH_CACHE_STATIC_H_ */
@@ -11,7 +11,9 @@
 
 
 /**
- * Get the flash store instance which has the block ID.
+ * Get the flash store instance which has the block ID.  If the aggregator has a populated index
+ * entry for the block, the flash store is determined directly from the index.  Otherwise, each
+ * flash store is queried in order until the block is found.
  *
  * @param flash_aggregator Agggregator that manages arbitary num of flash stores.
  * @param id Block ID of the data.
@@ -29,6 +31,14 @@ static int flash_store_aggregator_get_flash_store_and_block_index (
 	const struct flash_store *const *flash_store_array = flash_aggregator->flash_store_array;
 	int status = FLASH_STORE_UNSUPPORTED_ID;
 
+	if ((flash_aggregator->block_index != NULL) && (id >= 0) &&
+		((size_t) id < flash_aggregator->index_length) &&
+		flash_aggregator->block_index[id].valid) {
+		*flash_store = flash_store_array[flash_aggregator->block_index[id].store];
+		*block_index = flash_aggregator->block_index[id].index;
+		return 0;
+	}
+
 	while (iterator < flash_aggregator->flash_store_cnt) {
 		if (flash_store_array[iterator] == NULL) {
 			status = FLASH_STORE_NO_STORAGE;
@@ -300,6 +310,43 @@ int flash_store_aggregator_init (struct flash_store_aggregator *aggregator,
 	return 0;
 }
 
+/**
+ * Initialize a flash storage aggregator that uses an index to map block IDs to flash stores.
+ * flash_store_aggregator_build_index must be called before the index will be used.  Until then,
+ * block lookups will query each flash store for the number of blocks it contains.
+ *
+ * @param aggregator The flash storage aggregator to initialize.
+ * @param flash_store_array Array that holds flash store instances.
+ * @param flash_store_cnt Max number of flash store instances of flash_store_array.
+ * @param block_index Storage for the block index.  There should be one entry for each block in
+ * all the aggregated flash stores.
+ * @param index_length The number of entries available in the block index.
+ *
+ * @return 0 if the flash storage was successfully initialized or an error code.
+ */
+int flash_store_aggregator_init_indexed (struct flash_store_aggregator *aggregator,
+	const struct flash_store *const *flash_store_array, size_t flash_store_cnt,
+	struct flash_store_aggregator_block *block_index, size_t index_length)
+{
+	int status;
+
+	if ((block_index == NULL) || (index_length == 0)) {
+		return FLASH_STORE_INVALID_ARGUMENT;
+	}
+
+	status = flash_store_aggregator_init (aggregator, flash_store_array, flash_store_cnt);
+	if (status != 0) {
+		return status;
+	}
+
+	memset (block_index, 0, sizeof (struct flash_store_aggregator_block) * index_length);
+
+	aggregator->block_index = block_index;
+	aggregator->index_length = index_length;
+
+	return 0;
+}
+
 /**
  * Release the resources used for flash store aggregator.
  *
@@ -309,3 +356,60 @@ void flash_store_aggregator_release (const struct flash_store_aggregator *aggreg
 {
 	UNUSED (aggregator);
 }
+
+/**
+ * Populate the block index for a flash store aggregator.  The number of blocks in each flash store
+ * is queried once, and every block ID is mapped to the flash store that contains it.  Block
+ * lookups will not need to query the flash stores once the index has been built.
+ *
+ * The index must be rebuilt if the number of blocks in any of the flash stores changes.
+ *
+ * @param aggregator The flash store aggregator to index.
+ *
+ * @return 0 if the index was successfully built or an error code.  If the index is not large
+ * enough for all blocks, FLASH_STORE_INSUFFICIENT_STORAGE will be returned.  In any failure case,
+ * lookups for blocks that could not be added to the index will query the flash stores directly.
+ */
+int flash_store_aggregator_build_index (const struct flash_store_aggregator *aggregator)
+{
+	const struct flash_store *flash;
+	size_t id = 0;
+	size_t loop;
+	int num_blocks;
+	int i;
+
+	if ((aggregator == NULL) || (aggregator->block_index == NULL)) {
+		return FLASH_STORE_INVALID_ARGUMENT;
+	}
+
+	if (aggregator->flash_store_cnt > (UINT8_MAX + 1)) {
+		return FLASH_STORE_INSUFFICIENT_STORAGE;
+	}
+
+	memset (aggregator->block_index, 0,
+		sizeof (struct flash_store_aggregator_block) * aggregator->index_length);
+
+	for (loop = 0; loop < aggregator->flash_store_cnt; loop++) {
+		flash = aggregator->flash_store_array[loop];
+		if (flash == NULL) {
+			return FLASH_STORE_NO_STORAGE;
+		}
+
+		num_blocks = flash->get_num_blocks (flash);
+		if (ROT_IS_ERROR (num_blocks)) {
+			return num_blocks;
+		}
+
+		if (((id + num_blocks) > aggregator->index_length) || (num_blocks > (UINT16_MAX + 1))) {
+			return FLASH_STORE_INSUFFICIENT_STORAGE;
+		}
+
+		for (i = 0; i < num_blocks; i++, id++) {
+			aggregator->block_index[id].store = loop;
+			aggregator->block_index[id].index = i;
+			aggregator->block_index[id].valid = 1;
+		}
+	}
+
+	return 0;
+}
@@ -10,6 +10,16 @@
 #include "flash_store.h"
 
 
+/**
+ * Entry in the block index of a flash store aggregator.  Each entry maps one aggregated block ID
+ * to the flash store that contains the block.
+ */
+struct flash_store_aggregator_block {
+	uint8_t valid;										/**< Flag indicating the entry has been populated. */
+	uint8_t store;										/**< Index of the flash store containing the block. */
+	uint16_t index;										/**< Block ID relative to the flash store. */
+};
+
 /**
  * Manages an arbitary number of flash store instances. Aggregates the flash store instances
  * and translates the requested ID to the correct flash_store.
@@ -18,11 +28,18 @@ struct flash_store_aggregator {
 	struct flash_store base;							/**< Base flash_store. */
 	const struct flash_store *const *flash_store_array;	/**< Flash device used for storage. */
 	size_t flash_store_cnt;								/**< Holds the count of number of flash stores. */
+	struct flash_store_aggregator_block *block_index;	/**< Optional mapping of block IDs to flash stores. */
+	size_t index_length;								/**< Number of entries in the block index. */
 };
 
 int flash_store_aggregator_init (struct flash_store_aggregator *aggregator,
 	const struct flash_store *const *flash_store_array, size_t flash_store_cnt);
+int flash_store_aggregator_init_indexed (struct flash_store_aggregator *aggregator,
+	const struct flash_store *const *flash_store_array, size_t flash_store_cnt,
+	struct flash_store_aggregator_block *block_index, size_t index_length);
 void flash_store_aggregator_release (const struct flash_store_aggregator *aggregator);
 
+int flash_store_aggregator_build_index (const struct flash_store_aggregator *aggregator);
+
 
 #endif /* FLASH_STORE_AGGREGATOR_H_*/
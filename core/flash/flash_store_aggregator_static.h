@@ -48,7 +48,29 @@ int flash_store_aggregtor_get_num_blocks (const struct flash_store *flash_store)
 #define	flash_store_aggregator_static_init(flash_store_array_ptr, flash_store_array_cnt) { \
 		.base = FLASH_STORE_AGGREGATOR_API_INIT, \
 		.flash_store_array = flash_store_array_ptr, \
-		.flash_store_cnt = flash_store_array_cnt \
+		.flash_store_cnt = flash_store_array_cnt, \
+		.block_index = NULL, \
+		.index_length = 0 \
+	}
+
+/**
+ * Initialize a static instance of a flash store aggregator that uses an index to map block IDs to
+ * flash stores.  flash_store_aggregator_build_index must be called before the index is used.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param flash_store_array_ptr pointer to the array that holds flash store instances.
+ * @param flash_store_array_cnt Max number of flash store instances of flash_store_array.
+ * @param block_index_ptr Storage for the block index.  This must be zero initialized.
+ * @param block_index_len The number of entries available in the block index.
+ */
+#define	flash_store_aggregator_static_init_indexed(flash_store_array_ptr, flash_store_array_cnt, \
+	block_index_ptr, block_index_len)	{ \
+		.base = FLASH_STORE_AGGREGATOR_API_INIT, \
+		.flash_store_array = flash_store_array_ptr, \
+		.flash_store_cnt = flash_store_array_cnt, \
+		.block_index = block_index_ptr, \
+		.index_length = block_index_len \
 	}
 
 
@@ -46,6 +46,56 @@ int flash_store_contiguous_blocks_verify_write_params (
 	return 0;
 }
 
+/**
+ * Update the directory entry for a block of variable length storage.  Nothing is done if there is
+ * no directory for the flash store.
+ *
+ * @param flash The flash store to update.
+ * @param id Block ID to update.
+ * @param status The new status of the block.
+ * @param header Header information for the block data.  This is only used for valid blocks.
+ */
+static void flash_store_contiguous_blocks_update_directory (
+	const struct flash_store_contiguous_blocks *flash, int id,
+	enum flash_store_contiguous_blocks_entry_status status,
+	const struct flash_store_header *header)
+{
+	struct flash_store_contiguous_blocks_entry *entry;
+
+	if (flash->state->directory == NULL) {
+		return;
+	}
+
+	entry = &flash->state->directory[id];
+	if (status == FLASH_STORE_BLOCK_VALID) {
+		entry->length = header->length;
+		entry->header_len = header->header_len;
+	}
+	entry->status = status;
+}
+
+/**
+ * Set the status of all blocks in the flash store directory.  Nothing is done if there is no
+ * directory for the flash store.
+ *
+ * @param flash The flash store to update.
+ * @param status The new status for every block.
+ */
+static void flash_store_contiguous_blocks_set_directory (
+	const struct flash_store_contiguous_blocks *flash,
+	enum flash_store_contiguous_blocks_entry_status status)
+{
+	uint32_t i;
+
+	if (flash->state->directory == NULL) {
+		return;
+	}
+
+	for (i = 0; i < flash->state->blocks; i++) {
+		flash->state->directory[i].status = status;
+	}
+}
+
 /**
  * Write a block of data to flash, including any data for internal use.  Parameters must have been
  * prevalidated.
@@ -73,6 +123,8 @@ int flash_store_contiguous_blocks_write_common (const struct flash_store_contigu
 	}
 	offset = base_offset;
 
+	flash_store_contiguous_blocks_update_directory (flash, id, FLASH_STORE_BLOCK_UNKNOWN, NULL);
+
 	status = flash_sector_erase_region (flash->flash, flash->base_addr + base_offset,
 		flash->state->block_size);
 	if (status != 0) {
@@ -246,6 +298,18 @@ int flash_store_contiguous_blocks_write_common (const struct flash_store_contigu
 		}
 	}
 
+	if (flash->variable) {
+		struct flash_store_header header = {
+			.header_len = (flash->state->old_header) ? sizeof (uint16_t) :
+				FLASH_STORE_HEADER_LENGTH,
+			.marker = FLASH_STORE_HEADER_MARKER,
+			.length = length
+		};
+
+		flash_store_contiguous_blocks_update_directory (flash, id, FLASH_STORE_BLOCK_VALID,
+			&header);
+	}
+
 	return 0;
 }
 
@@ -329,6 +393,53 @@ static int flash_store_contiguous_blocks_read_header (
 	return 0;
 }
 
+/**
+ * Get the header for a block of variable length data.  If the flash store has a directory, the
+ * header information will be retrieved from the directory instead of flash when possible.
+ *
+ * @param flash The flash store that manages contiguous blocks of memory.
+ * @param id Block ID of the data.
+ * @param offset Address offset of the data block.
+ * @param header Output for the header data.
+ *
+ * @return 0 if the header is valid or an error code.
+ */
+static int flash_store_contiguous_blocks_get_header (
+	const struct flash_store_contiguous_blocks *flash, int id, int offset,
+	struct flash_store_header *header)
+{
+	struct flash_store_contiguous_blocks_entry *entry;
+	int status;
+
+	if (flash->state->directory != NULL) {
+		entry = &flash->state->directory[id];
+
+		switch (entry->status) {
+			case FLASH_STORE_BLOCK_VALID:
+				header->header_len = entry->header_len;
+				header->marker = FLASH_STORE_HEADER_MARKER;
+				header->length = entry->length;
+				return 0;
+
+			case FLASH_STORE_BLOCK_EMPTY:
+				return FLASH_STORE_NO_DATA;
+
+			default:
+				break;
+		}
+	}
+
+	status = flash_store_contiguous_blocks_read_header (flash, offset, header);
+	if (status == 0) {
+		flash_store_contiguous_blocks_update_directory (flash, id, FLASH_STORE_BLOCK_VALID, header);
+	}
+	else if (status == FLASH_STORE_NO_DATA) {
+		flash_store_contiguous_blocks_update_directory (flash, id, FLASH_STORE_BLOCK_EMPTY, NULL);
+	}
+
+	return status;
+}
+
 /**
  * Read a block of data from flash.
  *
@@ -370,7 +481,7 @@ int flash_store_contiguous_blocks_read_common (const struct flash_store_contiguo
 	if (flash->variable) {
 		struct flash_store_header header;
 
-		status = flash_store_contiguous_blocks_read_header (flash, offset, &header);
+		status = flash_store_contiguous_blocks_get_header (flash, id, offset, &header);
 		if (status != 0) {
 			return status;
 		}
@@ -445,6 +556,7 @@ int flash_store_contiguous_blocks_read_with_hash (const struct flash_store *flas
 int flash_store_contiguous_blocks_erase (const struct flash_store *flash_store, int id)
 {
 	int offset;
+	int status;
 	const struct flash_store_contiguous_blocks *flash =
 		(const struct flash_store_contiguous_blocks*) flash_store;
 
@@ -461,13 +573,21 @@ int flash_store_contiguous_blocks_erase (const struct flash_store *flash_store,
 		offset = -offset;
 	}
 
-	return flash_sector_erase_region_and_verify (flash->flash, flash->base_addr + offset,
+	flash_store_contiguous_blocks_update_directory (flash, id, FLASH_STORE_BLOCK_UNKNOWN, NULL);
+
+	status = flash_sector_erase_region_and_verify (flash->flash, flash->base_addr + offset,
 		flash->state->block_size);
+	if (status == 0) {
+		flash_store_contiguous_blocks_update_directory (flash, id, FLASH_STORE_BLOCK_EMPTY, NULL);
+	}
+
+	return status;
 }
 
 int flash_store_contiguous_blocks_erase_all (const struct flash_store *flash_store)
 {
 	int offset = 0;
+	int status;
 	const struct flash_store_contiguous_blocks *flash =
 		(const struct flash_store_contiguous_blocks*) flash_store;
 
@@ -479,8 +599,15 @@ int flash_store_contiguous_blocks_erase_all (const struct flash_store *flash_sto
 		offset = flash->state->block_size * (flash->state->blocks - 1);
 	}
 
-	return flash_sector_erase_region_and_verify (flash->flash, flash->base_addr - offset,
+	flash_store_contiguous_blocks_set_directory (flash, FLASH_STORE_BLOCK_UNKNOWN);
+
+	status = flash_sector_erase_region_and_verify (flash->flash, flash->base_addr - offset,
 		flash->state->block_size * flash->state->blocks);
+	if (status == 0) {
+		flash_store_contiguous_blocks_set_directory (flash, FLASH_STORE_BLOCK_EMPTY);
+	}
+
+	return status;
 }
 
 int flash_store_contiguous_blocks_get_data_length (const struct flash_store *flash_store, int id)
@@ -506,7 +633,7 @@ int flash_store_contiguous_blocks_get_data_length (const struct flash_store *fla
 			offset = -offset;
 		}
 
-		status = flash_store_contiguous_blocks_read_header (flash, offset, &header);
+		status = flash_store_contiguous_blocks_get_header (flash, id, offset, &header);
 		if (status != 0) {
 			return status;
 		}
@@ -541,7 +668,7 @@ int flash_store_contiguous_blocks_has_data_stored (const struct flash_store *fla
 			offset = -offset;
 		}
 
-		status = flash_store_contiguous_blocks_read_header (flash, offset, &header);
+		status = flash_store_contiguous_blocks_get_header (flash, id, offset, &header);
 		switch (status) {
 			case 0:
 				return 1;
@@ -957,3 +1084,68 @@ void flash_store_contiguous_blocks_use_length_only_header
 		store->state->old_header = true;
 	}
 }
+
+/**
+ * Build a directory of the data stored in each block of variable length storage.  The header of
+ * every block is read once from flash and kept in the directory.  Subsequent requests for the data
+ * length or whether data is stored will be handled from the directory without accessing flash.
+ * The directory is kept up to date as blocks are written and erased through the flash store.
+ *
+ * Fixed length storage does not need to read any block information from flash, so no directory
+ * will be used for these flash stores.
+ *
+ * If the flash store state is re-initialized, the directory must be built again.
+ *
+ * @param store The flash storage that will use the directory.
+ * @param directory Storage for the directory.  There must be one entry for each block.
+ * @param entries The number of entries available in the directory.
+ *
+ * @return 0 if the directory was built successfully or an error code.
+ */
+int flash_store_contiguous_blocks_build_directory (
+	const struct flash_store_contiguous_blocks *store,
+	struct flash_store_contiguous_blocks_entry *directory, size_t entries)
+{
+	struct flash_store_header header;
+	uint32_t i;
+	int offset;
+	int status;
+
+	if ((store == NULL) || (directory == NULL)) {
+		return FLASH_STORE_INVALID_ARGUMENT;
+	}
+
+	if (!store->variable) {
+		return 0;
+	}
+
+	if (entries < store->state->blocks) {
+		return FLASH_STORE_BUFFER_TOO_SMALL;
+	}
+
+	store->state->directory = NULL;
+
+	for (i = 0; i < store->state->blocks; i++) {
+		offset = i * store->state->block_size;
+		if (store->decreasing) {
+			offset = -offset;
+		}
+
+		status = flash_store_contiguous_blocks_read_header (store, offset, &header);
+		if (status == 0) {
+			directory[i].length = header.length;
+			directory[i].header_len = header.header_len;
+			directory[i].status = FLASH_STORE_BLOCK_VALID;
+		}
+		else if (status == FLASH_STORE_NO_DATA) {
+			directory[i].status = FLASH_STORE_BLOCK_EMPTY;
+		}
+		else {
+			return status;
+		}
+	}
+
+	store->state->directory = directory;
+
+	return 0;
+}
@@ -26,6 +26,24 @@ struct flash_store_header {
 #define	FLASH_STORE_HEADER_LENGTH		(sizeof (struct flash_store_header))
 #define	FLASH_STORE_HEADER_MIN_LENGTH	4
 
+/**
+ * Status of a block in the flash store directory.
+ */
+enum flash_store_contiguous_blocks_entry_status {
+	FLASH_STORE_BLOCK_UNKNOWN = 0,	/**< The block contents must be checked in flash. */
+	FLASH_STORE_BLOCK_EMPTY,		/**< The block does not contain valid data. */
+	FLASH_STORE_BLOCK_VALID,		/**< The block contains valid data. */
+};
+
+/**
+ * Information about the data stored in a single block of variable length storage.
+ */
+struct flash_store_contiguous_blocks_entry {
+	uint16_t length;				/**< Length of the data stored in the block. */
+	uint8_t header_len;				/**< Length of the header on the stored data. */
+	uint8_t status;					/**< Status of the block contents. */
+};
+
 /**
  * Variable context for a flash store instance.
  */
@@ -39,6 +57,7 @@ struct flash_store_contiguous_blocks_state {
 	platform_mutex lock;		/**< Page buffer synchronization. */
 #endif
 	bool old_header;			/**< Flag indicating variable storage header only saves the length. */
+	struct flash_store_contiguous_blocks_entry *directory;	/**< Cached block header information. */
 };
 
 /**
@@ -80,6 +99,9 @@ void flash_store_contiguous_blocks_release (const struct flash_store_contiguous_
 
 void flash_store_contiguous_blocks_use_length_only_header (
 	struct flash_store_contiguous_blocks *store);
+int flash_store_contiguous_blocks_build_directory (
+	const struct flash_store_contiguous_blocks *store,
+	struct flash_store_contiguous_blocks_entry *directory, size_t entries);
 
 /* Internal functions for use by derived types. */
 int flash_store_contiguous_blocks_init_state_common (
@@ -5,6 +5,7 @@
 #include "platform_api.h"
 #include "flash_util.h"
 #include "flash_common.h"
+#include "logging/trace_ring.h"
 
 
 /**
@@ -445,7 +446,9 @@ int flash_hash_update_noncontiguous_contents_at_offset (const struct flash *flas
 				return status;
 			}
 
+			TRACE_RING_BEGIN (TRACE_RING_POINT_HASH_UPDATE, next_read);
 			status = hash->update (hash, data, next_read);
+			TRACE_RING_END (TRACE_RING_POINT_HASH_UPDATE, status);
 			if (status != 0) {
 				return status;
 			}
@@ -540,6 +543,114 @@ int flash_sector_erase_region (const struct flash *flash, uint32_t start_addr, s
 		flash->sector_erase);
 }
 
+/**
+ * Determine the most efficient way to erase the next part of a flash region.
+ *
+ * @param addr The sector aligned address of the next data to erase.
+ * @param remaining The number of bytes that still need to be erased, starting from the address.
+ * @param sector The sector size of the flash.
+ * @param block The block size of the flash.  If this is the same as the sector size, only sector
+ * erase operations will be used.
+ * @param block_erase Output indicating if the next operation should be a block erase.
+ *
+ * @return The number of bytes from the address that will be cleared by the next erase operation.
+ * For a block erase that starts before the address, this only includes the bytes in the block after
+ * the address.
+ */
+static size_t flash_mixed_erase_next (uint32_t addr, size_t remaining, uint32_t sector,
+	uint32_t block, bool *block_erase)
+{
+	size_t in_block = block - FLASH_REGION_OFFSET (addr, block);
+	size_t span = (remaining < in_block) ? remaining : in_block;
+	size_t sectors;
+
+	if (block == sector) {
+		*block_erase = false;
+		return sector;
+	}
+
+	if (span == block) {
+		*block_erase = true;
+		return block;
+	}
+
+	/* Only part of the block needs to be erased.  Pick whichever option takes the least time. */
+	sectors = (span + (sector - 1)) / sector;
+	if (sectors >= FLASH_MIXED_ERASE_SECTOR_LIMIT) {
+		*block_erase = true;
+		return in_block;
+	}
+
+	*block_erase = false;
+	return sector;
+}
+
+/**
+ * Erase a region of flash using a combination of block and sector erase operations.  Blocks that
+ * are fully covered by the region are erased with a single block erase.  Partial blocks at the
+ * start or end of the region are erased with sector erases unless it would be faster to erase the
+ * entire block.
+ *
+ * The erasure will never extend outside the flash blocks that contain the region, so the region
+ * may be treated the same as for flash_erase_region.  The amount of data erased outside the region
+ * will often be much less.
+ *
+ * @param flash The flash device to erase.
+ * @param start_addr The starting address of the region to erase.  The erase operation will start
+ * no later than the beginning of the flash sector that contains the starting address.
+ * @param length The number of bytes to erase starting from start_addr.  Any additional data that
+ * needs to be erased to align to erase boundaries does not count toward this length.
+ *
+ * @return 0 if the region was successfully erased or an error code.
+ */
+int flash_mixed_erase_region (const struct flash *flash, uint32_t start_addr, size_t length)
+{
+	uint32_t sector;
+	uint32_t block;
+	size_t erased;
+	bool block_erase;
+	int status;
+
+	if (flash == NULL) {
+		return FLASH_UTIL_INVALID_ARGUMENT;
+	}
+
+	status = flash->get_sector_size (flash, &sector);
+	if (status != 0) {
+		return status;
+	}
+
+	status = flash->get_block_size (flash, &block);
+	if (status != 0) {
+		return status;
+	}
+
+	if ((block <= sector) || (FLASH_REGION_OFFSET (block, sector) != 0)) {
+		/* Blocks that can't be divided into sectors can't be mixed.  Only use sector erase. */
+		block = sector;
+	}
+
+	if (length != 0) {
+		length += FLASH_REGION_OFFSET (start_addr, sector);
+		start_addr = FLASH_REGION_BASE (start_addr, sector);
+	}
+
+	while ((status == 0) && (length != 0)) {
+		erased = flash_mixed_erase_next (start_addr, length, sector, block, &block_erase);
+		if (block_erase) {
+			status = flash->block_erase (flash, FLASH_REGION_BASE (start_addr, block));
+		}
+		else {
+			status = flash->sector_erase (flash, start_addr);
+		}
+
+		length -= ((length > erased) ? erased : length);
+		start_addr += erased;
+	}
+
+	return status;
+}
+
 /**
  * Check a region of flash to ensure it contains the expected data.
  *
@@ -681,6 +792,24 @@ int flash_sector_erase_region_and_verify (const struct flash *flash, uint32_t st
 	return flash_erase_region_and_verify_ext (flash, start_addr, length, flash_sector_erase_region);
 }
 
+/**
+ * Erase a region of flash and check that the contents are blank.  The erasure will use a mix of
+ * block and sector erase operations, as done by flash_mixed_erase_region.
+ *
+ * @param flash The flash device to erase.
+ * @param start_addr The starting address of the region to erase.  The erase operation will start
+ * no later than the beginning of the flash sector that contains the starting address.
+ * @param length The number of bytes to erase starting from start_addr.  Any additional data that
+ * needs to be erased to align to erase boundaries does not count toward this length.
+ *
+ * @return 0 if the region was successfully erased or an error code.
+ */
+int flash_mixed_erase_region_and_verify (const struct flash *flash, uint32_t start_addr,
+	size_t length)
+{
+	return flash_erase_region_and_verify_ext (flash, start_addr, length, flash_mixed_erase_region);
+}
+
 /**
  * Program a block of data to a flash device after first erasing the region to be programmed.
  *
@@ -1410,3 +1539,228 @@ int flash_copy_ext_to_blank_and_verify (const struct flash *dest_flash, uint32_t
 {
 	return flash_copy_data_region (dest_flash, dest_addr, src_flash, src_addr, length, NULL, 1);
 }
+
+/**
+ * Copy data from one flash location to another, only updating the destination sectors that do not
+ * already contain the source data.  Each destination sector is compared against the source before
+ * any erase is issued.  Sectors that differ will be erased, blank checked, and programmed.
+ *
+ * Erase blocks are on 4kB boundaries.
+ *
+ * @param dest_flash The flash device to copy data to.
+ * @param dest_addr The starting address of the region to copy to.
+ * @param src_flash The flash device to copy data from.
+ * @param src_addr The starting address of the region to copy from.
+ * @param length The size of the region to copy.
+ * @param skipped Optional output for the number of sectors that already contained the source data
+ * and were not modified.  This can be null if the count is not needed.
+ * @param verify Flag indicating if the copy should be verified after the data has been written to
+ * the destination.
+ *
+ * @return 0 if the data was successfully copied or an error code.
+ */
+static int flash_sector_copy_data_region_differential (const struct flash *dest_flash,
+	uint32_t dest_addr, const struct flash *src_flash, uint32_t src_addr, size_t length,
+	size_t *skipped, uint8_t verify)
+{
+	uint32_t sector;
+	uint32_t page;
+	size_t same = 0;
+	size_t sector_len;
+	int status;
+
+	if (skipped) {
+		*skipped = 0;
+	}
+
+	if ((dest_flash == NULL) || (src_flash == NULL)) {
+		return FLASH_UTIL_INVALID_ARGUMENT;
+	}
+
+	if (length == 0) {
+		return 0;
+	}
+
+	status = dest_flash->get_sector_size (dest_flash, &sector);
+	if (status != 0) {
+		return status;
+	}
+
+	if (dest_flash == src_flash) {
+		status = flash_check_copy_region (dest_addr, src_addr, length, FLASH_REGION_MASK (sector));
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	status = dest_flash->get_page_size (dest_flash, &page);
+	if (status != 0) {
+		return status;
+	}
+
+	if (page > FLASH_MAX_COPY_BLOCK) {
+		return FLASH_UTIL_UNSUPPORTED_PAGE_SIZE;
+	}
+
+	while (length != 0) {
+		sector_len = sector - FLASH_REGION_OFFSET (dest_addr, sector);
+		sector_len = (length > sector_len) ? sector_len : length;
+
+		status = flash_verify_copy_ext (dest_flash, dest_addr, src_flash, src_addr, sector_len);
+		if (status == 0) {
+			same++;
+		}
+		else if (status == FLASH_UTIL_DATA_MISMATCH) {
+			status = dest_flash->sector_erase (dest_flash, dest_addr);
+			if (status == 0) {
+				status = flash_blank_check (dest_flash, dest_addr, sector_len);
+			}
+			if (status != 0) {
+				return status;
+			}
+
+			status = flash_copy_data_to_blank_region (dest_flash, dest_addr, src_flash, src_addr,
+				sector_len, page, verify);
+			if (status != 0) {
+				return status;
+			}
+		}
+		else {
+			return status;
+		}
+
+		length -= sector_len;
+		dest_addr += sector_len;
+		src_addr += sector_len;
+	}
+
+	if (skipped) {
+		*skipped = same;
+	}
+
+	return 0;
+}
+
+/**
+ * Copy data stored in at a location in flash to another flash location, only erasing and
+ * programming destination sectors whose contents differ from the source.  The source and
+ * destination flash devices can be the same or different devices.  If they are the same, then the
+ * source and destination regions must not overlap or be within the same erase block.
+ *
+ * Erase blocks are on 4kB boundaries.  As with flash_sector_copy_ext, any data in a modified sector
+ * that is outside the copied region will be lost.
+ *
+ * @param dest_flash The flash device to write the copy to.
+ * @param dest_addr The flash address where the copy will be stored.
+ * @param src_flash The flash device to read the copy from.
+ * @param src_addr The flash address where the data will be copied from.
+ * @param length The number of bytes to copy.
+ * @param skipped Optional output for the number of sectors that already matched the source.
+ *
+ * @return 0 if the data was successfully copied or an error code.
+ */
+int flash_sector_copy_ext_differential (const struct flash *dest_flash, uint32_t dest_addr,
+	const struct flash *src_flash, uint32_t src_addr, size_t length, size_t *skipped)
+{
+	return flash_sector_copy_data_region_differential (dest_flash, dest_addr, src_flash, src_addr,
+		length, skipped, 0);
+}
+
+/**
+ * Copy data stored in at a location in flash to another flash location, only erasing and
+ * programming destination sectors whose contents differ from the source.  The source and
+ * destination flash devices can be the same or different devices.  If they are the same, then the
+ * source and destination regions must not overlap or be within the same erase block.  Any sectors
+ * that get programmed will be verified.
+ *
+ * Erase blocks are on 4kB boundaries.  As with flash_sector_copy_ext, any data in a modified sector
+ * that is outside the copied region will be lost.
+ *
+ * @param dest_flash The flash device to write the copy to.
+ * @param dest_addr The flash address where the copy will be stored.
+ * @param src_flash The flash device to read the copy from.
+ * @param src_addr The flash address where the data will be copied from.
+ * @param length The number of bytes to copy.
+ * @param skipped Optional output for the number of sectors that already matched the source.
+ *
+ * @return 0 if the data was successfully copied or an error code.
+ */
+int flash_sector_copy_ext_differential_and_verify (const struct flash *dest_flash,
+	uint32_t dest_addr, const struct flash *src_flash, uint32_t src_addr, size_t length,
+	size_t *skipped)
+{
+	return flash_sector_copy_data_region_differential (dest_flash, dest_addr, src_flash, src_addr,
+		length, skipped, 1);
+}
+
+/**
+ * Erase a region of flash, only issuing erase commands for sectors that are not already blank.
+ * Any sectors that get erased will be blank checked after the erase.
+ *
+ * Erase blocks are on 4kB boundaries.  Only the requested region is checked for blank data, so
+ * a sector that is blank within the region will not be erased even if it contains data outside
+ * the region.
+ *
+ * @param flash The flash device to erase.
+ * @param start_addr The starting address of the region to erase.
+ * @param length The number of bytes to erase.
+ * @param skipped Optional output for the number of sectors that were already blank.
+ *
+ * @return 0 if the region is blank or an error code.
+ */
+int flash_sector_erase_region_differential (const struct flash *flash, uint32_t start_addr,
+	size_t length, size_t *skipped)
+{
+	uint32_t sector;
+	size_t blank = 0;
+	size_t sector_len;
+	int status;
+
+	if (skipped) {
+		*skipped = 0;
+	}
+
+	if (flash == NULL) {
+		return FLASH_UTIL_INVALID_ARGUMENT;
+	}
+
+	if (length == 0) {
+		return 0;
+	}
+
+	status = flash->get_sector_size (flash, &sector);
+	if (status != 0) {
+		return status;
+	}
+
+	while (length != 0) {
+		sector_len = sector - FLASH_REGION_OFFSET (start_addr, sector);
+		sector_len = (length > sector_len) ? sector_len : length;
+
+		status = flash_blank_check (flash, start_addr, sector_len);
+		if (status == 0) {
+			blank++;
+		}
+		else if (status == FLASH_UTIL_NOT_BLANK) {
+			status = flash->sector_erase (flash, start_addr);
+			if (status == 0) {
+				status = flash_blank_check (flash, start_addr, sector_len);
+			}
+			if (status != 0) {
+				return status;
+			}
+		}
+		else {
+			return status;
+		}
+
+		length -= sector_len;
+		start_addr += sector_len;
+	}
+
+	if (skipped) {
+		*skipped = blank;
+	}
+
+	return 0;
+}
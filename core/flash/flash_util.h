@@ -23,6 +23,16 @@
  */
 #define	FLASH_MAX_COPY_BLOCK		512
 
+/**
+ * The number of sector erases that take at least as long as a single block erase.  When a mixed
+ * erase would need this many sector erases to clear part of a block, the entire block is erased
+ * instead.  Typical SPI NOR devices take about 4 times longer to erase a 64kB block than a 4kB
+ * sector.
+ */
+#ifndef FLASH_MIXED_ERASE_SECTOR_LIMIT
+#define	FLASH_MIXED_ERASE_SECTOR_LIMIT	4
+#endif
+
 
 /**
  * Defines a single region of flash memory.
@@ -76,6 +86,7 @@ int flash_hash_update_noncontiguous_contents_at_offset (const struct flash *flas
 
 int flash_erase_region (const struct flash *flash, uint32_t start_addr, size_t length);
 int flash_sector_erase_region (const struct flash *flash, uint32_t start_addr, size_t length);
+int flash_mixed_erase_region (const struct flash *flash, uint32_t start_addr, size_t length);
 int flash_blank_check (const struct flash *flash, uint32_t start_addr, size_t length);
 int flash_value_check (const struct flash *flash, uint32_t start_addr, size_t length,
 	uint8_t value);
@@ -83,6 +94,8 @@ int flash_value_check (const struct flash *flash, uint32_t start_addr, size_t le
 int flash_erase_region_and_verify (const struct flash *flash, uint32_t start_addr, size_t length);
 int flash_sector_erase_region_and_verify (const struct flash *flash, uint32_t start_addr,
 	size_t length);
+int flash_mixed_erase_region_and_verify (const struct flash *flash, uint32_t start_addr,
+	size_t length);
 
 int flash_program_data (const struct flash *flash, uint32_t start_addr, const uint8_t *data,
 	size_t length);
@@ -130,6 +143,14 @@ int flash_copy_ext_to_blank (const struct flash *dest_flash, uint32_t dest_addr,
 int flash_copy_ext_to_blank_and_verify (const struct flash *dest_flash, uint32_t dest_addr,
 	const struct flash *src_flash, uint32_t src_addr, size_t length);
 
+int flash_sector_copy_ext_differential (const struct flash *dest_flash, uint32_t dest_addr,
+	const struct flash *src_flash, uint32_t src_addr, size_t length, size_t *skipped);
+int flash_sector_copy_ext_differential_and_verify (const struct flash *dest_flash,
+	uint32_t dest_addr, const struct flash *src_flash, uint32_t src_addr, size_t length,
+	size_t *skipped);
+int flash_sector_erase_region_differential (const struct flash *flash, uint32_t start_addr,
+	size_t length, size_t *skipped);
+
 
 #define	FLASH_UTIL_ERROR(code)		ROT_ERROR (ROT_MODULE_FLASH_UTIL, code)
 
@@ -9,6 +9,7 @@
 #include "flash/flash_common.h"
 #include "flash/flash_logging.h"
 #include "common/unused.h"
+#include "logging/trace_ring.h"
 
 
 /* Status bits indicating when flash is operating in 4-byte address mode. */
@@ -666,6 +667,10 @@ static int spi_flash_simple_command (const struct spi_flash *flash, uint8_t cmd)
 {
 	struct flash_xfer xfer;
 
+	/* Many commands sent this way start a write or change the device state, so the device can no
+	 * longer be assumed to be idle. */
+	flash->state->wip_idle = false;
+
 	FLASH_XFER_INIT_CMD_ONLY (xfer, cmd, 0);
 	return flash->spi->xfer (flash->spi, &xfer);
 }
@@ -714,18 +719,42 @@ static int spi_flash_is_wip_set (const struct spi_flash *flash)
 		FLASH_XFER_INIT_READ_REG (xfer, FLASH_CMD_RDSR_FLAG, &reg, 1, 0);
 	}
 
+	flash->state->status_reads++;
+
 	status = flash->spi->xfer (flash->spi, &xfer);
 	if (status == 0) {
 		if (!flash->state->use_busy_flag) {
-			return ((reg & FLASH_STATUS_WIP) != 0);
+			status = ((reg & FLASH_STATUS_WIP) != 0);
 		}
 		else {
-			return ((reg & FLASH_FLAG_STATUS_READY) == 0);
+			status = ((reg & FLASH_FLAG_STATUS_READY) == 0);
 		}
+
+		flash->state->wip_idle = flash->state->track_wip && (status == 0);
 	}
 	else {
-		return status;
+		flash->state->wip_idle = false;
+	}
+
+	return status;
+}
+
+/**
+ * Check that the flash is not executing a write before sending a new command.  If write state is
+ * being tracked and the device is already known to be idle, the device will not be queried.
+ *
+ * @param flash The flash instance to check.
+ *
+ * @return 0 if no write is in progress, 1 if there is, or an error code.
+ */
+static int spi_flash_check_wip (const struct spi_flash *flash)
+{
+	if (flash->state->wip_idle) {
+		flash->state->status_reads_skipped++;
+		return 0;
 	}
+
+	return spi_flash_is_wip_set (flash);
 }
 
 /**
@@ -796,7 +825,7 @@ static int spi_flash_write_register (const struct spi_flash *flash, uint8_t cmd,
 	struct flash_xfer xfer;
 	int status;
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_wip (flash);
 	if (status != 0) {
 		return (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 	}
@@ -1931,8 +1960,9 @@ int spi_flash_read (const struct spi_flash *flash, uint32_t address, uint8_t *da
 	SPI_FLASH_BOUNDS_CHECK (flash->state->device_size, address, length);
 
 	platform_mutex_lock (&flash->state->lock);
+	TRACE_RING_BEGIN (TRACE_RING_POINT_FLASH_READ, length);
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_wip (flash);
 	if (status != 0) {
 		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
@@ -1944,6 +1974,7 @@ int spi_flash_read (const struct spi_flash *flash, uint32_t address, uint8_t *da
 	status = flash->spi->xfer (flash->spi, &xfer);
 
 exit:
+	TRACE_RING_END (TRACE_RING_POINT_FLASH_READ, status);
 	platform_mutex_unlock (&flash->state->lock);
 	return status;
 }
@@ -2026,7 +2057,7 @@ int spi_flash_write (const struct spi_flash *flash, uint32_t address, const uint
 
 	platform_mutex_lock (&flash->state->lock);
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_wip (flash);
 	if (status != 0) {
 		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
@@ -2114,7 +2145,7 @@ static int spi_flash_erase_region (const struct spi_flash *flash, uint32_t addre
 
 	platform_mutex_lock (&flash->state->lock);
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_wip (flash);
 	if (status != 0) {
 		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
@@ -2241,7 +2272,7 @@ int spi_flash_chip_erase (const struct spi_flash *flash)
 
 	platform_mutex_lock (&flash->state->lock);
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_wip (flash);
 	if (status != 0) {
 		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
@@ -2317,3 +2348,57 @@ int spi_flash_wait_for_write (const struct spi_flash *flash, int32_t timeout)
 
 	return status;
 }
+
+/**
+ * Enable or disable tracking of the device write state.  When enabled, the driver remembers when
+ * the device has reported that it is idle and will not query the status register again before
+ * sending commands until a new write is started.  This removes a status read from every flash read
+ * that follows a completed write.
+ *
+ * Write tracking must only be enabled when the flash device is exclusively accessed through this
+ * driver instance.  If any other SPI master can issue commands to the device, the tracked state
+ * will not be accurate.  In cases where the device is shared, tracking can be disabled while
+ * another master has access and enabled again afterwards.
+ *
+ * Changing the tracking setting will always cause the next command to query the device.
+ *
+ * @param flash The flash instance to configure.
+ * @param enable Flag indicating if write state should be tracked.
+ *
+ * @return 0 if the setting was changed or an error code.
+ */
+int spi_flash_enable_wip_tracking (const struct spi_flash *flash, bool enable)
+{
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+	flash->state->track_wip = enable;
+	flash->state->wip_idle = false;
+	platform_mutex_unlock (&flash->state->lock);
+
+	return 0;
+}
+
+/**
+ * Get the counters for status register reads used to check for writes in progress.
+ *
+ * @param flash The flash instance to query.
+ * @param stats Output for the status read counters.
+ *
+ * @return 0 if the counters were retrieved or an error code.
+ */
+int spi_flash_get_wip_stats (const struct spi_flash *flash, struct spi_flash_wip_stats *stats)
+{
+	if ((flash == NULL) || (stats == NULL)) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+	stats->status_reads = flash->state->status_reads;
+	stats->status_reads_skipped = flash->state->status_reads_skipped;
+	platform_mutex_unlock (&flash->state->lock);
+
+	return 0;
+}
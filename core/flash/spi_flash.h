@@ -49,6 +49,10 @@ struct spi_flash_state {
 	bool reset_3byte;									/**< Flag to switch to 3-byte mode on reset. */
 	enum spi_flash_sfdp_quad_enable quad_enable;		/**< Method to enable QSPI. */
 	bool sr1_volatile;									/**< Flag to use volatile write enable for status register 1. */
+	bool track_wip;										/**< Flag to track write state instead of always querying the device. */
+	bool wip_idle;										/**< The device is known to not be executing a write. */
+	uint32_t status_reads;								/**< Number of status reads issued to check for a write. */
+	uint32_t status_reads_skipped;						/**< Number of status reads avoided by tracking write state. */
 };
 
 /**
@@ -60,6 +64,14 @@ struct spi_flash {
 	const struct flash_master *spi;						/**< The SPI master connected to the flash device. */
 };
 
+/**
+ * Counters for status register reads used to check for writes in progress.
+ */
+struct spi_flash_wip_stats {
+	uint32_t status_reads;				/**< Number of status reads issued to check for a write. */
+	uint32_t status_reads_skipped;		/**< Number of status reads avoided by tracking write state. */
+};
+
 /**
  * Version number of the device info context.
  */
@@ -170,6 +182,9 @@ int spi_flash_chip_erase (const struct spi_flash *flash);
 int spi_flash_is_write_in_progress (const struct spi_flash *flash);
 int spi_flash_wait_for_write (const struct spi_flash *flash, int32_t timeout);
 
+int spi_flash_enable_wip_tracking (const struct spi_flash *flash, bool enable);
+int spi_flash_get_wip_stats (const struct spi_flash *flash, struct spi_flash_wip_stats *stats);
+
 
 #define	SPI_FLASH_ERROR(code)		ROT_ERROR (ROT_MODULE_SPI_FLASH, code)
 
@@ -262,10 +262,19 @@ static int host_flash_manager_dual_initialize_flash_protection (struct host_flas
 static int host_flash_manager_dual_restore_flash_read_write_regions (
 	struct host_flash_manager *manager, struct host_flash_manager_rw_regions *host_rw)
 {
-	if ((manager == NULL) || (host_rw == NULL)) {
+	struct host_flash_manager_dual *dual = (struct host_flash_manager_dual*) manager;
+
+	if ((dual == NULL) || (host_rw == NULL)) {
 		return HOST_FLASH_MGR_INVALID_ARGUMENT;
 	}
 
+	if (dual->differential_restore) {
+		return host_fw_restore_read_write_data_multiple_fw_differential (
+			host_flash_manager_dual_get_read_write_flash (manager),
+			host_flash_manager_dual_get_read_only_flash (manager), host_rw->writable,
+			host_rw->count, NULL);
+	}
+
 	return host_fw_restore_read_write_data_multiple_fw (
 		host_flash_manager_dual_get_read_write_flash (manager),
 		host_flash_manager_dual_get_read_only_flash (manager), host_rw->writable, host_rw->count);
@@ -414,6 +423,25 @@ int host_flash_manager_dual_init_with_managed_flash_initialization (
 	return 0;
 }
 
+/**
+ * Configure the manager to only rewrite flash sectors that do not already contain the expected data
+ * when restoring read/write regions.  Each sector of a region is checked before any change is made,
+ * and sectors that are already blank or already match the read-only flash are left untouched.
+ *
+ * This is disabled by default, in which case every read/write region is always erased and, if
+ * necessary, programmed.
+ *
+ * @param manager The flash manager to configure.
+ * @param enable Flag indicating if differential restore should be used.
+ */
+void host_flash_manager_dual_set_differential_restore (struct host_flash_manager_dual *manager,
+	bool enable)
+{
+	if (manager != NULL) {
+		manager->differential_restore = enable;
+	}
+}
+
 /**
  * Release the resources used for dual host flash management.
  *
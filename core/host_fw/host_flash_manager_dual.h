@@ -19,6 +19,7 @@ struct host_flash_manager_dual {
 	const struct spi_filter_interface *filter;			/**< The SPI filter connected to the flash devices. */
 	const struct flash_mfg_filter_handler *mfg_handler;	/**< The filter handler for flash device types. */
 	struct host_flash_initialization *flash_init;		/**< Host flash initialization manager. */
+	bool differential_restore;							/**< Only rewrite read/write sectors that differ. */
 };
 
 
@@ -32,5 +33,8 @@ int host_flash_manager_dual_init_with_managed_flash_initialization (
 	struct host_flash_initialization *flash_init);
 void host_flash_manager_dual_release (struct host_flash_manager_dual *manager);
 
+void host_flash_manager_dual_set_differential_restore (struct host_flash_manager_dual *manager,
+	bool enable);
+
 
 #endif /* HOST_FLASH_MANAGER_DUAL_H_ */
@@ -985,6 +985,340 @@ int host_fw_restore_read_write_data_multiple_fw (const struct spi_flash *restore
 	return 0;
 }
 
+/**
+ * Find the firmware image region that contains a flash address or, if no region contains the
+ * address, the next image region after the address.
+ *
+ * @param addr The flash address to search for.
+ * @param img_list The list of firmware images in flash.
+ *
+ * @return The region description for the image region or null if there are no image regions at or
+ * after the address.
+ */
+static const struct flash_region* host_fw_find_img_region_at_addr (uint32_t addr,
+	const struct pfm_image_list *img_list)
+{
+	const struct flash_region *next = NULL;
+	const struct flash_region *regions;
+	size_t count;
+	size_t i;
+	size_t j;
+
+	for (i = 0; i < img_list->count; i++) {
+		if (img_list->images_sig) {
+			regions = img_list->images_sig[i].regions;
+			count = img_list->images_sig[i].count;
+		}
+		else {
+			regions = img_list->images_hash[i].regions;
+			count = img_list->images_hash[i].count;
+		}
+
+		for (j = 0; j < count; j++) {
+			if (regions[j].start_addr > addr) {
+				if (!next || (regions[j].start_addr < next->start_addr)) {
+					next = &regions[j];
+				}
+			}
+			else if ((addr - regions[j].start_addr) < regions[j].length) {
+				return &regions[j];
+			}
+		}
+	}
+
+	return next;
+}
+
+/**
+ * Process a region of read-only flash that is contained within a single flash sector.  Parts of the
+ * region that belong to a firmware image should match the device being restored from, and all other
+ * parts should be blank.
+ *
+ * @param restore The flash device being restored.
+ * @param from The device being restored from.
+ * @param img_list The list of firmware images in the good flash device.
+ * @param addr The starting address of the region.
+ * @param length The length of the region.
+ * @param program Flag indicating if the image data should be programmed to the region instead of
+ * being checked.  The region must already be blank when programming.
+ *
+ * @return 0 if the region was processed successfully or an error code.  When checking the region,
+ * FLASH_UTIL_DATA_MISMATCH or FLASH_UTIL_NOT_BLANK indicates the region needs to be restored.
+ */
+static int host_fw_restore_read_only_sector (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_image_list *img_list, uint32_t addr,
+	size_t length, bool program)
+{
+	const struct flash_region *img;
+	uint32_t end = addr + length;
+	size_t img_len;
+	int status = 0;
+
+	while ((status == 0) && (addr < end)) {
+		img = host_fw_find_img_region_at_addr (addr, img_list);
+		if (img && (img->start_addr <= addr)) {
+			img_len = (img->start_addr + img->length) - addr;
+			img_len = (img_len > (end - addr)) ? (end - addr) : img_len;
+
+			if (program) {
+				status = flash_copy_ext_to_blank (&restore->base, addr, &from->base, addr, img_len);
+			}
+			else {
+				status = flash_verify_copy_ext (&restore->base, addr, &from->base, addr, img_len);
+			}
+		}
+		else {
+			img_len = (img && (img->start_addr < end)) ? img->start_addr - addr : end - addr;
+
+			if (!program) {
+				status = flash_blank_check (&restore->base, addr, img_len);
+			}
+		}
+
+		addr += img_len;
+	}
+
+	return status;
+}
+
+/**
+ * Restore a region of read-only flash, only updating sectors that do not already contain the
+ * expected data.
+ *
+ * @param restore The flash device being restored.
+ * @param from The device being restored from.
+ * @param img_list The list of firmware images in the good flash device.
+ * @param addr The starting address of the read-only region.
+ * @param length The length of the read-only region.
+ * @param sector The sector size of the flash device being restored.
+ * @param skipped Counter for the number of sectors that did not need to be updated.
+ *
+ * @return 0 if the region was restored successfully or an error code.
+ */
+static int host_fw_restore_read_only_region_differential (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_image_list *img_list, uint32_t addr,
+	size_t length, uint32_t sector, size_t *skipped)
+{
+	size_t sector_len;
+	int status;
+
+	while (length != 0) {
+		sector_len = sector - FLASH_REGION_OFFSET (addr, sector);
+		sector_len = (length > sector_len) ? sector_len : length;
+
+		status = host_fw_restore_read_only_sector (restore, from, img_list, addr, sector_len,
+			false);
+		if (status == 0) {
+			(*skipped)++;
+		}
+		else if ((status == FLASH_UTIL_DATA_MISMATCH) || (status == FLASH_UTIL_NOT_BLANK)) {
+			status = restore->base.sector_erase (&restore->base, addr);
+			if (status != 0) {
+				return status;
+			}
+
+			status = host_fw_restore_read_only_sector (restore, from, img_list, addr, sector_len,
+				true);
+			if (status != 0) {
+				return status;
+			}
+		}
+		else {
+			return status;
+		}
+
+		length -= sector_len;
+		addr += sector_len;
+	}
+
+	return 0;
+}
+
+/**
+ * Restore the firmware images in a flash device from the contents of a different device.  Each
+ * sector of read-only flash is compared against the expected contents before any change is made.
+ * Only sectors that do not match are erased and programmed.  No verification will be performed on
+ * the restored device.
+ *
+ * The final state of the restored device is the same as host_fw_restore_flash_device, but when
+ * most of the flash is already correct, the number of erase cycles is significantly reduced.
+ *
+ * @param restore The flash device that should be restored.
+ * @param from The device to restore from.
+ * @param img_list The list of firmware images in the good flash device.
+ * @param writable The list of read/write regions in the good flash device.
+ * @param skipped Optional output for the number of sectors that already contained the expected
+ * data and were not modified.  This can be null if the count is not needed.
+ *
+ * @return 0 if the bad flash was restored to a good state or an error code.
+ */
+int host_fw_restore_flash_device_differential (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_image_list *img_list,
+	const struct pfm_read_write_regions *writable, size_t *skipped)
+{
+	uint32_t flash_size;
+	uint32_t sector;
+	uint32_t last_addr;
+	const struct flash_region *pos;
+	size_t same = 0;
+	int status;
+
+	if (skipped) {
+		*skipped = 0;
+	}
+
+	if ((restore == NULL) || (from == NULL) || (img_list == NULL) || (writable == NULL)) {
+		return HOST_FW_UTIL_INVALID_ARGUMENT;
+	}
+
+	status = spi_flash_get_device_size (restore, &flash_size);
+	if (status != 0) {
+		return status;
+	}
+
+	status = restore->base.get_sector_size (&restore->base, &sector);
+	if (status != 0) {
+		return status;
+	}
+
+	last_addr = 0;
+	pos = host_fw_find_next_rw_region (last_addr, writable, 1);
+	while (pos) {
+		status = host_fw_restore_read_only_region_differential (restore, from, img_list, last_addr,
+			pos->start_addr - last_addr, sector, &same);
+		if (status != 0) {
+			goto exit;
+		}
+
+		last_addr = pos->start_addr + pos->length;
+		pos = host_fw_find_next_rw_region (last_addr, writable, 1);
+	}
+
+	status = host_fw_restore_read_only_region_differential (restore, from, img_list, last_addr,
+		flash_size - last_addr, sector, &same);
+
+exit:
+	if (skipped) {
+		*skipped = same;
+	}
+
+	return status;
+}
+
+/**
+ * Restore the read/write data in a flash device, only modifying sectors that do not already contain
+ * the expected data.
+ *
+ * @param restore The flash device that should be restored.
+ * @param from The device to restore data from.  This can be null.
+ * @param writable The list of read/write regions to restore.
+ * @param skipped Counter for the number of sectors that did not need to be updated.
+ *
+ * @return 0 if all regions were restored successfully or an error code.
+ */
+static int host_fw_restore_read_write_data_differential_count (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_read_write_regions *writable, size_t *skipped)
+{
+	size_t same;
+	size_t i;
+	int status;
+
+	for (i = 0; i < writable->count; i++) {
+		switch (writable->properties[i].on_failure) {
+			case PFM_RW_ERASE:
+				status = flash_sector_erase_region_differential (&restore->base,
+					writable->regions[i].start_addr, writable->regions[i].length, &same);
+				break;
+
+			case PFM_RW_RESTORE:
+				if (from == NULL) {
+					continue;
+				}
+
+				status = flash_sector_copy_ext_differential_and_verify (&restore->base,
+					writable->regions[i].start_addr, &from->base, writable->regions[i].start_addr,
+					writable->regions[i].length, &same);
+				break;
+
+			default:
+				continue;
+		}
+
+		*skipped += same;
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Restore the read/write data in a flash device.  Based on the configuration of each region, the
+ * destination flash will either be left unchanged, erased, or copied from a different flash device.
+ * Only sectors that do not already contain the expected data will be erased or programmed.
+ *
+ * @param restore The flash device that should be restored.
+ * @param from The device to restore data from.  If this is null, regions that are configured to be
+ * copied will instead remain unchanged.
+ * @param writable The list of read/write regions to restore.
+ * @param skipped Optional output for the number of sectors that already contained the expected
+ * data and were not modified.  This can be null if the count is not needed.
+ *
+ * @return 0 if all regions were restored successfully or an error code.
+ */
+int host_fw_restore_read_write_data_differential (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_read_write_regions *writable, size_t *skipped)
+{
+	return host_fw_restore_read_write_data_multiple_fw_differential (restore, from, writable, 1,
+		skipped);
+}
+
+/**
+ * Restore the read/write data in a flash device.  Based on the configuration of each region, the
+ * destination flash will either be left unchanged, erased, or copied from a different flash device.
+ * Only sectors that do not already contain the expected data will be erased or programmed.
+ *
+ * Read/write data from multiple firmware components will be restored.
+ *
+ * @param restore The flash device that should be restored.
+ * @param from The device to restore data from.  If this is null, regions that are configured to be
+ * copied will instead remain unchanged.
+ * @param writable An array of read/write regions to restore.
+ * @param fw_count The number of firmware components in the list.
+ * @param skipped Optional output for the number of sectors that already contained the expected
+ * data and were not modified.  This can be null if the count is not needed.
+ *
+ * @return 0 if all regions were restored successfully or an error code.
+ */
+int host_fw_restore_read_write_data_multiple_fw_differential (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_read_write_regions *writable, size_t fw_count,
+	size_t *skipped)
+{
+	size_t same = 0;
+	size_t i;
+	int status = 0;
+
+	if (skipped) {
+		*skipped = 0;
+	}
+
+	if ((restore == NULL) || (writable == NULL)) {
+		return HOST_FW_UTIL_INVALID_ARGUMENT;
+	}
+
+	for (i = 0; (status == 0) && (i < fw_count); i++) {
+		status = host_fw_restore_read_write_data_differential_count (restore, from, &writable[i],
+			&same);
+	}
+
+	if (skipped) {
+		*skipped = same;
+	}
+
+	return status;
+}
+
 /**
  * Configure the SPI filter with the read/write region definitions from a PFM entry.
  *
@@ -60,6 +60,15 @@ int host_fw_restore_read_write_data (const struct spi_flash *restore, const stru
 int host_fw_restore_read_write_data_multiple_fw (const struct spi_flash *restore,
 	const struct spi_flash *from, const struct pfm_read_write_regions *writable, size_t fw_count);
 
+int host_fw_restore_flash_device_differential (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_image_list *img_list,
+	const struct pfm_read_write_regions *writable, size_t *skipped);
+int host_fw_restore_read_write_data_differential (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_read_write_regions *writable, size_t *skipped);
+int host_fw_restore_read_write_data_multiple_fw_differential (const struct spi_flash *restore,
+	const struct spi_flash *from, const struct pfm_read_write_regions *writable, size_t fw_count,
+	size_t *skipped);
+
 int host_fw_config_spi_filter_read_write_regions (const struct spi_filter_interface *filter,
 	const struct pfm_read_write_regions *writable);
 int host_fw_config_spi_filter_read_write_regions_multiple_fw (
@@ -2,10 +2,16 @@
 // Licensed under the MIT license.
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 #include "debug_log.h"
 #include "platform_api.h"
 #include "common/unused.h"
 
+#ifdef LOGGING_DEBUG_LOG_COMPACT_ENTRIES
+#include "debug_log_compact.h"
+#endif
+
 
 /* By default, the global singleton for the debug log is defined here.  However, if the target
  * project wants to define this to be a constant instance, it needs to be defined and initialized
@@ -18,6 +24,11 @@ const struct logging *debug_log = NULL;
 /**
  * Create a new entry in the debug log.
  *
+ * If LOGGING_DEBUG_LOG_COMPACT_ENTRIES is defined, the entry will be stored using the compact
+ * encoding.  This requires a debug log that supports variable length entries, such as a flash log.
+ * A log that only stores fixed-size entries, such as a memory log, will cause the entry to be
+ * rejected with LOGGING_UNSUPPORTED_ENTRY_FORMAT.
+ *
  * @param severity Severity level of the new entry.
  * @param component Component that is generating the entry.
  * @param msg_index Identifier code for the log entry message.
@@ -31,6 +42,10 @@ int debug_log_create_entry (uint8_t severity, uint8_t component, uint8_t msg_ind
 {
 #ifdef LOGGING_SUPPORT_DEBUG_LOG
 	struct debug_log_entry_info entry;
+#ifdef LOGGING_DEBUG_LOG_COMPACT_ENTRIES
+	uint8_t compact[DEBUG_LOG_COMPACT_MAX_LENGTH];
+	int status;
+#endif
 
 	if (debug_log == NULL) {
 		return LOGGING_NO_LOG_AVAILABLE;
@@ -48,7 +63,22 @@ int debug_log_create_entry (uint8_t severity, uint8_t component, uint8_t msg_ind
 	entry.arg2 = arg2;
 	entry.time = platform_get_time ();
 
+#ifdef LOGGING_DEBUG_LOG_COMPACT_ENTRIES
+	status = debug_log_compact_encode (&entry, compact, sizeof (compact));
+	if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+
+	status = debug_log->create_entry (debug_log, compact, status);
+	if (status == LOGGING_BAD_ENTRY_LENGTH) {
+		/* The log requires entries of a specific length, so it can't store compact entries. */
+		status = LOGGING_UNSUPPORTED_ENTRY_FORMAT;
+	}
+
+	return status;
+#else
 	return debug_log->create_entry (debug_log, (uint8_t*) &entry, sizeof (entry));
+#endif
 #else
 	UNUSED (severity);
 	UNUSED (component);
@@ -142,3 +172,61 @@ int debug_log_read_contents (uint32_t offset, uint8_t *contents, size_t length)
 	return LOGGING_NO_LOG_AVAILABLE;
 #endif
 }
+
+/**
+ * Find the first entry in the debug log that is newer than a specified entry.  This can be used to
+ * only read entries that have been added since the last time the log was read.
+ *
+ * @param entry_id The ID of the last entry already retrieved.
+ *
+ * @return The offset in the log of the first newer entry or an error code.  Use ROT_IS_ERROR to
+ * check the return value.  If there are no newer entries, the current size of the log is returned.
+ */
+int debug_log_get_entry_offset (uint32_t entry_id)
+{
+#ifdef LOGGING_SUPPORT_DEBUG_LOG
+	if (debug_log == NULL) {
+		return LOGGING_NO_LOG_AVAILABLE;
+	}
+
+	return debug_log->get_entry_offset (debug_log, entry_id);
+#else
+	UNUSED (entry_id);
+
+	return LOGGING_NO_LOG_AVAILABLE;
+#endif
+}
+
+/**
+ * Get the number of bytes a new debug log entry will use in the log, including the standard logging
+ * header.
+ *
+ * When compact entries are being used, the length depends on the entry arguments and the current
+ * time, so it can change as time elapses.
+ *
+ * @param arg1 The first argument for the entry.
+ * @param arg2 The second argument for the entry.
+ *
+ * @return The length of the entry in the log.
+ */
+size_t debug_log_get_entry_length (uint32_t arg1, uint32_t arg2)
+{
+#ifdef LOGGING_DEBUG_LOG_COMPACT_ENTRIES
+	struct debug_log_entry_info entry;
+	uint8_t compact[DEBUG_LOG_COMPACT_MAX_LENGTH];
+
+	memset (&entry, 0, sizeof (entry));
+	entry.arg1 = arg1;
+	entry.arg2 = arg2;
+	entry.time = platform_get_time ();
+
+	/* Encoding can't fail with a maximum length buffer. */
+	return sizeof (struct logging_entry_header) +
+		debug_log_compact_encode (&entry, compact, sizeof (compact));
+#else
+	UNUSED (arg1);
+	UNUSED (arg2);
+
+	return sizeof (struct debug_log_entry);
+#endif
+}
@@ -95,6 +95,8 @@ int debug_log_flush (void);
 int debug_log_clear (void);
 int debug_log_get_size (void);
 int debug_log_read_contents (uint32_t offset, uint8_t *contents, size_t length);
+int debug_log_get_entry_offset (uint32_t entry_id);
+size_t debug_log_get_entry_length (uint32_t arg1, uint32_t arg2);
 
 
 #endif /* DEBUG_LOG_H_ */
@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "debug_log_compact.h"
+
+
+/**
+ * Write a value to a buffer as a variable length integer.  The buffer must be large enough to hold
+ * the encoded value.
+ *
+ * @param value The value to encode.
+ * @param buffer Output buffer for the encoded value.
+ *
+ * @return The number of bytes written to the buffer.
+ */
+static size_t debug_log_compact_encode_varint (uint64_t value, uint8_t *buffer)
+{
+	size_t length = 0;
+
+	while (value >= 0x80) {
+		buffer[length++] = (value & 0x7f) | 0x80;
+		value >>= 7;
+	}
+
+	buffer[length++] = value;
+
+	return length;
+}
+
+/**
+ * Read a variable length integer from a buffer.
+ *
+ * @param data The buffer containing the encoded value.
+ * @param length The number of bytes available in the buffer.
+ * @param max_bits The maximum number of bits allowed in the decoded value.
+ * @param value Output for the decoded value.
+ *
+ * @return The number of bytes used by the encoded value or an error code.
+ */
+static int debug_log_compact_decode_varint (const uint8_t *data, size_t length, int max_bits,
+	uint64_t *value)
+{
+	size_t pos = 0;
+	int shift = 0;
+	uint8_t bits;
+
+	*value = 0;
+
+	while (pos < length) {
+		bits = data[pos] & 0x7f;
+		if ((shift >= max_bits) ||
+			(((max_bits - shift) < 7) && ((bits >> (max_bits - shift)) != 0))) {
+			return LOGGING_MALFORMED_ENTRY;
+		}
+
+		*value |= ((uint64_t) bits) << shift;
+		if (!(data[pos++] & 0x80)) {
+			return pos;
+		}
+
+		shift += 7;
+	}
+
+	return LOGGING_MALFORMED_ENTRY;
+}
+
+/**
+ * Encode a debug log entry using the compact format.  The time is stored as the elapsed time since
+ * boot, so each entry can be decoded without needing any other entries in the log.
+ *
+ * @param entry The entry to encode.  The format field is ignored.
+ * @param buffer Output buffer for the encoded entry.  This should be at least
+ * DEBUG_LOG_COMPACT_MAX_LENGTH bytes.
+ * @param length Length of the output buffer.
+ *
+ * @return The length of the encoded entry or an error code.  Use ROT_IS_ERROR to check the return
+ * value.
+ */
+int debug_log_compact_encode (const struct debug_log_entry_info *entry, uint8_t *buffer,
+	size_t length)
+{
+	uint8_t encoded[DEBUG_LOG_COMPACT_MAX_LENGTH];
+	size_t pos = 0;
+
+	if ((entry == NULL) || (buffer == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	encoded[pos++] = DEBUG_LOG_ENTRY_FORMAT_COMPACT;
+	encoded[pos++] = entry->severity;
+	encoded[pos++] = entry->component;
+	encoded[pos++] = entry->msg_index;
+	pos += debug_log_compact_encode_varint (entry->arg1, &encoded[pos]);
+	pos += debug_log_compact_encode_varint (entry->arg2, &encoded[pos]);
+	pos += debug_log_compact_encode_varint (entry->time, &encoded[pos]);
+
+	if (length < pos) {
+		return LOGGING_ENTRY_BUFFER_TOO_SMALL;
+	}
+
+	memcpy (buffer, encoded, pos);
+
+	return pos;
+}
+
+/**
+ * Decode a debug log entry that uses the compact format.
+ *
+ * @param data The encoded entry data, not including the standard logging header.
+ * @param length Length of the encoded entry data.
+ * @param entry Output for the decoded entry.  The entry format will be set to
+ * DEBUG_LOG_ENTRY_FORMAT.
+ *
+ * @return The number of bytes used by the encoded entry or an error code.  Use ROT_IS_ERROR to
+ * check the return value.
+ */
+int debug_log_compact_decode (const uint8_t *data, size_t length,
+	struct debug_log_entry_info *entry)
+{
+	uint64_t value;
+	size_t pos = 4;
+	int status;
+
+	if ((data == NULL) || (entry == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	if (length < pos) {
+		return LOGGING_MALFORMED_ENTRY;
+	}
+
+	if (data[0] != DEBUG_LOG_ENTRY_FORMAT_COMPACT) {
+		return LOGGING_UNSUPPORTED_ENTRY_FORMAT;
+	}
+
+	entry->format = DEBUG_LOG_ENTRY_FORMAT;
+	entry->severity = data[1];
+	entry->component = data[2];
+	entry->msg_index = data[3];
+
+	status = debug_log_compact_decode_varint (&data[pos], length - pos, 32, &value);
+	if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+	entry->arg1 = value;
+	pos += status;
+
+	status = debug_log_compact_decode_varint (&data[pos], length - pos, 32, &value);
+	if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+	entry->arg2 = value;
+	pos += status;
+
+	status = debug_log_compact_decode_varint (&data[pos], length - pos, 64, &value);
+	if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+	entry->time = value;
+	pos += status;
+
+	return pos;
+}
+
+/**
+ * Convert a debug log entry read from the log into the standard entry format.  Entries that are
+ * already in the standard format are copied without modification.
+ *
+ * @param data The log entry data, starting with the standard logging header.
+ * @param length Length of the log entry data.  This can be longer than the entry, in which case
+ * only the first entry is converted.
+ * @param entry Output for the entry in the standard format.  The entry length in the header is
+ * updated to match the standard format.
+ *
+ * @return The number of bytes used by the entry in the log data or an error code.  Use
+ * ROT_IS_ERROR to check the return value.
+ */
+int debug_log_compact_expand_entry (const uint8_t *data, size_t length,
+	struct debug_log_entry *entry)
+{
+	const struct logging_entry_header *header = (const struct logging_entry_header*) data;
+	size_t entry_len;
+	int status;
+
+	if ((data == NULL) || (entry == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	if (length < sizeof (struct logging_entry_header)) {
+		return LOGGING_MALFORMED_ENTRY;
+	}
+
+	if (!LOGGING_IS_ENTRY_START (header->log_magic)) {
+		return LOGGING_UNSUPPORTED_ENTRY_FORMAT;
+	}
+
+	entry_len = header->length;
+	if ((entry_len < sizeof (struct logging_entry_header)) || (entry_len > length)) {
+		return LOGGING_MALFORMED_ENTRY;
+	}
+
+	if ((entry_len == sizeof (struct logging_entry_header)) ||
+		(data[sizeof (struct logging_entry_header)] != DEBUG_LOG_ENTRY_FORMAT_COMPACT)) {
+		if (entry_len != sizeof (struct debug_log_entry)) {
+			return LOGGING_UNSUPPORTED_ENTRY_FORMAT;
+		}
+
+		memcpy ((uint8_t*) entry, data, sizeof (struct debug_log_entry));
+		if (entry->entry.format != DEBUG_LOG_ENTRY_FORMAT) {
+			return LOGGING_UNSUPPORTED_ENTRY_FORMAT;
+		}
+
+		return entry_len;
+	}
+
+	status = debug_log_compact_decode (&data[sizeof (struct logging_entry_header)],
+		entry_len - sizeof (struct logging_entry_header), &entry->entry);
+	if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+
+	if ((size_t) status != (entry_len - sizeof (struct logging_entry_header))) {
+		return LOGGING_MALFORMED_ENTRY;
+	}
+
+	memcpy ((uint8_t*) &entry->header, data, sizeof (struct logging_entry_header));
+	entry->header.length = sizeof (struct debug_log_entry);
+
+	return entry_len;
+}
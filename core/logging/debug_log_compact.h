@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef DEBUG_LOG_COMPACT_H_
+#define DEBUG_LOG_COMPACT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "debug_log.h"
+
+
+/**
+ * Format identifier for debug log entries that use the compact encoding.  Unlike the standard
+ * format, this is stored as a single byte at the start of the entry data.
+ */
+#define	DEBUG_LOG_ENTRY_FORMAT_COMPACT		2
+
+/**
+ * The maximum number of bytes needed to encode a debug log entry in the compact format.  This
+ * does not include the standard logging header.
+ *
+ * The entry is encoded as:
+ * - 1 byte format identifier
+ * - 1 byte severity
+ * - 1 byte component ID
+ * - 1 byte message ID
+ * - arg1 as a variable length integer (1 - 5 bytes)
+ * - arg2 as a variable length integer (1 - 5 bytes)
+ * - time as a variable length integer (1 - 10 bytes)
+ *
+ * Variable length integers store 7 bits per byte, starting with the least significant bits.  The
+ * most significant bit of each byte is set if there are more bytes in the value.
+ */
+#define	DEBUG_LOG_COMPACT_MAX_LENGTH		(4 + 5 + 5 + 10)
+
+
+int debug_log_compact_encode (const struct debug_log_entry_info *entry, uint8_t *buffer,
+	size_t length);
+int debug_log_compact_decode (const uint8_t *data, size_t length,
+	struct debug_log_entry_info *entry);
+int debug_log_compact_expand_entry (const uint8_t *data, size_t length,
+	struct debug_log_entry *entry);
+
+
+#endif /* DEBUG_LOG_COMPACT_H_ */
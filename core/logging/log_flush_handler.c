@@ -39,6 +39,12 @@ void log_flush_handler_execute (const struct periodic_task_handler *handler)
 	const struct log_flush_handler *flush = (const struct log_flush_handler*) handler;
 	size_t i;
 
+	/* Move all staged entries to the shared logs before flushing, so nothing that was added before
+	 * this execution is left in a staging buffer. */
+	for (i = 0; i < flush->staging_count; i++) {
+		logging_staging_drain (flush->staging[i]);
+	}
+
 	for (i = 0; i < flush->log_count; i++) {
 		flush->logs[i]->flush (flush->logs[i]);
 	}
@@ -60,6 +66,29 @@ void log_flush_handler_execute (const struct periodic_task_handler *handler)
 int log_flush_handler_init (struct log_flush_handler *handler,
 	struct log_flush_handler_state *state, const struct logging **logs, size_t log_count,
 	uint32_t period_ms)
+{
+	return log_flush_handler_init_with_staging (handler, state, NULL, 0, logs, log_count,
+		period_ms);
+}
+
+/**
+ * Initialize a handler to drain staging logs and flush log data.
+ *
+ * @param handler The log handler to initialize.
+ * @param state Variable context for the handler.  This must be uninitialized.
+ * @param staging The list of staging logs that should be drained.  This can be null if there are
+ * no staging logs.
+ * @param staging_count The number of staging logs in the list.
+ * @param logs The list of logs that should be flushed.  This would normally include the shared logs
+ * used by the staging logs.
+ * @param log_count The number of logs in the list.
+ * @param period_ms The amount of time between log flush requests, in milliseconds.
+ *
+ * @return 0 if the handler was successfully initialized or an error code.
+ */
+int log_flush_handler_init_with_staging (struct log_flush_handler *handler,
+	struct log_flush_handler_state *state, const struct logging_staging **staging,
+	size_t staging_count, const struct logging **logs, size_t log_count, uint32_t period_ms)
 {
 	if ((handler == NULL) || (state == NULL) || (logs == NULL) || (log_count == 0)) {
 		return LOGGING_INVALID_ARGUMENT;
@@ -72,6 +101,8 @@ int log_flush_handler_init (struct log_flush_handler *handler,
 	handler->base.execute = log_flush_handler_execute;
 
 	handler->state = state;
+	handler->staging = staging;
+	handler->staging_count = staging_count;
 	handler->logs = logs;
 	handler->log_count = log_count;
 	handler->period = period_ms;
@@ -92,7 +123,8 @@ int log_flush_handler_init (struct log_flush_handler *handler,
 int log_flush_handler_init_state (const struct log_flush_handler *handler)
 {
 	if ((handler == NULL) || (handler->state == NULL) || (handler->logs == NULL) ||
-		(handler->log_count == 0)) {
+		(handler->log_count == 0) ||
+		((handler->staging == NULL) && (handler->staging_count != 0))) {
 		return LOGGING_INVALID_ARGUMENT;
 	}
 
@@ -9,6 +9,7 @@
 #include <stdbool.h>
 #include "platform_api.h"
 #include "logging.h"
+#include "logging_staging.h"
 #include "system/periodic_task.h"
 
 
@@ -22,10 +23,16 @@ struct log_flush_handler_state {
 
 /**
  * Handler to flush log data.
+ *
+ * The handler can also drain staging logs into their shared logs.  Each producer task adds entries
+ * to its own staging log, and the handler moves all staged entries before flushing the shared logs,
+ * so the shared logs are only updated from the flush task.
  */
 struct log_flush_handler {
 	struct periodic_task_handler base;		/**< Base interface for task integration. */
 	struct log_flush_handler_state *state;	/**< Variable context for the handler. */
+	const struct logging_staging **staging;	/**< List of staging logs to drain. */
+	size_t staging_count;					/**< Number of staging logs in the list. */
 	const struct logging **logs;			/**< List of logs to flush. */
 	size_t log_count;						/**< Number of logs in the list. */
 	uint32_t period;						/**< Required time between log flush requests. */
@@ -35,6 +42,9 @@ struct log_flush_handler {
 int log_flush_handler_init (struct log_flush_handler *handler,
 	struct log_flush_handler_state *state, const struct logging **logs, size_t log_count,
 	uint32_t period_ms);
+int log_flush_handler_init_with_staging (struct log_flush_handler *handler,
+	struct log_flush_handler_state *state, const struct logging_staging **staging,
+	size_t staging_count, const struct logging **logs, size_t log_count, uint32_t period_ms);
 int log_flush_handler_init_state (const struct log_flush_handler *handler);
 void log_flush_handler_release (const struct log_flush_handler *handler);
 
@@ -35,9 +35,28 @@ void log_flush_handler_execute (const struct periodic_task_handler *handler);
  * @param num_logs The number of logs in the list.
  * @param period_ms The amount of time between log flush requests, in milliseconds.
  */
-#define	log_flush_handler_static_init(state_ptr, logs_ptr, num_logs, period_ms)	{ \
+#define	log_flush_handler_static_init(state_ptr, logs_ptr, num_logs, period_ms)	\
+	log_flush_handler_static_init_with_staging (state_ptr, NULL, 0, logs_ptr, num_logs, period_ms)
+
+/**
+ * Initialize a static instance of a log flush handler that also drains staging logs.  This does not
+ * initialize the handler state.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state Variable context for the handler.
+ * @param staging_ptr The list of staging logs that should be drained.
+ * @param num_staging The number of staging logs in the list.
+ * @param logs_ptr The list of logs that should be flushed.
+ * @param num_logs The number of logs in the list.
+ * @param period_ms The amount of time between log flush requests, in milliseconds.
+ */
+#define	log_flush_handler_static_init_with_staging(state_ptr, staging_ptr, num_staging, \
+	logs_ptr, num_logs, period_ms)	{ \
 		.base = LOG_FLUSH_HANDLER_API_INIT, \
 		.state = state_ptr, \
+		.staging = staging_ptr, \
+		.staging_count = num_staging, \
 		.logs = logs_ptr, \
 		.log_count = num_logs, \
 		.period = period_ms, \
@@ -24,6 +24,13 @@
  */
 #define	LOGGING_HEADER_FORMAT(x)	((x) & 0x0F)
 
+/**
+ * Determine if a log entry ID was assigned after a reference entry ID.  This accounts for entry
+ * IDs that wrap.
+ */
+#define	LOGGING_IS_NEWER_ENTRY(id, ref)	\
+	(((int32_t) ((uint32_t) (id) - (uint32_t) (ref))) > 0)
+
 
 #pragma pack(push, 1)
 
@@ -114,6 +121,21 @@ struct logging {
 	 */
 	int (*read_contents) (const struct logging *logging, uint32_t offset, uint8_t *contents,
 		size_t length);
+
+	/**
+	 * Find the location of the oldest entry in the log that was added after a specific entry.
+	 * Reading the log contents from this offset will return only entries newer than the specified
+	 * entry.
+	 *
+	 * @param logging The log to query.
+	 * @param entry_id ID of the entry to use as the reference.  This would typically be the ID of
+	 * the last entry that has already been read from the log.
+	 *
+	 * @return The offset within the log of the first newer entry or an error code.  If there are no
+	 * newer entries, the current size of the log is returned.  Use ROT_IS_ERROR to check the return
+	 * value.
+	 */
+	int (*get_entry_offset) (const struct logging *logging, uint32_t entry_id);
 };
 
 
@@ -136,6 +158,11 @@ enum {
 	LOGGING_BAD_ENTRY_LENGTH = LOGGING_ERROR (0x0a),		/**< The entry data is not the right size for the log. */
 	LOGGING_NO_LOG_AVAILABLE = LOGGING_ERROR (0x0b),		/**< There is no log available for the operation. */
 	LOGGING_INSUFFICIENT_STORAGE = LOGGING_ERROR (0x0c),	/**< Memory for the log does not meet minimum requirements. */
+	LOGGING_BUFFER_FULL = LOGGING_ERROR (0x0d),				/**< There is no space to buffer the entry. */
+	LOGGING_GET_ENTRY_OFFSET_FAILED = LOGGING_ERROR (0x0e),	/**< The location of an entry could not be determined. */
+	LOGGING_UNSUPPORTED_ENTRY_FORMAT = LOGGING_ERROR (0x0f),	/**< The entry data uses an unknown format. */
+	LOGGING_MALFORMED_ENTRY = LOGGING_ERROR (0x10),			/**< The entry data is truncated or not encoded correctly. */
+	LOGGING_ENTRY_BUFFER_TOO_SMALL = LOGGING_ERROR (0x11),	/**< A buffer for entry data is not large enough. */
 };
 
 
@@ -14,6 +14,67 @@
 #define	LOGGING_FLASH_TERMINATOR	(1U << 15)
 
 
+/**
+ * Mark a sector as no longer containing any log data.  This is done when the sector is erased.
+ *
+ * @param logging The log to update.
+ * @param sector_num The sector being erased.
+ */
+static void logging_flash_release_sector (const struct logging_flash *logging, int sector_num)
+{
+	logging->state->flash_used[sector_num] = 0;
+
+	/* Releasing a sector shifts the offsets of the log data, so the read hint is not valid. */
+	logging->state->read_hint_valid = false;
+
+	if (logging->state->log_start == sector_num) {
+		int next_sector = (logging->state->log_start + 1) % LOGGING_FLASH_SECTORS;
+		if (logging->state->flash_used[next_sector] != 0) {
+			logging->state->log_start = next_sector;
+		}
+	}
+}
+
+/**
+ * Update the entry index for a sector that is about to have entries written to the beginning of it.
+ *
+ * @param logging The log to update.
+ * @param sector_num The sector that will be written.
+ * @param data The entry data that will be written to the start of the sector.
+ */
+static void logging_flash_set_first_entry (const struct logging_flash *logging, int sector_num,
+	const uint8_t *data)
+{
+	struct logging_entry_header header;
+
+	memcpy ((uint8_t*) &header, data, sizeof (header));
+	logging->state->first_entry_id[sector_num] = header.entry_id;
+}
+
+/**
+ * Determine the flash address for the next entries after the entry buffer has been saved.
+ *
+ * @param logging The log being updated.
+ * @param addr The flash address immediately following the saved data.
+ *
+ * @return The flash address where the next entries will be written.
+ */
+static uint32_t logging_flash_get_next_write_addr (const struct logging_flash *logging,
+	uint32_t addr)
+{
+	if ((FLASH_SECTOR_OFFSET (addr) != 0) &&
+		((logging->state->write_remain < (int) sizeof (struct logging_entry_header)) ||
+			logging->state->terminated)) {
+		addr = FLASH_SECTOR_BASE (addr) + FLASH_SECTOR_SIZE;
+	}
+
+	if (addr >= (logging->base_addr + LOGGING_FLASH_AREA_LEN)) {
+		addr = logging->base_addr;
+	}
+
+	return addr;
+}
+
 /**
  * Save the entry buffer to flash.
  *
@@ -38,14 +99,8 @@ static int logging_flash_save_buffer (const struct logging_flash *logging)
 				return status;
 			}
 
-			logging->state->flash_used[curr_sector_num] = 0;
-
-			if (logging->state->log_start == curr_sector_num) {
-				int next_sector = (logging->state->log_start + 1) % LOGGING_FLASH_SECTORS;
-				if (logging->state->flash_used[next_sector] != 0) {
-					logging->state->log_start = next_sector;
-				}
-			}
+			logging_flash_release_sector (logging, curr_sector_num);
+			logging_flash_set_first_entry (logging, curr_sector_num, logging->state->entry_buffer);
 		}
 
 		status = spi_flash_write (logging->flash, logging->state->next_addr,
@@ -65,16 +120,8 @@ static int logging_flash_save_buffer (const struct logging_flash *logging)
 		logging->state->flash_used[curr_sector_num] += write_len;
 
 		if (status == 0) {
-			if ((FLASH_SECTOR_OFFSET (logging->state->next_addr) != 0) &&
-				((logging->state->write_remain < (int) sizeof (struct logging_entry_header)) ||
-					logging->state->terminated)) {
-				logging->state->next_addr =
-					FLASH_SECTOR_BASE (logging->state->next_addr) + FLASH_SECTOR_SIZE;
-			}
-
-			if (logging->state->next_addr >= (logging->base_addr + LOGGING_FLASH_AREA_LEN)) {
-				logging->state->next_addr = logging->base_addr;
-			}
+			logging->state->next_addr =
+				logging_flash_get_next_write_addr (logging, logging->state->next_addr);
 
 			logging->state->next_write = logging->state->entry_buffer;
 			logging->state->write_remain = sizeof (logging->state->entry_buffer) -
@@ -96,6 +143,188 @@ static int logging_flash_save_buffer (const struct logging_flash *logging)
 	return status;
 }
 
+/**
+ * Hand off the contents of the entry buffer to the write buffer so new entries can be added while
+ * the data is written to flash.  The write buffer must be empty.  The state lock must be held by
+ * the caller.
+ *
+ * @param logging The log to update.
+ */
+static void logging_flash_queue_buffer (const struct logging_flash *logging)
+{
+	size_t write_len = logging->state->next_write - logging->state->entry_buffer;
+
+	if (write_len == 0) {
+		return;
+	}
+
+	memcpy (logging->write_buffer, logging->state->entry_buffer, write_len);
+	logging->state->pending_len = write_len;
+	logging->state->pending_addr = logging->state->next_addr;
+	logging->state->pending_terminated = logging->state->terminated;
+
+	/* The pending data is treated as already written, even though it is not yet on flash.  If the
+	 * write doesn't complete, the rest of the data will be retried at the same location. */
+	logging->state->next_addr =
+		logging_flash_get_next_write_addr (logging, logging->state->next_addr + write_len);
+	logging->state->next_write = logging->state->entry_buffer;
+	logging->state->write_remain = sizeof (logging->state->entry_buffer) -
+		FLASH_SECTOR_OFFSET (logging->state->next_addr);
+	logging->state->terminated = false;
+}
+
+/**
+ * Write the data in the write buffer to flash.  The write lock must be held by the caller, but the
+ * state lock must not be.  The state lock is not held while flash is being accessed, so new
+ * entries can be added during the write.
+ *
+ * @param logging The log to save.
+ *
+ * @return 0 if all pending data was written to flash or an error code.
+ */
+static int logging_flash_write_pending (const struct logging_flash *logging)
+{
+	uint32_t addr;
+	size_t write_len;
+	int sector_num;
+	bool erase = false;
+	int status;
+
+	platform_mutex_lock (&logging->state->lock);
+
+	addr = logging->state->pending_addr;
+	write_len = logging->state->pending_len;
+	sector_num = (FLASH_SECTOR_BASE (addr) - logging->base_addr) / FLASH_SECTOR_SIZE;
+
+	if ((write_len != 0) && (FLASH_SECTOR_OFFSET (addr) == 0)) {
+		logging_flash_set_first_entry (logging, sector_num, logging->write_buffer);
+
+		if (logging->state->erased_ahead && (logging->state->erased_addr == addr)) {
+			logging->state->erased_ahead = false;
+		}
+		else {
+			/* Stop reporting the old sector contents before they get erased. */
+			logging_flash_release_sector (logging, sector_num);
+			erase = true;
+		}
+	}
+
+	platform_mutex_unlock (&logging->state->lock);
+
+	if (write_len == 0) {
+		return 0;
+	}
+
+	if (erase) {
+		status = spi_flash_sector_erase (logging->flash, addr);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	status = spi_flash_write (logging->flash, addr, logging->write_buffer, write_len);
+	if (ROT_IS_ERROR (status)) {
+		return status;
+	}
+
+	platform_mutex_lock (&logging->state->lock);
+
+	logging->state->flash_used[sector_num] += status;
+
+	if (status == (int) write_len) {
+		if (logging->state->pending_terminated) {
+			logging->state->flash_used[sector_num] -= sizeof (struct logging_entry_header);
+		}
+
+		logging->state->pending_len = 0;
+		logging->state->pending_terminated = false;
+		status = 0;
+	}
+	else {
+		memmove (logging->write_buffer, &logging->write_buffer[status], write_len - status);
+		logging->state->pending_len -= status;
+		logging->state->pending_addr += status;
+		status = LOGGING_INCOMPLETE_FLUSH;
+	}
+
+	platform_mutex_unlock (&logging->state->lock);
+
+	return status;
+}
+
+/**
+ * Erase the sector that will next be written, if entries will be written to the beginning of a
+ * sector.  The write lock must be held by the caller, but the state lock must not be.
+ *
+ * @param logging The log to update.
+ *
+ * @return 0 if the erase was successful or not needed or an error code.
+ */
+static int logging_flash_erase_ahead (const struct logging_flash *logging)
+{
+	uint32_t addr;
+	int status;
+
+	platform_mutex_lock (&logging->state->lock);
+
+	addr = logging->state->next_addr;
+	if ((logging->state->pending_len != 0) || (FLASH_SECTOR_OFFSET (addr) != 0) ||
+		(logging->state->erased_ahead && (logging->state->erased_addr == addr))) {
+		platform_mutex_unlock (&logging->state->lock);
+		return 0;
+	}
+
+	logging_flash_release_sector (logging,
+		(FLASH_SECTOR_BASE (addr) - logging->base_addr) / FLASH_SECTOR_SIZE);
+	logging->state->erased_ahead = false;
+
+	platform_mutex_unlock (&logging->state->lock);
+
+	status = spi_flash_sector_erase (logging->flash, addr);
+	if (status == 0) {
+		platform_mutex_lock (&logging->state->lock);
+		logging->state->erased_addr = addr;
+		logging->state->erased_ahead = true;
+		platform_mutex_unlock (&logging->state->lock);
+	}
+
+	return status;
+}
+
+/**
+ * Make space available in the entry buffer by handing off the buffered entries to be written to
+ * flash.  If there is already data waiting to be written, it will be written before returning.
+ * The state lock must be held by the caller and will be held on return.
+ *
+ * Entries could be added by other tasks while waiting for flash, so the caller must check again if
+ * there is enough space in the entry buffer.
+ *
+ * @param logging The log to update.
+ *
+ * @return 0 if the entry buffer was handed off or an error code.
+ */
+static int logging_flash_swap_buffer (const struct logging_flash *logging)
+{
+	int status;
+
+	if (logging->state->pending_len != 0) {
+		platform_mutex_unlock (&logging->state->lock);
+
+		platform_mutex_lock (&logging->state->write_lock);
+		status = logging_flash_write_pending (logging);
+		platform_mutex_lock (&logging->state->lock);
+		platform_mutex_unlock (&logging->state->write_lock);
+
+		if ((status != 0) || (logging->state->pending_len != 0)) {
+			return status;
+		}
+	}
+
+	logging_flash_queue_buffer (logging);
+
+	return 0;
+}
+
 /**
  * Write an entry header to the entry buffer.  It assumed there is sufficient space for the header.
  *
@@ -134,7 +363,7 @@ int logging_flash_create_entry (const struct logging *logging, uint8_t *entry, s
 
 	platform_mutex_lock (&flash_log->state->lock);
 
-	if (flash_log->state->terminated ||
+	while (flash_log->state->terminated ||
 		(flash_log->state->write_remain < (int) (sizeof (struct logging_entry_header) + length))) {
 
 		if (!flash_log->state->terminated &&
@@ -143,7 +372,13 @@ int logging_flash_create_entry (const struct logging *logging, uint8_t *entry, s
 			flash_log->state->terminated = true;
 		}
 
-		status = logging_flash_save_buffer (flash_log);
+		if (flash_log->write_buffer == NULL) {
+			status = logging_flash_save_buffer (flash_log);
+		}
+		else {
+			status = logging_flash_swap_buffer (flash_log);
+		}
+
 		if (status != 0) {
 			platform_mutex_unlock (&flash_log->state->lock);
 			return status;
@@ -169,9 +404,33 @@ int logging_flash_flush (const struct logging *logging)
 		return LOGGING_INVALID_ARGUMENT;
 	}
 
-	platform_mutex_lock (&flash_log->state->lock);
-	status = logging_flash_save_buffer (flash_log);
-	platform_mutex_unlock (&flash_log->state->lock);
+	if (flash_log->write_buffer == NULL) {
+		platform_mutex_lock (&flash_log->state->lock);
+		status = logging_flash_save_buffer (flash_log);
+		platform_mutex_unlock (&flash_log->state->lock);
+
+		return status;
+	}
+
+	platform_mutex_lock (&flash_log->state->write_lock);
+
+	/* Finish any entries already handed off before saving the contents of the entry buffer. */
+	status = logging_flash_write_pending (flash_log);
+	if (status == 0) {
+		platform_mutex_lock (&flash_log->state->lock);
+		if (flash_log->state->pending_len == 0) {
+			logging_flash_queue_buffer (flash_log);
+		}
+		platform_mutex_unlock (&flash_log->state->lock);
+
+		status = logging_flash_write_pending (flash_log);
+	}
+
+	if (status == 0) {
+		status = logging_flash_erase_ahead (flash_log);
+	}
+
+	platform_mutex_unlock (&flash_log->state->write_lock);
 
 	return status;
 }
@@ -185,6 +444,7 @@ int logging_flash_clear (const struct logging *logging)
 		return LOGGING_INVALID_ARGUMENT;
 	}
 
+	platform_mutex_lock (&flash_log->state->write_lock);
 	platform_mutex_lock (&flash_log->state->lock);
 
 	status = spi_flash_block_erase (flash_log->flash, flash_log->base_addr);
@@ -194,14 +454,22 @@ int logging_flash_clear (const struct logging *logging)
 
 	memset (flash_log->state->flash_used, 0, sizeof (flash_log->state->flash_used));
 	flash_log->state->log_start = 0;
+	flash_log->state->read_hint_valid = false;
 
 	flash_log->state->next_addr = flash_log->base_addr;
 	flash_log->state->next_write = flash_log->state->entry_buffer;
 	flash_log->state->write_remain = sizeof (flash_log->state->entry_buffer);
 	flash_log->state->terminated = false;
+	flash_log->state->pending_len = 0;
+	flash_log->state->pending_terminated = false;
+
+	/* The first sector was erased with the rest of the block. */
+	flash_log->state->erased_addr = flash_log->base_addr;
+	flash_log->state->erased_ahead = true;
 
 exit:
 	platform_mutex_unlock (&flash_log->state->lock);
+	platform_mutex_unlock (&flash_log->state->write_lock);
 	return status;
 }
 
@@ -221,6 +489,11 @@ int logging_flash_get_size (const struct logging *logging)
 		log_size += flash_log->state->flash_used[sector];
 	}
 
+	log_size += flash_log->state->pending_len;
+	if (flash_log->state->pending_terminated) {
+		log_size -= sizeof (struct logging_entry_header);
+	}
+
 	log_size += (flash_log->state->next_write - flash_log->state->entry_buffer);
 	if (flash_log->state->terminated) {
 		log_size -= sizeof (struct logging_entry_header);
@@ -238,6 +511,7 @@ int logging_flash_read_contents (const struct logging *logging, uint32_t offset,
 	int bytes_read = 0;
 	int i;
 	int sectors;
+	uint32_t sector_offset;
 	size_t read_len;
 	uint32_t read_offset;
 	int status;
@@ -248,8 +522,19 @@ int logging_flash_read_contents (const struct logging *logging, uint32_t offset,
 
 	platform_mutex_lock (&flash_log->state->lock);
 
-	i = flash_log->state->log_start;
-	sectors = 0;
+	/* Sequential reads of the log will continue from the sector where the last read finished
+	 * rather than starting from the first sector each time. */
+	if (flash_log->state->read_hint_valid && (offset >= flash_log->state->read_hint_offset)) {
+		i = flash_log->state->read_hint_sector;
+		sectors = flash_log->state->read_hint_count;
+		sector_offset = flash_log->state->read_hint_offset;
+		offset -= sector_offset;
+	}
+	else {
+		i = flash_log->state->log_start;
+		sectors = 0;
+		sector_offset = 0;
+	}
 
 	while ((length != 0) && (sectors < LOGGING_FLASH_SECTORS) &&
 		(flash_log->state->flash_used[i] != 0)) {
@@ -266,9 +551,15 @@ int logging_flash_read_contents (const struct logging *logging, uint32_t offset,
 				platform_mutex_unlock (&flash_log->state->lock);
 				return status;
 			}
+
+			flash_log->state->read_hint_sector = i;
+			flash_log->state->read_hint_count = sectors;
+			flash_log->state->read_hint_offset = sector_offset;
+			flash_log->state->read_hint_valid = true;
 		}
 
 		bytes_read += read_len;
+		sector_offset += flash_log->state->flash_used[i];
 		contents += read_len;
 		length -= read_len;
 		offset -= read_offset;
@@ -277,7 +568,23 @@ int logging_flash_read_contents (const struct logging *logging, uint32_t offset,
 		sectors++;
 	}
 
-	/* After reading all data from flash, read buffered entries that haven't been flushed yet. */
+	/* After reading all data from flash, read entries that are waiting to be written. */
+	if (flash_log->state->pending_len != 0) {
+		read_len = flash_log->state->pending_len;
+		if (flash_log->state->pending_terminated) {
+			read_len -= sizeof (struct logging_entry_header);
+		}
+		read_offset = (offset < read_len) ? offset : read_len;
+		read_len = (length < (read_len - read_offset)) ? length : (read_len - read_offset);
+
+		memcpy (contents, flash_log->write_buffer + read_offset, read_len);
+		bytes_read += read_len;
+		contents += read_len;
+		length -= read_len;
+		offset -= read_offset;
+	}
+
+	/* Then read buffered entries that haven't been flushed yet. */
 	read_len = flash_log->state->next_write - flash_log->state->entry_buffer;
 	if (flash_log->state->terminated) {
 		read_len -= sizeof (struct logging_entry_header);
@@ -293,6 +600,174 @@ int logging_flash_read_contents (const struct logging *logging, uint32_t offset,
 	return bytes_read;
 }
 
+/**
+ * Find the first entry in a block of log data that is newer than a specified entry.
+ *
+ * @param data The log data to search.
+ * @param length The length of the log data.
+ * @param entry_id The entry ID to compare against.
+ *
+ * @return The offset of the first newer entry or the length of the data if there are no newer
+ * entries.
+ */
+static size_t logging_flash_find_newer_entry (const uint8_t *data, size_t length,
+	uint32_t entry_id)
+{
+	struct logging_entry_header header;
+	size_t pos = 0;
+	size_t entry_len;
+
+	while ((pos < length) && ((length - pos) >= sizeof (header))) {
+		memcpy ((uint8_t*) &header, &data[pos], sizeof (header));
+		if (LOGGING_IS_NEWER_ENTRY (header.entry_id, entry_id)) {
+			return pos;
+		}
+
+		entry_len = header.length & ~LOGGING_FLASH_TERMINATOR;
+		if (entry_len < sizeof (header)) {
+			break;
+		}
+
+		pos += entry_len;
+	}
+
+	return length;
+}
+
+/**
+ * Find the first entry in a sector of the flash log that is newer than a specified entry.  The
+ * state lock must be held by the caller.
+ *
+ * @param logging The log to search.
+ * @param sector The sector to search.
+ * @param entry_id The entry ID to compare against.
+ *
+ * @return The offset within the sector of the first newer entry, the number of bytes used in the
+ * sector if there are no newer entries, or an error code.
+ */
+static int logging_flash_find_newer_entry_in_sector (const struct logging_flash *logging,
+	int sector, uint32_t entry_id)
+{
+	struct logging_entry_header header;
+	uint32_t addr = logging->base_addr + (FLASH_SECTOR_SIZE * sector);
+	uint32_t pos = 0;
+	uint32_t entry_len;
+	int status;
+
+	while ((pos < logging->state->flash_used[sector]) &&
+		((logging->state->flash_used[sector] - pos) >= sizeof (header))) {
+		status = spi_flash_read (logging->flash, addr + pos, (uint8_t*) &header, sizeof (header));
+		if (status != 0) {
+			return status;
+		}
+
+		if (LOGGING_IS_NEWER_ENTRY (header.entry_id, entry_id)) {
+			return pos;
+		}
+
+		entry_len = header.length & ~LOGGING_FLASH_TERMINATOR;
+		if (entry_len < sizeof (header)) {
+			break;
+		}
+
+		pos += entry_len;
+	}
+
+	return logging->state->flash_used[sector];
+}
+
+int logging_flash_get_entry_offset (const struct logging *logging, uint32_t entry_id)
+{
+	const struct logging_flash *flash_log = (const struct logging_flash*) logging;
+	int sectors = 0;
+	int low = 0;
+	int high;
+	int mid;
+	int i;
+	uint32_t offset = 0;
+	size_t buffer_len;
+	int status = 0;
+
+	if (flash_log == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash_log->state->lock);
+
+	while ((sectors < LOGGING_FLASH_SECTORS) &&
+		(flash_log->state->flash_used[(flash_log->state->log_start + sectors) %
+			LOGGING_FLASH_SECTORS] != 0)) {
+		sectors++;
+	}
+
+	/* Entry IDs increase through the log, so the index of the first entry in each sector can be
+	 * binary searched to find the sector that contains the first newer entry. */
+	high = sectors;
+	while (low < high) {
+		mid = low + ((high - low) / 2);
+		i = (flash_log->state->log_start + mid) % LOGGING_FLASH_SECTORS;
+
+		if (LOGGING_IS_NEWER_ENTRY (flash_log->state->first_entry_id[i], entry_id)) {
+			high = mid;
+		}
+		else {
+			low = mid + 1;
+		}
+	}
+
+	if (low > 0) {
+		for (mid = 0; mid < (low - 1); mid++) {
+			offset += flash_log->state->flash_used[(flash_log->state->log_start + mid) %
+				LOGGING_FLASH_SECTORS];
+		}
+
+		i = (flash_log->state->log_start + low - 1) % LOGGING_FLASH_SECTORS;
+		status = logging_flash_find_newer_entry_in_sector (flash_log, i, entry_id);
+		if (ROT_IS_ERROR (status)) {
+			goto exit;
+		}
+
+		offset += status;
+		if ((uint32_t) status < flash_log->state->flash_used[i]) {
+			status = offset;
+			goto exit;
+		}
+	}
+
+	if (low < sectors) {
+		status = offset;
+		goto exit;
+	}
+
+	/* No newer entries on flash, so check the entries that haven't been written yet. */
+	if (flash_log->state->pending_len != 0) {
+		buffer_len = flash_log->state->pending_len;
+		if (flash_log->state->pending_terminated) {
+			buffer_len -= sizeof (struct logging_entry_header);
+		}
+
+		status = logging_flash_find_newer_entry (flash_log->write_buffer, buffer_len, entry_id);
+		offset += status;
+		if ((size_t) status < buffer_len) {
+			status = offset;
+			goto exit;
+		}
+	}
+
+	buffer_len = flash_log->state->next_write - flash_log->state->entry_buffer;
+	if (flash_log->state->terminated) {
+		buffer_len -= sizeof (struct logging_entry_header);
+	}
+
+	status = offset +
+		logging_flash_find_newer_entry (flash_log->state->entry_buffer, buffer_len, entry_id);
+
+exit:
+	platform_mutex_unlock (&flash_log->state->lock);
+
+	return status;
+}
+
 /**
  * Initialize a log that uses flash for persistent storage.  Log entries already on flash will be
  * detected and maintained.
@@ -321,6 +796,7 @@ int logging_flash_init (struct logging_flash *logging, struct logging_flash_stat
 	logging->base.clear = logging_flash_clear;
 	logging->base.get_size = logging_flash_get_size;
 	logging->base.read_contents = logging_flash_read_contents;
+	logging->base.get_entry_offset = logging_flash_get_entry_offset;
 
 	logging->state = state;
 	logging->flash = flash;
@@ -329,6 +805,45 @@ int logging_flash_init (struct logging_flash *logging, struct logging_flash_stat
 	return logging_flash_init_state (logging);
 }
 
+/**
+ * Initialize a log that uses flash for persistent storage and writes entries to flash from a second
+ * buffer.  Log entries already on flash will be detected and maintained.
+ *
+ * Entries will only be written to flash when the log is flushed, unless both buffers are full.
+ * This log should be flushed periodically by a background task.
+ *
+ * The log will consume an entire flash erase block.
+ *
+ * @param logging The log to initialize.
+ * @param state Variable context for the log.  This must be uninitialized.
+ * @param flash The flash device where log entries are stored.
+ * @param base_addr The starting address for log entries.  This must be aligned to the beginning of
+ * an erase block.
+ * @param write_buffer Buffer to hold entries waiting to be written to flash.  This must be
+ * FLASH_SECTOR_SIZE bytes.
+ *
+ * @return 0 if the log was successfully initialized or an error code.
+ */
+int logging_flash_init_double_buffered (struct logging_flash *logging,
+	struct logging_flash_state *state, const struct spi_flash *flash, uint32_t base_addr,
+	uint8_t *write_buffer)
+{
+	int status;
+
+	if (write_buffer == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	status = logging_flash_init (logging, state, flash, base_addr);
+	if (status != 0) {
+		return status;
+	}
+
+	logging->write_buffer = write_buffer;
+
+	return 0;
+}
+
 /**
  * Initialize only the variable state for log in SPI flash.  The rest of the log instance is assumed
  * to have already been initialized.
@@ -435,6 +950,10 @@ int logging_flash_init_state (const struct logging_flash *logging)
 					}
 				}
 
+				if (pos == logging->state->entry_buffer) {
+					logging->state->first_entry_id[curr_sector_num] = header->entry_id;
+				}
+
 				logging->state->flash_used[curr_sector_num] += length;
 				pos += length;
 			}
@@ -455,6 +974,12 @@ int logging_flash_init_state (const struct logging_flash *logging)
 		return status;
 	}
 
+	status = platform_mutex_init (&logging->state->write_lock);
+	if (status != 0) {
+		platform_mutex_free (&logging->state->lock);
+		return status;
+	}
+
 	logging->state->next_addr = flash_addr;
 	logging->state->next_entry_id = entry_id;
 	logging->state->next_write = logging->state->entry_buffer;
@@ -474,5 +999,6 @@ void logging_flash_release (const struct logging_flash *logging)
 {
 	if (logging) {
 		platform_mutex_free (&logging->state->lock);
+		platform_mutex_free (&logging->state->write_lock);
 	}
 }
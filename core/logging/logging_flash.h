@@ -30,23 +30,43 @@ struct logging_flash_state {
 	bool terminated;							/**< Entry buffer has been terminated. */
 	uint32_t next_entry_id;						/**< Next ID to assign to a log entry. */
 	uint32_t flash_used[LOGGING_FLASH_SECTORS];	/**< Number of valid bytes stored in each sector. */
+	uint32_t first_entry_id[LOGGING_FLASH_SECTORS];	/**< ID of the first entry in each sector. */
 	uint32_t next_addr;							/**< Next flash address to write to. */
 	int log_start;								/**< The sector that contains the first entries. */
+	platform_mutex write_lock;					/**< Synchronization for writing the pending buffer. */
+	size_t pending_len;							/**< Bytes in the write buffer waiting for flash. */
+	uint32_t pending_addr;						/**< Flash address for the pending data. */
+	bool pending_terminated;					/**< Pending data ends with a termination entry. */
+	uint32_t erased_addr;						/**< Sector that was erased ahead of being written. */
+	bool erased_ahead;							/**< A sector has been erased ahead of use. */
+	bool read_hint_valid;						/**< The read cursor hint can be used. */
+	int read_hint_sector;						/**< Sector containing the last data read. */
+	int read_hint_count;						/**< Number of sectors before the hint sector. */
+	uint32_t read_hint_offset;					/**< Log offset of the start of the hint sector. */
 };
 
 /**
  * A log that will persistently store entries in SPI flash.
+ *
+ * By default, entries are written to flash by whichever task fills the entry buffer.  A log can
+ * optionally be given a second buffer.  In this case, a full entry buffer is handed off to the
+ * second buffer and only written to flash when the log is flushed, so the task adding entries does
+ * not wait for flash operations.  Flushing will also erase the next sector ahead of it being needed.
  */
 struct logging_flash {
 	struct logging base;						/**< The base logging instance. */
 	struct logging_flash_state *state;			/**< Variable context for the log instance. */
 	const struct spi_flash *flash;				/**< The flash where log entries are stored. */
 	uint32_t base_addr;							/**< The base address of the log data on flash. */
+	uint8_t *write_buffer;						/**< Optional buffer for entries waiting to be written. */
 };
 
 
 int logging_flash_init (struct logging_flash *logging, struct logging_flash_state *state,
 	const struct spi_flash *flash, uint32_t base_addr);
+int logging_flash_init_double_buffered (struct logging_flash *logging,
+	struct logging_flash_state *state, const struct spi_flash *flash, uint32_t base_addr,
+	uint8_t *write_buffer);
 int logging_flash_init_state (const struct logging_flash *logging);
 void logging_flash_release (const struct logging_flash *logging);
 
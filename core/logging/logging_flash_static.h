@@ -14,6 +14,7 @@ int logging_flash_clear (const struct logging *logging);
 int logging_flash_get_size (const struct logging *logging);
 int logging_flash_read_contents (const struct logging *logging, uint32_t offset, uint8_t *contents,
 	size_t length);
+int logging_flash_get_entry_offset (const struct logging *logging, uint32_t entry_id);
 
 
 /**
@@ -33,7 +34,8 @@ int logging_flash_read_contents (const struct logging *logging, uint32_t offset,
 		LOGGING_FLASH_FLUSH_API \
 		.clear = logging_flash_clear, \
 		.get_size = logging_flash_get_size, \
-		.read_contents = logging_flash_read_contents \
+		.read_contents = logging_flash_read_contents, \
+		.get_entry_offset = logging_flash_get_entry_offset \
 	}
 
 
@@ -54,5 +56,27 @@ int logging_flash_read_contents (const struct logging *logging, uint32_t offset,
 		.base_addr = flash_base_addr \
 	}
 
+/**
+ * Initialize a static instance of a log that uses SPI flash and writes entries to flash in the
+ * background from a second buffer.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the log.
+ * @param flash_ptr The flash device where log entries are stored.
+ * @param flash_base_addr The starting address for log entries.  This must be aligned to the
+ * beginning of an erase block.
+ * @param write_buf Buffer to hold entries waiting to be written to flash.  This must be
+ * FLASH_SECTOR_SIZE bytes.
+ */
+#define	logging_flash_static_init_double_buffered(state_ptr, flash_ptr, flash_base_addr, \
+	write_buf)	{ \
+		.base = LOGGING_FLASH_API_INIT, \
+		.state = state_ptr, \
+		.flash = flash_ptr, \
+		.base_addr = flash_base_addr, \
+		.write_buffer = write_buf \
+	}
+
 
 #endif /* LOGGING_FLASH_STATIC_H_ */
@@ -128,6 +128,49 @@ int logging_memory_read_contents (const struct logging *logging, uint32_t offset
 	return bytes_read;
 }
 
+int logging_memory_get_entry_offset (const struct logging *logging, uint32_t entry_id)
+{
+	const struct logging_memory *mem_log = (const struct logging_memory*) logging;
+	const struct logging_entry_header *header;
+	size_t start = 0;
+	size_t low = 0;
+	size_t high = 0;
+	size_t mid;
+
+	if (mem_log == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&mem_log->state->lock);
+
+	if (mem_log->state->is_full) {
+		start = mem_log->state->log_start;
+		high = mem_log->log_size / mem_log->entry_size;
+	}
+	else {
+		high = mem_log->state->log_end / mem_log->entry_size;
+	}
+
+	/* Entries are a fixed size and IDs increase through the log, so a binary search can find the
+	 * first newer entry without checking every entry. */
+	while (low < high) {
+		mid = low + ((high - low) / 2);
+		header = (const struct logging_entry_header*)
+			&mem_log->log_buffer[(start + (mid * mem_log->entry_size)) % mem_log->log_size];
+
+		if (LOGGING_IS_NEWER_ENTRY (header->entry_id, entry_id)) {
+			high = mid;
+		}
+		else {
+			low = mid + 1;
+		}
+	}
+
+	platform_mutex_unlock (&mem_log->state->lock);
+
+	return low * mem_log->entry_size;
+}
+
 /**
  * Initialize a log that stores contents in volatile memory.  The memory for the log will by
  * dynamically allocated to the necessary size.
@@ -207,6 +250,7 @@ int logging_memory_init_from_buffer (struct logging_memory *logging,
 	logging->base.clear = logging_memory_clear;
 	logging->base.get_size = logging_memory_get_size;
 	logging->base.read_contents = logging_memory_read_contents;
+	logging->base.get_entry_offset = logging_memory_get_entry_offset;
 
 	logging->state = state;
 
@@ -220,27 +264,51 @@ int logging_memory_init_from_buffer (struct logging_memory *logging,
  */
 static void logging_memory_find_last_entry (const struct logging_memory *logging)
 {
-	struct logging_entry_header *header = (struct logging_entry_header*) logging->log_buffer;
-	struct logging_entry_header *prev = NULL;
+	const struct logging_entry_header *first =
+		(const struct logging_entry_header*) logging->log_buffer;
+	const struct logging_entry_header *header;
+	size_t entry_count = logging->log_size / logging->entry_size;
+	size_t low = 1;
+	size_t high = entry_count;
+	size_t mid;
+
+	if (!LOGGING_IS_ENTRY_START (first->log_magic)) {
+		return;
+	}
 
-	while (!logging->state->is_full && (logging->state->log_end != logging->log_size) &&
-		LOGGING_IS_ENTRY_START (header->log_magic)) {
-		if (prev && (header->entry_id != logging->state->next_entry_id)) {
-			logging->state->is_full = true;
-			logging->state->log_start = logging->state->log_end;
+	/* Entries are added with consecutive IDs, so the end of the log is the first entry that does
+	 * not continue the sequence from the start of the buffer.  Since entries are a fixed size, the
+	 * entry index can be used to binary search for this location. */
+	while (low < high) {
+		mid = low + ((high - low) / 2);
+		header = (const struct logging_entry_header*)
+			&logging->log_buffer[mid * logging->entry_size];
+
+		if (LOGGING_IS_ENTRY_START (header->log_magic) &&
+			(header->entry_id == (uint32_t) (first->entry_id + mid))) {
+			low = mid + 1;
 		}
 		else {
-			prev = header;
-			logging->state->next_entry_id = header->entry_id + 1;
-			logging->state->log_end += logging->entry_size;
-			header = (struct logging_entry_header*) &logging->log_buffer[logging->state->log_end];
+			high = mid;
 		}
 	}
 
-	if (logging->state->log_end == logging->log_size) {
+	logging->state->next_entry_id = first->entry_id + low;
+	logging->state->log_end = low * logging->entry_size;
+
+	if (low == entry_count) {
 		logging->state->is_full = true;
 		logging->state->log_end = 0;
 	}
+	else {
+		header = (const struct logging_entry_header*)
+			&logging->log_buffer[logging->state->log_end];
+
+		if (LOGGING_IS_ENTRY_START (header->log_magic)) {
+			logging->state->is_full = true;
+			logging->state->log_start = logging->state->log_end;
+		}
+	}
 }
 
 /**
@@ -250,10 +318,11 @@ static void logging_memory_find_last_entry (const struct logging_memory *logging
  * If the provided buffer is not aligned to the size of the entry, including the logging header,
  * the usable buffer will be truncated to generate this alignment.
  *
- * The buffer is scanned for the first entry location that does not contain a valid entry or that
+ * The buffer is searched for the first entry location that does not contain a valid entry or that
  * has a discontinuity in entry IDs.  This will mark the current end of the log, and new entries
  * will be added starting at this location.  If this location contains a valid entry, it is assumed
- * that the log is full and the rest of the buffer also contains valid entries.  If this is not
+ * that the log is full and the rest of the buffer also contains valid entries.  It is also assumed
+ * that no entries after the end of the log continue the sequence of entry IDs.  If this is not
  * guaranteed by the caller, reading the log could result in corrupt log entries.
  *
  * @param logging The log to initialize.
@@ -14,6 +14,7 @@ int logging_memory_clear (const struct logging *logging);
 int logging_memory_get_size (const struct logging *logging);
 int logging_memory_read_contents (const struct logging *logging, uint32_t offset, uint8_t *contents,
 	size_t length);
+int logging_memory_get_entry_offset (const struct logging *logging, uint32_t entry_id);
 
 
 /**
@@ -33,7 +34,8 @@ int logging_memory_read_contents (const struct logging *logging, uint32_t offset
 		LOGGING_MEMORY_FLUSH_API \
 		.clear = logging_memory_clear, \
 		.get_size = logging_memory_get_size, \
-		.read_contents = logging_memory_read_contents \
+		.read_contents = logging_memory_read_contents, \
+		.get_entry_offset = logging_memory_get_entry_offset \
 	}
 
 
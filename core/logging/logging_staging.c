@@ -0,0 +1,323 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "logging_staging.h"
+#include "logging_staging_static.h"
+
+
+/**
+ * Length marker indicating the rest of the ring, up to the end of the buffer, is not used.
+ */
+#define	LOGGING_STAGING_PADDING		0xffff
+
+
+int logging_staging_create_entry (const struct logging *logging, uint8_t *entry, size_t length)
+{
+	const struct logging_staging *staging = (const struct logging_staging*) logging;
+	uint16_t entry_len;
+	uint32_t head;
+	uint32_t used;
+	size_t record_len;
+	size_t pos;
+	size_t contiguous;
+	size_t pad = 0;
+
+	if ((staging == NULL) || (entry == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	record_len = sizeof (entry_len) + length;
+	if ((length == 0) || (length >= LOGGING_STAGING_PADDING) ||
+		(record_len > staging->ring_size)) {
+		return LOGGING_BAD_ENTRY_LENGTH;
+	}
+
+	head = staging->state->head;
+	used = head - staging->state->tail;
+
+	/* Don't write any new data until the consumer is done with the space. */
+	platform_memory_barrier ();
+
+	/* Entries are always contiguous in the ring.  If there isn't enough space before the end of the
+	 * buffer, skip to the beginning. */
+	pos = head & (staging->ring_size - 1);
+	contiguous = staging->ring_size - pos;
+	if (contiguous < record_len) {
+		pad = contiguous;
+	}
+
+	if ((used + pad + record_len) > staging->ring_size) {
+		staging->state->dropped++;
+		return LOGGING_BUFFER_FULL;
+	}
+
+	if (pad != 0) {
+		if (pad >= sizeof (entry_len)) {
+			entry_len = LOGGING_STAGING_PADDING;
+			memcpy (&staging->ring[pos], &entry_len, sizeof (entry_len));
+		}
+
+		pos = 0;
+	}
+
+	entry_len = length;
+	memcpy (&staging->ring[pos], &entry_len, sizeof (entry_len));
+	memcpy (&staging->ring[pos + sizeof (entry_len)], entry, length);
+
+	/* Make sure the entry is complete before it is visible to the consumer. */
+	platform_memory_barrier ();
+	staging->state->head = head + pad + record_len;
+
+	return 0;
+}
+
+/**
+ * Move all staged entries to the shared log.  The lock must be held by the caller.
+ *
+ * @param staging The staging log to drain.
+ *
+ * @return 0 if all entries were added to the shared log or an error code.  Entries are removed from
+ * the ring even if they could not be added to the shared log.
+ */
+static int logging_staging_drain_entries (const struct logging_staging *staging)
+{
+	uint16_t entry_len;
+	uint32_t head;
+	uint32_t tail;
+	size_t pos;
+	size_t contiguous;
+	int entry_status;
+	int status = 0;
+
+	tail = staging->state->tail;
+	head = staging->state->head;
+
+	/* Don't read any entry data until the current head position is known. */
+	platform_memory_barrier ();
+
+	while (tail != head) {
+		pos = tail & (staging->ring_size - 1);
+		contiguous = staging->ring_size - pos;
+
+		if (contiguous >= sizeof (entry_len)) {
+			memcpy (&entry_len, &staging->ring[pos], sizeof (entry_len));
+		}
+		else {
+			entry_len = LOGGING_STAGING_PADDING;
+		}
+
+		if (entry_len == LOGGING_STAGING_PADDING) {
+			tail += contiguous;
+		}
+		else {
+			entry_status = staging->log->create_entry (staging->log,
+				&staging->ring[pos + sizeof (entry_len)], entry_len);
+			if ((entry_status != 0) && (status == 0)) {
+				status = entry_status;
+			}
+
+			tail += sizeof (entry_len) + entry_len;
+		}
+
+		/* Release the space back to the producer only after the entry has been consumed. */
+		platform_memory_barrier ();
+		staging->state->tail = tail;
+	}
+
+	return status;
+}
+
+#ifndef LOGGING_DISABLE_FLUSH
+int logging_staging_flush (const struct logging *logging)
+{
+	const struct logging_staging *staging = (const struct logging_staging*) logging;
+	int status;
+	int flush_status;
+
+	if (staging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	status = logging_staging_drain (staging);
+	flush_status = staging->log->flush (staging->log);
+
+	return (status != 0) ? status : flush_status;
+}
+#endif
+
+int logging_staging_clear (const struct logging *logging)
+{
+	const struct logging_staging *staging = (const struct logging_staging*) logging;
+
+	if (staging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&staging->state->lock);
+
+	/* Discard everything that has been staged.  Entries added after this point will be kept. */
+	staging->state->tail = staging->state->head;
+
+	platform_mutex_unlock (&staging->state->lock);
+
+	return staging->log->clear (staging->log);
+}
+
+int logging_staging_get_size (const struct logging *logging)
+{
+	const struct logging_staging *staging = (const struct logging_staging*) logging;
+
+	if (staging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	return staging->log->get_size (staging->log);
+}
+
+int logging_staging_read_contents (const struct logging *logging, uint32_t offset,
+	uint8_t *contents, size_t length)
+{
+	const struct logging_staging *staging = (const struct logging_staging*) logging;
+
+	if (staging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	return staging->log->read_contents (staging->log, offset, contents, length);
+}
+
+int logging_staging_get_entry_offset (const struct logging *logging, uint32_t entry_id)
+{
+	const struct logging_staging *staging = (const struct logging_staging*) logging;
+
+	if (staging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	return staging->log->get_entry_offset (staging->log, entry_id);
+}
+
+/**
+ * Initialize a log that stages entries before adding them to a shared log.
+ *
+ * Entries added to the staging log will not be visible when reading the log contents until the
+ * staging log has been flushed or drained.
+ *
+ * @param logging The staging log to initialize.
+ * @param state Variable context for the log.  This must be uninitialized.
+ * @param log The shared log that will receive the staged entries.
+ * @param ring Buffer to use for staging entries.
+ * @param ring_size Size of the staging buffer.  This must be a power of 2.
+ *
+ * @return 0 if the log was successfully initialized or an error code.
+ */
+int logging_staging_init (struct logging_staging *logging, struct logging_staging_state *state,
+	const struct logging *log, uint8_t *ring, size_t ring_size)
+{
+	if (logging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	memset (logging, 0, sizeof (struct logging_staging));
+
+	logging->base.create_entry = logging_staging_create_entry;
+#ifndef LOGGING_DISABLE_FLUSH
+	logging->base.flush = logging_staging_flush;
+#endif
+	logging->base.clear = logging_staging_clear;
+	logging->base.get_size = logging_staging_get_size;
+	logging->base.read_contents = logging_staging_read_contents;
+	logging->base.get_entry_offset = logging_staging_get_entry_offset;
+
+	logging->state = state;
+	logging->log = log;
+	logging->ring = ring;
+	logging->ring_size = ring_size;
+
+	return logging_staging_init_state (logging);
+}
+
+/**
+ * Initialize only the variable state for a staging log.  The rest of the log instance is assumed to
+ * have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param logging The log instance that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int logging_staging_init_state (const struct logging_staging *logging)
+{
+	if ((logging == NULL) || (logging->state == NULL) || (logging->log == NULL) ||
+		(logging->ring == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	if ((logging->ring_size & (logging->ring_size - 1)) != 0) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	if (logging->ring_size <= sizeof (uint16_t)) {
+		return LOGGING_INSUFFICIENT_STORAGE;
+	}
+
+	memset (logging->state, 0, sizeof (struct logging_staging_state));
+
+	return platform_mutex_init (&logging->state->lock);
+}
+
+/**
+ * Release the resources used by a staging log.  Any entries that have not been drained will be
+ * lost.
+ *
+ * @param logging The log to release.
+ */
+void logging_staging_release (const struct logging_staging *logging)
+{
+	if (logging) {
+		platform_mutex_free (&logging->state->lock);
+	}
+}
+
+/**
+ * Move all staged entries to the shared log without flushing the shared log.
+ *
+ * @param logging The staging log to drain.
+ *
+ * @return 0 if all entries were added to the shared log or an error code.  Entries are removed from
+ * the staging log even if they could not be added to the shared log.
+ */
+int logging_staging_drain (const struct logging_staging *logging)
+{
+	int status;
+
+	if (logging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&logging->state->lock);
+	status = logging_staging_drain_entries (logging);
+	platform_mutex_unlock (&logging->state->lock);
+
+	return status;
+}
+
+/**
+ * Get the number of entries that were discarded because the staging buffer was full.
+ *
+ * @param logging The staging log to query.
+ *
+ * @return The number of discarded entries.
+ */
+uint32_t logging_staging_get_dropped_count (const struct logging_staging *logging)
+{
+	if (logging == NULL) {
+		return 0;
+	}
+
+	return logging->state->dropped;
+}
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef LOGGING_STAGING_H_
+#define LOGGING_STAGING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "logging.h"
+#include "platform_api.h"
+
+
+/**
+ * Variable context for a staging log.
+ */
+struct logging_staging_state {
+	platform_mutex lock;				/**< Synchronization for draining staged entries. */
+	volatile uint32_t head;				/**< Total bytes added to the ring.  Only updated by the producer. */
+	volatile uint32_t tail;				/**< Total bytes removed from the ring.  Only updated when draining. */
+	volatile uint32_t dropped;			/**< Number of entries discarded because the ring was full. */
+};
+
+/**
+ * A log that stages entries in a single-producer, single-consumer ring buffer before adding them to
+ * a shared log.  Adding an entry never takes a lock or touches the storage for the shared log, so
+ * each task that needs non-blocking logging should have its own staging log.  Entries are moved to
+ * the shared log when the staging log is drained, which would normally be done by a log flush
+ * handler initialized with {@link log_flush_handler_init_with_staging}.
+ *
+ * Only a single task can add entries to a staging log.  Tasks that share a log each get their own
+ * staging log for it.  Any task can flush, drain, clear, or read from a staging log.
+ */
+struct logging_staging {
+	struct logging base;				/**< The base logging instance. */
+	struct logging_staging_state *state;	/**< Variable context for the log instance. */
+	const struct logging *log;			/**< The shared log that will receive staged entries. */
+	uint8_t *ring;						/**< Buffer used to stage log entries. */
+	size_t ring_size;					/**< Size of the staging buffer.  This must be a power of 2. */
+};
+
+
+int logging_staging_init (struct logging_staging *logging, struct logging_staging_state *state,
+	const struct logging *log, uint8_t *ring, size_t ring_size);
+int logging_staging_init_state (const struct logging_staging *logging);
+void logging_staging_release (const struct logging_staging *logging);
+
+int logging_staging_drain (const struct logging_staging *logging);
+uint32_t logging_staging_get_dropped_count (const struct logging_staging *logging);
+
+
+#endif /* LOGGING_STAGING_H_ */
@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef LOGGING_STAGING_STATIC_H_
+#define LOGGING_STAGING_STATIC_H_
+
+#include "logging/logging_staging.h"
+
+
+/* Internal functions declared to allow for static initialization. */
+int logging_staging_create_entry (const struct logging *logging, uint8_t *entry, size_t length);
+int logging_staging_flush (const struct logging *logging);
+int logging_staging_clear (const struct logging *logging);
+int logging_staging_get_size (const struct logging *logging);
+int logging_staging_read_contents (const struct logging *logging, uint32_t offset,
+	uint8_t *contents, size_t length);
+int logging_staging_get_entry_offset (const struct logging *logging, uint32_t entry_id);
+
+
+/**
+ * Constant initializer for the flush operation.
+ */
+#ifndef LOGGING_DISABLE_FLUSH
+#define	LOGGING_STAGING_FLUSH_API	.flush = logging_staging_flush,
+#else
+#define	LOGGING_STAGING_FLUSH_API
+#endif
+
+/**
+ * Constant initializer for the logging API.
+ */
+#define	LOGGING_STAGING_API_INIT  { \
+		.create_entry = logging_staging_create_entry, \
+		LOGGING_STAGING_FLUSH_API \
+		.clear = logging_staging_clear, \
+		.get_size = logging_staging_get_size, \
+		.read_contents = logging_staging_read_contents, \
+		.get_entry_offset = logging_staging_get_entry_offset \
+	}
+
+
+/**
+ * Initialize a static instance of a staging log.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the log.
+ * @param log_ptr The shared log that will receive staged entries.
+ * @param ring_ptr Buffer to use for staging entries.
+ * @param ring_len Size of the staging buffer.  This must be a power of 2.
+ */
+#define	logging_staging_static_init(state_ptr, log_ptr, ring_ptr, ring_len)	{ \
+		.base = LOGGING_STAGING_API_INIT, \
+		.state = state_ptr, \
+		.log = log_ptr, \
+		.ring = ring_ptr, \
+		.ring_size = ring_len \
+	}
+
+
+#endif /* LOGGING_STAGING_STATIC_H_ */
@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "trace_ring.h"
+
+
+/**
+ * Initialize a ring for recording trace events.
+ *
+ * @param ring The trace ring to initialize.
+ * @param events Storage for the events in the ring.
+ * @param count The number of events that can be stored.  This must be a power of 2.
+ * @param thread_id Identifier for the thread that will record events in the ring.
+ *
+ * @return 0 if the trace ring was initialized successfully or an error code.
+ */
+int trace_ring_init (struct trace_ring *ring, struct trace_ring_event *events, size_t count,
+	uint32_t thread_id)
+{
+	if ((ring == NULL) || (events == NULL) || (count == 0) || ((count & (count - 1)) != 0)) {
+		return TRACE_RING_INVALID_ARGUMENT;
+	}
+
+	memset (ring, 0, sizeof (struct trace_ring));
+
+	ring->events = events;
+	ring->mask = count - 1;
+	ring->thread_id = thread_id;
+
+	return 0;
+}
+
+/**
+ * Remove all events from a trace ring.
+ *
+ * @param ring The trace ring to clear.
+ */
+void trace_ring_clear (struct trace_ring *ring)
+{
+	if (ring != NULL) {
+		ring->next = 0;
+		ring->used = 0;
+	}
+}
+
+/**
+ * Add an event to a trace ring.  If the ring is full, the oldest event will be overwritten.
+ *
+ * @param ring The trace ring to update.
+ * @param point The trace point that generated the event.
+ * @param type The type of event being recorded.
+ * @param arg Context for the event.
+ * @param timestamp The time at which the event occurred.
+ */
+void trace_ring_record (struct trace_ring *ring, uint16_t point, uint8_t type, uint32_t arg,
+	uint64_t timestamp)
+{
+	struct trace_ring_event *event;
+
+	if (ring == NULL) {
+		return;
+	}
+
+	event = &ring->events[ring->next];
+	event->timestamp = timestamp;
+	event->arg = arg;
+	event->point = point;
+	event->type = type;
+	event->reserved = 0;
+
+	ring->next = (ring->next + 1) & ring->mask;
+	if (ring->used <= ring->mask) {
+		ring->used++;
+	}
+}
+
+/**
+ * Get the number of events currently stored in a trace ring.
+ *
+ * @param ring The trace ring to query.
+ *
+ * @return The number of events in the ring.
+ */
+size_t trace_ring_get_event_count (const struct trace_ring *ring)
+{
+	if (ring == NULL) {
+		return 0;
+	}
+
+	return ring->used;
+}
+
+/**
+ * Get an event stored in a trace ring.  Events are indexed from oldest to newest.
+ *
+ * @param ring The trace ring to query.
+ * @param index Index of the event to get, where 0 is the oldest event in the ring.
+ *
+ * @return The requested event or null if the index is not valid.
+ */
+const struct trace_ring_event* trace_ring_get_event (const struct trace_ring *ring, size_t index)
+{
+	if ((ring == NULL) || (index >= ring->used)) {
+		return NULL;
+	}
+
+	return &ring->events[(ring->next - ring->used + index) & ring->mask];
+}
+
+#ifdef LOGGING_ENABLE_TRACE_RING
+/**
+ * Record the start of an instrumented code path in the trace ring for the current thread.  Nothing
+ * is recorded if the thread does not have a trace ring.
+ *
+ * @param point The trace point being entered.
+ * @param arg Context for the event.
+ */
+void trace_ring_begin (uint16_t point, uint32_t arg)
+{
+	struct trace_ring *ring = trace_ring_get_current ();
+
+	if (ring != NULL) {
+		trace_ring_record (ring, point, TRACE_RING_EVENT_BEGIN, arg, trace_ring_get_timestamp ());
+	}
+}
+
+/**
+ * Record the completion of an instrumented code path in the trace ring for the current thread.
+ * Nothing is recorded if the thread does not have a trace ring.
+ *
+ * @param point The trace point being exited.
+ * @param arg Result of the operation.
+ */
+void trace_ring_end (uint16_t point, uint32_t arg)
+{
+	struct trace_ring *ring = trace_ring_get_current ();
+
+	if (ring != NULL) {
+		trace_ring_record (ring, point, TRACE_RING_EVENT_END, arg, trace_ring_get_timestamp ());
+	}
+}
+#endif
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef TRACE_RING_H_
+#define TRACE_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "status/rot_status.h"
+
+
+/**
+ * Identifiers for the code paths that have been instrumented with trace points.
+ */
+enum trace_ring_point {
+	TRACE_RING_POINT_MCTP_PROCESS_PACKET = 0,	/**< Processing of a received MCTP packet. */
+	TRACE_RING_POINT_CMD_PROCESS_REQUEST,		/**< Command handler processing a request. */
+	TRACE_RING_POINT_FLASH_READ,				/**< Read of data from SPI flash. */
+	TRACE_RING_POINT_HASH_UPDATE,				/**< Hash update with data read from flash. */
+	TRACE_RING_NUM_POINTS						/**< Number of defined trace points. */
+};
+
+/**
+ * The types of events that can be recorded in a trace ring.
+ */
+enum trace_ring_event_type {
+	TRACE_RING_EVENT_BEGIN = 0,					/**< Start of an instrumented code path. */
+	TRACE_RING_EVENT_END,						/**< Completion of an instrumented code path. */
+};
+
+/**
+ * A single event recorded in a trace ring.
+ */
+struct trace_ring_event {
+	uint64_t timestamp;				/**< Platform timestamp when the event was recorded. */
+	uint32_t arg;					/**< Context for the event.  Meaning depends on the trace point. */
+	uint16_t point;					/**< The trace point that generated the event. */
+	uint8_t type;					/**< The type of event. */
+	uint8_t reserved;				/**< Unused. */
+};
+
+/**
+ * A fixed-size ring of trace events.  Once the ring is full, new events overwrite the oldest
+ * events.
+ *
+ * Each ring must only be written by a single thread, so no locking is used when events are
+ * recorded.  Reading events from a ring while the owning thread is still recording can return
+ * events that are being overwritten.
+ */
+struct trace_ring {
+	struct trace_ring_event *events;	/**< Storage for the events in the ring. */
+	size_t mask;					/**< Mask to apply to the index for wrapping around the ring. */
+	size_t next;					/**< Index where the next event will be written. */
+	size_t used;					/**< Number of valid events in the ring. */
+	uint32_t thread_id;				/**< Identifier for the thread that owns the ring. */
+};
+
+
+int trace_ring_init (struct trace_ring *ring, struct trace_ring_event *events, size_t count,
+	uint32_t thread_id);
+void trace_ring_clear (struct trace_ring *ring);
+
+void trace_ring_record (struct trace_ring *ring, uint16_t point, uint8_t type, uint32_t arg,
+	uint64_t timestamp);
+
+size_t trace_ring_get_event_count (const struct trace_ring *ring);
+const struct trace_ring_event* trace_ring_get_event (const struct trace_ring *ring, size_t index);
+
+
+/* Platform functions that must be available when trace points are enabled. */
+
+/**
+ * Get the trace ring that should be used for events generated by the calling thread.
+ *
+ * @return The trace ring for the current thread or null if events from the thread are not being
+ * traced.
+ */
+struct trace_ring* trace_ring_get_current (void);
+
+/**
+ * Get a monotonic timestamp for a trace event.  The units depend on the platform and should be the
+ * highest resolution counter that is cheap to read, such as a cycle counter.
+ *
+ * @return The current timestamp.
+ */
+uint64_t trace_ring_get_timestamp (void);
+
+
+#ifdef LOGGING_ENABLE_TRACE_RING
+void trace_ring_begin (uint16_t point, uint32_t arg);
+void trace_ring_end (uint16_t point, uint32_t arg);
+
+/**
+ * Record the start of an instrumented code path in the trace ring for the current thread.
+ *
+ * @param point The trace point being entered.
+ * @param arg Context for the event, such as a command ID or data length.
+ */
+#define	TRACE_RING_BEGIN(point, arg)	trace_ring_begin (point, arg)
+
+/**
+ * Record the completion of an instrumented code path in the trace ring for the current thread.
+ *
+ * @param point The trace point being exited.
+ * @param arg Result of the operation, such as the status code.
+ */
+#define	TRACE_RING_END(point, arg)		trace_ring_end (point, arg)
+#else
+#define	TRACE_RING_BEGIN(point, arg)
+#define	TRACE_RING_END(point, arg)
+#endif
+
+
+#define	TRACE_RING_ERROR(code)		ROT_ERROR (ROT_MODULE_TRACE_RING, code)
+
+/**
+ * Error codes that can be generated by a trace ring.
+ */
+enum {
+	TRACE_RING_INVALID_ARGUMENT = TRACE_RING_ERROR (0x00),		/**< Input parameter is null or not valid. */
+	TRACE_RING_EXPORT_FAILED = TRACE_RING_ERROR (0x01),			/**< The trace events could not be exported. */
+};
+
+
+#endif /* TRACE_RING_H_ */
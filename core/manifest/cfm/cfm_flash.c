@@ -14,6 +14,15 @@
 #include "cfm_flash.h"
 
 
+/**
+ * Get a memory pool to use for a CFM allocation.
+ *
+ * @param cfm The CFM being queried.
+ * @param type The type of pool to get.
+ */
+#define	CFM_FLASH_POOL(cfm, type)	\
+	((((cfm) != NULL) && ((cfm)->pools != NULL)) ? (cfm)->pools->type : NULL)
+
 static int cfm_flash_verify (struct manifest *cfm, struct hash_engine *hash,
 	const struct signature_verification *verification, uint8_t *hash_out, size_t hash_length)
 {
@@ -463,9 +472,7 @@ static int cfm_flash_get_component_pmr (struct cfm *cfm, uint32_t component_id,
  */
 static void cfm_flash_free_cfm_digests (struct cfm_flash *cfm_flash, struct cfm_digests *digests)
 {
-	UNUSED (cfm_flash);
-
-	platform_free ((void*) digests->digests);
+	object_pool_free (CFM_FLASH_POOL (cfm_flash, digests), (void*) digests->digests);
 	digests->digests = NULL;
 }
 
@@ -488,7 +495,7 @@ static void cfm_flash_free_cfm_allowable_digests (struct cfm_flash *cfm_flash,
 		cfm_flash_free_cfm_digests (cfm_flash, &allowable_digests[i].digests);
 	}
 
-	platform_free ((void*) allowable_digests);
+	object_pool_free (CFM_FLASH_POOL (cfm_flash, digests), (void*) allowable_digests);
 }
 
 /**
@@ -519,7 +526,7 @@ static int cfm_flash_populate_digests (struct cfm_flash *cfm_flash, struct cfm_d
 
 	digests_len = hash_len * digest_count;
 
-	digests->digests = platform_malloc (digests_len);
+	digests->digests = object_pool_allocate (CFM_FLASH_POOL (cfm_flash, digests), digests_len);
 	if (digests->digests == NULL) {
 		return CFM_NO_MEMORY;
 	}
@@ -606,7 +613,8 @@ static int cfm_flash_populate_allowable_digests (struct cfm_flash *cfm_flash,
 		offset += sizeof (struct cfm_allowable_digest_element);
 
 		// Allocate space for digests list
-		curr_allowable_digest->digests.digests = platform_malloc (digests_len);
+		curr_allowable_digest->digests.digests =
+			object_pool_allocate (CFM_FLASH_POOL (cfm_flash, digests), digests_len);
 		if (curr_allowable_digest->digests.digests == NULL) {
 			return CFM_NO_MEMORY;
 		}
@@ -732,7 +740,8 @@ static int cfm_flash_get_next_measurement (struct cfm *cfm,
 	pmr_measurement->pmr_id = measurement_element.pmr_id;
 	pmr_measurement->measurement_id = measurement_element.measurement_id;
 	pmr_measurement->allowable_digests_count = measurement_element.allowable_digest_count;
-	pmr_measurement->allowable_digests = platform_calloc (
+	pmr_measurement->allowable_digests =
+		object_pool_allocate_zeroize (CFM_FLASH_POOL (cfm_flash, digests),
 		pmr_measurement->allowable_digests_count, sizeof (struct cfm_allowable_digests));
 
 	// Retrieve list of cfm_allowable_digests
@@ -820,7 +829,7 @@ static void cfm_flash_free_measurement_container (struct cfm *cfm,
 {
 	if ((cfm != NULL) && (container != NULL)) {
 		cfm_flash_free_measurement_container_internal (cfm, container);
-		platform_free (container->context);
+		object_pool_free (CFM_FLASH_POOL ((struct cfm_flash*) cfm, contexts), container->context);
 		container->context = NULL;
 	}
 }
@@ -1113,14 +1122,17 @@ static int cfm_flash_get_next_measurement_or_measurement_data (struct cfm *cfm,
 	if (first) {
 		memset (container, 0, sizeof (struct cfm_measurement_container));
 
-		container->context = platform_calloc (sizeof (struct cfm_flash_measurement_context), 1);
+		container->context = object_pool_allocate_zeroize (
+			CFM_FLASH_POOL ((struct cfm_flash*) cfm, contexts), 1,
+			sizeof (struct cfm_flash_measurement_context));
 		context = (struct cfm_flash_measurement_context*) container->context;
 
 		context->version_set_element = cfm_flash_determine_version_set_element (cfm, component_id,
 			&comp_device_entry, &context->comp_device_hash_type);
 		if (ROT_IS_ERROR (context->version_set_element)) {
 			status = context->version_set_element;
-			platform_free (container->context);
+			object_pool_free (CFM_FLASH_POOL ((struct cfm_flash*) cfm, contexts),
+				container->context);
 			container->context = NULL;
 
 			return status;
@@ -1485,3 +1497,18 @@ void cfm_flash_release (struct cfm_flash *cfm)
 		manifest_flash_release (&cfm->base_flash);
 	}
 }
+
+/**
+ * Configure the CFM to allocate digest lists and measurement contexts from memory pools instead of
+ * the system heap.  This must be called before any data is requested from the CFM, and any data
+ * must be freed before the pools are changed.
+ *
+ * @param cfm The CFM instance to configure.
+ * @param pools The memory pools to use for CFM data.  Null to use the system heap for all data.
+ */
+void cfm_flash_use_pools (struct cfm_flash *cfm, const struct cfm_flash_pools *pools)
+{
+	if (cfm != NULL) {
+		cfm->pools = pools;
+	}
+}
@@ -8,14 +8,26 @@
 #include "cfm.h"
 #include "manifest/manifest_flash.h"
 #include "flash/flash.h"
+#include "memory_mgmt/object_pool.h"
 
 
+/**
+ * Memory pools that can be used for data generated from a CFM.  A null pool will cause that type
+ * of data to be allocated from the system heap.  Any data that is larger than a pool block will
+ * also be allocated from the system heap.
+ */
+struct cfm_flash_pools {
+	const struct object_pool *digests;			/**< Pool for digest and allowable digest lists. */
+	const struct object_pool *contexts;			/**< Pool for measurement iteration contexts. */
+};
+
 /**
  * Defines a CFM that is stored in flash memory.
  */
 struct cfm_flash {
 	struct cfm base;							/**< The base CFM instance. */
 	struct manifest_flash base_flash;			/**< The base CFM flash instance. */
+	const struct cfm_flash_pools *pools;		/**< Optional memory pools for generated data. */
 };
 
 
@@ -24,5 +36,7 @@ int cfm_flash_init (struct cfm_flash *cfm, const struct flash *flash, struct has
 	size_t max_platform_id);
 void cfm_flash_release (struct cfm_flash *cfm);
 
+void cfm_flash_use_pools (struct cfm_flash *cfm, const struct cfm_flash_pools *pools);
+
 
 #endif //CFM_FLASH_H
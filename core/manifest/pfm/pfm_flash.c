@@ -18,6 +18,37 @@
  */
 static const char *NO_FW_IDS[] = {NULL};
 
+/**
+ * Get a memory pool to use for a PFM list.
+ *
+ * @param pfm The PFM being queried.
+ * @param type The type of pool to get.
+ */
+#define	PFM_FLASH_POOL(pfm, type)	\
+	((((pfm) != NULL) && ((pfm)->pools != NULL)) ? (pfm)->pools->type : NULL)
+
+
+/**
+ * Allocate a copy of an identifier string.
+ *
+ * @param pfm The PFM that contains the string.
+ * @param str The string to copy.
+ *
+ * @return The allocated copy of the string or null if there is no memory available.
+ */
+static char* pfm_flash_copy_string (struct pfm_flash *pfm, const char *str)
+{
+	size_t length = strlen (str) + 1;
+	char *copy;
+
+	copy = object_pool_allocate (PFM_FLASH_POOL (pfm, strings), length);
+	if (copy != NULL) {
+		memcpy (copy, str, length);
+	}
+
+	return copy;
+}
+
 
 static int pfm_flash_verify (struct manifest *pfm, struct hash_engine *hash,
 	const struct signature_verification *verification, uint8_t *hash_out, size_t hash_length)
@@ -197,16 +228,15 @@ static int pfm_flash_is_empty (struct manifest *pfm)
 
 static void pfm_flash_free_firmware (struct pfm *pfm, struct pfm_firmware *fw)
 {
+	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
 	size_t i;
 
-	UNUSED (pfm);
-
 	if ((fw != NULL) && (fw->ids != NULL) && (fw->ids != NO_FW_IDS)) {
 		for (i = 0; i < fw->count; i++) {
-			platform_free ((void*) fw->ids[i]);
+			object_pool_free (PFM_FLASH_POOL (pfm_flash, strings), (void*) fw->ids[i]);
 		}
 
-		platform_free (fw->ids);
+		object_pool_free (PFM_FLASH_POOL (pfm_flash, strings), fw->ids);
 
 		memset (fw, 0, sizeof (*fw));
 	}
@@ -287,7 +317,8 @@ static int pfm_flash_get_firmware_v2 (struct pfm_flash *pfm, struct pfm_firmware
 
 	if ((pfm->flash_dev_format >= 0) && (pfm->flash_dev.fw_count != 0)) {
 		fw->count = pfm->flash_dev.fw_count;
-		fw->ids = platform_calloc (fw->count, sizeof (char*));
+		fw->ids = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, strings), fw->count,
+			sizeof (char*));
 		if (fw->ids == NULL) {
 			return PFM_NO_MEMORY;
 		}
@@ -299,7 +330,7 @@ static int pfm_flash_get_firmware_v2 (struct pfm_flash *pfm, struct pfm_firmware
 			}
 
 			fw_element.id[fw_element.id_length] = '\0';
-			fw->ids[i] = strdup ((char*) fw_element.id);
+			fw->ids[i] = pfm_flash_copy_string (pfm, (char*) fw_element.id);
 			if (fw->ids[i] == NULL) {
 				status = PFM_NO_MEMORY;
 				goto error;
@@ -339,16 +370,16 @@ static int pfm_flash_get_firmware (struct pfm *pfm, struct pfm_firmware *fw)
 
 static void pfm_flash_free_fw_versions (struct pfm *pfm, struct pfm_firmware_versions *ver_list)
 {
+	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
 	size_t i;
 
-	UNUSED (pfm);
-
 	if ((ver_list != NULL) && (ver_list->versions != NULL)) {
 		for (i = 0; i < ver_list->count; i++) {
-			platform_free ((void*) ver_list->versions[i].fw_version_id);
+			object_pool_free (PFM_FLASH_POOL (pfm_flash, strings),
+				(void*) ver_list->versions[i].fw_version_id);
 		}
 
-		platform_free ((void*) ver_list->versions);
+		object_pool_free (PFM_FLASH_POOL (pfm_flash, versions), (void*) ver_list->versions);
 
 		memset (ver_list, 0, sizeof (*ver_list));
 	}
@@ -404,7 +435,8 @@ static int pfm_flash_get_supported_versions_v1 (struct pfm_flash *pfm,
 	}
 
 	if (ver_list) {
-		version_list = platform_calloc (fw_section.fw_count, sizeof (struct pfm_firmware_version));
+		version_list = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, versions),
+			fw_section.fw_count, sizeof (struct pfm_firmware_version));
 		if (version_list == NULL) {
 			return PFM_NO_MEMORY;
 		}
@@ -434,7 +466,7 @@ static int pfm_flash_get_supported_versions_v1 (struct pfm_flash *pfm,
 		if (ver_list) {
 			version_list[i].version_addr = fw_header.version_addr;
 			version_list[i].blank_byte = fw_header.blank_byte;
-			version_list[i].fw_version_id = strdup ((char*) version_str);
+			version_list[i].fw_version_id = pfm_flash_copy_string (pfm, (char*) version_str);
 			if (version_list[i].fw_version_id == NULL) {
 				status = PFM_NO_MEMORY;
 				goto error;
@@ -590,7 +622,8 @@ static int pfm_flash_get_supported_versions_v2 (struct pfm_flash *pfm, const cha
 	count = buffer.fw_element.version_count;
 	if (ver_list) {
 		ver_list->count = count;
-		version_list = platform_calloc (ver_list->count, sizeof (struct pfm_firmware_version));
+		version_list = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, versions),
+			ver_list->count, sizeof (struct pfm_firmware_version));
 		if (version_list == NULL) {
 			return PFM_NO_MEMORY;
 		}
@@ -611,7 +644,8 @@ static int pfm_flash_get_supported_versions_v2 (struct pfm_flash *pfm, const cha
 		if (ver_list) {
 			version_list[i].blank_byte = pfm->flash_dev.blank_byte;
 			version_list[i].version_addr = buffer.ver_element.version_addr;
-			version_list[i].fw_version_id = strdup ((char*) buffer.ver_element.version);
+			version_list[i].fw_version_id = pfm_flash_copy_string (pfm,
+				(char*) buffer.ver_element.version);
 			if (version_list[i].fw_version_id == NULL) {
 				status = PFM_NO_MEMORY;
 				goto error;
@@ -863,11 +897,11 @@ static int pfm_flash_read_multiple_regions_v1 (struct manifest_flash *pfm, size_
 static void pfm_flash_free_read_write_regions (struct pfm *pfm,
 	struct pfm_read_write_regions *writable)
 {
-	UNUSED (pfm);
+	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
 
 	if (writable != NULL) {
-		platform_free ((void*) writable->regions);
-		platform_free ((void*) writable->properties);
+		object_pool_free (PFM_FLASH_POOL (pfm_flash, regions), (void*) writable->regions);
+		object_pool_free (PFM_FLASH_POOL (pfm_flash, regions), (void*) writable->properties);
 
 		memset (writable, 0, sizeof (*writable));
 	}
@@ -896,14 +930,16 @@ static int pfm_flash_get_read_write_regions_v1 (struct pfm_flash *pfm, const cha
 		return status;
 	}
 
-	region_list = platform_calloc (fw_header.rw_count, sizeof (struct flash_region));
+	region_list = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, regions), fw_header.rw_count,
+		sizeof (struct flash_region));
 	if (region_list == NULL) {
 		return PFM_NO_MEMORY;
 	}
 
 	writable->regions = region_list;
 	writable->count = fw_header.rw_count;
-	writable->properties = platform_calloc (fw_header.rw_count, sizeof (struct pfm_read_write));
+	writable->properties = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, regions),
+		fw_header.rw_count, sizeof (struct pfm_read_write));
 	if (writable->properties == NULL) {
 		status = PFM_NO_MEMORY;
 		goto error;
@@ -1049,12 +1085,14 @@ static int pfm_flash_get_read_write_regions_v2 (struct pfm_flash *pfm, const cha
 	}
 
 	writable->count = buffer.ver_element.rw_count;
-	writable->regions = platform_calloc (writable->count, sizeof (struct flash_region));
+	writable->regions = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, regions),
+		writable->count, sizeof (struct flash_region));
 	if (writable->regions == NULL) {
 		return PFM_NO_MEMORY;
 	}
 
-	writable->properties = platform_calloc (writable->count, sizeof (struct pfm_read_write));
+	writable->properties = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, regions),
+		writable->count, sizeof (struct pfm_read_write));
 	if (writable->properties == NULL) {
 		status = PFM_NO_MEMORY;
 		goto error;
@@ -1106,25 +1144,26 @@ static int pfm_flash_get_read_write_regions (struct pfm *pfm, const char *fw, co
 
 static void pfm_flash_free_firmware_images (struct pfm *pfm, struct pfm_image_list *img_list)
 {
+	struct pfm_flash *pfm_flash = (struct pfm_flash*) pfm;
 	size_t i;
 
-	UNUSED (pfm);
-
 	if (img_list != NULL) {
 		if (img_list->images_sig != NULL) {
 			for (i = 0; i < img_list->count; i++) {
-				platform_free ((void*) img_list->images_sig[i].regions);
+				object_pool_free (PFM_FLASH_POOL (pfm_flash, regions),
+					(void*) img_list->images_sig[i].regions);
 			}
 
-			platform_free ((void*) img_list->images_sig);
+			object_pool_free (PFM_FLASH_POOL (pfm_flash, images), (void*) img_list->images_sig);
 		}
 
 		if (img_list->images_hash != NULL) {
 			for (i = 0; i < img_list->count; i++) {
-				platform_free ((void*) img_list->images_hash[i].regions);
+				object_pool_free (PFM_FLASH_POOL (pfm_flash, regions),
+					(void*) img_list->images_hash[i].regions);
 			}
 
-			platform_free ((void*) img_list->images_hash);
+			object_pool_free (PFM_FLASH_POOL (pfm_flash, images), (void*) img_list->images_hash);
 		}
 
 		memset (img_list, 0, sizeof (*img_list));
@@ -1163,7 +1202,8 @@ static int pfm_flash_get_firmware_images_v1 (struct pfm_flash *pfm, const char *
 		return status;
 	}
 
-	images = platform_calloc (fw_header.img_count, sizeof (struct pfm_image_signature));
+	images = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, images), fw_header.img_count,
+		sizeof (struct pfm_image_signature));
 	if (images == NULL) {
 		return PFM_NO_MEMORY;
 	}
@@ -1190,7 +1230,8 @@ static int pfm_flash_get_firmware_images_v1 (struct pfm_flash *pfm, const char *
 			goto error;
 		}
 
-		region_list = platform_calloc (img_header.region_count, sizeof (struct flash_region));
+		region_list = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, regions),
+			img_header.region_count, sizeof (struct flash_region));
 		if (region_list == NULL) {
 			status = PFM_NO_MEMORY;
 			goto error;
@@ -1350,7 +1391,8 @@ static int pfm_flash_get_firmware_images_v2 (struct pfm_flash *pfm, const char *
 
 	img_list->count = buffer.ver_element.img_count;
 	img_list->images_sig = NULL;
-	img_list->images_hash = platform_calloc (img_list->count, sizeof (struct pfm_image_hash));
+	img_list->images_hash = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, images),
+		img_list->count, sizeof (struct pfm_image_hash));
 	if (img_list->images_hash == NULL) {
 		return PFM_NO_MEMORY;
 	}
@@ -1425,7 +1467,8 @@ static int pfm_flash_get_firmware_images_v2 (struct pfm_flash *pfm, const char *
 
 		images = (struct pfm_image_hash*) img_list->images_hash;
 		images[i].count = img->region_count;
-		images[i].regions = platform_calloc (images[i].count, sizeof (struct flash_region));
+		images[i].regions = object_pool_allocate_zeroize (PFM_FLASH_POOL (pfm, regions),
+			images[i].count, sizeof (struct flash_region));
 		if (images[i].regions == NULL) {
 			status = PFM_NO_MEMORY;
 			goto error;
@@ -1568,3 +1611,18 @@ void pfm_flash_release (struct pfm_flash *pfm)
 		manifest_flash_release (&pfm->base_flash);
 	}
 }
+
+/**
+ * Configure the PFM to allocate generated lists from memory pools instead of the system heap.
+ * This must be called before any lists are requested from the PFM, and any lists must be freed
+ * before the pools are changed.
+ *
+ * @param pfm The PFM instance to configure.
+ * @param pools The memory pools to use for PFM lists.  Null to use the system heap for all lists.
+ */
+void pfm_flash_use_pools (struct pfm_flash *pfm, const struct pfm_flash_pools *pools)
+{
+	if (pfm != NULL) {
+		pfm->pools = pools;
+	}
+}
@@ -9,8 +9,21 @@
 #include "pfm_format.h"
 #include "manifest/manifest_flash.h"
 #include "flash/flash.h"
+#include "memory_mgmt/object_pool.h"
 
 
+/**
+ * Memory pools that can be used for lists generated from a PFM.  A null pool will cause that type
+ * of list to be allocated from the system heap.  Any list that is larger than a pool block will
+ * also be allocated from the system heap.
+ */
+struct pfm_flash_pools {
+	const struct object_pool *versions;			/**< Pool for firmware version lists. */
+	const struct object_pool *images;			/**< Pool for firmware image lists. */
+	const struct object_pool *regions;			/**< Pool for flash region and read/write property lists. */
+	const struct object_pool *strings;			/**< Pool for firmware ID lists and identifier strings. */
+};
+
 /**
  * Defines a PFM that is stored in flash memory.
  */
@@ -19,6 +32,7 @@ struct pfm_flash {
 	struct manifest_flash base_flash;			/**< The base PFM flash instance. */
 	struct pfm_flash_device_element flash_dev;	/**< Flash device element for the PFM. */
 	int flash_dev_format;						/**< Format of the flash device element. */
+	const struct pfm_flash_pools *pools;		/**< Optional memory pools for generated lists. */
 };
 
 
@@ -27,5 +41,7 @@ int pfm_flash_init (struct pfm_flash *pfm, const struct flash *flash, struct has
 	size_t max_platform_id);
 void pfm_flash_release (struct pfm_flash *pfm);
 
+void pfm_flash_use_pools (struct pfm_flash *pfm, const struct pfm_flash_pools *pools);
+
 
 #endif //PFM_FLASH_H
@@ -14,6 +14,7 @@
 #include "mctp_logging.h"
 #include "mctp_base_protocol.h"
 #include "mctp_interface.h"
+#include "logging/trace_ring.h"
 #include "platform_io.h"
 
 
@@ -234,16 +235,15 @@ static int mctp_interface_generate_error_packet (struct mctp_interface *mctp, in
 }
 
 /**
- * MCTP interface message processing function
+ * Process a received MCTP packet.
  *
  * @param mctp MCTP interface instance
  * @param rx_packet The received packet to process
- * @param tx_message Output for a response message to send.  This pointer MUST NOT be freed by the
- * caller.
+ * @param tx_message Output for a response message to send.
  *
  * @return Completion status, 0 if success or an error code.
  */
-int mctp_interface_process_packet (struct mctp_interface *mctp, struct cmd_packet *rx_packet,
+static int mctp_interface_handle_packet (struct mctp_interface *mctp, struct cmd_packet *rx_packet,
 	struct cmd_message **tx_message)
 {
 	struct cerberus_protocol_header *header;
@@ -523,6 +523,31 @@ int mctp_interface_process_packet (struct mctp_interface *mctp, struct cmd_packe
 	return 0;
 }
 
+/**
+ * MCTP interface message processing function
+ *
+ * @param mctp MCTP interface instance
+ * @param rx_packet The received packet to process
+ * @param tx_message Output for a response message to send.  This pointer MUST NOT be freed by the
+ * caller.
+ *
+ * @return Completion status, 0 if success or an error code.
+ */
+int mctp_interface_process_packet (struct mctp_interface *mctp, struct cmd_packet *rx_packet,
+	struct cmd_message **tx_message)
+{
+	int status;
+
+	TRACE_RING_BEGIN (TRACE_RING_POINT_MCTP_PROCESS_PACKET,
+		(rx_packet != NULL) ? rx_packet->pkt_size : 0);
+
+	status = mctp_interface_handle_packet (mctp, rx_packet, tx_message);
+
+	TRACE_RING_END (TRACE_RING_POINT_MCTP_PROCESS_PACKET, status);
+
+	return status;
+}
+
 /**
  * Reset the MCTP layer.  This discards previously received packets and begins looking for a new
  * message.
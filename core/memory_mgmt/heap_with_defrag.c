@@ -8,6 +8,35 @@
 
 
 #define HEAP_WITH_DEFRAG_BLOCK_MAGIC_NUM				0xAA920221
+#define HEAP_WITH_DEFRAG_FREE_BLOCK_MAGIC_NUM			0xAA92F4EE
+
+/**
+ * Number of free list bins that hold blocks of a single size.  Each of these bins holds free blocks
+ * with exactly (bin * 4) bytes.
+ */
+#define HEAP_WITH_DEFRAG_EXACT_BINS						32
+
+/**
+ * Smallest block size that is stored in a range bin.  Each range bin holds free blocks with sizes
+ * from a single power of 2 up to, but not including, the next power of 2.
+ */
+#define HEAP_WITH_DEFRAG_RANGE_BIN_MIN					(HEAP_WITH_DEFRAG_EXACT_BINS * 4)
+
+/**
+ * log2 of the smallest block size that is stored in a range bin.
+ */
+#define HEAP_WITH_DEFRAG_RANGE_BIN_MIN_SHIFT			7
+
+/**
+ * Total number of free list bins.  The last bin holds all blocks of at least 2^31 bytes.
+ */
+#define HEAP_WITH_DEFRAG_NUM_BINS						\
+	(HEAP_WITH_DEFRAG_EXACT_BINS + (32 - HEAP_WITH_DEFRAG_RANGE_BIN_MIN_SHIFT))
+
+/**
+ * Number of 32-bit words needed to track which bins contain free blocks.
+ */
+#define HEAP_WITH_DEFRAG_BIN_MAP_WORDS					((HEAP_WITH_DEFRAG_NUM_BINS + 31) / 32)
 
 /**
  * Get address of block contents from control block address.
@@ -35,16 +64,210 @@
 #define heap_with_defrag_round_to_nearest_dword(size)  (((size) + 3) & ~((size_t) 3))
 
 
-/* Linked list of control block headers of allocated memory blocks.  This list starts off empty
- * then every newly allocated block will be added to the beginning of this list. */
-static struct heap_with_defrag_ctrl_block *allocated_list = NULL;
+/* Start and end of the memory managed by the heap.  Every block in the heap is contiguous with the
+ * next, so all blocks can be found by walking from the start of the heap using the block sizes. */
+static uint8_t *heap_start = NULL;
+static uint8_t *heap_end = NULL;
+
+/* Free blocks are kept in a set of bins based on block size.  Each bin is a doubly linked list of
+ * control block headers with no particular order.  Small blocks are binned by exact size, so
+ * allocations of common small sizes can be satisfied from the head of a single bin.  Larger blocks
+ * are binned by power of 2 ranges.  A bitmap tracks which bins are not empty so the smallest bin
+ * with a large enough block can be found without walking empty bins.
+ *
+ * Every deallocation will result in the freed block being combined with the blocks right before or
+ * after it in memory if they are free, so there will never be two contiguous free blocks.  An
+ * allocated block uses the prev pointer in its control block to track the free block right before
+ * it in memory, which allows this to be done without searching the free blocks. */
+static struct heap_with_defrag_ctrl_block *free_bins[HEAP_WITH_DEFRAG_NUM_BINS];
+static uint32_t free_bin_map[HEAP_WITH_DEFRAG_BIN_MAP_WORDS];
+
+
+/**
+ * Determine the free list bin for a block size.
+ *
+ * @param size The size of the block, not including the control block.
+ *
+ * @return The bin index for the block.
+ */
+static size_t heap_with_defrag_get_bin (size_t size)
+{
+	size_t bin = HEAP_WITH_DEFRAG_EXACT_BINS;
+
+	if (size < HEAP_WITH_DEFRAG_RANGE_BIN_MIN) {
+		return size / 4;
+	}
+
+	size >>= HEAP_WITH_DEFRAG_RANGE_BIN_MIN_SHIFT;
+	while ((size > 1) && (bin < (HEAP_WITH_DEFRAG_NUM_BINS - 1))) {
+		size >>= 1;
+		bin++;
+	}
+
+	return bin;
+}
+
+/**
+ * Find the first bin at or after a specified bin that contains free blocks.
+ *
+ * @param bin The first bin to check.
+ *
+ * @return The index of the first bin that is not empty or HEAP_WITH_DEFRAG_NUM_BINS if there are
+ * no free blocks in any bin.
+ */
+static size_t heap_with_defrag_find_bin (size_t bin)
+{
+	size_t word = bin / 32;
+	uint32_t bits;
+
+	if (bin >= HEAP_WITH_DEFRAG_NUM_BINS) {
+		return HEAP_WITH_DEFRAG_NUM_BINS;
+	}
+
+	bits = free_bin_map[word] & (0xffffffffU << (bin % 32));
+	while (bits == 0) {
+		if (++word == HEAP_WITH_DEFRAG_BIN_MAP_WORDS) {
+			return HEAP_WITH_DEFRAG_NUM_BINS;
+		}
+
+		bits = free_bin_map[word];
+	}
+
+	/* Determine the index of the lowest bit that is set. */
+	bin = word * 32;
+	if ((bits & 0xffff) == 0) {
+		bin += 16;
+		bits >>= 16;
+	}
+	if ((bits & 0xff) == 0) {
+		bin += 8;
+		bits >>= 8;
+	}
+	if ((bits & 0xf) == 0) {
+		bin += 4;
+		bits >>= 4;
+	}
+	if ((bits & 0x3) == 0) {
+		bin += 2;
+		bits >>= 2;
+	}
+	if ((bits & 0x1) == 0) {
+		bin += 1;
+	}
+
+	return bin;
+}
+
+/**
+ * Add a block to the free list bin for its size.
+ *
+ * @param block The free block to add.
+ */
+static void heap_with_defrag_add_free_block (struct heap_with_defrag_ctrl_block *block)
+{
+	size_t bin = heap_with_defrag_get_bin (block->size);
+
+	block->magic = HEAP_WITH_DEFRAG_FREE_BLOCK_MAGIC_NUM;
+	block->prev = NULL;
+	block->next = free_bins[bin];
+
+	if (block->next != NULL) {
+		block->next->prev = block;
+	}
+
+	free_bins[bin] = block;
+	free_bin_map[bin / 32] |= (1U << (bin % 32));
+}
+
+/**
+ * Remove a block from its free list bin.
+ *
+ * @param block The free block to remove.
+ */
+static void heap_with_defrag_remove_free_block (struct heap_with_defrag_ctrl_block *block)
+{
+	size_t bin = heap_with_defrag_get_bin (block->size);
+
+	if (block->prev == NULL) {
+		free_bins[bin] = block->next;
+
+		if (free_bins[bin] == NULL) {
+			free_bin_map[bin / 32] &= ~(1U << (bin % 32));
+		}
+	}
+	else {
+		block->prev->next = block->next;
+	}
 
-/* Linked list of control block headers of free memory blocks.  This list starts off with a single
- * node from the entire available heap size.  Every deallocation will result in blocks being added
- * to this list.  List entries are ordered by increasing memory address, and every deallocation will
- * result in freed block being combined with node right before or after it if contiguous. */
-static struct heap_with_defrag_ctrl_block *free_list = NULL;
+	if (block->next != NULL) {
+		block->next->prev = block->prev;
+	}
 
+	block->next = NULL;
+	block->prev = NULL;
+}
+
+/**
+ * Get the block that follows another block in memory.
+ *
+ * @param block The block whose neighbor should be found.
+ *
+ * @return The next block in memory or NULL if the block is at the end of the heap.
+ */
+static struct heap_with_defrag_ctrl_block* heap_with_defrag_get_next_block (
+	struct heap_with_defrag_ctrl_block *block)
+{
+	struct heap_with_defrag_ctrl_block *next = HEAP_WITH_DEFRAG_BLOCK_END (block);
+
+	if ((uint8_t*) next >= heap_end) {
+		return NULL;
+	}
+
+	return next;
+}
+
+/**
+ * Update the allocated block that follows a block in memory to track whether the block before it
+ * is free.
+ *
+ * @param block The block that has changed state.
+ * @param free_block The free block that will precede the next block or NULL if the preceding block
+ * is allocated.
+ */
+static void heap_with_defrag_update_next_block (struct heap_with_defrag_ctrl_block *block,
+	struct heap_with_defrag_ctrl_block *free_block)
+{
+	struct heap_with_defrag_ctrl_block *next = heap_with_defrag_get_next_block (block);
+
+	if (next != NULL) {
+		next->prev = free_block;
+	}
+}
+
+/**
+ * Search a single free list bin for a block that can satisfy an allocation.
+ *
+ * @param bin The bin to search.
+ * @param size Size of the requested allocation.
+ * @param alloc_size Size of the allocation including the control block.
+ *
+ * @return The first free block that can be used for the allocation or NULL if there is none.
+ */
+static struct heap_with_defrag_ctrl_block* heap_with_defrag_search_bin (size_t bin, size_t size,
+	size_t alloc_size)
+{
+	struct heap_with_defrag_ctrl_block *runner = free_bins[bin];
+
+	while (runner != NULL) {
+		if ((runner->size == size) || (runner->size >= alloc_size)) {
+			break;
+		}
+
+		runner = runner->next;
+	}
+
+	return runner;
+}
 
 /**
  * Setup heap allocator
@@ -56,16 +279,21 @@ static struct heap_with_defrag_ctrl_block *free_list = NULL;
  */
 int heap_with_defrag_init (const void *heap_addr, size_t heap_len)
 {
+	struct heap_with_defrag_ctrl_block *block;
+
 	if ((heap_addr == NULL) || (heap_len <= HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN)) {
 		return HEAP_WITH_DEFRAG_INVALID_ARGUMENT;
 	}
 
-	free_list = (struct heap_with_defrag_ctrl_block*) heap_addr;
-	allocated_list = NULL;
-	free_list->magic = HEAP_WITH_DEFRAG_BLOCK_MAGIC_NUM;
-	free_list->size = heap_len - HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN;
-	free_list->next = NULL;
-	free_list->prev = NULL;
+	memset (free_bins, 0, sizeof (free_bins));
+	memset (free_bin_map, 0, sizeof (free_bin_map));
+
+	heap_start = (uint8_t*) heap_addr;
+	heap_end = heap_start + heap_len;
+
+	block = (struct heap_with_defrag_ctrl_block*) heap_addr;
+	block->size = heap_len - HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN;
+	heap_with_defrag_add_free_block (block);
 
 	return 0;
 }
@@ -79,68 +307,67 @@ int heap_with_defrag_init (const void *heap_addr, size_t heap_len)
  */
 void* heap_with_defrag_allocate (size_t size)
 {
-	struct heap_with_defrag_ctrl_block *runner = free_list;
+	struct heap_with_defrag_ctrl_block *runner;
+	struct heap_with_defrag_ctrl_block *block;
 	size_t alloc_size;
+	size_t bin;
 
 	size = heap_with_defrag_round_to_nearest_dword (size);
 	alloc_size = size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN;
 
-	// Find first free block that can fit requested allocation
-	while (runner != NULL) {
-		if (runner->size == size) {
-			// If block is exactly the size we need, then remove from free list
-			if (runner->prev == NULL) {
-				free_list = runner->next;
-
-				if (runner->next != NULL) {
-					runner->next->prev = NULL;
-				}
-			}
-			else {
-				runner->prev->next = runner->next;
-
-				if (runner->next != NULL) {
-					runner->next->prev = runner->prev;
-				}
-			}
-
-			break;
-		}
-		else if (runner->size >= alloc_size) {
-			/* If the block is larger than what we need, then trim off end of block for the newly
-			 * allocated block.  All new allocations must come from within the memory of an existing
-			 * block or exactly match the size of an existing block. An inefficiency with this
-			 * approach is free_list nodes with size greater than the requested size, but less than
-			 * alloc_size, will fail the allocation. The alternative would be to reuse the existing
-			 * block that is larger than it needs to be, but that introduces new corner cases that
-			 * would need to be considered. */
-			runner->size -= alloc_size;
-			runner = HEAP_WITH_DEFRAG_BLOCK_END (runner);
+	/* All new allocations must come from within the memory of an existing block or exactly match
+	 * the size of an existing block.  Exact matches are preferred, since they don't need to split a
+	 * larger block.  Free blocks with size greater than the requested size, but less than
+	 * alloc_size, cannot be used for the allocation.  The alternative would be to reuse the
+	 * existing block that is larger than it needs to be, but that introduces new corner cases that
+	 * would need to be considered. */
+	bin = heap_with_defrag_get_bin (size);
+	runner = heap_with_defrag_search_bin (bin, size, alloc_size);
+	if (runner == NULL) {
+		bin = heap_with_defrag_get_bin (alloc_size);
 
-			break;
+		/* Blocks in the bin that contains alloc_size might still be too small if it is a range
+		 * bin, but blocks in any later bin will be large enough. */
+		if (bin >= HEAP_WITH_DEFRAG_EXACT_BINS) {
+			runner = heap_with_defrag_search_bin (bin, size, alloc_size);
+			bin++;
 		}
 
-		runner = runner->next;
-	}
-
-	if (runner != NULL) {
-		// Set up control block of new block then add to beginning of allocated list
-		runner->magic = HEAP_WITH_DEFRAG_BLOCK_MAGIC_NUM;
-		runner->size = size;
-		runner->next = allocated_list;
-		runner->prev = NULL;
+		if (runner == NULL) {
+			bin = heap_with_defrag_find_bin (bin);
+			if (bin == HEAP_WITH_DEFRAG_NUM_BINS) {
+				// No block large enough found in free list
+				return NULL;
+			}
 
-		if (allocated_list != NULL) {
-			allocated_list->prev = runner;
+			runner = free_bins[bin];
 		}
+	}
 
-		allocated_list = runner;
+	heap_with_defrag_remove_free_block (runner);
 
-		return HEAP_WITH_DEFRAG_BLOCK_CONTENTS (runner);
+	if (runner->size == size) {
+		/* If block is exactly the size we need, then use the entire block.  A free block is never
+		 * preceded by another free block, so there is no free block before the new block. */
+		block = runner;
+		block->prev = NULL;
+	}
+	else {
+		/* If the block is larger than what we need, then trim off end of block for the newly
+		 * allocated block.  The new block will follow the remaining free block. */
+		runner->size -= alloc_size;
+		heap_with_defrag_add_free_block (runner);
+
+		block = HEAP_WITH_DEFRAG_BLOCK_END (runner);
+		block->size = size;
+		block->prev = runner;
 	}
 
-	// No block large enough found in free list
-	return NULL;
+	block->magic = HEAP_WITH_DEFRAG_BLOCK_MAGIC_NUM;
+	block->next = NULL;
+	heap_with_defrag_update_next_block (block, NULL);
+
+	return HEAP_WITH_DEFRAG_BLOCK_CONTENTS (block);
 }
 
 /**
@@ -224,10 +451,9 @@ void* heap_with_defrag_reallocate (void *addr, size_t size)
  */
 void heap_with_defrag_free (void *addr)
 {
-	struct heap_with_defrag_ctrl_block *free_block = NULL;
-	struct heap_with_defrag_ctrl_block *runner = free_list;
-	struct heap_with_defrag_ctrl_block *runner_next;
-	bool in_free_list = false;
+	struct heap_with_defrag_ctrl_block *free_block;
+	struct heap_with_defrag_ctrl_block *prev_block;
+	struct heap_with_defrag_ctrl_block *next_block;
 
 	if (addr == NULL) {
 		return;
@@ -240,95 +466,33 @@ void heap_with_defrag_free (void *addr)
 		return;
 	}
 
-	// Remove from allocated list
-	if (free_block->prev == NULL) {
-		allocated_list = free_block->next;
-
-		if (free_block->next != NULL) {
-			free_block->next->prev = NULL;
-		}
-	}
-	else {
-		free_block->prev->next = free_block->next;
-
-		if (free_block->next != NULL) {
-			free_block->next->prev = free_block->prev;
-		}
-	}
-
+	prev_block = free_block->prev;
 	free_block->next = NULL;
 	free_block->prev = NULL;
 
-	// Add freed block to free list
+	// Check if we can combine freed block with next block
+	next_block = heap_with_defrag_get_next_block (free_block);
+	if ((next_block != NULL) && (next_block->magic == HEAP_WITH_DEFRAG_FREE_BLOCK_MAGIC_NUM)) {
+		heap_with_defrag_remove_free_block (next_block);
+		free_block->size += (next_block->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN);
 
-	// If free list is empty, set head to free_block
-	if (runner == NULL) {
-		free_list = free_block;
-
-		return;
+		next_block->magic = 0;
+		next_block->size = 0;
 	}
 
-	// Get block right before free_block in memory address order
-	while ((runner->next != NULL) && (runner->next < free_block)) {
-		runner = runner->next;
-	}
+	// Check if we can combine freed block (or combined block) with previous block
+	if (prev_block != NULL) {
+		heap_with_defrag_remove_free_block (prev_block);
+		prev_block->size += (free_block->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN);
 
-	if (runner > free_block) {
-		/* If free_block comes before all nodes in free list, then loop above would not be entered,
-		 * and runner will still be after free_block.  If thats the case, then free_block should
-		 * become head of the free list. */
-		free_list = free_block;
-		free_block->next = runner;
-		runner->prev = free_block;
-		runner_next = runner;
-		in_free_list = true;
-	}
-	else {
-		runner_next = runner->next;
-
-		// Since not freed block is not first entry, check if we can combine with previous block
-		if (HEAP_WITH_DEFRAG_BLOCK_END (runner) == free_block) {
-			runner->size += free_block->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN;
-			free_block->magic = 0;
-			free_block->size = 0;
-			free_block->prev = NULL;
-			free_block->next = NULL;
-
-			free_block = runner;
-			in_free_list = true;
-		}
-	}
-
-	// Check if we can combine freed block (or combined block) with next block
-	if ((runner_next != NULL) && (HEAP_WITH_DEFRAG_BLOCK_END (free_block) == runner_next)) {
-		free_block->size += (runner_next->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN);
-		free_block->next = runner_next->next;
+		free_block->magic = 0;
+		free_block->size = 0;
 
-		if (runner_next->next != NULL) {
-			runner_next->next->prev = free_block;
-		}
-
-		if (!in_free_list) {
-			free_block->prev = runner_next->prev;
-			runner_next->prev->next = free_block;
-		}
-
-		runner_next->magic = 0;
-		runner_next->size = 0;
-		runner_next->prev = NULL;
-		runner_next->next = NULL;
-		in_free_list = true;
+		free_block = prev_block;
 	}
 
-	if (!in_free_list) {
-		free_block->next = runner->next;
-		free_block->prev = runner;
-		runner->next = free_block;
-
-		if (free_block->next != NULL) {
-			free_block->next->prev = free_block;
-		}
-	}
+	heap_with_defrag_add_free_block (free_block);
+	heap_with_defrag_update_next_block (free_block, free_block);
 }
 
 /**
@@ -340,7 +504,7 @@ void heap_with_defrag_free (void *addr)
  */
 int heap_with_defrag_get_stats (struct heap_with_defrag_stats *stats)
 {
-	struct heap_with_defrag_ctrl_block *runner = allocated_list;
+	struct heap_with_defrag_ctrl_block *runner = (struct heap_with_defrag_ctrl_block*) heap_start;
 
 	if (stats == NULL) {
 		return HEAP_WITH_DEFRAG_INVALID_ARGUMENT;
@@ -349,21 +513,20 @@ int heap_with_defrag_get_stats (struct heap_with_defrag_stats *stats)
 	memset (stats, 0, sizeof (struct heap_with_defrag_stats));
 
 	while (runner != NULL) {
-		stats->total_allocated_size += runner->size;
-		stats->total_allocated_size_w_overhead +=
-			(runner->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN);
-		++stats->num_allocated_blocks;
-		runner = runner->next;
-	}
-
-	runner = free_list;
+		if (runner->magic == HEAP_WITH_DEFRAG_FREE_BLOCK_MAGIC_NUM) {
+			stats->total_free_size += runner->size;
+			stats->total_free_size_w_overhead +=
+				(runner->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN);
+			++stats->num_free_blocks;
+		}
+		else {
+			stats->total_allocated_size += runner->size;
+			stats->total_allocated_size_w_overhead +=
+				(runner->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN);
+			++stats->num_allocated_blocks;
+		}
 
-	while (runner != NULL) {
-		stats->total_free_size += runner->size;
-		stats->total_free_size_w_overhead +=
-			(runner->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN);
-		++stats->num_free_blocks;
-		runner = runner->next;
+		runner = heap_with_defrag_get_next_block (runner);
 	}
 
 	return 0;
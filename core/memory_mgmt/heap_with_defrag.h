@@ -11,21 +11,21 @@
 /* Module for a basic heap memory allocator.  Allocator supports stdlib malloc, calloc, realloc, and
  * free equivalents with the same API.  Allocation sizes are 4-byte aligned, and free operations
  * have basic defragmentation by combining freed block with contiguous preceding or succeeding
- * blocks.  This implementation is not thread-safe.  Memory is allocated from the end of the first
- * large enough free block, so allocations will start from the end of the heap */
+ * blocks.  This implementation is not thread-safe.  Free blocks are grouped by size, and memory is
+ * allocated from the end of a free block of the smallest size class that fits the request, so
+ * allocations will start from the end of the heap */
 
 /**
  * Heap allocation control block header
  *
- * The heap allocator will have two doubly linked lists, one for allocated blocks and another for
- * free blocks.  Each linked list node will be of heap_with_defrag_ctrl_block type.  The memory
- * block handled by the control block will be right after end of control block.
+ * Free blocks are kept in doubly linked lists, with one list for each range of block sizes.  The
+ * memory block handled by the control block will be right after end of control block.
  */
 struct heap_with_defrag_ctrl_block {
 	uint32_t magic;												/**< Magic ID to determine valid blocks. */
 	size_t size;												/**< Size of block, not including control block. */
-	struct heap_with_defrag_ctrl_block *next;					/**< Pointer to next control block. */
-	struct heap_with_defrag_ctrl_block *prev;					/**< Pointer to previous control block. */
+	struct heap_with_defrag_ctrl_block *next;					/**< Pointer to next free control block. */
+	struct heap_with_defrag_ctrl_block *prev;					/**< Pointer to previous free control block, or free block just before an allocated block. */
 };
 
 #define HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN					(sizeof (struct heap_with_defrag_ctrl_block))
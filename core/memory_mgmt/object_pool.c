@@ -0,0 +1,243 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "object_pool.h"
+
+
+/**
+ * Get the block that follows a free block in the list of available blocks.
+ *
+ * @param block The free block.
+ *
+ * @return The next free block or NULL if there are no more free blocks.
+ */
+static uint8_t* object_pool_get_next_free (const uint8_t *block)
+{
+	uint8_t *next;
+
+	memcpy (&next, block, sizeof (next));
+	return next;
+}
+
+/**
+ * Set the block that follows a free block in the list of available blocks.
+ *
+ * @param block The free block.
+ * @param next The next free block.
+ */
+static void object_pool_set_next_free (uint8_t *block, uint8_t *next)
+{
+	memcpy (block, &next, sizeof (next));
+}
+
+/**
+ * Determine if a block of memory belongs to a pool.
+ *
+ * @param pool The pool to check.
+ * @param block The memory to check.
+ *
+ * @return true if the memory is a block in the pool.
+ */
+static bool object_pool_is_pool_block (const struct object_pool *pool, const uint8_t *block)
+{
+	uintptr_t start = (uintptr_t) pool->blocks;
+	uintptr_t addr = (uintptr_t) block;
+
+	return ((addr >= start) && (addr < (start + (pool->block_size * pool->block_count))));
+}
+
+/**
+ * Allocate a block of memory.  The memory will come from the pool if possible.
+ *
+ * @param pool The pool to allocate from.  If this is null, the memory will be allocated from the
+ * system heap.
+ * @param length The number of bytes to allocate.
+ *
+ * @return The allocated memory or null if there is no memory available.
+ */
+void* object_pool_allocate (const struct object_pool *pool, size_t length)
+{
+	uint8_t *block = NULL;
+
+	if (pool == NULL) {
+		return platform_malloc (length);
+	}
+
+	platform_mutex_lock (&pool->state->lock);
+
+	if ((length <= pool->block_size) && (pool->state->free_list != NULL)) {
+		block = pool->state->free_list;
+		pool->state->free_list = object_pool_get_next_free (block);
+
+		pool->state->stats.in_use++;
+		if (pool->state->stats.in_use > pool->state->stats.high_water) {
+			pool->state->stats.high_water = pool->state->stats.in_use;
+		}
+	}
+	else {
+		pool->state->stats.fallback++;
+	}
+
+	platform_mutex_unlock (&pool->state->lock);
+
+	if (block == NULL) {
+		block = platform_malloc (length);
+	}
+
+	return block;
+}
+
+/**
+ * Allocate an array of items and zero the memory.  The memory will come from the pool if possible.
+ *
+ * @param pool The pool to allocate from.  If this is null, the memory will be allocated from the
+ * system heap.
+ * @param num_items The number of items in the array.
+ * @param size The size of each item.
+ *
+ * @return The allocated memory or null if there is no memory available.
+ */
+void* object_pool_allocate_zeroize (const struct object_pool *pool, size_t num_items, size_t size)
+{
+	size_t length = num_items * size;
+	void *block;
+
+	if ((size != 0) && ((length / size) != num_items)) {
+		return NULL;
+	}
+
+	block = object_pool_allocate (pool, length);
+	if (block != NULL) {
+		memset (block, 0, length);
+	}
+
+	return block;
+}
+
+/**
+ * Free memory allocated with object_pool_allocate or object_pool_allocate_zeroize.  If the memory
+ * did not come from the pool, it will be returned to the system heap.
+ *
+ * @param pool The pool the memory was allocated from.
+ * @param block The memory to free.
+ */
+void object_pool_free (const struct object_pool *pool, void *block)
+{
+	if (block == NULL) {
+		return;
+	}
+
+	if ((pool == NULL) || !object_pool_is_pool_block (pool, block)) {
+		platform_free (block);
+		return;
+	}
+
+	platform_mutex_lock (&pool->state->lock);
+
+	object_pool_set_next_free (block, pool->state->free_list);
+	pool->state->free_list = block;
+	pool->state->stats.in_use--;
+
+	platform_mutex_unlock (&pool->state->lock);
+}
+
+/**
+ * Get the usage statistics for an object pool.
+ *
+ * @param pool The pool to query.
+ * @param stats Output for the pool statistics.
+ *
+ * @return 0 if the statistics were retrieved or an error code.
+ */
+int object_pool_get_stats (const struct object_pool *pool, struct object_pool_stats *stats)
+{
+	if ((pool == NULL) || (stats == NULL)) {
+		return OBJECT_POOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&pool->state->lock);
+	*stats = pool->state->stats;
+	platform_mutex_unlock (&pool->state->lock);
+
+	return 0;
+}
+
+/**
+ * Initialize a pool of fixed-size memory blocks.
+ *
+ * @param pool The object pool to initialize.
+ * @param state Variable context for the pool.
+ * @param blocks Storage for the pool blocks.  This must be block_count * block_size bytes and
+ * aligned for the objects that will be stored in the pool.
+ * @param block_size The number of bytes in each block.  This must be a multiple of the pointer
+ * size.
+ * @param block_count The number of blocks in the pool.
+ *
+ * @return 0 if the pool was successfully initialized or an error code.
+ */
+int object_pool_init (struct object_pool *pool, struct object_pool_state *state, uint8_t *blocks,
+	size_t block_size, size_t block_count)
+{
+	if (pool == NULL) {
+		return OBJECT_POOL_INVALID_ARGUMENT;
+	}
+
+	memset (pool, 0, sizeof (struct object_pool));
+
+	pool->state = state;
+	pool->blocks = blocks;
+	pool->block_size = block_size;
+	pool->block_count = block_count;
+
+	return object_pool_init_state (pool);
+}
+
+/**
+ * Initialize only the variable state for an object pool.  The rest of the pool instance is assumed
+ * to have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param pool The object pool that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int object_pool_init_state (const struct object_pool *pool)
+{
+	size_t i;
+
+	if ((pool == NULL) || (pool->state == NULL) || (pool->blocks == NULL) ||
+		(pool->block_count == 0) || (pool->block_size == 0)) {
+		return OBJECT_POOL_INVALID_ARGUMENT;
+	}
+
+	if ((pool->block_size % sizeof (uint8_t*)) != 0) {
+		return OBJECT_POOL_INVALID_ARGUMENT;
+	}
+
+	memset (pool->state, 0, sizeof (struct object_pool_state));
+
+	for (i = pool->block_count; i > 0; i--) {
+		object_pool_set_next_free (&pool->blocks[(i - 1) * pool->block_size],
+			pool->state->free_list);
+		pool->state->free_list = &pool->blocks[(i - 1) * pool->block_size];
+	}
+
+	return platform_mutex_init (&pool->state->lock);
+}
+
+/**
+ * Release the resources used by an object pool.  Any blocks still allocated from the pool must not
+ * be used after the pool is released.
+ *
+ * @param pool The object pool to release.
+ */
+void object_pool_release (const struct object_pool *pool)
+{
+	if (pool) {
+		platform_mutex_free (&pool->state->lock);
+	}
+}
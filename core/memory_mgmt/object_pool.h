@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef OBJECT_POOL_H_
+#define OBJECT_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "platform_api.h"
+#include "status/rot_status.h"
+
+
+/**
+ * Usage statistics for an object pool.
+ */
+struct object_pool_stats {
+	size_t in_use;					/**< Number of blocks currently allocated from the pool. */
+	size_t high_water;				/**< Largest number of blocks that have been allocated at once. */
+	uint32_t fallback;				/**< Number of allocations that had to use the system heap. */
+};
+
+/**
+ * Variable context for an object pool.
+ */
+struct object_pool_state {
+	platform_mutex lock;			/**< Synchronization for pool accesses. */
+	uint8_t *free_list;				/**< The first block that is available for allocation. */
+	struct object_pool_stats stats;	/**< Usage statistics for the pool. */
+};
+
+/**
+ * A pool of fixed-size memory blocks.  Allocations and frees from the pool are constant time and
+ * never fragment the system heap, which makes pools suitable for buffers that are repeatedly
+ * allocated and freed while the device is running.
+ *
+ * Requests that are larger than a pool block or that are made while all blocks are in use are
+ * passed to the system heap, and memory that did not come from the pool is returned to the system
+ * heap when freed.  This allows a pool to be sized for the expected workload without causing
+ * failures for unusual requests.  A NULL pool will always use the system heap.
+ */
+struct object_pool {
+	struct object_pool_state *state;	/**< Variable context for the pool. */
+	uint8_t *blocks;				/**< Storage for the pool.  Holds block_count * block_size bytes. */
+	size_t block_size;				/**< Number of bytes in each block. */
+	size_t block_count;				/**< Number of blocks in the pool. */
+};
+
+
+int object_pool_init (struct object_pool *pool, struct object_pool_state *state, uint8_t *blocks,
+	size_t block_size, size_t block_count);
+int object_pool_init_state (const struct object_pool *pool);
+void object_pool_release (const struct object_pool *pool);
+
+void* object_pool_allocate (const struct object_pool *pool, size_t length);
+void* object_pool_allocate_zeroize (const struct object_pool *pool, size_t num_items, size_t size);
+void object_pool_free (const struct object_pool *pool, void *block);
+
+int object_pool_get_stats (const struct object_pool *pool, struct object_pool_stats *stats);
+
+
+#define	OBJECT_POOL_ERROR(code)		ROT_ERROR (ROT_MODULE_OBJECT_POOL, code)
+
+/**
+ * Error codes that can be generated by an object pool.
+ */
+enum {
+	OBJECT_POOL_INVALID_ARGUMENT = OBJECT_POOL_ERROR (0x00),	/**< Input parameter is null or not valid. */
+	OBJECT_POOL_NO_MEMORY = OBJECT_POOL_ERROR (0x01),			/**< Memory allocation failed. */
+};
+
+
+#endif /* OBJECT_POOL_H_ */
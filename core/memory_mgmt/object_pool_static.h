@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef OBJECT_POOL_STATIC_H_
+#define OBJECT_POOL_STATIC_H_
+
+#include "object_pool.h"
+
+
+/**
+ * Initialize a static instance of an object pool.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the pool.
+ * @param blocks_ptr Storage for the pool blocks.  This must be block_cnt * block_len bytes and
+ * aligned for the objects that will be stored in the pool.
+ * @param block_len The number of bytes in each block.  This must be a multiple of the pointer
+ * size.
+ * @param block_cnt The number of blocks in the pool.
+ */
+#define	object_pool_static_init(state_ptr, blocks_ptr, block_len, block_cnt)	{ \
+		.state = state_ptr, \
+		.blocks = blocks_ptr, \
+		.block_size = block_len, \
+		.block_count = block_cnt \
+	}
+
+
+#endif /* OBJECT_POOL_STATIC_H_ */
@@ -119,6 +119,23 @@ uint32_t platform_htons (uint32_t hostshort);
 #endif
 
 
+/**************************
+ * Memory ordering.
+ **************************/
+
+#ifndef platform_memory_barrier
+/**
+ * Issue a full memory barrier.  All memory accesses before the barrier will be complete before any
+ * memory accesses after the barrier.  This is necessary for data that is shared between execution
+ * contexts without using a lock.
+ *
+ * A default implementation is provided using the compiler intrinsic.  Platforms can override this
+ * if necessary.
+ */
+#define	platform_memory_barrier()	__sync_synchronize ()
+#endif
+
+
 /*****************************
  * Sleep and system time.
  *****************************/
@@ -62,6 +62,7 @@ static int recovery_image_verify (struct recovery_image *image, struct hash_engi
 	uint8_t *signature;
 	size_t img_len;
 	size_t section_len;
+	size_t host_len;
 	size_t sig_len;
 	struct recovery_image_section_header section_header;
 	int header_len;
@@ -147,9 +148,10 @@ static int recovery_image_verify (struct recovery_image *image, struct hash_engi
 
 		header_len = image_header_get_length (&section_header.base);
 		recovery_image_section_header_get_section_image_length (&section_header, &section_len);
+		recovery_image_section_header_get_host_length (&section_header, &host_len);
 		recovery_image_section_header_release (&section_header);
 
-		min_host_addr = host_addr + section_len;
+		min_host_addr = host_addr + host_len;
 		rem_len -= (header_len + section_len);
 		next_addr += (header_len + section_len);
 	}
@@ -232,6 +234,262 @@ static int recovery_image_get_version (struct recovery_image *image, char *versi
 	return status;
 }
 
+#if (RECOVERY_IMAGE_DECOMPRESS_WINDOW % FLASH_VERIFICATION_BLOCK) != 0
+#error "RECOVERY_IMAGE_DECOMPRESS_WINDOW must be a multiple of FLASH_VERIFICATION_BLOCK"
+#endif
+
+/**
+ * Context for decompressing a recovery image section into host flash.
+ */
+struct recovery_image_decompress {
+	const struct flash *src;					/**< The flash containing the compressed data. */
+	uint32_t src_addr;							/**< Address of the next compressed data. */
+	size_t src_remaining;						/**< Compressed bytes that have not been read. */
+	uint8_t input[FLASH_VERIFICATION_BLOCK];	/**< Buffer for compressed data read from flash. */
+	size_t in_pos;								/**< Next byte in the input buffer. */
+	size_t in_len;								/**< Number of valid bytes in the input buffer. */
+	const struct flash *dest;					/**< The flash for decompressed data. */
+	uint32_t dest_addr;							/**< Host address of the section. */
+	uint8_t *window;							/**< History of the decompressed data. */
+	size_t out_len;								/**< Total number of bytes decompressed. */
+	size_t out_flushed;							/**< Decompressed bytes written to flash. */
+	size_t out_max;								/**< Expected length of the decompressed data. */
+};
+
+/**
+ * Get the next byte of compressed data, reading more data from flash if necessary.
+ *
+ * @param ctx The decompression context.
+ * @param byte Output for the next compressed byte.
+ *
+ * @return 0 if a byte was available or an error code.
+ */
+static int recovery_image_decompress_next_byte (struct recovery_image_decompress *ctx,
+	uint8_t *byte)
+{
+	int status;
+
+	if (ctx->in_pos == ctx->in_len) {
+		if (ctx->src_remaining == 0) {
+			return RECOVERY_IMAGE_BAD_COMPRESSED_DATA;
+		}
+
+		ctx->in_len = (ctx->src_remaining > sizeof (ctx->input)) ?
+			sizeof (ctx->input) : ctx->src_remaining;
+
+		status = ctx->src->read (ctx->src, ctx->src_addr, ctx->input, ctx->in_len);
+		if (status != 0) {
+			return status;
+		}
+
+		ctx->src_addr += ctx->in_len;
+		ctx->src_remaining -= ctx->in_len;
+		ctx->in_pos = 0;
+	}
+
+	*byte = ctx->input[ctx->in_pos++];
+
+	return 0;
+}
+
+/**
+ * Read the extended portion of a literal or match length.  Lengths with a value of 15 in the
+ * sequence token are followed by additional bytes that are added to the length, terminated by the
+ * first byte that is not 255.
+ *
+ * @param ctx The decompression context.
+ * @param length The length value from the token.  This will be updated with the full length.
+ *
+ * @return 0 if the length was read successfully or an error code.
+ */
+static int recovery_image_decompress_read_length (struct recovery_image_decompress *ctx,
+	size_t *length)
+{
+	uint8_t byte;
+	int status;
+
+	if (*length != 15) {
+		return 0;
+	}
+
+	do {
+		status = recovery_image_decompress_next_byte (ctx, &byte);
+		if (status != 0) {
+			return status;
+		}
+
+		*length += byte;
+	} while (byte == 255);
+
+	return 0;
+}
+
+/**
+ * Write any decompressed data that has not yet been stored to host flash.
+ *
+ * @param ctx The decompression context.
+ *
+ * @return 0 if the data was written successfully or an error code.
+ */
+static int recovery_image_decompress_flush (struct recovery_image_decompress *ctx)
+{
+	size_t length = ctx->out_len - ctx->out_flushed;
+	int status;
+
+	if (length == 0) {
+		return 0;
+	}
+
+	status = flash_write_and_verify (ctx->dest, ctx->dest_addr + ctx->out_flushed,
+		&ctx->window[ctx->out_flushed % RECOVERY_IMAGE_DECOMPRESS_WINDOW], length);
+	if (status != 0) {
+		return status;
+	}
+
+	ctx->out_flushed = ctx->out_len;
+
+	return 0;
+}
+
+/**
+ * Add a decompressed byte to the output.  Data is written to host flash each time a full
+ * verification block has been decompressed.
+ *
+ * @param ctx The decompression context.
+ * @param byte The decompressed byte.
+ *
+ * @return 0 if the byte was added successfully or an error code.
+ */
+static int recovery_image_decompress_output (struct recovery_image_decompress *ctx, uint8_t byte)
+{
+	if (ctx->out_len == ctx->out_max) {
+		return RECOVERY_IMAGE_BAD_COMPRESSED_DATA;
+	}
+
+	ctx->window[ctx->out_len % RECOVERY_IMAGE_DECOMPRESS_WINDOW] = byte;
+	ctx->out_len++;
+
+	if ((ctx->out_len - ctx->out_flushed) == FLASH_VERIFICATION_BLOCK) {
+		return recovery_image_decompress_flush (ctx);
+	}
+
+	return 0;
+}
+
+/**
+ * Decompress a recovery image section directly into host flash.  The section uses the LZ4 block
+ * format, with match offsets limited to RECOVERY_IMAGE_DECOMPRESS_WINDOW bytes.  Compressed data
+ * is read from the recovery image as it is needed and decompressed data is written to host flash
+ * in blocks, so neither the compressed nor the decompressed section needs to fit in memory.
+ *
+ * @param dest The host flash to write the section to.  The region must already be blank.
+ * @param dest_addr The host address to write the decompressed data.
+ * @param src The flash that contains the recovery image.
+ * @param src_addr The address of the compressed section data.
+ * @param src_len Length of the compressed section data.
+ * @param out_len Length of the section data after decompression.
+ *
+ * @return 0 if the section was decompressed to host flash successfully or an error code.
+ */
+static int recovery_image_decompress_section (const struct flash *dest, uint32_t dest_addr,
+	const struct flash *src, uint32_t src_addr, size_t src_len, size_t out_len)
+{
+	struct recovery_image_decompress ctx;
+	size_t length;
+	size_t offset;
+	uint8_t token;
+	uint8_t byte;
+	int status = 0;
+
+	memset (&ctx, 0, sizeof (ctx));
+	ctx.src = src;
+	ctx.src_addr = src_addr;
+	ctx.src_remaining = src_len;
+	ctx.dest = dest;
+	ctx.dest_addr = dest_addr;
+	ctx.out_max = out_len;
+
+	ctx.window = platform_malloc (RECOVERY_IMAGE_DECOMPRESS_WINDOW);
+	if (ctx.window == NULL) {
+		return RECOVERY_IMAGE_NO_MEMORY;
+	}
+
+	while ((ctx.in_pos != ctx.in_len) || (ctx.src_remaining != 0)) {
+		status = recovery_image_decompress_next_byte (&ctx, &token);
+		if (status != 0) {
+			goto exit;
+		}
+
+		/* Copy literal data directly from the compressed stream. */
+		length = token >> 4;
+		status = recovery_image_decompress_read_length (&ctx, &length);
+		if (status != 0) {
+			goto exit;
+		}
+
+		while (length--) {
+			status = recovery_image_decompress_next_byte (&ctx, &byte);
+			if (status == 0) {
+				status = recovery_image_decompress_output (&ctx, byte);
+			}
+			if (status != 0) {
+				goto exit;
+			}
+		}
+
+		/* The last sequence only contains literals. */
+		if ((ctx.in_pos == ctx.in_len) && (ctx.src_remaining == 0)) {
+			break;
+		}
+
+		/* Copy matching data from the decompression history. */
+		status = recovery_image_decompress_next_byte (&ctx, &byte);
+		if (status != 0) {
+			goto exit;
+		}
+
+		offset = byte;
+		status = recovery_image_decompress_next_byte (&ctx, &byte);
+		if (status != 0) {
+			goto exit;
+		}
+
+		offset |= (byte << 8);
+		if ((offset == 0) || (offset > ctx.out_len) ||
+			(offset > RECOVERY_IMAGE_DECOMPRESS_WINDOW)) {
+			status = RECOVERY_IMAGE_BAD_COMPRESSED_DATA;
+			goto exit;
+		}
+
+		length = token & 0xf;
+		status = recovery_image_decompress_read_length (&ctx, &length);
+		if (status != 0) {
+			goto exit;
+		}
+
+		length += 4;
+		while (length--) {
+			byte = ctx.window[(ctx.out_len - offset) % RECOVERY_IMAGE_DECOMPRESS_WINDOW];
+			status = recovery_image_decompress_output (&ctx, byte);
+			if (status != 0) {
+				goto exit;
+			}
+		}
+	}
+
+	if (ctx.out_len != ctx.out_max) {
+		status = RECOVERY_IMAGE_BAD_COMPRESSED_DATA;
+		goto exit;
+	}
+
+	status = recovery_image_decompress_flush (&ctx);
+
+exit:
+	platform_free (ctx.window);
+
+	return status;
+}
+
 static int recovery_image_apply_to_flash (struct recovery_image *image,
 	const struct spi_flash *flash)
 {
@@ -245,6 +503,8 @@ static int recovery_image_apply_to_flash (struct recovery_image *image,
 	uint32_t host_addr;
 	size_t section_hdr_len;
 	size_t section_img_len;
+	size_t host_len;
+	enum recovery_image_section_compression compression;
 	int status;
 
 	if ((image == NULL) || (flash == NULL)) {
@@ -273,10 +533,25 @@ static int recovery_image_apply_to_flash (struct recovery_image *image,
 		recovery_image_section_header_get_host_write_addr (&section_header, &host_addr);
 		recovery_image_section_header_get_length (&section_header, &section_hdr_len);
 		recovery_image_section_header_get_section_image_length (&section_header, &section_img_len);
+		recovery_image_section_header_get_host_length (&section_header, &host_len);
+		recovery_image_section_header_get_compression (&section_header, &compression);
 		recovery_image_section_header_release (&section_header);
 
-		status = flash_copy_ext_to_blank_and_verify (&flash->base, host_addr, image->flash,
-			next_img_addr + section_hdr_len, section_img_len);
+		switch (compression) {
+			case RECOVERY_IMAGE_SECTION_COMPRESSION_NONE:
+				status = flash_copy_ext_to_blank_and_verify (&flash->base, host_addr, image->flash,
+					next_img_addr + section_hdr_len, section_img_len);
+				break;
+
+			case RECOVERY_IMAGE_SECTION_COMPRESSION_LZ:
+				status = recovery_image_decompress_section (&flash->base, host_addr, image->flash,
+					next_img_addr + section_hdr_len, section_img_len, host_len);
+				break;
+
+			default:
+				status = RECOVERY_IMAGE_UNSUPPORTED_COMPRESSION;
+				break;
+		}
 		if (status != 0) {
 			return status;
 		}
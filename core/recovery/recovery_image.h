@@ -14,6 +14,16 @@
 #include "flash/spi_flash.h"
 
 
+/**
+ * Size of the history window used when decompressing recovery image sections.  Compressed sections
+ * cannot reference data further back than this many bytes.  This must be a multiple of
+ * FLASH_VERIFICATION_BLOCK.
+ */
+#ifndef RECOVERY_IMAGE_DECOMPRESS_WINDOW
+#define	RECOVERY_IMAGE_DECOMPRESS_WINDOW		4096
+#endif
+
+
 /**
  * The API for interfacing with the recovery image.
  */
@@ -96,6 +106,8 @@ enum {
 	RECOVERY_IMAGE_INCOMPATIBLE = RECOVERY_IMAGE_ERROR (0x06),				/**< The recovery image is incompatible with the system. */
 	RECOVERY_IMAGE_INVALID_SECTION_ADDRESS = RECOVERY_IMAGE_ERROR (0x07),	/**< The section address is an invalid value. */
 	RECOVERY_IMAGE_ID_BUFFER_TOO_SMALL = RECOVERY_IMAGE_ERROR (0x08),		/**< A buffer for version output was too small. */
+	RECOVERY_IMAGE_UNSUPPORTED_COMPRESSION = RECOVERY_IMAGE_ERROR (0x09),	/**< A section uses an unknown compression type. */
+	RECOVERY_IMAGE_BAD_COMPRESSED_DATA = RECOVERY_IMAGE_ERROR (0x0a),		/**< Compressed section data could not be decoded. */
 };
 
 
@@ -351,7 +351,7 @@ static int recovery_image_manager_erase_recovery_region (
 	}
 
 	region->is_valid = false;
-	return flash_erase_region (region->updater.flash, region->updater.base_addr,
+	return flash_mixed_erase_region (region->updater.flash, region->updater.base_addr,
 		region->updater.max_size);
 }
 
@@ -15,6 +15,12 @@ union recovery_image_section_header_format {
 		uint32_t addr;			/**< The host address to store the section image. */
 		uint32_t length;		/**< The length of the section image. */
 	} format0;
+	struct __attribute__ ((__packed__)) {
+		uint32_t addr;			/**< The host address to store the section image. */
+		uint32_t length;		/**< The length of the section image. */
+		uint32_t host_length;	/**< The length of the section data written to the host. */
+		uint8_t compression;	/**< The compression applied to the section image. */
+	} format1;
 } __attribute__ ((__packed__));
 
 /**
@@ -36,6 +42,7 @@ union recovery_image_section_header_format {
 int recovery_image_section_header_init (struct recovery_image_section_header *header,
 	const struct flash *flash, uint32_t addr)
 {
+	union recovery_image_section_header_format *format;
 	size_t length;
 	int status;
 
@@ -53,6 +60,12 @@ int recovery_image_section_header_init (struct recovery_image_section_header *he
 			}
 			break;
 
+		case 1:
+			if (length != SECTION_HEADER_FORMAT_LENGTH (1)) {
+				return RECOVERY_IMAGE_SECTION_HEADER_BAD_FORMAT_LENGTH;
+			}
+			break;
+
 		default:
 			if (length < (sizeof (union recovery_image_section_header_format))) {
 				return RECOVERY_IMAGE_SECTION_HEADER_BAD_FORMAT_LENGTH;
@@ -60,8 +73,23 @@ int recovery_image_section_header_init (struct recovery_image_section_header *he
 	}
 
 	status = image_header_load_data (&header->base, flash, addr);
+	if (status != 0) {
+		return status;
+	}
+
+	if (header->base.info.format == 1) {
+		format = (union recovery_image_section_header_format*) header->base.data;
+
+		/* Uncompressed data is copied directly to the host, so both lengths must be the same. */
+		if ((format->format1.compression == RECOVERY_IMAGE_SECTION_COMPRESSION_NONE) &&
+			(format->format1.host_length != format->format1.length)) {
+			image_header_release (&header->base);
 
-	return status;
+			return RECOVERY_IMAGE_SECTION_HEADER_BAD_HOST_LENGTH;
+		}
+	}
+
+	return 0;
 }
 
 /**
@@ -135,3 +163,56 @@ int recovery_image_section_header_get_host_write_addr (struct recovery_image_sec
 	return 0;
 }
 
+/**
+ * Get the number of bytes that will be written to the host for the section.  This is the length
+ * of the section image after decompression.  For uncompressed sections, this is the same as the
+ * section image length.
+ *
+ * @param header The header to query.
+ * @param length Output for the length of the section data written to the host.
+ *
+ * @return 0 if the host data length was available in the header or an error code.
+ */
+int recovery_image_section_header_get_host_length (struct recovery_image_section_header *header,
+	size_t *length)
+{
+	if ((header == NULL) || (length == NULL)) {
+		return RECOVERY_IMAGE_SECTION_HEADER_INVALID_ARGUMENT;
+	}
+
+	if (header->base.info.format == 0) {
+		*length = ((union recovery_image_section_header_format*) header->base.data)->format0.length;
+	}
+	else {
+		*length =
+			((union recovery_image_section_header_format*) header->base.data)->format1.host_length;
+	}
+
+	return 0;
+}
+
+/**
+ * Get the type of compression applied to the section image.
+ *
+ * @param header The header to query.
+ * @param compression Output for the section compression type.
+ *
+ * @return 0 if the compression type was available in the header or an error code.
+ */
+int recovery_image_section_header_get_compression (struct recovery_image_section_header *header,
+	enum recovery_image_section_compression *compression)
+{
+	if ((header == NULL) || (compression == NULL)) {
+		return RECOVERY_IMAGE_SECTION_HEADER_INVALID_ARGUMENT;
+	}
+
+	if (header->base.info.format == 0) {
+		*compression = RECOVERY_IMAGE_SECTION_COMPRESSION_NONE;
+	}
+	else {
+		*compression =
+			((union recovery_image_section_header_format*) header->base.data)->format1.compression;
+	}
+
+	return 0;
+}
@@ -17,6 +17,14 @@
 #define	RECOVERY_IMAGE_SECTION_HEADER_MAX_LENGTH				1024
 
 
+/**
+ * Compression that can be applied to a recovery image section.
+ */
+enum recovery_image_section_compression {
+	RECOVERY_IMAGE_SECTION_COMPRESSION_NONE = 0,	/**< The section image is not compressed. */
+	RECOVERY_IMAGE_SECTION_COMPRESSION_LZ = 1,		/**< The section image is LZ4 compressed. */
+};
+
 /**
  * Interface for a recovery image section header that provides information about the section image.
  */
@@ -36,6 +44,10 @@ int recovery_image_section_header_get_section_image_length (
 	struct recovery_image_section_header *header, size_t *length);
 int recovery_image_section_header_get_host_write_addr (struct recovery_image_section_header *header,
 	uint32_t *addr);
+int recovery_image_section_header_get_host_length (struct recovery_image_section_header *header,
+	size_t *length);
+int recovery_image_section_header_get_compression (struct recovery_image_section_header *header,
+	enum recovery_image_section_compression *compression);
 
 
 #define	RECOVERY_IMAGE_SECTION_HEADER_ERROR(code)		ROT_ERROR (ROT_MODULE_RECOVERY_IMAGE_SECTION_HEADER, code)
@@ -47,6 +59,7 @@ enum {
 	RECOVERY_IMAGE_SECTION_HEADER_INVALID_ARGUMENT = RECOVERY_IMAGE_SECTION_HEADER_ERROR (0x00),	/**< Input parameter is null or not valid. */
 	RECOVERY_IMAGE_SECTION_HEADER_NO_MEMORY = RECOVERY_IMAGE_SECTION_HEADER_ERROR (0x01),			/**< Memory allocation failed. */
 	RECOVERY_IMAGE_SECTION_HEADER_BAD_FORMAT_LENGTH = RECOVERY_IMAGE_SECTION_HEADER_ERROR (0x02),	/**< The header length doesn't match the expected length for the format. */
+	RECOVERY_IMAGE_SECTION_HEADER_BAD_HOST_LENGTH = RECOVERY_IMAGE_SECTION_HEADER_ERROR (0x03),	/**< An uncompressed section has a host length different from the section length. */
 };
 
 
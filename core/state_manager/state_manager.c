@@ -348,15 +348,12 @@ void state_manager_block_non_volatile_state_storage (struct state_manager *manag
 /**
  * Store the current non-volatile state to flash.
  *
- * It is expected that this function would be called in the context of a background task that will
- * periodically store the non-volatile state. This call could result in the need to erase flash, so
- * it could take an extended time for the operation to complete.
- *
  * @param manager The manager whose state should be stored.
+ * @param force Flag to store any state changes immediately, ignoring the store window.
  *
  * @return 0 if the non-volatile state was successfully stored or an error code.
  */
-int state_manager_store_non_volatile_state (struct state_manager *manager)
+static int state_manager_store_state (struct state_manager *manager, bool force)
 {
 	int status = 0;
 	int erase_status;
@@ -367,10 +364,10 @@ int state_manager_store_non_volatile_state (struct state_manager *manager)
 	uint16_t in_flash;
 	bool bit_error = false;
 	bool refresh = false;
-
-	if (manager == NULL) {
-		return STATE_MANAGER_INVALID_ARGUMENT;
-	}
+	platform_clock start;
+	platform_clock end;
+	bool timed = false;
+	bool stored = false;
 
 	status = manager->nv_store->get_sector_size (manager->nv_store, &sector_size);
 	if (status != 0) {
@@ -384,6 +381,24 @@ int state_manager_store_non_volatile_state (struct state_manager *manager)
 	store_state |= MULTI_BYTE_STATE;
 	platform_mutex_unlock (&manager->state_lock);
 
+	/* Batch state changes by waiting for the store window to elapse after the first change is
+	 * detected.  All changes made during the window will be stored in a single entry. */
+	if (store_state == manager->last_nv_stored) {
+		manager->is_pending = false;
+	}
+	else if (!force && (manager->store_window != 0)) {
+		if (!manager->is_pending &&
+			(platform_init_timeout (manager->store_window, &manager->pending) == 0)) {
+			manager->is_pending = true;
+		}
+
+		if (manager->is_pending && (platform_has_timeout_expired (&manager->pending) == 0)) {
+			manager->stats.deferred++;
+			platform_mutex_unlock (&manager->store_lock);
+			return 0;
+		}
+	}
+
 	/* If our current state hasn't changed from what is on flash, verify the flash contents and
 	 * refresh as necessary. */
 	if (store_state == manager->last_nv_stored) {
@@ -405,6 +420,8 @@ int state_manager_store_non_volatile_state (struct state_manager *manager)
 
 	/* If our current state is different from that stored on flash, write it to flash. */
 	if (store_state != manager->last_nv_stored) {
+		timed = (platform_init_current_tick (&start) == 0);
+
 		next_addr = manager->store_addr + 8;
 		if (next_addr == (manager->base_addr + (sector_size * 2))) {
 			next_addr = manager->base_addr;
@@ -447,6 +464,9 @@ int state_manager_store_non_volatile_state (struct state_manager *manager)
 			if (status == sizeof (nv_state)) {
 				status = 0;
 				manager->last_nv_stored = store_state;
+				manager->is_pending = false;
+				manager->stats.entry_writes++;
+				stored = true;
 			}
 			else {
 				/* We handle this scenario, but only minimally.  This is not really possible given
@@ -470,6 +490,7 @@ int state_manager_store_non_volatile_state (struct state_manager *manager)
 				manager->base_addr + sector_size, sector_size);
 			if (erase_status == 0) {
 				manager->volatile_state |= SECTOR_2_BLANK;
+				manager->stats.sector_erases++;
 			}
 			else {
 				debug_log_create_entry (DEBUG_LOG_SEVERITY_WARNING, DEBUG_LOG_COMPONENT_STATE_MGR,
@@ -487,6 +508,7 @@ int state_manager_store_non_volatile_state (struct state_manager *manager)
 				manager->base_addr, sector_size);
 			if (erase_status == 0) {
 				manager->volatile_state |= SECTOR_1_BLANK;
+				manager->stats.sector_erases++;
 			}
 			else {
 				debug_log_create_entry (DEBUG_LOG_SEVERITY_WARNING, DEBUG_LOG_COMPONENT_STATE_MGR,
@@ -495,11 +517,105 @@ int state_manager_store_non_volatile_state (struct state_manager *manager)
 		}
 	}
 
+	if (stored && timed && (platform_init_current_tick (&end) == 0)) {
+		manager->stats.last_flush_ms = platform_get_duration (&start, &end);
+		if (manager->stats.last_flush_ms > manager->stats.max_flush_ms) {
+			manager->stats.max_flush_ms = manager->stats.last_flush_ms;
+		}
+	}
+
 	platform_mutex_unlock (&manager->store_lock);
 
 	return status;
 }
 
+/**
+ * Store the current non-volatile state to flash.
+ *
+ * It is expected that this function would be called in the context of a background task that will
+ * periodically store the non-volatile state. This call could result in the need to erase flash, so
+ * it could take an extended time for the operation to complete.
+ *
+ * If a store window has been configured, new state changes will not be written until the window
+ * has elapsed.  Calls made before that time will return success without updating flash.
+ *
+ * @param manager The manager whose state should be stored.
+ *
+ * @return 0 if the non-volatile state was successfully stored or an error code.
+ */
+int state_manager_store_non_volatile_state (struct state_manager *manager)
+{
+	if (manager == NULL) {
+		return STATE_MANAGER_INVALID_ARGUMENT;
+	}
+
+	return state_manager_store_state (manager, false);
+}
+
+/**
+ * Immediately store the current non-volatile state to flash, even if the store window for pending
+ * state changes has not yet elapsed.  This should be used when the state must be saved before an
+ * event that would cause pending changes to be lost, such as a device reset.
+ *
+ * @param manager The manager whose state should be stored.
+ *
+ * @return 0 if the non-volatile state was successfully stored or an error code.
+ */
+int state_manager_flush_non_volatile_state (struct state_manager *manager)
+{
+	if (manager == NULL) {
+		return STATE_MANAGER_INVALID_ARGUMENT;
+	}
+
+	return state_manager_store_state (manager, true);
+}
+
+/**
+ * Configure the amount of time state changes will be held before being stored to flash.  Any
+ * additional changes made during this time will be stored in the same flash entry, reducing the
+ * number of flash writes when many settings are updated together.
+ *
+ * @param manager The state manager to configure.
+ * @param window_ms The time to wait after detecting a state change before storing it, in
+ * milliseconds.  Set this to 0 to store state changes on the next store request.
+ *
+ * @return 0 if the store window was configured successfully or an error code.
+ */
+int state_manager_set_store_window (struct state_manager *manager, uint32_t window_ms)
+{
+	if (manager == NULL) {
+		return STATE_MANAGER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&manager->store_lock);
+	manager->store_window = window_ms;
+	manager->is_pending = false;
+	platform_mutex_unlock (&manager->store_lock);
+
+	return 0;
+}
+
+/**
+ * Get the statistics for storing non-volatile state to flash.
+ *
+ * @param manager The state manager to query.
+ * @param stats Output for the storage statistics.
+ *
+ * @return 0 if the statistics were retrieved successfully or an error code.
+ */
+int state_manager_get_stats (struct state_manager *manager, struct state_manager_stats *stats)
+{
+	if ((manager == NULL) || (stats == NULL)) {
+		return STATE_MANAGER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&manager->store_lock);
+	*stats = manager->stats;
+	platform_mutex_unlock (&manager->store_lock);
+
+	return 0;
+}
+
 /**
  * Save the setting for the manifest region that contains the active manifest.
  * This setting will be stored in non-volatile memory on the next call to store state.
@@ -20,6 +20,17 @@ enum manifest_region {
 };
 
 
+/**
+ * Statistics for storing non-volatile state.
+ */
+struct state_manager_stats {
+	uint32_t entry_writes;			/**< Number of state entries written to flash. */
+	uint32_t sector_erases;			/**< Number of state sectors erased. */
+	uint32_t deferred;				/**< Number of store requests deferred by the store window. */
+	uint32_t last_flush_ms;			/**< Time taken by the last store that wrote to flash. */
+	uint32_t max_flush_ms;			/**< Longest time taken by a store that wrote to flash. */
+};
+
 /**
  * Manager for state information.
  */
@@ -32,6 +43,10 @@ struct state_manager {
 	uint8_t volatile_state;			/**< The current volatile state. */
 	platform_mutex state_lock;		/**< Synchronization lock for state. */
 	platform_mutex store_lock;		/**< Synchronization lock for store actions. */
+	uint32_t store_window;			/**< Time to batch state changes before storing them. */
+	platform_clock pending;			/**< Time at which pending state changes must be stored. */
+	bool is_pending;				/**< Flag indicating there are unstored state changes. */
+	struct state_manager_stats stats;	/**< Statistics for non-volatile state storage. */
 
 	/**
 	 * Save the setting for the manifest region that contains the active manifest.
@@ -84,6 +99,9 @@ int state_manager_init (struct state_manager *manager, const struct flash *state
 void state_manager_release (struct state_manager *manager);
 
 int state_manager_store_non_volatile_state (struct state_manager *manager);
+int state_manager_flush_non_volatile_state (struct state_manager *manager);
+int state_manager_set_store_window (struct state_manager *manager, uint32_t window_ms);
+int state_manager_get_stats (struct state_manager *manager, struct state_manager_stats *stats);
 void state_manager_block_non_volatile_state_storage (struct state_manager *manager, bool block);
 
 /* Internal functions for use by derived types. */
@@ -124,6 +124,8 @@ enum {
 	ROT_MODULE_DICE_UEID_EXTENSION = 0x0070,			/**< Extension handler for TCG DICE Ueid extensions. */
 	ROT_MODULE_DME_EXTENSION = 0x0071,					/**< Extension handler for DME extensions. */
 	ROT_MODULE_DME_STRUCTURE = 0x0072,					/**< Parsing and management of the DME structure. */
+	ROT_MODULE_OBJECT_POOL = 0x0073,					/**< Fixed-size memory block pools. */
+	ROT_MODULE_TRACE_RING = 0x0074,						/**< Ring buffer for execution trace events. */
 };
 
 
@@ -149,6 +149,7 @@ enum {
 	EVENT_TASK_UNKNOWN_HANDLER = EVENT_TASK_ERROR (0x08),		/**< The handler is not known to the task. */
 	EVENT_TASK_NOT_READY = EVENT_TASK_ERROR (0x09),				/**< The handler was not prepared to be notified. */
 	EVENT_TASK_TOO_MUCH_DATA = EVENT_TASK_ERROR (0x0a),			/**< An event was submitted with too much data. */
+	EVENT_TASK_NO_EVENTS = EVENT_TASK_ERROR (0x0b),				/**< There are no queued events to process. */
 };
 
 
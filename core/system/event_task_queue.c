@@ -0,0 +1,201 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <string.h>
+#include "event_task_queue.h"
+
+
+/**
+ * Initialize a queue of event contexts.
+ *
+ * @param queue The queue to initialize.
+ * @param slots Storage for the queued events.
+ * @param num_slots The number of events that can be queued at the same time.
+ *
+ * @return 0 if the queue was initialized successfully or an error code.
+ */
+int event_task_queue_init (struct event_task_queue *queue, struct event_task_queue_slot *slots,
+	size_t num_slots)
+{
+	if ((queue == NULL) || (slots == NULL) || (num_slots == 0)) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (queue, 0, sizeof (struct event_task_queue));
+	memset (slots, 0, sizeof (struct event_task_queue_slot) * num_slots);
+
+	queue->slots = slots;
+	queue->num_slots = num_slots;
+	queue->filling = -1;
+
+	return 0;
+}
+
+/**
+ * Reserve an unused slot in the queue for a new event.  Only one slot can be reserved at a time.
+ *
+ * @param queue The queue to reserve a slot from.
+ * @param context Output for the event context of the reserved slot.
+ *
+ * @return 0 if a slot was reserved or an error code.  If all slots are in use,
+ * EVENT_TASK_BUSY will be returned.
+ */
+int event_task_queue_reserve (struct event_task_queue *queue, struct event_task_context **context)
+{
+	size_t i;
+
+	if ((queue == NULL) || (context == NULL)) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	if (queue->filling >= 0) {
+		return EVENT_TASK_BUSY;
+	}
+
+	for (i = 0; i < queue->num_slots; i++) {
+		if (queue->slots[i].state == EVENT_TASK_QUEUE_SLOT_FREE) {
+			queue->slots[i].state = EVENT_TASK_QUEUE_SLOT_FILLING;
+			queue->filling = i;
+
+			*context = &queue->slots[i].context;
+			return 0;
+		}
+	}
+
+	return EVENT_TASK_BUSY;
+}
+
+/**
+ * Add the reserved slot to the queue of events waiting to be processed.
+ *
+ * @param queue The queue to update.
+ * @param handler Index of the handler that will process the event.
+ * @param priority Priority of the event.  Events with larger values will be processed first.
+ *
+ * @return 0 if the event was queued or an error code.  If no slot has been reserved,
+ * EVENT_TASK_NOT_READY will be returned.
+ */
+int event_task_queue_commit (struct event_task_queue *queue, int handler, uint8_t priority)
+{
+	struct event_task_queue_slot *slot;
+
+	if ((queue == NULL) || (handler < 0)) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	if (queue->filling < 0) {
+		return EVENT_TASK_NOT_READY;
+	}
+
+	slot = &queue->slots[queue->filling];
+	slot->handler = handler;
+	slot->priority = priority;
+	slot->sequence = queue->next_sequence++;
+	slot->state = EVENT_TASK_QUEUE_SLOT_PENDING;
+
+	queue->filling = -1;
+	queue->pending++;
+
+	return 0;
+}
+
+/**
+ * Release the reserved slot without queuing an event.
+ *
+ * @param queue The queue to update.
+ */
+void event_task_queue_cancel (struct event_task_queue *queue)
+{
+	if ((queue != NULL) && (queue->filling >= 0)) {
+		queue->slots[queue->filling].state = EVENT_TASK_QUEUE_SLOT_FREE;
+		queue->filling = -1;
+	}
+}
+
+/**
+ * Get the next event that should be processed.  This will be the oldest event with the highest
+ * priority.  The slot for the event will remain in use until event_task_queue_complete is called.
+ *
+ * @param queue The queue to query.
+ * @param handler Output for the index of the handler that will process the event.
+ * @param context Output for the event context.
+ *
+ * @return 0 if an event was found or an error code.  If there are no events waiting to be
+ * processed, EVENT_TASK_NO_EVENTS will be returned.
+ */
+int event_task_queue_take (struct event_task_queue *queue, int *handler,
+	struct event_task_context **context)
+{
+	struct event_task_queue_slot *next = NULL;
+	size_t i;
+
+	if ((queue == NULL) || (handler == NULL) || (context == NULL)) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	for (i = 0; i < queue->num_slots; i++) {
+		struct event_task_queue_slot *slot = &queue->slots[i];
+
+		if (slot->state == EVENT_TASK_QUEUE_SLOT_PENDING) {
+			/* Sequence numbers are compared using the difference to handle wrapping. */
+			if ((next == NULL) || (slot->priority > next->priority) ||
+				((slot->priority == next->priority) &&
+					((int32_t) (slot->sequence - next->sequence) < 0))) {
+				next = slot;
+			}
+		}
+	}
+
+	if (next == NULL) {
+		return EVENT_TASK_NO_EVENTS;
+	}
+
+	next->state = EVENT_TASK_QUEUE_SLOT_RUNNING;
+	queue->pending--;
+
+	*handler = next->handler;
+	*context = &next->context;
+
+	return 0;
+}
+
+/**
+ * Indicate that processing has finished for an event, allowing the slot to be reused.
+ *
+ * @param queue The queue to update.
+ * @param context The event context returned from event_task_queue_take.
+ */
+void event_task_queue_complete (struct event_task_queue *queue,
+	const struct event_task_context *context)
+{
+	size_t i;
+
+	if ((queue == NULL) || (context == NULL)) {
+		return;
+	}
+
+	for (i = 0; i < queue->num_slots; i++) {
+		if ((&queue->slots[i].context == context) &&
+			(queue->slots[i].state == EVENT_TASK_QUEUE_SLOT_RUNNING)) {
+			queue->slots[i].state = EVENT_TASK_QUEUE_SLOT_FREE;
+			return;
+		}
+	}
+}
+
+/**
+ * Get the number of events waiting to be processed.
+ *
+ * @param queue The queue to query.
+ *
+ * @return The number of pending events.
+ */
+size_t event_task_queue_get_pending_count (const struct event_task_queue *queue)
+{
+	if (queue == NULL) {
+		return 0;
+	}
+
+	return queue->pending;
+}
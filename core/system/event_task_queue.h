@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef EVENT_TASK_QUEUE_H_
+#define EVENT_TASK_QUEUE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "system/event_task.h"
+
+
+/**
+ * Possible states for an event slot in the queue.
+ */
+enum event_task_queue_slot_state {
+	EVENT_TASK_QUEUE_SLOT_FREE = 0,							/**< The slot is available for a new event. */
+	EVENT_TASK_QUEUE_SLOT_FILLING,							/**< The slot context is being populated by a submitter. */
+	EVENT_TASK_QUEUE_SLOT_PENDING,							/**< The slot contains an event waiting to be processed. */
+	EVENT_TASK_QUEUE_SLOT_RUNNING,							/**< The slot contains the event currently being processed. */
+};
+
+/**
+ * Storage for a single queued event.
+ */
+struct event_task_queue_slot {
+	struct event_task_context context;						/**< Context for the event handler. */
+	enum event_task_queue_slot_state state;					/**< Current state of the slot. */
+	int handler;											/**< Index of the handler that will process the event. */
+	uint8_t priority;										/**< Priority of the event handler. */
+	uint32_t sequence;										/**< Submission order of the event. */
+};
+
+/**
+ * A queue of event contexts to allow an event task to accept new events while a previous event is
+ * being processed.  Events are processed in priority order, with events of equal priority
+ * processed in the order they were submitted.
+ *
+ * The queue does not provide any synchronization.  The event task that owns the queue must ensure
+ * it is only accessed while holding the task lock.
+ */
+struct event_task_queue {
+	struct event_task_queue_slot *slots;					/**< Storage for queued events. */
+	size_t num_slots;										/**< Number of slots in the queue. */
+	int filling;											/**< Index of the slot being populated. */
+	uint32_t next_sequence;									/**< Sequence number for the next submitted event. */
+	size_t pending;											/**< Number of events waiting to be processed. */
+};
+
+
+int event_task_queue_init (struct event_task_queue *queue, struct event_task_queue_slot *slots,
+	size_t num_slots);
+
+int event_task_queue_reserve (struct event_task_queue *queue, struct event_task_context **context);
+int event_task_queue_commit (struct event_task_queue *queue, int handler, uint8_t priority);
+void event_task_queue_cancel (struct event_task_queue *queue);
+
+int event_task_queue_take (struct event_task_queue *queue, int *handler,
+	struct event_task_context **context);
+void event_task_queue_complete (struct event_task_queue *queue,
+	const struct event_task_context *context);
+
+size_t event_task_queue_get_pending_count (const struct event_task_queue *queue);
+
+
+#endif /* EVENT_TASK_QUEUE_H_ */
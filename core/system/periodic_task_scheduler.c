@@ -0,0 +1,411 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <string.h>
+#include "periodic_task_scheduler.h"
+#include "common/unused.h"
+
+
+/**
+ * Get the current time relative to the scheduler epoch.
+ *
+ * @param scheduler The scheduler to query.
+ * @param now Output for the current time, in milliseconds.
+ *
+ * @return 0 if the time was determined or an error code.
+ */
+static int periodic_task_scheduler_get_time (const struct periodic_task_scheduler *scheduler,
+	uint32_t *now)
+{
+	platform_clock current;
+	int status;
+
+	status = platform_init_current_tick (&current);
+	if (status != 0) {
+		return status;
+	}
+
+	*now = platform_get_duration (&scheduler->state->epoch, &current);
+
+	return 0;
+}
+
+/**
+ * Get the time a handler next needs to run.
+ *
+ * @param scheduler The scheduler that is querying the handler.
+ * @param handler The handler to query.
+ * @param ready Time to use if the handler is ready to run now, relative to the scheduler epoch.
+ *
+ * @return The next execution time relative to the scheduler epoch.
+ */
+static uint32_t periodic_task_scheduler_get_deadline (
+	const struct periodic_task_scheduler *scheduler, const struct periodic_task_handler *handler,
+	uint32_t ready)
+{
+	const platform_clock *next_time;
+
+	next_time = handler->get_next_execution (handler);
+	if (next_time == NULL) {
+		return ready;
+	}
+
+	return platform_get_duration (&scheduler->state->epoch, next_time);
+}
+
+/**
+ * Determine if one heap entry should run before another.
+ *
+ * @param a The first entry to compare.
+ * @param b The second entry to compare.
+ *
+ * @return true if entry a should run before entry b.
+ */
+static bool periodic_task_scheduler_is_before (const struct periodic_task_scheduler_entry *a,
+	const struct periodic_task_scheduler_entry *b)
+{
+	int32_t diff = (int32_t) (a->deadline - b->deadline);
+
+	if (diff != 0) {
+		return (diff < 0);
+	}
+
+	return ((int32_t) (a->sequence - b->sequence) < 0);
+}
+
+/**
+ * Move a heap entry away from the root until the heap is ordered.
+ *
+ * @param scheduler The scheduler that owns the heap.
+ * @param pos The position of the entry to move.
+ */
+static void periodic_task_scheduler_sift_down (const struct periodic_task_scheduler *scheduler,
+	size_t pos)
+{
+	struct periodic_task_scheduler_entry *heap = scheduler->heap;
+	struct periodic_task_scheduler_entry entry = heap[pos];
+	size_t size = scheduler->state->heap_size;
+
+	while (1) {
+		size_t child = (2 * pos) + 1;
+
+		if (child >= size) {
+			break;
+		}
+
+		if (((child + 1) < size) &&
+			periodic_task_scheduler_is_before (&heap[child + 1], &heap[child])) {
+			child++;
+		}
+
+		if (!periodic_task_scheduler_is_before (&heap[child], &entry)) {
+			break;
+		}
+
+		heap[pos] = heap[child];
+		pos = child;
+	}
+
+	heap[pos] = entry;
+}
+
+/**
+ * Initialize a scheduler for periodic handlers.
+ *
+ * @param scheduler The scheduler to initialize.
+ * @param state Variable context for the scheduler.  This must be uninitialized.
+ * @param handlers The list of handlers to schedule.
+ * @param num_handlers The number of handlers in the list.
+ * @param heap Storage for the scheduler heap.  This must have space for num_handlers entries.
+ * @param stats Storage for handler statistics.  This must have space for num_handlers entries.
+ * @param miss_threshold_ms The number of milliseconds a handler can be delayed past its scheduled
+ * time before it is counted as a missed deadline.
+ *
+ * @return 0 if the scheduler was initialized successfully or an error code.
+ */
+int periodic_task_scheduler_init (struct periodic_task_scheduler *scheduler,
+	struct periodic_task_scheduler_state *state, const struct periodic_task_handler **handlers,
+	size_t num_handlers, struct periodic_task_scheduler_entry *heap,
+	struct periodic_task_handler_stats *stats, uint32_t miss_threshold_ms)
+{
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (scheduler, 0, sizeof (struct periodic_task_scheduler));
+
+	scheduler->state = state;
+	scheduler->handlers = handlers;
+	scheduler->num_handlers = num_handlers;
+	scheduler->heap = heap;
+	scheduler->stats = stats;
+	scheduler->miss_threshold_ms = miss_threshold_ms;
+
+	return periodic_task_scheduler_init_state (scheduler);
+}
+
+/**
+ * Initialize only the variable state for a periodic handler scheduler.  The rest of the scheduler
+ * instance is assumed to have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param scheduler The scheduler that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int periodic_task_scheduler_init_state (const struct periodic_task_scheduler *scheduler)
+{
+	if ((scheduler == NULL) || (scheduler->state == NULL) || (scheduler->handlers == NULL) ||
+		(scheduler->num_handlers == 0) || (scheduler->heap == NULL) || (scheduler->stats == NULL)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (scheduler->state, 0, sizeof (struct periodic_task_scheduler_state));
+	memset (scheduler->stats, 0, sizeof (struct periodic_task_handler_stats) *
+		scheduler->num_handlers);
+
+	return platform_init_current_tick (&scheduler->state->epoch);
+}
+
+/**
+ * Release the resources used by a periodic handler scheduler.  No handlers will be released.
+ *
+ * @param scheduler The scheduler to release.
+ */
+void periodic_task_scheduler_release (const struct periodic_task_scheduler *scheduler)
+{
+	UNUSED (scheduler);
+}
+
+/**
+ * Prepare all scheduled handlers for execution and build the initial schedule.  This must be
+ * called from the context of the task that will execute the handlers.
+ *
+ * @param scheduler The scheduler to prepare.
+ *
+ * @return 0 if the handlers were prepared and scheduled or an error code.
+ */
+int periodic_task_scheduler_prepare_handlers (const struct periodic_task_scheduler *scheduler)
+{
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	periodic_task_prepare_handlers (scheduler->handlers, scheduler->num_handlers);
+
+	return periodic_task_scheduler_refresh (scheduler);
+}
+
+/**
+ * Rebuild the schedule by querying every handler for its next execution time.
+ *
+ * @param scheduler The scheduler to refresh.
+ *
+ * @return 0 if the schedule was rebuilt or an error code.
+ */
+int periodic_task_scheduler_refresh (const struct periodic_task_scheduler *scheduler)
+{
+	struct periodic_task_scheduler_entry *entry;
+	uint32_t now;
+	size_t i;
+	int status;
+
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	status = periodic_task_scheduler_get_time (scheduler, &now);
+	if (status != 0) {
+		return status;
+	}
+
+	scheduler->state->heap_size = 0;
+
+	for (i = 0; i < scheduler->num_handlers; i++) {
+		if (scheduler->handlers[i] != NULL) {
+			entry = &scheduler->heap[scheduler->state->heap_size];
+
+			entry->deadline = periodic_task_scheduler_get_deadline (scheduler,
+				scheduler->handlers[i], now);
+			entry->sequence = scheduler->state->next_sequence++;
+			entry->handler = i;
+
+			scheduler->state->heap_size++;
+		}
+	}
+
+	for (i = scheduler->state->heap_size / 2; i > 0; i--) {
+		periodic_task_scheduler_sift_down (scheduler, i - 1);
+	}
+
+	return 0;
+}
+
+/**
+ * Find the handler that needs to run next.  The execution time of the handler at the top of the
+ * heap is checked in case it has changed.  If it has been delayed, it is rescheduled and the
+ * handler that is now first is checked.
+ *
+ * @param scheduler The scheduler to query.  The heap must not be empty.
+ * @param now Output for the current time relative to the scheduler epoch.
+ *
+ * @return 0 if the next handler was determined or an error code.
+ */
+static int periodic_task_scheduler_select_next (const struct periodic_task_scheduler *scheduler,
+	uint32_t *now)
+{
+	struct periodic_task_scheduler_entry *next = &scheduler->heap[0];
+	uint32_t deadline;
+	uint32_t ready;
+	size_t index;
+	int status;
+
+	status = periodic_task_scheduler_get_time (scheduler, now);
+	if (status != 0) {
+		return status;
+	}
+
+	do {
+		index = next->handler;
+
+		/* A handler that no longer reports an execution time is ready now, even if it was
+		 * previously scheduled to run later.  A handler that was already due keeps its deadline so
+		 * any delay in running it is still tracked. */
+		ready = ((int32_t) (next->deadline - *now) > 0) ? *now : next->deadline;
+
+		deadline = periodic_task_scheduler_get_deadline (scheduler, scheduler->handlers[index],
+			ready);
+		if (deadline != next->deadline) {
+			next->deadline = deadline;
+			periodic_task_scheduler_sift_down (scheduler, 0);
+		}
+	} while (index != next->handler);
+
+	return 0;
+}
+
+/**
+ * Execute the handler that is scheduled to run next.  If the handler is not ready yet, wait until
+ * it is ready before executing it.  After execution, the handler is rescheduled based on its new
+ * execution time.
+ *
+ * @param scheduler The scheduler to run.
+ *
+ * @return 0 if a handler was executed or an error code.  This does not report status of the
+ * handler, just whether a handler was executed or not.
+ */
+int periodic_task_scheduler_execute_next_handler (const struct periodic_task_scheduler *scheduler)
+{
+	struct periodic_task_scheduler_entry *next;
+	struct periodic_task_handler_stats *stats;
+	const struct periodic_task_handler *handler;
+	uint32_t now;
+	int32_t late;
+	int status;
+
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	if (scheduler->state->heap_size == 0) {
+		return PERIODIC_TASK_NO_HANDLERS;
+	}
+
+	status = periodic_task_scheduler_select_next (scheduler, &now);
+	if (status != 0) {
+		return status;
+	}
+
+	next = &scheduler->heap[0];
+	handler = scheduler->handlers[next->handler];
+
+	late = (int32_t) (now - next->deadline);
+	if (late < 0) {
+		platform_msleep (-late);
+		late = 0;
+	}
+
+	handler->execute (handler);
+
+	stats = &scheduler->stats[next->handler];
+	stats->executions++;
+	if ((uint32_t) late > stats->max_late_ms) {
+		stats->max_late_ms = late;
+	}
+	if ((uint32_t) late > scheduler->miss_threshold_ms) {
+		stats->missed_deadlines++;
+	}
+
+	/* Reschedule the handler based on its new execution time.  A handler that is always ready is
+	 * placed behind any other handlers that are ready. */
+	status = periodic_task_scheduler_get_time (scheduler, &now);
+	if (status != 0) {
+		now = next->deadline;
+	}
+
+	next->deadline = periodic_task_scheduler_get_deadline (scheduler, handler, now);
+	next->sequence = scheduler->state->next_sequence++;
+	periodic_task_scheduler_sift_down (scheduler, 0);
+
+	return 0;
+}
+
+/**
+ * Determine how long until the next scheduled handler needs to run.  This allows the caller to
+ * wait for the next handler without blocking in
+ * {@link periodic_task_scheduler_execute_next_handler}.
+ *
+ * @param scheduler The scheduler to query.
+ * @param delay_ms Output for the number of milliseconds until the next handler is ready.  This
+ * will be 0 if a handler is ready to run now.
+ *
+ * @return 0 if the delay was determined or an error code.
+ */
+int periodic_task_scheduler_get_next_delay (const struct periodic_task_scheduler *scheduler,
+	uint32_t *delay_ms)
+{
+	uint32_t now;
+	int32_t remaining;
+	int status;
+
+	if ((scheduler == NULL) || (delay_ms == NULL)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	if (scheduler->state->heap_size == 0) {
+		return PERIODIC_TASK_NO_HANDLERS;
+	}
+
+	status = periodic_task_scheduler_select_next (scheduler, &now);
+	if (status != 0) {
+		return status;
+	}
+
+	remaining = (int32_t) (scheduler->heap[0].deadline - now);
+	*delay_ms = (remaining > 0) ? remaining : 0;
+
+	return 0;
+}
+
+/**
+ * Get the execution statistics for a scheduled handler.
+ *
+ * @param scheduler The scheduler to query.
+ * @param index Index of the handler in the scheduler handler list.
+ * @param stats Output for the handler statistics.
+ *
+ * @return 0 if the statistics were retrieved or an error code.
+ */
+int periodic_task_scheduler_get_handler_stats (const struct periodic_task_scheduler *scheduler,
+	size_t index, struct periodic_task_handler_stats *stats)
+{
+	if ((scheduler == NULL) || (stats == NULL) || (index >= scheduler->num_handlers)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	*stats = scheduler->stats[index];
+
+	return 0;
+}
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef PERIODIC_TASK_SCHEDULER_H_
+#define PERIODIC_TASK_SCHEDULER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "platform_api.h"
+#include "system/periodic_task.h"
+
+
+/**
+ * The default number of milliseconds a handler can run after its scheduled time before it is
+ * counted as a missed deadline.
+ */
+#ifndef PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS
+#define	PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS		100
+#endif
+
+
+/**
+ * Execution statistics for a single periodic handler.
+ */
+struct periodic_task_handler_stats {
+	uint32_t executions;							/**< Number of times the handler has been executed. */
+	uint32_t missed_deadlines;						/**< Number of executions that started past the miss threshold. */
+	uint32_t max_late_ms;							/**< Largest delay between the scheduled time and execution. */
+};
+
+/**
+ * An entry in the scheduler heap.
+ */
+struct periodic_task_scheduler_entry {
+	uint32_t deadline;								/**< Scheduled time, in milliseconds since the scheduler epoch. */
+	uint32_t sequence;								/**< Order in which the entry was scheduled. */
+	size_t handler;									/**< Index of the handler in the handler list. */
+};
+
+/**
+ * Variable context for the scheduler.
+ */
+struct periodic_task_scheduler_state {
+	platform_clock epoch;							/**< Reference time for heap deadlines. */
+	size_t heap_size;								/**< Number of handlers in the heap. */
+	uint32_t next_sequence;							/**< Sequence number for the next scheduled entry. */
+};
+
+/**
+ * Scheduler for a set of periodic handlers.  Handlers are kept in a min-heap ordered by the time of
+ * their next execution, so selecting the next handler does not require querying every handler.
+ * After a handler executes, it is rescheduled based on its new execution time.
+ *
+ * The scheduler caches each handler's execution time.  If a handler changes its next execution
+ * time outside of its execute call, periodic_task_scheduler_refresh must be called for the change
+ * to take effect before the handler's previously scheduled time.
+ */
+struct periodic_task_scheduler {
+	struct periodic_task_scheduler_state *state;	/**< Variable context for the scheduler. */
+	const struct periodic_task_handler **handlers;	/**< List of registered handlers. */
+	size_t num_handlers;							/**< Number of registered handlers in the list. */
+	struct periodic_task_scheduler_entry *heap;		/**< Heap storage.  Must hold num_handlers entries. */
+	struct periodic_task_handler_stats *stats;		/**< Statistics for each handler.  Must hold num_handlers entries. */
+	uint32_t miss_threshold_ms;						/**< Delay that is counted as a missed deadline. */
+};
+
+
+int periodic_task_scheduler_init (struct periodic_task_scheduler *scheduler,
+	struct periodic_task_scheduler_state *state, const struct periodic_task_handler **handlers,
+	size_t num_handlers, struct periodic_task_scheduler_entry *heap,
+	struct periodic_task_handler_stats *stats, uint32_t miss_threshold_ms);
+int periodic_task_scheduler_init_state (const struct periodic_task_scheduler *scheduler);
+void periodic_task_scheduler_release (const struct periodic_task_scheduler *scheduler);
+
+int periodic_task_scheduler_prepare_handlers (const struct periodic_task_scheduler *scheduler);
+int periodic_task_scheduler_refresh (const struct periodic_task_scheduler *scheduler);
+int periodic_task_scheduler_execute_next_handler (const struct periodic_task_scheduler *scheduler);
+int periodic_task_scheduler_get_next_delay (const struct periodic_task_scheduler *scheduler,
+	uint32_t *delay_ms);
+
+int periodic_task_scheduler_get_handler_stats (const struct periodic_task_scheduler *scheduler,
+	size_t index, struct periodic_task_handler_stats *stats);
+
+
+#endif /* PERIODIC_TASK_SCHEDULER_H_ */
@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef PERIODIC_TASK_SCHEDULER_STATIC_H_
+#define PERIODIC_TASK_SCHEDULER_STATIC_H_
+
+#include "periodic_task_scheduler.h"
+
+
+/**
+ * Initialize a static instance of a scheduler for periodic handlers.  This does not initialize the
+ * scheduler state.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the scheduler.
+ * @param handlers_list The list of handlers to schedule.
+ * @param count The number of handlers in the list.
+ * @param heap_ptr Storage for the scheduler heap.  This must have space for count entries.
+ * @param stats_ptr Storage for handler statistics.  This must have space for count entries.
+ * @param miss_threshold Number of milliseconds a handler can be delayed before it is counted as a
+ * missed deadline.
+ */
+#define	periodic_task_scheduler_static_init(state_ptr, handlers_list, count, heap_ptr, \
+	stats_ptr, miss_threshold)	{ \
+		.state = state_ptr, \
+		.handlers = handlers_list, \
+		.num_handlers = count, \
+		.heap = heap_ptr, \
+		.stats = stats_ptr, \
+		.miss_threshold_ms = miss_threshold \
+	}
+
+
+#endif /* PERIODIC_TASK_SCHEDULER_STATIC_H_ */
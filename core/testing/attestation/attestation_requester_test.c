@@ -130,6 +130,7 @@ struct attestation_requester_testing {
 	bool get_all_blocks;										/**< Flag indicating whether to return all measurement blocks in response */
 	bool measurement_modify;									/**< Flag indicating whether to modify measurement byte 0 */
 	bool digest_instead_of_raw;									/**< Flag indicating whether to respond with a digest instead of raw measurement data */
+	bool digest_len_incorrect;									/**< Flag indicating whether to respond with a digest that is too short */
 	bool num_blocks_incorrect;									/**< Flag indicating whether to respond with incorrect number of blocks */
 	bool unexpected_measurement_block;							/**< Flag indicating whether to respond with unexpected measurement block */
 	bool rsp_fail;												/**< Flag indicating whether to respond with a failure command code */
@@ -2350,7 +2351,8 @@ static int64_t attestation_requester_testing_spdm_get_measurements_rsp_callback
 		(4 - testing->device_id_block_short);
 
 	block_len = testing->spdm_discovery ? spdm_measurements_block_size (device_id_len) :
-		num_blocks_in_rsp * spdm_measurements_block_size (hash_len);
+		(num_blocks_in_rsp * spdm_measurements_block_size (hash_len)) -
+			testing->digest_len_incorrect;
 
 	if (testing->get_num_indices) {
 		block_len = 0;
@@ -2385,13 +2387,14 @@ static int64_t attestation_requester_testing_spdm_get_measurements_rsp_callback
 		if (!testing->spdm_discovery) {
 			if (!testing->second_response[1]) {
 				block->index = 1 + testing->unexpected_measurement_block;
-				block->measurement_size = sizeof (struct spdm_measurements_block_dmtf) + hash_len;
+				block->measurement_size = sizeof (struct spdm_measurements_block_dmtf) + hash_len -
+					testing->digest_len_incorrect;
 				block->measurement_specification = 1;
 				block->dmtf.measurement_block_type = 0;
-				block->dmtf.measurement_size = hash_len;
+				block->dmtf.measurement_size = hash_len - testing->digest_len_incorrect;
 				block->dmtf.raw_bit_stream = !testing->digest_instead_of_raw & testing->raw_rsp[0];
 
-				for (i = 0; i < hash_len; ++i, ++payload_len) {
+				for (i = 0; i < block->dmtf.measurement_size; ++i, ++payload_len) {
 					msg[payload_len] = 50 + i + testing->raw_rsp[0];
 
 					if ((i == 0) && (testing->measurement_modify)) {
@@ -4247,20 +4250,22 @@ static void attestation_requester_testing_send_and_receive_spdm_get_measurements
 	rsp->slot_id = ATTESTATION_RIOT_SLOT_NUM;
 	rsp->number_of_blocks = num_blocks;
 
-	rsp->measurement_record_len[0] = num_blocks * spdm_measurements_block_size (hash_len);
+	rsp->measurement_record_len[0] = (num_blocks * spdm_measurements_block_size (hash_len)) -
+		testing->digest_len_incorrect;
 
 	offset = sizeof (struct spdm_get_measurements_response) +
 		sizeof (struct spdm_measurements_block_header);
 
 	if (measurement_operation != 2) {
 		block->index = 1 + testing->unexpected_measurement_block;
-		block->measurement_size = sizeof (struct spdm_measurements_block_dmtf) + hash_len;
+		block->measurement_size = sizeof (struct spdm_measurements_block_dmtf) + hash_len -
+			testing->digest_len_incorrect;
 		block->measurement_specification = 1;
 		block->dmtf.measurement_block_type = 0;
-		block->dmtf.measurement_size = hash_len;
+		block->dmtf.measurement_size = hash_len - testing->digest_len_incorrect;
 		block->dmtf.raw_bit_stream = !testing->digest_instead_of_raw & testing->raw_rsp[0];
 
-		for (i = 0; i < hash_len; ++i, ++offset) {
+		for (i = 0; i < block->dmtf.measurement_size; ++i, ++offset) {
 			rsp_buf[offset] = 50 + i + testing->raw_rsp[0];
 
 			if ((i == 0) && (testing->measurement_modify)) {
@@ -4767,6 +4772,26 @@ static void attestation_requester_test_deinit_null (CuTest *test)
 	attestation_requester_deinit (NULL);
 }
 
+static void attestation_requester_test_set_batch_measurements_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_requester_set_batch_measurements (NULL, true);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+}
+
+static void attestation_requester_test_set_cert_chain_pool_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = attestation_requester_set_cert_chain_pool (NULL, NULL);
+	CuAssertIntEquals (test, ATTESTATION_INVALID_ARGUMENT, status);
+}
+
 static void attestation_requester_test_attest_device_cerberus_ecc (CuTest *test)
 {
 	struct attestation_requester_testing testing;
@@ -4821,6 +4846,79 @@ static void attestation_requester_test_attest_device_cerberus_ecc (CuTest *test)
 	complete_attestation_requester_mock_test (test, &testing, true);
 }
 
+static void attestation_requester_test_attest_device_cerberus_ecc_cert_chain_pool (CuTest *test)
+{
+	struct attestation_requester_testing testing;
+	uint32_t component_id = 50;
+	uint8_t digest[SHA256_HASH_LENGTH];
+	struct cfm_pmr_digest pmr_digest;
+	struct object_pool_state cert_state;
+	struct object_pool cert_pool;
+	uint8_t cert_blocks[1][CERBERUS_PROTOCOL_MAX_CERT_CHAIN_LEN];
+	struct object_pool_stats stats;
+	int status;
+	int i;
+
+	for (i = 0; i < SHA256_HASH_LENGTH; ++i) {
+		digest[i] = i * 3;
+	}
+
+	pmr_digest.pmr_id = 0;
+	pmr_digest.digests.hash_type = HASH_TYPE_SHA256;
+	pmr_digest.digests.digest_count = 1;
+	pmr_digest.digests.digests = digest;
+
+	TEST_START;
+
+	status = object_pool_init (&cert_pool, &cert_state, (uint8_t*) cert_blocks,
+		sizeof (cert_blocks[0]), 1);
+	CuAssertIntEquals (test, 0, status);
+
+	setup_attestation_requester_mock_attestation_test (test, &testing, true, true, true, true,
+		HASH_TYPE_SHA256, CFM_ATTESTATION_CERBERUS_PROTOCOL, ATTESTATION_RIOT_SLOT_NUM,
+		component_id);
+
+	status = attestation_requester_set_cert_chain_pool (&testing.test, &cert_pool);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_requester_testing_send_and_receive_cerberus_device_capabilities (test, true, false,
+		false, 0, &testing);
+
+	attestation_requester_testing_send_and_receive_cerberus_get_digest_with_mocks (test, &testing,
+		1);
+
+	attestation_requester_testing_send_and_receive_cerberus_get_certificate_with_mocks (test,
+		&testing, true, true, 2, true, false, NULL, component_id);
+
+	attestation_requester_testing_send_and_receive_cerberus_challenge (test, true, false, false,
+		false, false, false, false, 5, 0, 0, 0, 0, 0, 0, true, false, &testing);
+
+	status = mock_expect (&testing.cfm.mock, testing.cfm.base.get_component_pmr_digest,
+		&testing.cfm, 0, MOCK_ARG (component_id), MOCK_ARG (0), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&testing.cfm.mock, 2, &pmr_digest,
+		sizeof (struct cfm_pmr_digest), -1);
+	status |= mock_expect_save_arg (&testing.cfm.mock, 2, 1);
+	status |= mock_expect (&testing.cfm.mock, testing.cfm.base.free_component_pmr_digest,
+		&testing.cfm, 0, MOCK_ARG_SAVED_ARG (1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_requester_attest_device (&testing.test, 0x0A);
+	CuAssertIntEquals (test, 0, status);
+
+	status = device_manager_get_device_state_by_eid (&testing.device_mgr, 0x0A);
+	CuAssertIntEquals (test, DEVICE_MANAGER_AUTHENTICATED, status);
+
+	status = object_pool_get_stats (&cert_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+	CuAssertIntEquals (test, 1, stats.high_water);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	complete_attestation_requester_mock_test (test, &testing, true);
+
+	object_pool_release (&cert_pool);
+}
+
 static void attestation_requester_test_attest_device_cerberus_ecc_vendor_root_ca (CuTest *test)
 {
 	struct attestation_requester_testing testing;
@@ -7500,6 +7598,168 @@ static void attestation_requester_test_attest_device_spdm_sha512_1_1_only_challe
 	complete_attestation_requester_mock_test (test, &testing, true);
 }
 
+static void attestation_requester_test_attest_device_spdm_cert_chain_from_cache (CuTest *test)
+{
+	struct attestation_requester_testing testing;
+	struct cfm_component_device component_device;
+	struct cfm_pmr_digest pmr_digest;
+	uint32_t component_id = 12;
+	uint8_t digest[SHA256_HASH_LENGTH];
+	uint8_t digest2[SHA256_HASH_LENGTH];
+	uint8_t signature[ECC_KEY_LENGTH_256 * 2];
+	uint8_t sig_der[ECC_DER_P256_ECDSA_MAX_LENGTH];
+	int status;
+	size_t i;
+
+	for (i = 0; i < sizeof (digest); ++i) {
+		digest[i] = i * 2;
+		digest2[i] = 50 + i;
+	}
+
+	for (i = 0; i < (ECC_KEY_LENGTH_256 * 2); ++i) {
+		signature[i] = i * 10;
+	}
+
+	TEST_START;
+
+	status = ecc_der_encode_ecdsa_signature (signature,
+		&signature[ECC_KEY_LENGTH_256], ECC_KEY_LENGTH_256, sig_der, sizeof (sig_der));
+	CuAssertIntEquals (test, 69, status);
+
+	pmr_digest.pmr_id = 0;
+	pmr_digest.digests.hash_type = HASH_TYPE_SHA256;
+	pmr_digest.digests.digest_count = 1;
+	pmr_digest.digests.digests = digest2;
+
+	component_device.attestation_protocol = CFM_ATTESTATION_DMTF_SPDM;
+	component_device.cert_slot = ATTESTATION_RIOT_SLOT_NUM;
+	component_device.component_id = component_id;
+	component_device.num_pmr_ids = 1;
+	component_device.pmr_id_list = pmr_id_list;
+	component_device.measurement_hash_type = HASH_TYPE_SHA256;
+	component_device.transcript_hash_type = HASH_TYPE_SHA256;
+
+	setup_attestation_requester_mock_attestation_test (test, &testing, true, true, true, true,
+		HASH_TYPE_SHA256, CFM_ATTESTATION_DMTF_SPDM, ATTESTATION_RIOT_SLOT_NUM,
+		component_id);
+
+	testing.spdm_max_version = 1;
+	testing.spdm_version = 1;
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.start_sha256,
+		&testing.secondary_hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_requester_testing_send_and_receive_spdm_negotiate_algorithms_with_mocks (test, 0,
+		false, &testing);
+	attestation_requester_testing_send_and_receive_spdm_get_digests_with_mocks (test, false, true,
+		false, &testing, 3);
+	attestation_requester_testing_send_and_receive_spdm_get_certificate_with_mocks_and_verify (test,
+		&testing, HASH_TYPE_SHA256, 4, true, false, false, false, NULL, component_id);
+	attestation_requester_testing_send_and_receive_spdm_challenge_with_mocks (test, false, false,
+		&testing, 5);
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.finish,
+		&testing.secondary_hash, 0, MOCK_ARG_NOT_NULL, MOCK_ARG (HASH_MAX_HASH_LEN));
+	status |= mock_expect_output_tmp (&testing.secondary_hash.mock, 0, digest, sizeof (digest), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.ecc.mock, testing.ecc.base.init_public_key, &testing.ecc,
+		0, MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_PUBLIC_KEY,
+		RIOT_CORE_ALIAS_PUBLIC_KEY_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_PUBLIC_KEY_LEN), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_save_arg (&testing.ecc.mock, 2, 0);
+	status |= mock_expect (&testing.ecc.mock, testing.ecc.base.verify, &testing.ecc,
+		0, MOCK_ARG_SAVED_ARG (0), MOCK_ARG_PTR_CONTAINS_TMP (digest, sizeof (digest)),
+		MOCK_ARG (sizeof (digest)), MOCK_ARG_PTR_CONTAINS_TMP (sig_der, 69),
+		MOCK_ARG (69));
+	status |= mock_expect (&testing.ecc.mock, testing.ecc.base.release_key_pair, &testing.ecc, 0,
+		MOCK_ARG_ANY, MOCK_ARG_SAVED_ARG (0));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.cfm.mock, testing.cfm.base.get_component_pmr_digest,
+		&testing.cfm, 0, MOCK_ARG (component_id), MOCK_ARG (0), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&testing.cfm.mock, 2, &pmr_digest,
+		sizeof (struct cfm_pmr_digest), -1);
+	status |= mock_expect_save_arg (&testing.cfm.mock, 2, 1);
+	status |= mock_expect (&testing.cfm.mock, testing.cfm.base.free_component_pmr_digest,
+		&testing.cfm, 0, MOCK_ARG_SAVED_ARG (1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_requester_attest_device (&testing.test, 0x0A);
+	CuAssertIntEquals (test, 0, status);
+
+	status = device_manager_get_device_state_by_eid (&testing.device_mgr, 0x0A);
+	CuAssertIntEquals (test, DEVICE_MANAGER_AUTHENTICATED, status);
+
+	/* The device manager only holds the alias key for the last device attested, so drop it to
+	 * simulate another device being attested in between. */
+	status = device_manager_clear_alias_key (&testing.device_mgr, 0x0A);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.cfm_manager.mock, testing.cfm_manager.base.get_active_cfm,
+		&testing.cfm_manager, MOCK_RETURN_PTR (&testing.cfm.base));
+	status |= mock_expect (&testing.cfm_manager.mock, testing.cfm_manager.base.free_cfm,
+		&testing.cfm_manager, 0, MOCK_ARG_PTR (&testing.cfm.base));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.cfm.mock, testing.cfm.base.get_component_device, &testing.cfm, 0,
+		MOCK_ARG (component_id), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&testing.cfm.mock, 1, &component_device,
+		sizeof (struct cfm_component_device), -1);
+	status |= mock_expect_save_arg (&testing.cfm.mock, 1, 2);
+	status |= mock_expect (&testing.cfm.mock, testing.cfm.base.free_component_device,
+		&testing.cfm, 0, MOCK_ARG_SAVED_ARG (2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.start_sha256,
+		&testing.secondary_hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	/* No Get Certificate requests or certificate verification should be performed. */
+	attestation_requester_testing_send_and_receive_spdm_negotiate_algorithms_with_mocks (test, 6,
+		false, &testing);
+	attestation_requester_testing_send_and_receive_spdm_get_digests_with_mocks (test, false, true,
+		false, &testing, 9);
+	attestation_requester_testing_send_and_receive_spdm_challenge_with_mocks (test, false, false,
+		&testing, 10);
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.finish,
+		&testing.secondary_hash, 0, MOCK_ARG_NOT_NULL, MOCK_ARG (HASH_MAX_HASH_LEN));
+	status |= mock_expect_output_tmp (&testing.secondary_hash.mock, 0, digest, sizeof (digest), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.ecc.mock, testing.ecc.base.init_public_key, &testing.ecc,
+		0, MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_PUBLIC_KEY,
+		RIOT_CORE_ALIAS_PUBLIC_KEY_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_PUBLIC_KEY_LEN), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_save_arg (&testing.ecc.mock, 2, 3);
+	status |= mock_expect (&testing.ecc.mock, testing.ecc.base.verify, &testing.ecc,
+		0, MOCK_ARG_SAVED_ARG (3), MOCK_ARG_PTR_CONTAINS_TMP (digest, sizeof (digest)),
+		MOCK_ARG (sizeof (digest)), MOCK_ARG_PTR_CONTAINS_TMP (sig_der, 69),
+		MOCK_ARG (69));
+	status |= mock_expect (&testing.ecc.mock, testing.ecc.base.release_key_pair, &testing.ecc, 0,
+		MOCK_ARG_ANY, MOCK_ARG_SAVED_ARG (3));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.cfm.mock, testing.cfm.base.get_component_pmr_digest,
+		&testing.cfm, 0, MOCK_ARG (component_id), MOCK_ARG (0), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&testing.cfm.mock, 2, &pmr_digest,
+		sizeof (struct cfm_pmr_digest), -1);
+	status |= mock_expect_save_arg (&testing.cfm.mock, 2, 4);
+	status |= mock_expect (&testing.cfm.mock, testing.cfm.base.free_component_pmr_digest,
+		&testing.cfm, 0, MOCK_ARG_SAVED_ARG (4));
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_requester_attest_device (&testing.test, 0x0A);
+	CuAssertIntEquals (test, 0, status);
+
+	status = device_manager_get_device_state_by_eid (&testing.device_mgr, 0x0A);
+	CuAssertIntEquals (test, DEVICE_MANAGER_AUTHENTICATED, status);
+
+	complete_attestation_requester_mock_test (test, &testing, true);
+}
+
 static void attestation_requester_test_attest_device_spdm_sha256_only_pmr0 (CuTest *test)
 {
 	struct attestation_requester_testing testing;
@@ -9386,6 +9646,161 @@ static void attestation_requester_test_attest_device_spdm_only_measurement_2_mea
 	complete_attestation_requester_mock_test (test, &testing, true);
 }
 
+static void attestation_requester_test_attest_device_spdm_only_measurement_2_measurement_blocks_batched (
+	CuTest *test)
+{
+	struct attestation_requester_testing testing;
+	uint8_t combined_spdm_prefix[SPDM_COMBINED_PREFIX_LEN] = {0};
+	char spdm_prefix[] = "dmtf-spdm-v1.2.*dmtf-spdm-v1.2.*dmtf-spdm-v1.2.*dmtf-spdm-v1.2.*";
+	char spdm_context[] = "responder-measurements signing";
+	struct cfm_measurement_container container;
+	struct cfm_measurement_container container2;
+	struct cfm_allowable_digests allowable_digests;
+	struct cfm_allowable_digests allowable_digests2;
+	uint32_t component_id = 65;
+	uint8_t digest[SHA256_HASH_LENGTH];
+	uint8_t digest2[SHA256_HASH_LENGTH];
+	uint8_t measurement[SHA256_HASH_LENGTH];
+	uint8_t measurement2[SHA256_HASH_LENGTH];
+	uint8_t signature[ECC_KEY_LENGTH_256 * 2];
+	uint8_t sig_der[ECC_DER_P256_ECDSA_MAX_LENGTH];
+	int status;
+	size_t i;
+
+	TEST_START;
+
+	container.measurement.digest.allowable_digests = &allowable_digests;
+	container2.measurement.digest.allowable_digests = &allowable_digests2;
+
+	container.measurement.digest.pmr_id = 0;
+	container.measurement.digest.measurement_id = 1;
+	container.measurement_type = CFM_MEASUREMENT_TYPE_DIGEST;
+	container.measurement.digest.allowable_digests_count = 1;
+	container.measurement.digest.allowable_digests[0].version_set = 1;
+	container.measurement.digest.allowable_digests[0].digests.digest_count = 1;
+	container.measurement.digest.allowable_digests[0].digests.hash_type = HASH_TYPE_SHA256;
+	container.measurement.digest.allowable_digests[0].digests.digests = measurement;
+
+	container2.measurement_type = CFM_MEASUREMENT_TYPE_DIGEST;
+	container2.measurement.digest.pmr_id = 0;
+	container2.measurement.digest.measurement_id = 2;
+	container2.measurement.digest.allowable_digests_count = 1;
+	container2.measurement.digest.allowable_digests[0].version_set = 1;
+	container2.measurement.digest.allowable_digests[0].digests.digest_count = 1;
+	container2.measurement.digest.allowable_digests[0].digests.hash_type =
+		HASH_TYPE_SHA256;
+	container2.measurement.digest.allowable_digests[0].digests.digests = measurement2;
+
+	for (i = 0; i < sizeof (digest); ++i) {
+		digest[i] = i * 3;
+		digest2[i] = i * 2;
+		measurement[i] = 50 + i;
+		measurement2[i] = 100 - i;
+	}
+
+	for (i = 0; i < (ECC_KEY_LENGTH_256 * 2); ++i) {
+		signature[i] = i * 10;
+	}
+
+	status = ecc_der_encode_ecdsa_signature (signature,
+		&signature[ECC_KEY_LENGTH_256], ECC_KEY_LENGTH_256, sig_der, sizeof (sig_der));
+	CuAssertIntEquals (test, 69, status);
+
+	strcpy ((char*) combined_spdm_prefix, spdm_prefix);
+	strcpy ((char*) &combined_spdm_prefix[100 - strlen (spdm_context)], spdm_context);
+
+	setup_attestation_requester_mock_attestation_test (test, &testing, true, true, true, true,
+		HASH_TYPE_SHA256, CFM_ATTESTATION_DMTF_SPDM, ATTESTATION_RIOT_SLOT_NUM,
+		component_id);
+
+	testing.challenge_unsupported = true;
+	testing.get_all_blocks = true;
+
+	status = attestation_requester_set_batch_measurements (&testing.test, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.start_sha256,
+		&testing.secondary_hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_requester_testing_send_and_receive_spdm_negotiate_algorithms_with_mocks (test, 0,
+		false, &testing);
+	attestation_requester_testing_send_and_receive_spdm_get_digests_with_mocks (test, false, true,
+		false, &testing, 3);
+	attestation_requester_testing_send_and_receive_spdm_get_certificate_with_mocks_and_verify (test,
+		&testing, HASH_TYPE_SHA256, 4, true, false, false, false, NULL, component_id);
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.cancel,
+		&testing.secondary_hash, 0);
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.start_sha256,
+		&testing.secondary_hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_requester_testing_send_and_receive_spdm_negotiate_algorithms_with_mocks (test, 5,
+		false, &testing);
+
+	attestation_requester_testing_send_and_receive_spdm_get_measurements_with_mocks (test, false,
+		false, &testing, 8, SPDM_MEASUREMENT_OPERATION_GET_ALL_BLOCKS);
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.finish,
+		&testing.secondary_hash, 0, MOCK_ARG_NOT_NULL, MOCK_ARG (HASH_MAX_HASH_LEN));
+	status |= mock_expect_output_tmp (&testing.secondary_hash.mock, 0, digest, sizeof (digest), -1);
+	status |= mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.start_sha256,
+		&testing.secondary_hash, 0);
+	status |= mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.update,
+		&testing.secondary_hash, 0, MOCK_ARG_PTR_CONTAINS (combined_spdm_prefix,
+			sizeof (combined_spdm_prefix)), MOCK_ARG (SPDM_COMBINED_PREFIX_LEN));
+	status |= mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.update,
+		&testing.secondary_hash, 0, MOCK_ARG_PTR_CONTAINS (digest, sizeof (digest)),
+		MOCK_ARG (sizeof (digest)));
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.finish,
+		&testing.secondary_hash, 0, MOCK_ARG_NOT_NULL, MOCK_ARG (HASH_MAX_HASH_LEN));
+	status |= mock_expect_output_tmp (&testing.secondary_hash.mock, 0, digest2, sizeof (digest2),
+		-1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.ecc.mock, testing.ecc.base.init_public_key, &testing.ecc,
+		0, MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_PUBLIC_KEY,
+		RIOT_CORE_ALIAS_PUBLIC_KEY_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_PUBLIC_KEY_LEN), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_save_arg (&testing.ecc.mock, 2, 0);
+	status |= mock_expect (&testing.ecc.mock, testing.ecc.base.verify, &testing.ecc,
+		0, MOCK_ARG_SAVED_ARG (0), MOCK_ARG_PTR_CONTAINS_TMP (digest2, sizeof (digest2)),
+		MOCK_ARG (sizeof (digest2)), MOCK_ARG_PTR_CONTAINS_TMP (sig_der, 69),
+		MOCK_ARG (69));
+	status |= mock_expect (&testing.ecc.mock, testing.ecc.base.release_key_pair, &testing.ecc, 0,
+		MOCK_ARG_ANY, MOCK_ARG_SAVED_ARG (0));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.cfm.mock, testing.cfm.base.get_component_pmr_digest,
+		&testing.cfm, CFM_PMR_DIGEST_NOT_FOUND, MOCK_ARG (component_id), MOCK_ARG (0),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect (&testing.cfm.mock,
+		testing.cfm.base.get_next_measurement_or_measurement_data, &testing.cfm, 0,
+		MOCK_ARG (component_id), MOCK_ARG_NOT_NULL, MOCK_ARG (1), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&testing.cfm.mock, 1, &container,
+		sizeof (struct cfm_measurement_container), -1);
+	status |= mock_expect (&testing.cfm.mock,
+		testing.cfm.base.get_next_measurement_or_measurement_data, &testing.cfm, 0,
+		MOCK_ARG (component_id), MOCK_ARG_NOT_NULL, MOCK_ARG (0), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&testing.cfm.mock, 1, &container2,
+		sizeof (struct cfm_measurement_container), -1);
+	status |= mock_expect (&testing.cfm.mock,
+		testing.cfm.base.get_next_measurement_or_measurement_data, &testing.cfm,
+		CFM_ENTRY_NOT_FOUND, MOCK_ARG (component_id), MOCK_ARG_NOT_NULL, MOCK_ARG (0));
+	status |= mock_expect (&testing.cfm.mock, testing.cfm.base.free_measurement_container,
+		&testing.cfm, 0, MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_requester_attest_device (&testing.test, 0x0A);
+	CuAssertIntEquals (test, 0, status);
+
+	status = device_manager_get_device_state_by_eid (&testing.device_mgr, 0x0A);
+	CuAssertIntEquals (test, DEVICE_MANAGER_AUTHENTICATED, status);
+
+	complete_attestation_requester_mock_test (test, &testing, true);
+}
+
 static void attestation_requester_test_attest_device_spdm_only_measurement_version_set_0_permitted (
 	CuTest *test)
 {
@@ -27704,6 +28119,136 @@ static void attestation_requester_test_attest_device_spdm_measurement_data_raw_r
 	complete_attestation_requester_mock_test (test, &testing, true);
 }
 
+static void attestation_requester_test_attest_device_spdm_measurement_digest_len_incorrect (
+	CuTest *test)
+{
+	struct attestation_requester_testing testing;
+	uint8_t combined_spdm_prefix[SPDM_COMBINED_PREFIX_LEN] = {0};
+	char spdm_prefix[] = "dmtf-spdm-v1.2.*dmtf-spdm-v1.2.*dmtf-spdm-v1.2.*dmtf-spdm-v1.2.*";
+	char spdm_context[] = "responder-measurements signing";
+	struct cfm_measurement_container container;
+	struct cfm_allowable_digests allowable_digests;
+	uint32_t component_id = 50;
+	uint8_t digest[SHA256_HASH_LENGTH];
+	uint8_t digest2[SHA256_HASH_LENGTH];
+	uint8_t measurement[SHA256_HASH_LENGTH];
+	uint8_t signature[ECC_KEY_LENGTH_256 * 2];
+	uint8_t sig_der[ECC_DER_P256_ECDSA_MAX_LENGTH];
+	int status;
+	size_t i;
+
+	container.measurement.digest.allowable_digests = &allowable_digests;
+
+	container.measurement_type = CFM_MEASUREMENT_TYPE_DIGEST;
+	container.measurement.digest.pmr_id = 0;
+	container.measurement.digest.measurement_id = 1;
+	container.measurement.digest.allowable_digests_count = 1;
+	container.measurement.digest.allowable_digests[0].version_set = 1;
+	container.measurement.digest.allowable_digests[0].digests.digest_count = 1;
+	container.measurement.digest.allowable_digests[0].digests.hash_type = HASH_TYPE_SHA256;
+	container.measurement.digest.allowable_digests[0].digests.digests = measurement;
+
+	for (i = 0; i < sizeof (digest); ++i) {
+		digest[i] = i * 3;
+		digest2[i] = i * 2;
+		measurement[i] = 50 + i;
+	}
+
+	for (i = 0; i < (ECC_KEY_LENGTH_256 * 2); ++i) {
+		signature[i] = i * 10;
+	}
+
+	TEST_START;
+
+	status = ecc_der_encode_ecdsa_signature (signature,
+		&signature[ECC_KEY_LENGTH_256], ECC_KEY_LENGTH_256, sig_der, sizeof (sig_der));
+	CuAssertIntEquals (test, 69, status);
+
+	strcpy ((char*) combined_spdm_prefix, spdm_prefix);
+	strcpy ((char*) &combined_spdm_prefix[100 - strlen (spdm_context)], spdm_context);
+
+	setup_attestation_requester_mock_attestation_test (test, &testing, true, true, true, true,
+		HASH_TYPE_SHA256, CFM_ATTESTATION_DMTF_SPDM, ATTESTATION_RIOT_SLOT_NUM,
+		component_id);
+
+	testing.challenge_unsupported = true;
+	testing.get_all_blocks = false;
+	testing.digest_len_incorrect = true;
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.start_sha256,
+		&testing.secondary_hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_requester_testing_send_and_receive_spdm_negotiate_algorithms_with_mocks (test, 0,
+		false, &testing);
+	attestation_requester_testing_send_and_receive_spdm_get_digests_with_mocks (test, false, true,
+		false, &testing, 3);
+	attestation_requester_testing_send_and_receive_spdm_get_certificate_with_mocks_and_verify (test,
+		&testing, HASH_TYPE_SHA256, 4, true, false, false, false, NULL, component_id);
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.cancel,
+		&testing.secondary_hash, 0);
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.start_sha256,
+		&testing.secondary_hash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	attestation_requester_testing_send_and_receive_spdm_negotiate_algorithms_with_mocks (test, 5,
+		false, &testing);
+
+	attestation_requester_testing_send_and_receive_spdm_get_measurements_with_mocks (test, false,
+		false, &testing, 8, 1);
+
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.finish,
+		&testing.secondary_hash, 0, MOCK_ARG_NOT_NULL, MOCK_ARG (HASH_MAX_HASH_LEN));
+	status |= mock_expect_output_tmp (&testing.secondary_hash.mock, 0, digest, sizeof (digest), -1);
+	status |= mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.start_sha256,
+		&testing.secondary_hash, 0);
+	status |= mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.update,
+		&testing.secondary_hash, 0, MOCK_ARG_PTR_CONTAINS (combined_spdm_prefix,
+			sizeof (combined_spdm_prefix)), MOCK_ARG (SPDM_COMBINED_PREFIX_LEN));
+	status |= mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.update,
+		&testing.secondary_hash, 0, MOCK_ARG_PTR_CONTAINS (digest, sizeof (digest)),
+		MOCK_ARG (sizeof (digest)));
+	status = mock_expect (&testing.secondary_hash.mock, testing.secondary_hash.base.finish,
+		&testing.secondary_hash, 0, MOCK_ARG_NOT_NULL, MOCK_ARG (HASH_MAX_HASH_LEN));
+	status |= mock_expect_output_tmp (&testing.secondary_hash.mock, 0, digest2, sizeof (digest2),
+		-1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.ecc.mock, testing.ecc.base.init_public_key, &testing.ecc,
+		0, MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_PUBLIC_KEY,
+		RIOT_CORE_ALIAS_PUBLIC_KEY_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_PUBLIC_KEY_LEN), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_save_arg (&testing.ecc.mock, 2, 0);
+	status |= mock_expect (&testing.ecc.mock, testing.ecc.base.verify, &testing.ecc,
+		0, MOCK_ARG_SAVED_ARG (0), MOCK_ARG_PTR_CONTAINS_TMP (digest2, sizeof (digest2)),
+		MOCK_ARG (sizeof (digest2)), MOCK_ARG_PTR_CONTAINS_TMP (sig_der, 69),
+		MOCK_ARG (69));
+	status |= mock_expect (&testing.ecc.mock, testing.ecc.base.release_key_pair, &testing.ecc, 0,
+		MOCK_ARG_ANY, MOCK_ARG_SAVED_ARG (0));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.cfm.mock, testing.cfm.base.get_component_pmr_digest,
+		&testing.cfm, CFM_PMR_DIGEST_NOT_FOUND, MOCK_ARG (component_id), MOCK_ARG (0),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect (&testing.cfm.mock,
+		testing.cfm.base.get_next_measurement_or_measurement_data, &testing.cfm, 0,
+		MOCK_ARG (component_id), MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output_tmp (&testing.cfm.mock, 1, &container,
+		sizeof (struct cfm_measurement_container), -1);
+	status |= mock_expect (&testing.cfm.mock, testing.cfm.base.free_measurement_container,
+		&testing.cfm, 0, MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = attestation_requester_attest_device (&testing.test, 0x0A);
+	CuAssertIntEquals (test, ATTESTATION_GET_MEAS_RSP_BAD_DIGEST_LEN, status);
+
+	status = device_manager_get_device_state_by_eid (&testing.device_mgr, 0x0A);
+	CuAssertIntEquals (test, DEVICE_MANAGER_ATTESTATION_FAILED, status);
+
+	complete_attestation_requester_mock_test (test, &testing, true);
+}
+
 static void attestation_requester_test_attest_device_spdm_measurement_data_num_blocks_in_rsp_not_one (
 	CuTest *test)
 {
@@ -30508,7 +31053,10 @@ TEST (attestation_requester_test_init_invalid_arg);
 TEST (attestation_requester_test_init_state);
 TEST (attestation_requester_test_init_state_invalid_arg);
 TEST (attestation_requester_test_deinit_null);
+TEST (attestation_requester_test_set_batch_measurements_null);
+TEST (attestation_requester_test_set_cert_chain_pool_null);
 TEST (attestation_requester_test_attest_device_cerberus_ecc);
+TEST (attestation_requester_test_attest_device_cerberus_ecc_cert_chain_pool);
 TEST (attestation_requester_test_attest_device_cerberus_ecc_vendor_root_ca);
 TEST (attestation_requester_test_attest_device_cerberus_ecc_untrusted_root_ca);
 TEST (attestation_requester_test_attest_device_cerberus_rsa);
@@ -30565,6 +31113,7 @@ TEST (attestation_requester_test_attest_device_spdm_sha384_only_challenge);
 TEST (attestation_requester_test_attest_device_spdm_sha384_1_1_only_challenge);
 TEST (attestation_requester_test_attest_device_spdm_sha512_only_challenge);
 TEST (attestation_requester_test_attest_device_spdm_sha512_1_1_only_challenge);
+TEST (attestation_requester_test_attest_device_spdm_cert_chain_from_cache);
 TEST (attestation_requester_test_attest_device_spdm_sha256_only_pmr0);
 TEST (attestation_requester_test_attest_device_spdm_sha256_1_1_only_pmr0);
 TEST (attestation_requester_test_attest_device_spdm_sha384_only_pmr0);
@@ -30580,6 +31129,7 @@ TEST (attestation_requester_test_attest_device_spdm_sha512_only_measurement);
 TEST (attestation_requester_test_attest_device_spdm_sha512_1_1_only_measurement);
 TEST (attestation_requester_test_attest_device_spdm_only_measurement_multiple_measurement_options);
 TEST (attestation_requester_test_attest_device_spdm_only_measurement_2_measurement_blocks);
+TEST (attestation_requester_test_attest_device_spdm_only_measurement_2_measurement_blocks_batched);
 TEST (attestation_requester_test_attest_device_spdm_only_measurement_version_set_0_permitted);
 TEST (attestation_requester_test_attest_device_spdm_only_measurement_skip_inapplicable_version_set);
 TEST (attestation_requester_test_attest_device_spdm_only_measurement_2_measurement_blocks_multiple_allowable_digests_for_different_version_sets);
@@ -30768,6 +31318,7 @@ TEST (attestation_requester_test_attest_device_spdm_measurement_only_measurement
 TEST (attestation_requester_test_attest_device_spdm_measurement_only_measurement_version_set_selection_fail);
 TEST (attestation_requester_test_attest_device_spdm_measurement_data_get_measurement_fail);
 TEST (attestation_requester_test_attest_device_spdm_measurement_data_raw_requested_but_response_digest);
+TEST (attestation_requester_test_attest_device_spdm_measurement_digest_len_incorrect);
 TEST (attestation_requester_test_attest_device_spdm_measurement_data_num_blocks_in_rsp_not_one);
 TEST (attestation_requester_test_attest_device_spdm_measurement_data_unexpected_measurement_block);
 TEST (attestation_requester_test_attest_device_spdm_measurement_only_measurement_data_version_set_selector_invalid);
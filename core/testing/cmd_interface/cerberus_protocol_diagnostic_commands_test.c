@@ -137,6 +137,99 @@ void cerberus_protocol_diagnostic_commands_testing_process_heap_stats_fail (CuTe
 	CuAssertIntEquals (test, 0, status);
 }
 
+void cerberus_protocol_diagnostic_commands_testing_process_command_stats (CuTest *test,
+	struct cmd_interface *cmd, uint8_t command_id, uint32_t requests, uint32_t failures)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	struct cerberus_protocol_command_stats_response *resp =
+		(struct cerberus_protocol_command_stats_response*) data;
+	struct cmd_interface_stats_entry *entries;
+	struct cmd_interface_stats_entry *found = NULL;
+	uint32_t histogram = 0;
+	int status;
+	int i;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	req->offset = 0;
+	request.length = sizeof (struct cerberus_protocol_command_stats);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF, resp->header.msg_type);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_MSFT_PCI_VID, resp->header.pci_vendor_id);
+	CuAssertIntEquals (test, 0, resp->header.crypt);
+	CuAssertIntEquals (test, 0, resp->header.reserved2);
+	CuAssertIntEquals (test, 0, resp->header.integrity_check);
+	CuAssertIntEquals (test, 0, resp->header.reserved1);
+	CuAssertIntEquals (test, 0, resp->header.rq);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_DIAG_COMMAND_STATS, resp->header.command);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	CuAssertTrue (test, (resp->num_commands > 0));
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_command_stats_response) +
+		(resp->num_commands * sizeof (struct cmd_interface_stats_entry)), request.length);
+
+	entries = cerberus_protocol_command_stats_entries (resp);
+	for (i = 0; i < resp->num_commands; i++) {
+		if (entries[i].command_id == command_id) {
+			found = &entries[i];
+		}
+	}
+
+	CuAssertPtrNotNull (test, found);
+	CuAssertIntEquals (test, requests, found->requests);
+	CuAssertIntEquals (test, failures, found->failures);
+
+	for (i = 0; i < CMD_INTERFACE_STATS_LATENCY_BUCKETS; i++) {
+		histogram += found->latency[i];
+	}
+	CuAssertIntEquals (test, requests, histogram);
+}
+
+void cerberus_protocol_diagnostic_commands_testing_process_command_stats_invalid_len (
+	CuTest *test, struct cmd_interface *cmd)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	int status;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	request.length = sizeof (struct cerberus_protocol_command_stats) + 1;
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	request.length = sizeof (struct cerberus_protocol_command_stats) - 1;
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+}
+
 /*******************
  * Test cases
  *******************/
@@ -194,9 +287,345 @@ static void cerberus_protocol_diagnostic_commands_test_heap_stats_format (CuTest
 	CuAssertIntEquals (test, 0x18171615, resp->heap.min_block);
 }
 
+static void cerberus_protocol_diagnostic_commands_test_command_stats_format (CuTest *test)
+{
+	uint8_t raw_buffer_req[] = {
+		0x7e,0x14,0x13,0x03,0xd1,
+		0x02
+	};
+	uint8_t raw_buffer_resp[] = {
+		0x7e,0x14,0x13,0x03,0xd1,
+		0x04,
+		0x5c,
+		0x01,0x02,0x03,0x04,
+		0x05,0x06,0x07,0x08,
+		0x09,0x0a,0x0b,0x0c,
+		0x0d,0x0e,0x0f,0x10,
+		0x11,0x12,0x13,0x14,
+		0x15,0x16,0x17,0x18,
+		0x19,0x1a,0x1b,0x1c,
+		0x1d,0x1e,0x1f,0x20,
+		0x21,0x22,0x23,0x24,
+		0x25,0x26,0x27,0x28,
+		0x29,0x2a,0x2b,0x2c,
+		0x2d,0x2e,0x2f,0x30
+	};
+	struct cerberus_protocol_command_stats *req;
+	struct cerberus_protocol_command_stats_response *resp;
+	struct cmd_interface_stats_entry *entry;
+
+	TEST_START;
+
+	CuAssertIntEquals (test, sizeof (raw_buffer_req),
+		sizeof (struct cerberus_protocol_command_stats));
+
+	req = (struct cerberus_protocol_command_stats*) raw_buffer_req;
+	CuAssertIntEquals (test, 0, req->header.integrity_check);
+	CuAssertIntEquals (test, 0x7e, req->header.msg_type);
+	CuAssertIntEquals (test, 0x1314, req->header.pci_vendor_id);
+	CuAssertIntEquals (test, 0, req->header.rq);
+	CuAssertIntEquals (test, 0, req->header.reserved2);
+	CuAssertIntEquals (test, 0, req->header.crypt);
+	CuAssertIntEquals (test, 0x03, req->header.reserved1);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_DIAG_COMMAND_STATS, req->header.command);
+
+	CuAssertIntEquals (test, 0x02, req->offset);
+
+	CuAssertIntEquals (test, sizeof (raw_buffer_resp),
+		sizeof (struct cerberus_protocol_command_stats_response) +
+			sizeof (struct cmd_interface_stats_entry));
+
+	resp = (struct cerberus_protocol_command_stats_response*) raw_buffer_resp;
+	CuAssertIntEquals (test, 0, resp->header.integrity_check);
+	CuAssertIntEquals (test, 0x7e, resp->header.msg_type);
+	CuAssertIntEquals (test, 0x1314, resp->header.pci_vendor_id);
+	CuAssertIntEquals (test, 0, resp->header.rq);
+	CuAssertIntEquals (test, 0, resp->header.reserved2);
+	CuAssertIntEquals (test, 0, resp->header.crypt);
+	CuAssertIntEquals (test, 0x03, resp->header.reserved1);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_DIAG_COMMAND_STATS, resp->header.command);
+
+	CuAssertIntEquals (test, 0x04, resp->num_commands);
+
+	entry = cerberus_protocol_command_stats_entries (resp);
+	CuAssertPtrEquals (test, &raw_buffer_resp[6], entry);
+	CuAssertIntEquals (test, 0x5c, entry->command_id);
+	CuAssertIntEquals (test, 0x04030201, entry->requests);
+	CuAssertIntEquals (test, 0x08070605, entry->failures);
+	CuAssertIntEquals (test, 0x0c0b0a09, entry->total_ms);
+	CuAssertIntEquals (test, 0x100f0e0d, entry->max_ms);
+	CuAssertIntEquals (test, 0x14131211, entry->latency[0]);
+	CuAssertIntEquals (test, 0x18171615, entry->latency[1]);
+	CuAssertIntEquals (test, 0x1c1b1a19, entry->latency[2]);
+	CuAssertIntEquals (test, 0x201f1e1d, entry->latency[3]);
+	CuAssertIntEquals (test, 0x24232221, entry->latency[4]);
+	CuAssertIntEquals (test, 0x28272625, entry->latency[5]);
+	CuAssertIntEquals (test, 0x2c2b2a29, entry->latency[6]);
+	CuAssertIntEquals (test, 0x302f2e2d, entry->latency[7]);
+}
+
+/**
+ * Initialize a list of command statistics with unique values for testing.
+ *
+ * @param stats The statistics list to initialize.
+ * @param count The number of entries in the list.
+ */
+static void cerberus_protocol_diagnostic_commands_testing_init_command_stats (
+	struct cmd_interface_stats_entry *stats, size_t count)
+{
+	size_t i;
+	int j;
+
+	for (i = 0; i < count; i++) {
+		cmd_interface_stats_init (&stats[i], CERBERUS_PROTOCOL_GET_FW_VERSION + i);
+		for (j = 0; j <= (int) i; j++) {
+			cmd_interface_stats_record (&stats[i], 1 << (2 * j), (j == 0) ? 0 : -1);
+		}
+	}
+}
+
+static void cerberus_protocol_diagnostic_commands_test_command_stats (CuTest *test)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	struct cerberus_protocol_command_stats_response *resp =
+		(struct cerberus_protocol_command_stats_response*) data;
+	struct cmd_interface_stats_entry stats[3];
+	int status;
+
+	TEST_START;
+
+	cerberus_protocol_diagnostic_commands_testing_init_command_stats (stats, 3);
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	req->offset = 0;
+	request.length = sizeof (struct cerberus_protocol_command_stats);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	status = cerberus_protocol_command_stats (stats, 3, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_command_stats_response) +
+		(sizeof (stats)), request.length);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_DIAG_COMMAND_STATS, resp->header.command);
+	CuAssertIntEquals (test, 3, resp->num_commands);
+
+	status = testing_validate_array ((uint8_t*) stats,
+		(uint8_t*) cerberus_protocol_command_stats_entries (resp), sizeof (stats));
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void cerberus_protocol_diagnostic_commands_test_command_stats_with_offset (CuTest *test)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	struct cerberus_protocol_command_stats_response *resp =
+		(struct cerberus_protocol_command_stats_response*) data;
+	struct cmd_interface_stats_entry stats[3];
+	int status;
+
+	TEST_START;
+
+	cerberus_protocol_diagnostic_commands_testing_init_command_stats (stats, 3);
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	req->offset = 1;
+	request.length = sizeof (struct cerberus_protocol_command_stats);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	status = cerberus_protocol_command_stats (stats, 3, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_command_stats_response) +
+		(sizeof (stats[0]) * 2), request.length);
+	CuAssertIntEquals (test, 3, resp->num_commands);
+
+	status = testing_validate_array ((uint8_t*) &stats[1],
+		(uint8_t*) cerberus_protocol_command_stats_entries (resp), sizeof (stats[0]) * 2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void cerberus_protocol_diagnostic_commands_test_command_stats_offset_past_end (
+	CuTest *test)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	struct cerberus_protocol_command_stats_response *resp =
+		(struct cerberus_protocol_command_stats_response*) data;
+	struct cmd_interface_stats_entry stats[3];
+	int status;
+
+	TEST_START;
+
+	cerberus_protocol_diagnostic_commands_testing_init_command_stats (stats, 3);
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	req->offset = 3;
+	request.length = sizeof (struct cerberus_protocol_command_stats);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	status = cerberus_protocol_command_stats (stats, 3, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_command_stats_response),
+		request.length);
+	CuAssertIntEquals (test, 3, resp->num_commands);
+}
+
+static void cerberus_protocol_diagnostic_commands_test_command_stats_limited_response (
+	CuTest *test)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	struct cerberus_protocol_command_stats_response *resp =
+		(struct cerberus_protocol_command_stats_response*) data;
+	struct cmd_interface_stats_entry stats[3];
+	int status;
+
+	TEST_START;
+
+	cerberus_protocol_diagnostic_commands_testing_init_command_stats (stats, 3);
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	req->offset = 0;
+	request.length = sizeof (struct cerberus_protocol_command_stats);
+	request.max_response = sizeof (struct cerberus_protocol_command_stats_response) +
+		(sizeof (stats[0]) * 2) - 1;
+
+	status = cerberus_protocol_command_stats (stats, 3, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_command_stats_response) +
+		sizeof (stats[0]), request.length);
+	CuAssertIntEquals (test, 3, resp->num_commands);
+
+	status = testing_validate_array ((uint8_t*) stats,
+		(uint8_t*) cerberus_protocol_command_stats_entries (resp), sizeof (stats[0]));
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void cerberus_protocol_diagnostic_commands_test_command_stats_no_commands (CuTest *test)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	struct cerberus_protocol_command_stats_response *resp =
+		(struct cerberus_protocol_command_stats_response*) data;
+	int status;
+
+	TEST_START;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	req->offset = 0;
+	request.length = sizeof (struct cerberus_protocol_command_stats);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	status = cerberus_protocol_command_stats (NULL, 3, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_command_stats_response),
+		request.length);
+	CuAssertIntEquals (test, 0, resp->num_commands);
+}
+
+static void cerberus_protocol_diagnostic_commands_test_command_stats_invalid_len (CuTest *test)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	struct cmd_interface_stats_entry stats[3];
+	int status;
+
+	TEST_START;
+
+	cerberus_protocol_diagnostic_commands_testing_init_command_stats (stats, 3);
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	request.length = sizeof (struct cerberus_protocol_command_stats) + 1;
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	status = cerberus_protocol_command_stats (stats, 3, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
+
+	request.length = sizeof (struct cerberus_protocol_command_stats) - 1;
+
+	status = cerberus_protocol_command_stats (stats, 3, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
+}
+
+static void cerberus_protocol_diagnostic_commands_test_command_stats_response_too_small (
+	CuTest *test)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_command_stats *req = (struct cerberus_protocol_command_stats*) data;
+	struct cmd_interface_stats_entry stats[3];
+	int status;
+
+	TEST_START;
+
+	cerberus_protocol_diagnostic_commands_testing_init_command_stats (stats, 3);
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_DIAG_COMMAND_STATS;
+
+	request.length = sizeof (struct cerberus_protocol_command_stats);
+	request.max_response = sizeof (struct cerberus_protocol_command_stats_response) - 1;
+
+	status = cerberus_protocol_command_stats (stats, 3, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_RESPONSE_TOO_SMALL, status);
+}
+
 
 TEST_SUITE_START (cerberus_protocol_diagnostic_commands);
 
 TEST (cerberus_protocol_diagnostic_commands_test_heap_stats_format);
+TEST (cerberus_protocol_diagnostic_commands_test_command_stats_format);
+TEST (cerberus_protocol_diagnostic_commands_test_command_stats);
+TEST (cerberus_protocol_diagnostic_commands_test_command_stats_with_offset);
+TEST (cerberus_protocol_diagnostic_commands_test_command_stats_offset_past_end);
+TEST (cerberus_protocol_diagnostic_commands_test_command_stats_limited_response);
+TEST (cerberus_protocol_diagnostic_commands_test_command_stats_no_commands);
+TEST (cerberus_protocol_diagnostic_commands_test_command_stats_invalid_len);
+TEST (cerberus_protocol_diagnostic_commands_test_command_stats_response_too_small);
 
 TEST_SUITE_END;
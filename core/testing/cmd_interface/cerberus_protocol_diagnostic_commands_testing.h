@@ -16,5 +16,10 @@ void cerberus_protocol_diagnostic_commands_testing_process_heap_stats_invalid_le
 void cerberus_protocol_diagnostic_commands_testing_process_heap_stats_fail (CuTest *test,
 	struct cmd_interface *cmd, struct cmd_device_mock *device);
 
+void cerberus_protocol_diagnostic_commands_testing_process_command_stats (CuTest *test,
+	struct cmd_interface *cmd, uint8_t command_id, uint32_t requests, uint32_t failures);
+void cerberus_protocol_diagnostic_commands_testing_process_command_stats_invalid_len (
+	CuTest *test, struct cmd_interface *cmd);
+
 
 #endif /* CERBERUS_PROTOCOL_DIAGNOSTIC_COMMANDS_TESTING_H_ */
@@ -5547,6 +5547,323 @@ void cerberus_protocol_optional_commands_testing_process_log_read_debug_fail (Cu
 	debug_log = NULL;
 }
 
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry (CuTest *test,
+	struct cmd_interface *cmd, struct logging_mock *debug)
+{
+	uint8_t entry[16 * sizeof (struct debug_log_entry)];
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_get_log_after_entry *req =
+		(struct cerberus_protocol_get_log_after_entry*) data;
+	struct cerberus_protocol_get_log_response *resp =
+		(struct cerberus_protocol_get_log_response*) data;
+	uint32_t start = 10 * sizeof (struct debug_log_entry);
+	int max = CERBERUS_PROTOCOL_MAX_PAYLOAD_PER_MSG;
+	int length = sizeof (entry) - start;
+	int status;
+	int i_entry;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_READ_LOG;
+
+	req->log_type = CERBERUS_PROTOCOL_DEBUG_LOG;
+	req->offset = 0;
+	req->entry_id = 9;
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+
+	for (i_entry = 0; i_entry < 16; ++i_entry) {
+		struct debug_log_entry *contents =
+			(struct debug_log_entry*) &entry[i_entry * sizeof (struct debug_log_entry)];
+		contents->header.log_magic = 0xCB;
+		contents->header.length = sizeof (struct debug_log_entry);
+		contents->header.entry_id = i_entry;
+		contents->entry.format = DEBUG_LOG_ENTRY_FORMAT;
+		contents->entry.severity = 1;
+		contents->entry.component = 2;
+		contents->entry.msg_index = 3;
+		contents->entry.arg1 = 4;
+		contents->entry.arg2 = 5;
+		contents->entry.time = 6;
+	}
+
+	debug_log = &debug->base;
+
+	status = mock_expect (&debug->mock, debug->base.get_entry_offset, debug, start, MOCK_ARG (9));
+
+	status |= mock_expect (&debug->mock, debug->base.read_contents, debug, length,
+		MOCK_ARG (start), MOCK_ARG_NOT_NULL, MOCK_ARG (max));
+	status |= mock_expect_output (&debug->mock, 1, &entry[start], length, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_get_log_response) + length,
+		request.length);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF, resp->header.msg_type);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_MSFT_PCI_VID, resp->header.pci_vendor_id);
+	CuAssertIntEquals (test, 0, resp->header.crypt);
+	CuAssertIntEquals (test, 0, resp->header.reserved2);
+	CuAssertIntEquals (test, 0, resp->header.integrity_check);
+	CuAssertIntEquals (test, 0, resp->header.reserved1);
+	CuAssertIntEquals (test, 0, resp->header.rq);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_READ_LOG, resp->header.command);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	status = testing_validate_array (&entry[start], cerberus_protocol_log_data (resp), length);
+	CuAssertIntEquals (test, 0, status);
+
+	debug_log = NULL;
+}
+
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_offset (
+	CuTest *test, struct cmd_interface *cmd, struct logging_mock *debug)
+{
+	uint8_t entry[16 * sizeof (struct debug_log_entry)];
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_get_log_after_entry *req =
+		(struct cerberus_protocol_get_log_after_entry*) data;
+	struct cerberus_protocol_get_log_response *resp =
+		(struct cerberus_protocol_get_log_response*) data;
+	uint32_t start = 4 * sizeof (struct debug_log_entry);
+	uint32_t offset = 2 * sizeof (struct debug_log_entry);
+	int max = CERBERUS_PROTOCOL_MAX_PAYLOAD_PER_MSG;
+	int length = sizeof (entry) - start - offset;
+	int status;
+	int i;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_READ_LOG;
+
+	req->log_type = CERBERUS_PROTOCOL_DEBUG_LOG;
+	req->offset = offset;
+	req->entry_id = 3;
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+
+	for (i = 0; i < (int) sizeof (entry); i++) {
+		entry[i] = i;
+	}
+
+	debug_log = &debug->base;
+
+	status = mock_expect (&debug->mock, debug->base.get_entry_offset, debug, start, MOCK_ARG (3));
+
+	status |= mock_expect (&debug->mock, debug->base.read_contents, debug, length,
+		MOCK_ARG (start + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (max));
+	status |= mock_expect_output (&debug->mock, 1, &entry[start + offset], length, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_get_log_response) + length,
+		request.length);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF, resp->header.msg_type);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_MSFT_PCI_VID, resp->header.pci_vendor_id);
+	CuAssertIntEquals (test, 0, resp->header.crypt);
+	CuAssertIntEquals (test, 0, resp->header.reserved2);
+	CuAssertIntEquals (test, 0, resp->header.integrity_check);
+	CuAssertIntEquals (test, 0, resp->header.reserved1);
+	CuAssertIntEquals (test, 0, resp->header.rq);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_READ_LOG, resp->header.command);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	status = testing_validate_array (&entry[start + offset], cerberus_protocol_log_data (resp),
+		length);
+	CuAssertIntEquals (test, 0, status);
+
+	debug_log = NULL;
+}
+
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_none (
+	CuTest *test, struct cmd_interface *cmd, struct logging_mock *debug)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_get_log_after_entry *req =
+		(struct cerberus_protocol_get_log_after_entry*) data;
+	struct cerberus_protocol_get_log_response *resp =
+		(struct cerberus_protocol_get_log_response*) data;
+	uint32_t log_size = 16 * sizeof (struct debug_log_entry);
+	int max = CERBERUS_PROTOCOL_MAX_PAYLOAD_PER_MSG;
+	int status;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_READ_LOG;
+
+	req->log_type = CERBERUS_PROTOCOL_DEBUG_LOG;
+	req->offset = 0;
+	req->entry_id = 15;
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+
+	debug_log = &debug->base;
+
+	status = mock_expect (&debug->mock, debug->base.get_entry_offset, debug, log_size,
+		MOCK_ARG (15));
+	status |= mock_expect (&debug->mock, debug->base.read_contents, debug, 0, MOCK_ARG (log_size),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (max));
+
+	CuAssertIntEquals (test, 0, status);
+
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_get_log_response), request.length);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF, resp->header.msg_type);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_MSFT_PCI_VID, resp->header.pci_vendor_id);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_READ_LOG, resp->header.command);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	debug_log = NULL;
+}
+
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_overflow (
+	CuTest *test, struct cmd_interface *cmd, struct logging_mock *debug)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_get_log_after_entry *req =
+		(struct cerberus_protocol_get_log_after_entry*) data;
+	struct cerberus_protocol_get_log_response *resp =
+		(struct cerberus_protocol_get_log_response*) data;
+	int max = CERBERUS_PROTOCOL_MAX_PAYLOAD_PER_MSG;
+	int status;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_READ_LOG;
+
+	req->log_type = CERBERUS_PROTOCOL_DEBUG_LOG;
+	req->offset = 0xfffffff0;
+	req->entry_id = 3;
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+
+	debug_log = &debug->base;
+
+	status = mock_expect (&debug->mock, debug->base.get_entry_offset, debug, 0x100,
+		MOCK_ARG (3));
+	status |= mock_expect (&debug->mock, debug->base.read_contents, debug, 0,
+		MOCK_ARG (0xffffffff), MOCK_ARG_NOT_NULL, MOCK_ARG (max));
+
+	CuAssertIntEquals (test, 0, status);
+
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct cerberus_protocol_get_log_response), request.length);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_READ_LOG, resp->header.command);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	debug_log = NULL;
+}
+
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_fail (
+	CuTest *test, struct cmd_interface *cmd, struct logging_mock *debug)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_get_log_after_entry *req =
+		(struct cerberus_protocol_get_log_after_entry*) data;
+	int status;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_READ_LOG;
+
+	req->log_type = CERBERUS_PROTOCOL_DEBUG_LOG;
+	req->offset = 0;
+	req->entry_id = 9;
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+
+	debug_log = &debug->base;
+
+	status = mock_expect (&debug->mock, debug->base.get_entry_offset, debug,
+		LOGGING_GET_ENTRY_OFFSET_FAILED, MOCK_ARG (9));
+
+	CuAssertIntEquals (test, 0, status);
+
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, LOGGING_GET_ENTRY_OFFSET_FAILED, status);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	debug_log = NULL;
+}
+
+void cerberus_protocol_optional_commands_testing_process_log_read_after_entry_invalid_type (
+	CuTest *test, struct cmd_interface *cmd)
+{
+	uint8_t data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct cerberus_protocol_get_log_after_entry *req =
+		(struct cerberus_protocol_get_log_after_entry*) data;
+	int status;
+
+	memset (&request, 0, sizeof (request));
+	memset (data, 0, sizeof (data));
+	request.data = data;
+	req->header.msg_type = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	req->header.pci_vendor_id = CERBERUS_PROTOCOL_MSFT_PCI_VID;
+	req->header.command = CERBERUS_PROTOCOL_READ_LOG;
+
+	req->log_type = CERBERUS_PROTOCOL_ATTESTATION_LOG;
+	req->offset = 0;
+	req->entry_id = 9;
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry);
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	req->log_type = CERBERUS_PROTOCOL_TCG_LOG;
+
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry);
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+}
+
 void cerberus_protocol_optional_commands_testing_process_log_read_attestation_fail (CuTest *test,
 	struct cmd_interface *cmd, struct hash_engine_mock *hash, struct pcr_store *store)
 {
@@ -5693,6 +6010,20 @@ void cerberus_protocol_optional_commands_testing_process_log_read_invalid_len (C
 	status = cmd->process_request (cmd, &request);
 	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
 	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	req->log_type = CERBERUS_PROTOCOL_DEBUG_LOG;
+
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry) + 1;
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
+
+	request.length = sizeof (struct cerberus_protocol_get_log_after_entry) - 1;
+	request.crypto_timeout = true;
+	status = cmd->process_request (cmd, &request);
+	CuAssertIntEquals (test, CMD_HANDLER_BAD_LENGTH, status);
+	CuAssertIntEquals (test, false, request.crypto_timeout);
 }
 
 void cerberus_protocol_optional_commands_testing_process_log_read_tcg (CuTest *test,
@@ -12160,6 +12491,34 @@ static void cerberus_protocol_optional_commands_test_get_log_format (CuTest *tes
 	CuAssertPtrEquals (test, &raw_buffer_resp[5], cerberus_protocol_log_data (resp));
 }
 
+static void cerberus_protocol_optional_commands_test_get_log_after_entry_format (CuTest *test)
+{
+	uint8_t raw_buffer_req[] = {
+		0x7e,0x14,0x13,0x03,0x50,
+		0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09
+	};
+	struct cerberus_protocol_get_log_after_entry *req;
+
+	TEST_START;
+
+	CuAssertIntEquals (test, sizeof (raw_buffer_req),
+		sizeof (struct cerberus_protocol_get_log_after_entry));
+
+	req = (struct cerberus_protocol_get_log_after_entry*) raw_buffer_req;
+	CuAssertIntEquals (test, 0, req->header.integrity_check);
+	CuAssertIntEquals (test, 0x7e, req->header.msg_type);
+	CuAssertIntEquals (test, 0x1314, req->header.pci_vendor_id);
+	CuAssertIntEquals (test, 0, req->header.rq);
+	CuAssertIntEquals (test, 0, req->header.reserved2);
+	CuAssertIntEquals (test, 0, req->header.crypt);
+	CuAssertIntEquals (test, 0x03, req->header.reserved1);
+	CuAssertIntEquals (test, CERBERUS_PROTOCOL_READ_LOG, req->header.command);
+
+	CuAssertIntEquals (test, 0x01, req->log_type);
+	CuAssertIntEquals (test, 0x05040302, req->offset);
+	CuAssertIntEquals (test, 0x09080706, req->entry_id);
+}
+
 static void cerberus_protocol_optional_commands_test_clear_log_format (CuTest *test)
 {
 	uint8_t raw_buffer_req[] = {
@@ -12763,6 +13122,7 @@ TEST (cerberus_protocol_optional_commands_test_update_pmr_format);
 TEST (cerberus_protocol_optional_commands_test_key_exchange_format);
 TEST (cerberus_protocol_optional_commands_test_get_log_info_format);
 TEST (cerberus_protocol_optional_commands_test_get_log_format);
+TEST (cerberus_protocol_optional_commands_test_get_log_after_entry_format);
 TEST (cerberus_protocol_optional_commands_test_clear_log_format);
 TEST (cerberus_protocol_optional_commands_test_get_attestation_data_format);
 TEST (cerberus_protocol_optional_commands_test_prepare_fw_update_format);
@@ -260,6 +260,18 @@ void cerberus_protocol_optional_commands_testing_process_log_read_attestation_li
 	struct pcr_store *store);
 void cerberus_protocol_optional_commands_testing_process_log_read_debug_fail (CuTest *test,
 	struct cmd_interface *cmd, struct logging_mock *debug);
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry (CuTest *test,
+	struct cmd_interface *cmd, struct logging_mock *debug);
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_offset (
+	CuTest *test, struct cmd_interface *cmd, struct logging_mock *debug);
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_none (
+	CuTest *test, struct cmd_interface *cmd, struct logging_mock *debug);
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_overflow (
+	CuTest *test, struct cmd_interface *cmd, struct logging_mock *debug);
+void cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_fail (
+	CuTest *test, struct cmd_interface *cmd, struct logging_mock *debug);
+void cerberus_protocol_optional_commands_testing_process_log_read_after_entry_invalid_type (
+	CuTest *test, struct cmd_interface *cmd);
 void cerberus_protocol_optional_commands_testing_process_log_read_attestation_fail (CuTest *test,
 	struct cmd_interface *cmd, struct hash_engine_mock *hash, struct pcr_store *store);
 void cerberus_protocol_optional_commands_testing_process_log_read_invalid_offset (CuTest *test,
@@ -131,6 +131,12 @@ static void add_all_cmd_interface_tests (CuSuite *suite)
 #endif
 
 */
+#if (defined TESTING_RUN_CMD_INTERFACE_STATS_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_CMD_INTERFACE_STATS_SUITE
+	TESTING_RUN_SUITE (cmd_interface_stats);
+#endif
 }
 
 
@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "testing.h"
+#include "cmd_interface/cmd_interface.h"
+#include "cmd_interface/cmd_interface_stats.h"
+
+
+TEST_SUITE_LABEL ("cmd_interface_stats");
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void cmd_interface_stats_test_init (CuTest *test)
+{
+	struct cmd_interface_stats_entry entry;
+	int i;
+
+	TEST_START;
+
+	memset (&entry, 0x55, sizeof (entry));
+
+	cmd_interface_stats_init (&entry, 0x12);
+	CuAssertIntEquals (test, 0x12, entry.command_id);
+	CuAssertIntEquals (test, 0, entry.requests);
+	CuAssertIntEquals (test, 0, entry.failures);
+	CuAssertIntEquals (test, 0, entry.total_ms);
+	CuAssertIntEquals (test, 0, entry.max_ms);
+
+	for (i = 0; i < CMD_INTERFACE_STATS_LATENCY_BUCKETS; i++) {
+		CuAssertIntEquals (test, 0, entry.latency[i]);
+	}
+}
+
+static void cmd_interface_stats_test_init_null (CuTest *test)
+{
+	TEST_START;
+
+	cmd_interface_stats_init (NULL, 0x12);
+}
+
+static void cmd_interface_stats_test_get_latency_bucket (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, cmd_interface_stats_get_latency_bucket (0));
+	CuAssertIntEquals (test, 1, cmd_interface_stats_get_latency_bucket (1));
+	CuAssertIntEquals (test, 1, cmd_interface_stats_get_latency_bucket (3));
+	CuAssertIntEquals (test, 2, cmd_interface_stats_get_latency_bucket (4));
+	CuAssertIntEquals (test, 2, cmd_interface_stats_get_latency_bucket (15));
+	CuAssertIntEquals (test, 3, cmd_interface_stats_get_latency_bucket (16));
+	CuAssertIntEquals (test, 3, cmd_interface_stats_get_latency_bucket (63));
+	CuAssertIntEquals (test, 4, cmd_interface_stats_get_latency_bucket (64));
+	CuAssertIntEquals (test, 4, cmd_interface_stats_get_latency_bucket (255));
+	CuAssertIntEquals (test, 5, cmd_interface_stats_get_latency_bucket (256));
+	CuAssertIntEquals (test, 5, cmd_interface_stats_get_latency_bucket (1023));
+	CuAssertIntEquals (test, 6, cmd_interface_stats_get_latency_bucket (1024));
+	CuAssertIntEquals (test, 6, cmd_interface_stats_get_latency_bucket (4095));
+	CuAssertIntEquals (test, 7, cmd_interface_stats_get_latency_bucket (4096));
+	CuAssertIntEquals (test, 7, cmd_interface_stats_get_latency_bucket (0xffffffff));
+}
+
+static void cmd_interface_stats_test_record (CuTest *test)
+{
+	struct cmd_interface_stats_entry entry;
+
+	TEST_START;
+
+	cmd_interface_stats_init (&entry, 0x12);
+
+	cmd_interface_stats_record (&entry, 10, 0);
+	CuAssertIntEquals (test, 0x12, entry.command_id);
+	CuAssertIntEquals (test, 1, entry.requests);
+	CuAssertIntEquals (test, 0, entry.failures);
+	CuAssertIntEquals (test, 10, entry.total_ms);
+	CuAssertIntEquals (test, 10, entry.max_ms);
+	CuAssertIntEquals (test, 0, entry.latency[0]);
+	CuAssertIntEquals (test, 0, entry.latency[1]);
+	CuAssertIntEquals (test, 1, entry.latency[2]);
+	CuAssertIntEquals (test, 0, entry.latency[3]);
+	CuAssertIntEquals (test, 0, entry.latency[4]);
+	CuAssertIntEquals (test, 0, entry.latency[5]);
+	CuAssertIntEquals (test, 0, entry.latency[6]);
+	CuAssertIntEquals (test, 0, entry.latency[7]);
+}
+
+static void cmd_interface_stats_test_record_multiple (CuTest *test)
+{
+	struct cmd_interface_stats_entry entry;
+
+	TEST_START;
+
+	cmd_interface_stats_init (&entry, 0x12);
+
+	cmd_interface_stats_record (&entry, 10, 0);
+	cmd_interface_stats_record (&entry, 0, 0);
+	cmd_interface_stats_record (&entry, 300, 0);
+	cmd_interface_stats_record (&entry, 5000, 0);
+	cmd_interface_stats_record (&entry, 12, 0);
+
+	CuAssertIntEquals (test, 0x12, entry.command_id);
+	CuAssertIntEquals (test, 5, entry.requests);
+	CuAssertIntEquals (test, 0, entry.failures);
+	CuAssertIntEquals (test, 5322, entry.total_ms);
+	CuAssertIntEquals (test, 5000, entry.max_ms);
+	CuAssertIntEquals (test, 1, entry.latency[0]);
+	CuAssertIntEquals (test, 0, entry.latency[1]);
+	CuAssertIntEquals (test, 2, entry.latency[2]);
+	CuAssertIntEquals (test, 0, entry.latency[3]);
+	CuAssertIntEquals (test, 0, entry.latency[4]);
+	CuAssertIntEquals (test, 1, entry.latency[5]);
+	CuAssertIntEquals (test, 0, entry.latency[6]);
+	CuAssertIntEquals (test, 1, entry.latency[7]);
+}
+
+static void cmd_interface_stats_test_record_failure (CuTest *test)
+{
+	struct cmd_interface_stats_entry entry;
+
+	TEST_START;
+
+	cmd_interface_stats_init (&entry, 0x12);
+
+	cmd_interface_stats_record (&entry, 2, CMD_HANDLER_BAD_LENGTH);
+	cmd_interface_stats_record (&entry, 70, 0);
+	cmd_interface_stats_record (&entry, 20, CMD_HANDLER_UNSUPPORTED_INDEX);
+
+	CuAssertIntEquals (test, 0x12, entry.command_id);
+	CuAssertIntEquals (test, 3, entry.requests);
+	CuAssertIntEquals (test, 2, entry.failures);
+	CuAssertIntEquals (test, 92, entry.total_ms);
+	CuAssertIntEquals (test, 70, entry.max_ms);
+	CuAssertIntEquals (test, 0, entry.latency[0]);
+	CuAssertIntEquals (test, 1, entry.latency[1]);
+	CuAssertIntEquals (test, 0, entry.latency[2]);
+	CuAssertIntEquals (test, 1, entry.latency[3]);
+	CuAssertIntEquals (test, 1, entry.latency[4]);
+	CuAssertIntEquals (test, 0, entry.latency[5]);
+	CuAssertIntEquals (test, 0, entry.latency[6]);
+	CuAssertIntEquals (test, 0, entry.latency[7]);
+}
+
+static void cmd_interface_stats_test_record_null (CuTest *test)
+{
+	TEST_START;
+
+	cmd_interface_stats_record (NULL, 10, 0);
+}
+
+
+TEST_SUITE_START (cmd_interface_stats);
+
+TEST (cmd_interface_stats_test_init);
+TEST (cmd_interface_stats_test_init_null);
+TEST (cmd_interface_stats_test_get_latency_bucket);
+TEST (cmd_interface_stats_test_record);
+TEST (cmd_interface_stats_test_record_multiple);
+TEST (cmd_interface_stats_test_record_failure);
+TEST (cmd_interface_stats_test_record_null);
+
+TEST_SUITE_END;
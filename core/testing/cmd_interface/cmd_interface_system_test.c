@@ -4416,6 +4416,84 @@ static void cmd_interface_system_test_process_log_read_debug_fail (CuTest *test)
 	complete_cmd_interface_system_mock_test (test, &cmd);
 }
 
+static void cmd_interface_system_test_process_log_read_debug_after_entry (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+	cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry (test,
+		&cmd.handler.base, &cmd.debug);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
+static void cmd_interface_system_test_process_log_read_debug_after_entry_offset (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+	cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_offset (test,
+		&cmd.handler.base, &cmd.debug);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
+static void cmd_interface_system_test_process_log_read_debug_after_entry_none (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+	cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_none (test,
+		&cmd.handler.base, &cmd.debug);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
+static void cmd_interface_system_test_process_log_read_debug_after_entry_overflow (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+	cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_overflow (test,
+		&cmd.handler.base, &cmd.debug);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
+static void cmd_interface_system_test_process_log_read_debug_after_entry_fail (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+	cerberus_protocol_optional_commands_testing_process_log_read_debug_after_entry_fail (test,
+		&cmd.handler.base, &cmd.debug);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
+static void cmd_interface_system_test_process_log_read_after_entry_invalid_type (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+	cerberus_protocol_optional_commands_testing_process_log_read_after_entry_invalid_type (test,
+		&cmd.handler.base);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
 static void cmd_interface_system_test_process_log_read_attestation_fail (CuTest *test)
 {
 	struct cmd_interface_system_testing cmd;
@@ -7386,6 +7464,63 @@ static void cmd_interface_system_test_process_heap_stats_fail (CuTest *test)
 	complete_cmd_interface_system_mock_test (test, &cmd);
 }
 
+static void cmd_interface_system_test_process_command_stats (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+
+	cerberus_protocol_diagnostic_commands_testing_process_command_stats (test, &cmd.handler.base,
+		CERBERUS_PROTOCOL_DIAG_COMMAND_STATS, 0, 0);
+	cerberus_protocol_diagnostic_commands_testing_process_command_stats (test, &cmd.handler.base,
+		CERBERUS_PROTOCOL_DIAG_COMMAND_STATS, 1, 0);
+	cerberus_protocol_diagnostic_commands_testing_process_command_stats (test, &cmd.handler.base,
+		CERBERUS_PROTOCOL_GET_DEVICE_ID, 0, 0);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
+static void cmd_interface_system_test_process_command_stats_after_requests (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+
+	cerberus_protocol_required_commands_testing_process_get_device_id (test, &cmd.handler.base,
+		CERBERUS_PROTOCOL_MSFT_PCI_VID, 2, CERBERUS_PROTOCOL_MSFT_PCI_VID, 4);
+	cerberus_protocol_required_commands_testing_process_get_device_id (test, &cmd.handler.base,
+		CERBERUS_PROTOCOL_MSFT_PCI_VID, 2, CERBERUS_PROTOCOL_MSFT_PCI_VID, 4);
+	cerberus_protocol_required_commands_testing_process_get_device_id_invalid_len (test,
+		&cmd.handler.base);
+
+	cerberus_protocol_diagnostic_commands_testing_process_command_stats (test, &cmd.handler.base,
+		CERBERUS_PROTOCOL_GET_DEVICE_ID, 3, 1);
+	cerberus_protocol_diagnostic_commands_testing_process_command_stats (test, &cmd.handler.base,
+		CERBERUS_PROTOCOL_GET_FW_VERSION, 0, 0);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
+static void cmd_interface_system_test_process_command_stats_invalid_len (CuTest *test)
+{
+	struct cmd_interface_system_testing cmd;
+
+	TEST_START;
+
+	setup_cmd_interface_system_mock_test (test, &cmd, true, true, true, true, false, false, true,
+		true, true, true);
+
+	cerberus_protocol_diagnostic_commands_testing_process_command_stats_invalid_len (test,
+		&cmd.handler.base);
+	cerberus_protocol_diagnostic_commands_testing_process_command_stats (test, &cmd.handler.base,
+		CERBERUS_PROTOCOL_DIAG_COMMAND_STATS, 2, 2);
+	complete_cmd_interface_system_mock_test (test, &cmd);
+}
+
 static void cmd_interface_system_test_supports_all_required_commands (CuTest *test)
 {
 	struct cmd_interface_system_testing cmd;
@@ -8402,6 +8537,12 @@ TEST (cmd_interface_system_test_process_log_read_tcg);
 TEST (cmd_interface_system_test_process_log_read_tcg_fail);
 TEST (cmd_interface_system_test_process_log_read_attestation_limited_response);
 TEST (cmd_interface_system_test_process_log_read_debug_fail);
+TEST (cmd_interface_system_test_process_log_read_debug_after_entry);
+TEST (cmd_interface_system_test_process_log_read_debug_after_entry_offset);
+TEST (cmd_interface_system_test_process_log_read_debug_after_entry_none);
+TEST (cmd_interface_system_test_process_log_read_debug_after_entry_overflow);
+TEST (cmd_interface_system_test_process_log_read_debug_after_entry_fail);
+TEST (cmd_interface_system_test_process_log_read_after_entry_invalid_type);
 TEST (cmd_interface_system_test_process_log_read_attestation_fail);
 TEST (cmd_interface_system_test_process_log_read_invalid_type);
 TEST (cmd_interface_system_test_process_log_read_invalid_offset);
@@ -8625,6 +8766,9 @@ TEST (cmd_interface_system_test_process_session_sync_invalid_len);
 TEST (cmd_interface_system_test_process_heap_stats);
 TEST (cmd_interface_system_test_process_heap_stats_invalid_len);
 TEST (cmd_interface_system_test_process_heap_stats_fail);
+TEST (cmd_interface_system_test_process_command_stats);
+TEST (cmd_interface_system_test_process_command_stats_after_requests);
+TEST (cmd_interface_system_test_process_command_stats_invalid_len);
 TEST (cmd_interface_system_test_supports_all_required_commands);
 TEST (cmd_interface_system_test_process_response_null);
 TEST (cmd_interface_system_test_process_response_payload_too_short);
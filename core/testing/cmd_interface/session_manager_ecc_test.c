@@ -494,6 +494,10 @@ static void session_manager_ecc_test_init_invalid_arg (CuTest *test)
 		NULL, NULL, 1, NULL, 0,&cmd.keys_keystore.base);
 	CuAssertIntEquals (test, SESSION_MANAGER_INVALID_ARGUMENT, status);
 
+	status = session_manager_ecc_init (&cmd.session, &cmd.aes.base, &cmd.ecc.base, &cmd.hash.base,
+		&cmd.riot, NULL, SESSION_MANAGER_MAX_SESSIONS + 1, NULL, 0, &cmd.keys_keystore.base);
+	CuAssertIntEquals (test, SESSION_MANAGER_INVALID_ARGUMENT, status);
+
 	status = aes_mock_validate_and_release (&cmd.aes);
 	CuAssertIntEquals (test, 0, status);
 
@@ -2685,6 +2689,98 @@ static void session_manager_ecc_test_decrypt_message (CuTest *test)
 	release_session_manager_ecc_test (test, &cmd);
 }
 
+static void session_manager_ecc_test_decrypt_message_key_already_set (CuTest *test)
+{
+	struct session_manager_ecc_testing cmd;
+	uint8_t rq_data[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg rq;
+	uint8_t data[] = {
+		0xA,0xB,0xC,0xD,0xE,0xF,0xAA,0xBB,0xCC,0xDD,0xEE,0xFF
+	};
+	uint8_t decrypted[] = {
+		0x6,0x7,0x8,0x9,0xA,0xB,0xC
+	};
+	uint8_t aes_key[] = {
+		0xf1,0x3b,0x43,0x16,0x2c,0xe4,0x05,0x75,0x73,0xc5,0x54,0x10,0xad,0xd5,0xc5,0xc6,
+		0x0e,0x9a,0x37,0xff,0x3e,0xa0,0x02,0x34,0xd6,0x41,0x80,0xfa,0x1a,0x0e,0x0a,0x04
+	};
+	int status;
+
+	TEST_START;
+
+	rq.data = rq_data;
+	memcpy (rq.data, data, sizeof (data));
+	memcpy (rq.data + sizeof (data), SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG));
+	memcpy (rq.data + sizeof (data) + sizeof (SESSION_AES_GCM_TAG), SESSION_AES_IV,
+		sizeof (SESSION_AES_IV));
+
+	rq.length = 40;
+	rq.source_eid = 0x10;
+	rq.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	setup_session_manager_ecc_test (test, &cmd);
+
+	session_manager_ecc_establish_session (test, &cmd, 0x10);
+
+	status = mock_expect (&cmd.aes.mock, cmd.aes.base.set_key, &cmd.aes, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)), MOCK_ARG (sizeof (aes_key)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&cmd.aes.mock, cmd.aes.base.decrypt_data, &cmd.aes, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (rq.data + CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID,
+			sizeof (data) - CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID),
+		MOCK_ARG (sizeof (data) - CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG)),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_IV, sizeof (SESSION_AES_IV)),
+		MOCK_ARG (sizeof (SESSION_AES_IV)), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY - CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID));
+	status |= mock_expect_output (&cmd.aes.mock, 5, decrypted, sizeof (decrypted), 6);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd.session.base.decrypt_message (&cmd.session.base, &rq);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (data), rq.length);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY, rq.max_response);
+
+	status = testing_validate_array (data, rq.data, CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (decrypted, rq.data + CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID,
+		sizeof (decrypted));
+	CuAssertIntEquals (test, 0, status);
+
+	rq.length = 40;
+	memcpy (rq.data, data, sizeof (data));
+	memcpy (rq.data + sizeof (data), SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG));
+	memcpy (rq.data + sizeof (data) + sizeof (SESSION_AES_GCM_TAG), SESSION_AES_IV,
+		sizeof (SESSION_AES_IV));
+
+	status = mock_expect (&cmd.aes.mock, cmd.aes.base.decrypt_data, &cmd.aes, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (rq.data + CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID,
+			sizeof (data) - CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID),
+		MOCK_ARG (sizeof (data) - CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_GCM_TAG, sizeof (SESSION_AES_GCM_TAG)),
+		MOCK_ARG_PTR_CONTAINS (SESSION_AES_IV, sizeof (SESSION_AES_IV)),
+		MOCK_ARG (sizeof (SESSION_AES_IV)), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY - CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID));
+	status |= mock_expect_output (&cmd.aes.mock, 5, decrypted, sizeof (decrypted), 6);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd.session.base.decrypt_message (&cmd.session.base, &rq);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (data), rq.length);
+	CuAssertIntEquals (test, MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY, rq.max_response);
+
+	status = testing_validate_array (data, rq.data, CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (decrypted, rq.data + CERBERUS_PROTOCOL_HEADER_SIZE_NO_ID,
+		sizeof (decrypted));
+	CuAssertIntEquals (test, 0, status);
+
+	release_session_manager_ecc_test (test, &cmd);
+}
+
 static void session_manager_ecc_test_decrypt_message_unexpected_eid (CuTest *test)
 {
 	struct session_manager_ecc_testing cmd;
@@ -4781,6 +4877,7 @@ TEST (session_manager_ecc_test_establish_session_generate_hmac_key_fail);
 TEST (session_manager_ecc_test_establish_session_generate_hmac_fail);
 TEST (session_manager_ecc_test_establish_session_invalid_arg);
 TEST (session_manager_ecc_test_decrypt_message);
+TEST (session_manager_ecc_test_decrypt_message_key_already_set);
 TEST (session_manager_ecc_test_decrypt_message_unexpected_eid);
 TEST (session_manager_ecc_test_decrypt_message_session_not_established);
 TEST (session_manager_ecc_test_decrypt_message_set_key_fail);
@@ -628,7 +628,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_with_bad_rec
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -725,7 +726,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_with_bad_rec
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -789,7 +791,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_after_recove
 		sizeof (active_data));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x40000,
 		active_data, sizeof (active_data));
 
@@ -1084,7 +1087,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_keep_recover
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -1185,7 +1189,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_keep_recover
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -1250,7 +1255,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_keep_recover
 		sizeof (active_data));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x40000,
 		active_data, sizeof (active_data));
 
@@ -1416,7 +1422,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_static_init_
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -1485,7 +1492,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_static_init_
 		sizeof (active_data));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x40000,
 		active_data, sizeof (active_data));
 
@@ -1659,7 +1667,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_static_init_
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -1728,7 +1737,8 @@ static void firmware_update_handler_revoke_after_reset_test_prepare_static_init_
 		sizeof (active_data));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x40000,
 		active_data, sizeof (active_data));
 
@@ -1820,7 +1830,8 @@ static void firmware_update_handler_revoke_after_reset_test_execute_run_update (
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (staging_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (staging_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x30000,
 		staging_data, sizeof (staging_data));
 
@@ -1995,7 +2006,8 @@ static void firmware_update_handler_revoke_after_reset_test_execute_run_update_k
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (staging_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (staging_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x30000,
 		staging_data, sizeof (staging_data));
 
@@ -2099,7 +2111,8 @@ static void firmware_update_handler_revoke_after_reset_test_execute_run_update_s
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (staging_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (staging_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x30000,
 		staging_data, sizeof (staging_data));
 
@@ -2203,7 +2216,8 @@ static void firmware_update_handler_revoke_after_reset_test_execute_run_update_s
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (staging_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (staging_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x30000,
 		staging_data, sizeof (staging_data));
 
@@ -1793,7 +1793,8 @@ static void firmware_update_handler_test_prepare_with_bad_recovery_image (CuTest
 		MOCK_RETURN_PTR (&handler.header));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -1868,7 +1869,8 @@ static void firmware_update_handler_test_prepare_with_bad_recovery_image_marked_
 		MOCK_RETURN_PTR (&handler.header));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -1923,7 +1925,8 @@ static void firmware_update_handler_test_prepare_after_recovery_boot (CuTest *te
 		sizeof (active_data));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x40000,
 		active_data, sizeof (active_data));
 
@@ -2074,7 +2077,8 @@ static void firmware_update_handler_test_prepare_keep_recovery_updated_with_bad_
 		MOCK_RETURN_PTR (&handler.header));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -2152,7 +2156,8 @@ static void firmware_update_handler_test_prepare_keep_recovery_updated_with_bad_
 		MOCK_RETURN_PTR (&handler.header));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -2208,7 +2213,8 @@ static void firmware_update_handler_test_prepare_keep_recovery_updated_after_rec
 		sizeof (active_data));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x40000,
 		active_data, sizeof (active_data));
 
@@ -2309,7 +2315,8 @@ static void firmware_update_handler_test_prepare_static_init_with_bad_recovery_i
 		MOCK_RETURN_PTR (&handler.header));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -2367,7 +2374,8 @@ static void firmware_update_handler_test_prepare_static_init_after_recovery_boot
 		sizeof (active_data));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x40000,
 		active_data, sizeof (active_data));
 
@@ -2480,7 +2488,8 @@ static void firmware_update_handler_test_prepare_static_init_keep_recovery_updat
 		MOCK_RETURN_PTR (&handler.header));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x40000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x40000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x40000, 0x10000,
 		active_data, sizeof (active_data));
 
@@ -2540,7 +2549,8 @@ static void firmware_update_handler_test_prepare_static_init_keep_recovery_updat
 		sizeof (active_data));
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (active_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (active_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x40000,
 		active_data, sizeof (active_data));
 
@@ -2624,7 +2634,8 @@ static void firmware_update_handler_test_execute_run_update (CuTest *test)
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (staging_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (staging_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x30000,
 		staging_data, sizeof (staging_data));
 
@@ -2809,7 +2820,8 @@ static void firmware_update_handler_test_execute_run_update_keep_recovery_update
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (staging_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (staging_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x30000,
 		staging_data, sizeof (staging_data));
 
@@ -2924,7 +2936,8 @@ static void firmware_update_handler_test_execute_run_update_static_init (CuTest
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (staging_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (staging_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x30000,
 		staging_data, sizeof (staging_data));
 
@@ -3042,7 +3055,8 @@ static void firmware_update_handler_test_execute_run_update_static_init_keep_rec
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
 	status |= firmware_update_testing_flash_page_size (&handler.flash, FLASH_PAGE_SIZE);
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x10000, sizeof (staging_data));
+	status |= flash_mock_expect_erase_flash_mixed_verify (&handler.flash, 0x10000,
+		sizeof (staging_data));
 	status |= flash_mock_expect_copy_flash_verify (&handler.flash, &handler.flash, 0x10000, 0x30000,
 		staging_data, sizeof (staging_data));
 
@@ -0,0 +1,1177 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "testing.h"
+#include "flash/flash_cache.h"
+#include "flash/flash_cache_static.h"
+#include "testing/mock/flash/flash_mock.h"
+
+
+TEST_SUITE_LABEL ("flash_cache");
+
+
+/**
+ * Number of lines in the test cache.
+ */
+#define	FLASH_CACHE_TESTING_LINES		2
+
+/**
+ * Size of each line in the test cache.
+ */
+#define	FLASH_CACHE_TESTING_LINE_SIZE	64
+
+/**
+ * Size of the flash device used for testing.
+ */
+#define	FLASH_CACHE_TESTING_DEVICE_SIZE	0x100000
+
+
+/**
+ * Dependencies for testing the flash cache.
+ */
+struct flash_cache_testing {
+	struct flash_mock flash;										/**< Mock for the cached flash. */
+	struct flash_cache_state state;									/**< Context for the cache. */
+	struct flash_cache_line lines[FLASH_CACHE_TESTING_LINES];		/**< Cache line metadata. */
+	uint8_t data[FLASH_CACHE_TESTING_LINES * FLASH_CACHE_TESTING_LINE_SIZE];	/**< Cache storage. */
+	uint8_t flash_data[FLASH_CACHE_TESTING_LINE_SIZE * 4];			/**< Data returned from flash. */
+	struct flash_cache test;										/**< Cache under test. */
+};
+
+
+/**
+ * Initialize all dependencies for testing.
+ *
+ * @param test The test framework.
+ * @param cache Testing dependencies to initialize.
+ */
+static void flash_cache_testing_init_dependencies (CuTest *test,
+	struct flash_cache_testing *cache)
+{
+	size_t i;
+	int status;
+
+	status = flash_mock_init (&cache->flash);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < sizeof (cache->flash_data); i++) {
+		cache->flash_data[i] = i;
+	}
+}
+
+/**
+ * Initialize a flash cache for testing.
+ *
+ * @param test The test framework.
+ * @param cache Testing components to initialize.
+ */
+static void flash_cache_testing_init (CuTest *test, struct flash_cache_testing *cache)
+{
+	int status;
+
+	flash_cache_testing_init_dependencies (test, cache);
+
+	status = flash_cache_init (&cache->test, &cache->state, &cache->flash.base, cache->lines,
+		cache->data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release test dependencies and validate all mocks.
+ *
+ * @param test The test framework.
+ * @param cache Testing dependencies to release.
+ */
+static void flash_cache_testing_release_dependencies (CuTest *test,
+	struct flash_cache_testing *cache)
+{
+	int status;
+
+	status = flash_mock_validate_and_release (&cache->flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release a test instance and validate all mocks.
+ *
+ * @param test The test framework.
+ * @param cache Testing components to release.
+ */
+static void flash_cache_testing_validate_and_release (CuTest *test,
+	struct flash_cache_testing *cache)
+{
+	flash_cache_release (&cache->test);
+
+	flash_cache_testing_release_dependencies (test, cache);
+}
+
+/**
+ * Set up expectations for querying the device size.
+ *
+ * @param test The test framework.
+ * @param cache The testing components.
+ */
+static void flash_cache_testing_expect_device_size (CuTest *test,
+	struct flash_cache_testing *cache)
+{
+	uint32_t bytes = FLASH_CACHE_TESTING_DEVICE_SIZE;
+	int status;
+
+	status = mock_expect (&cache->flash.mock, cache->flash.base.get_device_size, &cache->flash, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&cache->flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Set up expectations for filling a cache line.
+ *
+ * @param test The test framework.
+ * @param cache The testing components.
+ * @param addr The flash address of the line.
+ * @param data The data to return for the line.
+ * @param length The length of the line read.
+ */
+static void flash_cache_testing_expect_line_fill (CuTest *test,
+	struct flash_cache_testing *cache, uint32_t addr, const uint8_t *data, size_t length)
+{
+	int status;
+
+	status = mock_expect (&cache->flash.mock, cache->flash.base.read, &cache->flash, 0,
+		MOCK_ARG (addr), MOCK_ARG_NOT_NULL, MOCK_ARG (length));
+	status |= mock_expect_output (&cache->flash.mock, 1, data, length, 2);
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Read from the cache and check the data that was returned.
+ *
+ * @param test The test framework.
+ * @param cache The testing components.
+ * @param addr The address to read.
+ * @param expected The expected data.
+ * @param length The number of bytes to read.
+ */
+static void flash_cache_testing_read (CuTest *test, struct flash_cache_testing *cache,
+	uint32_t addr, const uint8_t *expected, size_t length)
+{
+	uint8_t data[FLASH_CACHE_TESTING_LINE_SIZE * 4];
+	int status;
+
+	status = cache->test.base.read (&cache->test.base, addr, data, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (expected, data, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&cache->flash.mock);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Check the statistics reported by the cache.
+ *
+ * @param test The test framework.
+ * @param cache The testing components.
+ * @param hits The expected number of hits.
+ * @param misses The expected number of misses.
+ * @param uncached The expected number of uncached reads.
+ */
+static void flash_cache_testing_check_stats (CuTest *test, struct flash_cache_testing *cache,
+	uint32_t hits, uint32_t misses, uint32_t uncached)
+{
+	struct flash_cache_stats stats;
+	int status;
+
+	status = flash_cache_get_stats (&cache->test, &stats);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, hits, stats.hits);
+	CuAssertIntEquals (test, misses, stats.misses);
+	CuAssertIntEquals (test, uncached, stats.uncached);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void flash_cache_test_init (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init_dependencies (test, &cache);
+
+	status = flash_cache_init (&cache.test, &cache.state, &cache.flash.base, cache.lines,
+		cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, cache.test.base.get_device_size);
+	CuAssertPtrNotNull (test, cache.test.base.read);
+	CuAssertPtrNotNull (test, cache.test.base.get_page_size);
+	CuAssertPtrNotNull (test, cache.test.base.minimum_write_per_page);
+	CuAssertPtrNotNull (test, cache.test.base.write);
+	CuAssertPtrNotNull (test, cache.test.base.get_sector_size);
+	CuAssertPtrNotNull (test, cache.test.base.sector_erase);
+	CuAssertPtrNotNull (test, cache.test.base.get_block_size);
+	CuAssertPtrNotNull (test, cache.test.base.block_erase);
+	CuAssertPtrNotNull (test, cache.test.base.chip_erase);
+
+	flash_cache_testing_check_stats (test, &cache, 0, 0, 0);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_init_null (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init_dependencies (test, &cache);
+
+	status = flash_cache_init (NULL, &cache.state, &cache.flash.base, cache.lines,
+		cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init (&cache.test, NULL, &cache.flash.base, cache.lines,
+		cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init (&cache.test, &cache.state, NULL, cache.lines,
+		cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init (&cache.test, &cache.state, &cache.flash.base, NULL,
+		cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init (&cache.test, &cache.state, &cache.flash.base, cache.lines,
+		NULL, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init (&cache.test, &cache.state, &cache.flash.base, cache.lines,
+		cache.data, 0, FLASH_CACHE_TESTING_LINE_SIZE);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init (&cache.test, &cache.state, &cache.flash.base, cache.lines,
+		cache.data, FLASH_CACHE_TESTING_LINES, 0);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_release_dependencies (test, &cache);
+}
+
+static void flash_cache_test_init_line_size_not_power_of_2 (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init_dependencies (test, &cache);
+
+	status = flash_cache_init (&cache.test, &cache.state, &cache.flash.base, cache.lines,
+		cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE - 1);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_release_dependencies (test, &cache);
+}
+
+static void flash_cache_test_static_init (CuTest *test)
+{
+	struct flash_cache_testing cache = {
+		.test = flash_cache_static_init (&cache.state, &cache.flash.base, cache.lines, cache.data,
+			FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE)
+	};
+	int status;
+
+	TEST_START;
+
+	CuAssertPtrNotNull (test, cache.test.base.get_device_size);
+	CuAssertPtrNotNull (test, cache.test.base.read);
+	CuAssertPtrNotNull (test, cache.test.base.get_page_size);
+	CuAssertPtrNotNull (test, cache.test.base.minimum_write_per_page);
+	CuAssertPtrNotNull (test, cache.test.base.write);
+	CuAssertPtrNotNull (test, cache.test.base.get_sector_size);
+	CuAssertPtrNotNull (test, cache.test.base.sector_erase);
+	CuAssertPtrNotNull (test, cache.test.base.get_block_size);
+	CuAssertPtrNotNull (test, cache.test.base.block_erase);
+	CuAssertPtrNotNull (test, cache.test.base.chip_erase);
+
+	flash_cache_testing_init_dependencies (test, &cache);
+
+	status = flash_cache_init_state (&cache.test);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1004, &cache.flash_data[4], 4);
+	flash_cache_testing_read (test, &cache, 0x1010, &cache.flash_data[0x10], 8);
+
+	flash_cache_testing_check_stats (test, &cache, 1, 1, 0);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_static_init_null (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	struct flash_cache null_state = flash_cache_static_init (NULL, &cache.flash.base,
+		cache.lines, cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	struct flash_cache null_flash = flash_cache_static_init (&cache.state, NULL,
+		cache.lines, cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	struct flash_cache null_lines = flash_cache_static_init (&cache.state, &cache.flash.base,
+		NULL, cache.data, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	struct flash_cache null_data = flash_cache_static_init (&cache.state, &cache.flash.base,
+		cache.lines, NULL, FLASH_CACHE_TESTING_LINES, FLASH_CACHE_TESTING_LINE_SIZE);
+	struct flash_cache bad_size = flash_cache_static_init (&cache.state, &cache.flash.base,
+		cache.lines, cache.data, FLASH_CACHE_TESTING_LINES, 48);
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init_dependencies (test, &cache);
+
+	status = flash_cache_init_state (NULL);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init_state (&null_state);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init_state (&null_flash);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init_state (&null_lines);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init_state (&null_data);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_init_state (&bad_size);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_release_dependencies (test, &cache);
+}
+
+static void flash_cache_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	flash_cache_release (NULL);
+}
+
+static void flash_cache_test_get_device_size (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = FLASH_CACHE_TESTING_DEVICE_SIZE;
+	uint32_t out;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.get_device_size, &cache.flash, 0,
+		MOCK_ARG_PTR (&out));
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.get_device_size (&cache.test.base, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, bytes, out);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_get_device_size_null (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t out;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = cache.test.base.get_device_size (NULL, &out);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_get_page_size (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = 256;
+	uint32_t out;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.get_page_size, &cache.flash, 0,
+		MOCK_ARG_PTR (&out));
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.get_page_size (&cache.test.base, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, bytes, out);
+
+	status = cache.test.base.get_page_size (NULL, &out);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_minimum_write_per_page (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = 16;
+	uint32_t out;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.minimum_write_per_page,
+		&cache.flash, 0, MOCK_ARG_PTR (&out));
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.minimum_write_per_page (&cache.test.base, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, bytes, out);
+
+	status = cache.test.base.minimum_write_per_page (NULL, &out);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_get_sector_size (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = 0x1000;
+	uint32_t out;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.get_sector_size, &cache.flash, 0,
+		MOCK_ARG_PTR (&out));
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.get_sector_size (&cache.test.base, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, bytes, out);
+
+	status = cache.test.base.get_sector_size (NULL, &out);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_get_block_size (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = 0x10000;
+	uint32_t out;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.get_block_size, &cache.flash, 0,
+		MOCK_ARG_PTR (&out));
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.get_block_size (&cache.test.base, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, bytes, out);
+
+	status = cache.test.base.get_block_size (NULL, &out);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_miss_then_hit (CuTest *test)
+{
+	struct flash_cache_testing cache;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+	flash_cache_testing_check_stats (test, &cache, 0, 1, 0);
+
+	/* Nearby reads are served from the cache. */
+	flash_cache_testing_read (test, &cache, 0x1004, &cache.flash_data[4], 12);
+	flash_cache_testing_read (test, &cache, 0x1030, &cache.flash_data[0x30], 0x10);
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	flash_cache_testing_check_stats (test, &cache, 3, 1, 0);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_unaligned (CuTest *test)
+{
+	struct flash_cache_testing cache;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1040, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1075, &cache.flash_data[0x35], 5);
+	flash_cache_testing_read (test, &cache, 0x1041, &cache.flash_data[1], 1);
+
+	flash_cache_testing_check_stats (test, &cache, 1, 1, 0);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_across_lines (CuTest *test)
+{
+	struct flash_cache_testing cache;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1040,
+		&cache.flash_data[FLASH_CACHE_TESTING_LINE_SIZE], FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1038, &cache.flash_data[0x38], 0x10);
+	flash_cache_testing_check_stats (test, &cache, 0, 2, 0);
+
+	flash_cache_testing_read (test, &cache, 0x103c, &cache.flash_data[0x3c], 8);
+	flash_cache_testing_check_stats (test, &cache, 2, 2, 0);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_large_uncached (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.read, &cache.flash, 0,
+		MOCK_ARG (0x1010), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_CACHE_TESTING_LINE_SIZE * 2));
+	status |= mock_expect_output (&cache.flash.mock, 1, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE * 2, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	flash_cache_testing_read (test, &cache, 0x1010, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE * 2);
+	flash_cache_testing_check_stats (test, &cache, 0, 0, 1);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.read, &cache.flash, 0,
+		MOCK_ARG (0x1000), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_CACHE_TESTING_LINE_SIZE));
+	status |= mock_expect_output (&cache.flash.mock, 1, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+	flash_cache_testing_check_stats (test, &cache, 0, 0, 2);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_lru_replacement (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	const uint8_t *line_a = cache.flash_data;
+	const uint8_t *line_b = &cache.flash_data[FLASH_CACHE_TESTING_LINE_SIZE];
+	const uint8_t *line_c = &cache.flash_data[FLASH_CACHE_TESTING_LINE_SIZE * 2];
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, line_a,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, line_a, 4);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x2000, line_b,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x2000, line_b, 4);
+	flash_cache_testing_read (test, &cache, 0x1008, &line_a[8], 4);
+
+	/* The line at 0x2000 was used least recently, so it gets replaced. */
+	flash_cache_testing_expect_line_fill (test, &cache, 0x3000, line_c,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x3000, line_c, 4);
+	flash_cache_testing_read (test, &cache, 0x1004, &line_a[4], 4);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x2000, line_b,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x2000, line_b, 4);
+
+	flash_cache_testing_check_stats (test, &cache, 2, 4, 0);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_end_of_device (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t line_addr = FLASH_CACHE_TESTING_DEVICE_SIZE - FLASH_CACHE_TESTING_LINE_SIZE;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, line_addr, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, FLASH_CACHE_TESTING_DEVICE_SIZE - 4,
+		&cache.flash_data[FLASH_CACHE_TESTING_LINE_SIZE - 4], 4);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_partial_line_at_end_of_device (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = FLASH_CACHE_TESTING_DEVICE_SIZE - 0x10;
+	uint32_t line_addr = FLASH_CACHE_TESTING_DEVICE_SIZE - FLASH_CACHE_TESTING_LINE_SIZE;
+	uint8_t data[4];
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.get_device_size, &cache.flash, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	flash_cache_testing_expect_line_fill (test, &cache, line_addr, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE - 0x10);
+
+	flash_cache_testing_read (test, &cache, bytes - 4,
+		&cache.flash_data[FLASH_CACHE_TESTING_LINE_SIZE - 0x14], 4);
+
+	status = cache.test.base.read (&cache.test.base, bytes - 2, data, 4);
+	CuAssertIntEquals (test, FLASH_ADDRESS_OUT_OF_RANGE, status);
+
+	status = cache.test.base.read (&cache.test.base, FLASH_CACHE_TESTING_DEVICE_SIZE, data, 4);
+	CuAssertIntEquals (test, FLASH_ADDRESS_OUT_OF_RANGE, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_null (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint8_t data[4];
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = cache.test.base.read (NULL, 0x1000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = cache.test.base.read (&cache.test.base, 0x1000, NULL, sizeof (data));
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_device_size_error (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint8_t data[4];
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.get_device_size, &cache.flash,
+		FLASH_DEVICE_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.read (&cache.test.base, 0x1000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_DEVICE_SIZE_FAILED, status);
+
+	status = mock_validate (&cache.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The device size will be queried again. */
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_read_fill_error (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint8_t data[4];
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.read, &cache.flash,
+		FLASH_READ_FAILED, MOCK_ARG (0x1000), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (FLASH_CACHE_TESTING_LINE_SIZE));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.read (&cache.test.base, 0x1000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = mock_validate (&cache.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The failed line is not used for later reads. */
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	flash_cache_testing_check_stats (test, &cache, 0, 2, 0);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_write_invalidates_line (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint8_t write_data[] = {0x11, 0x22};
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x2000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x2000, cache.flash_data, 4);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.write, &cache.flash,
+		sizeof (write_data), MOCK_ARG (0x103f), MOCK_ARG_PTR_CONTAINS (write_data,
+		sizeof (write_data)), MOCK_ARG (sizeof (write_data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.write (&cache.test.base, 0x103f, write_data, sizeof (write_data));
+	CuAssertIntEquals (test, sizeof (write_data), status);
+
+	status = mock_validate (&cache.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Only the line that was written needs to be read again. */
+	cache.flash_data[0x3f] = write_data[0];
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x103c, &cache.flash_data[0x3c], 4);
+	flash_cache_testing_read (test, &cache, 0x2000, cache.flash_data, 4);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_write_error (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint8_t write_data[] = {0x11, 0x22};
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.write, &cache.flash,
+		FLASH_WRITE_FAILED, MOCK_ARG (0x1010), MOCK_ARG_PTR_CONTAINS (write_data,
+		sizeof (write_data)), MOCK_ARG (sizeof (write_data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.write (&cache.test.base, 0x1010, write_data, sizeof (write_data));
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
+	status = mock_validate (&cache.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_write_null (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint8_t write_data[] = {0x11, 0x22};
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = cache.test.base.write (NULL, 0x1010, write_data, sizeof (write_data));
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_sector_erase_invalidates_lines (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = 0x1000;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x2000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x2000, cache.flash_data, 4);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.sector_erase, &cache.flash, 0,
+		MOCK_ARG (0x1800));
+	status |= mock_expect (&cache.flash.mock, cache.flash.base.get_sector_size, &cache.flash, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.sector_erase (&cache.test.base, 0x1800);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&cache.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+	flash_cache_testing_read (test, &cache, 0x2000, cache.flash_data, 4);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_sector_erase_size_error (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x2000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x2000, cache.flash_data, 4);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.sector_erase, &cache.flash, 0,
+		MOCK_ARG (0x1000));
+	status |= mock_expect (&cache.flash.mock, cache.flash.base.get_sector_size, &cache.flash,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.sector_erase (&cache.test.base, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&cache.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Without knowing the erased region, everything is invalidated. */
+	flash_cache_testing_expect_line_fill (test, &cache, 0x2000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x2000, cache.flash_data, 4);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_sector_erase_error (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = 0x1000;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.sector_erase, &cache.flash,
+		FLASH_SECTOR_ERASE_FAILED, MOCK_ARG (0x1000));
+	status |= mock_expect (&cache.flash.mock, cache.flash.base.get_sector_size, &cache.flash, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.sector_erase (&cache.test.base, 0x1000);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+
+	status = cache.test.base.sector_erase (NULL, 0x1000);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_block_erase_invalidates_lines (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	uint32_t bytes = 0x10000;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x11000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x11000, cache.flash_data, 4);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x20000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x20000, cache.flash_data, 4);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.block_erase, &cache.flash, 0,
+		MOCK_ARG (0x10000));
+	status |= mock_expect (&cache.flash.mock, cache.flash.base.get_block_size, &cache.flash, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&cache.flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.block_erase (&cache.test.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&cache.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x11000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x11000, cache.flash_data, 4);
+	flash_cache_testing_read (test, &cache, 0x20000, cache.flash_data, 4);
+
+	status = cache.test.base.block_erase (NULL, 0x10000);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_chip_erase_invalidates_lines (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	status = mock_expect (&cache.flash.mock, cache.flash.base.chip_erase, &cache.flash, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = cache.test.base.chip_erase (&cache.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&cache.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	status = cache.test.base.chip_erase (NULL);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_invalidate (CuTest *test)
+{
+	struct flash_cache_testing cache;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	flash_cache_testing_expect_device_size (test, &cache);
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	flash_cache_invalidate (&cache.test);
+
+	flash_cache_testing_expect_line_fill (test, &cache, 0x1000, cache.flash_data,
+		FLASH_CACHE_TESTING_LINE_SIZE);
+
+	flash_cache_testing_read (test, &cache, 0x1000, cache.flash_data, 4);
+
+	flash_cache_testing_check_stats (test, &cache, 0, 2, 0);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+static void flash_cache_test_invalidate_null (CuTest *test)
+{
+	TEST_START;
+
+	flash_cache_invalidate (NULL);
+}
+
+static void flash_cache_test_get_stats_null (CuTest *test)
+{
+	struct flash_cache_testing cache;
+	struct flash_cache_stats stats;
+	int status;
+
+	TEST_START;
+
+	flash_cache_testing_init (test, &cache);
+
+	status = flash_cache_get_stats (NULL, &stats);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_cache_get_stats (&cache.test, NULL);
+	CuAssertIntEquals (test, FLASH_INVALID_ARGUMENT, status);
+
+	flash_cache_testing_validate_and_release (test, &cache);
+}
+
+
+TEST_SUITE_START (flash_cache);
+
+TEST (flash_cache_test_init);
+TEST (flash_cache_test_init_null);
+TEST (flash_cache_test_init_line_size_not_power_of_2);
+TEST (flash_cache_test_static_init);
+TEST (flash_cache_test_static_init_null);
+TEST (flash_cache_test_release_null);
+TEST (flash_cache_test_get_device_size);
+TEST (flash_cache_test_get_device_size_null);
+TEST (flash_cache_test_get_page_size);
+TEST (flash_cache_test_minimum_write_per_page);
+TEST (flash_cache_test_get_sector_size);
+TEST (flash_cache_test_get_block_size);
+TEST (flash_cache_test_read_miss_then_hit);
+TEST (flash_cache_test_read_unaligned);
+TEST (flash_cache_test_read_across_lines);
+TEST (flash_cache_test_read_large_uncached);
+TEST (flash_cache_test_read_lru_replacement);
+TEST (flash_cache_test_read_end_of_device);
+TEST (flash_cache_test_read_partial_line_at_end_of_device);
+TEST (flash_cache_test_read_null);
+TEST (flash_cache_test_read_device_size_error);
+TEST (flash_cache_test_read_fill_error);
+TEST (flash_cache_test_write_invalidates_line);
+TEST (flash_cache_test_write_error);
+TEST (flash_cache_test_write_null);
+TEST (flash_cache_test_sector_erase_invalidates_lines);
+TEST (flash_cache_test_sector_erase_size_error);
+TEST (flash_cache_test_sector_erase_error);
+TEST (flash_cache_test_block_erase_invalidates_lines);
+TEST (flash_cache_test_chip_erase_invalidates_lines);
+TEST (flash_cache_test_invalidate);
+TEST (flash_cache_test_invalidate_null);
+TEST (flash_cache_test_get_stats_null);
+
+TEST_SUITE_END;
@@ -1579,6 +1579,372 @@ static void flash_store_aggregator_test_has_data_stored_fail_aggregator_null (Cu
 	flash_store_aggregator_release (&store.test);
 }
 
+static void flash_store_aggregator_test_init_indexed (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[68];
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 68);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, store.test.base.write);
+	CuAssertPtrNotNull (test, store.test.base.read);
+	CuAssertPtrNotNull (test, store.test.base.erase);
+	CuAssertPtrNotNull (test, store.test.base.erase_all);
+	CuAssertPtrNotNull (test, store.test.base.get_data_length);
+	CuAssertPtrNotNull (test, store.test.base.has_data_stored);
+	CuAssertPtrNotNull (test, store.test.base.get_max_data_length);
+	CuAssertPtrNotNull (test, store.test.base.get_flash_size);
+	CuAssertPtrNotNull (test, store.test.base.get_num_blocks);
+
+	CuAssertPtrEquals (test, block_index, store.test.block_index);
+	CuAssertIntEquals (test, 68, store.test.index_length);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_init_indexed_null (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[68];
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init_indexed (NULL, store.flash_store_array, 2, block_index,
+		68);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	status = flash_store_aggregator_init_indexed (&store.test, NULL, 2, block_index, 68);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 0,
+		block_index, 68);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2, NULL,
+		68);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 0);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	flash_store_aggregator_testing_release_dependencies (test, &store.flash_1, &store.flash_2);
+}
+
+static void flash_store_aggregator_test_build_index (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[68];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 68);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.get_num_blocks,
+		&store.flash_2, 34);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_aggregator_build_index (&store.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.read, &store.flash_1,
+		sizeof (data), MOCK_ARG (2), MOCK_ARG_PTR (data), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.write, &store.flash_2, 0,
+		MOCK_ARG (0), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.erase, &store.flash_2, 0,
+		MOCK_ARG (33));
+	status |= mock_expect (&store.flash_1.mock, store.flash_1.base.get_data_length,
+		&store.flash_1, sizeof (data), MOCK_ARG (33));
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.has_data_stored,
+		&store.flash_2, 1, MOCK_ARG (2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.read (&store.test.base, 2, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = store.test.base.write (&store.test.base, 34, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.erase (&store.test.base, 67);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 33);
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 36);
+	CuAssertIntEquals (test, 1, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_build_index_static (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	const struct flash_store *flash_store_array[2] =
+		{&store.flash_1.base, &store.flash_2.base};
+	struct flash_store_aggregator_block block_index[68] = {0};
+	struct flash_store_aggregator aggregator =
+		flash_store_aggregator_static_init_indexed (flash_store_array, 2, block_index, 68);
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	store.test = aggregator;
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.get_num_blocks,
+		&store.flash_2, 34);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_aggregator_build_index (&store.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_2.mock, store.flash_2.base.has_data_stored,
+		&store.flash_2, 1, MOCK_ARG (2));
+	status |= mock_expect (&store.flash_1.mock, store.flash_1.base.has_data_stored,
+		&store.flash_1, 0, MOCK_ARG (0));
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 36);
+	CuAssertIntEquals (test, 1, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_build_index_invalid_id (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[68];
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 68);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.get_num_blocks,
+		&store.flash_2, 34);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_aggregator_build_index (&store.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.get_num_blocks,
+		&store.flash_2, 34);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 68);
+	CuAssertIntEquals (test, FLASH_STORE_UNSUPPORTED_ID, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_build_index_not_built (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[68];
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 68);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.get_num_blocks,
+		&store.flash_2, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.has_data_stored,
+		&store.flash_2, 1, MOCK_ARG (2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 36);
+	CuAssertIntEquals (test, 1, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_build_index_too_small (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[40];
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 40);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.get_num_blocks,
+		&store.flash_2, 34);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_aggregator_build_index (&store.test);
+	CuAssertIntEquals (test, FLASH_STORE_INSUFFICIENT_STORAGE, status);
+
+	/* Blocks in the first flash store were indexed. */
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.has_data_stored,
+		&store.flash_1, 1, MOCK_ARG (33));
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 33);
+	CuAssertIntEquals (test, 1, status);
+
+	/* Blocks in the second flash store were not. */
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.get_num_blocks,
+		&store.flash_2, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.has_data_stored,
+		&store.flash_2, 0, MOCK_ARG (0));
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 34);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_build_index_null (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[68];
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 68);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_aggregator_build_index (NULL);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_build_index_no_index (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init (&store.test, store.flash_store_array, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_aggregator_build_index (&store.test);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_build_index_num_blocks_fail (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[68];
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 68);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	status |= mock_expect (&store.flash_2.mock, store.flash_2.base.get_num_blocks,
+		&store.flash_2, FLASH_STORE_NUM_BLOCKS_FAILED);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_aggregator_build_index (&store.test);
+	CuAssertIntEquals (test, FLASH_STORE_NUM_BLOCKS_FAILED, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
+static void flash_store_aggregator_test_build_index_no_storage (CuTest *test)
+{
+	struct flash_store_aggregator_testing store;
+	struct flash_store_aggregator_block block_index[68];
+	int status;
+
+	TEST_START;
+
+	flash_store_aggregator_testing_init_dependencies (test, &store, &store.flash_1,
+		&store.flash_2);
+
+	store.flash_store_array[1] = NULL;
+
+	status = flash_store_aggregator_init_indexed (&store.test, store.flash_store_array, 2,
+		block_index, 68);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash_1.mock, store.flash_1.base.get_num_blocks,
+		&store.flash_1, 34);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_aggregator_build_index (&store.test);
+	CuAssertIntEquals (test, FLASH_STORE_NO_STORAGE, status);
+
+	flash_store_aggregator_testing_release (test, &store);
+}
+
 TEST_SUITE_START (flash_store_aggregator);
 
 TEST (flash_store_aggregator_test_init);
@@ -1633,5 +1999,16 @@ TEST (flash_store_aggregator_test_has_data_stored_end_index);
 TEST (flash_store_aggregator_test_has_data_stored_static);
 TEST (flash_store_aggregator_test_has_data_stored_fail_invalid_id);
 TEST (flash_store_aggregator_test_has_data_stored_fail_aggregator_null);
+TEST (flash_store_aggregator_test_init_indexed);
+TEST (flash_store_aggregator_test_init_indexed_null);
+TEST (flash_store_aggregator_test_build_index);
+TEST (flash_store_aggregator_test_build_index_static);
+TEST (flash_store_aggregator_test_build_index_invalid_id);
+TEST (flash_store_aggregator_test_build_index_not_built);
+TEST (flash_store_aggregator_test_build_index_too_small);
+TEST (flash_store_aggregator_test_build_index_null);
+TEST (flash_store_aggregator_test_build_index_no_index);
+TEST (flash_store_aggregator_test_build_index_num_blocks_fail);
+TEST (flash_store_aggregator_test_build_index_no_storage);
 
 TEST_SUITE_END;
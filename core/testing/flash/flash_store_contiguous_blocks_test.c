@@ -108,6 +108,46 @@ static void flash_store_contiguous_blocks_testing_release_dependencies (CuTest *
 	CuAssertIntEquals (test, 0, status);
 }
 
+/**
+ * Helper to build a directory for variable storage with three blocks starting at 0x10000.  The
+ * first block contains 256 bytes of data, the second block is empty, and the third block contains
+ * 128 bytes of data using the old header format.
+ *
+ * @param test The test framework.
+ * @param store Testing dependencies for the initialized flash store.
+ * @param directory The directory to build.
+ * @param entries The number of entries in the directory.
+ */
+static void flash_store_contiguous_blocks_testing_build_directory (CuTest *test,
+	struct flash_store_contiguous_blocks_testing *store,
+	struct flash_store_contiguous_blocks_entry *directory, size_t entries)
+{
+	uint8_t header[] = {0x04, 0xa5, 0x00, 0x01};
+	uint8_t blank[] = {0xff, 0xff, 0xff, 0xff};
+	uint8_t old_header[] = {0x80, 0x00, 0x00, 0x01};
+	int status;
+
+	status = mock_expect (&store->flash.mock, store->flash.base.read, &store->flash, 0,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (header)));
+	status |= mock_expect_output (&store->flash.mock, 1, header, sizeof (header), 2);
+
+	status |= mock_expect (&store->flash.mock, store->flash.base.read, &store->flash, 0,
+		MOCK_ARG (0x11000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&store->flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&store->flash.mock, store->flash.base.read, &store->flash, 0,
+		MOCK_ARG (0x12000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (old_header)));
+	status |= mock_expect_output (&store->flash.mock, 1, old_header, sizeof (old_header), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_contiguous_blocks_build_directory (&store->test, directory, entries);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&store->flash.mock);
+	CuAssertIntEquals (test, 0, status);
+}
+
 /*******************
  * Test cases
  *******************/
@@ -20007,6 +20047,571 @@ static void flash_store_contiguous_blocks_test_has_data_stored_variable_storage_
 }
 
 
+static void flash_store_contiguous_blocks_test_build_directory_variable_storage (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_build_directory (test, &store, directory, 3);
+
+	status = store.test.base.get_data_length (&store.test.base, 0);
+	CuAssertIntEquals (test, 256, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 1);
+	CuAssertIntEquals (test, FLASH_STORE_NO_DATA, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 2);
+	CuAssertIntEquals (test, 0x80, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 0);
+	CuAssertIntEquals (test, 1, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 2);
+	CuAssertIntEquals (test, 1, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_build_directory_variable_storage_decreasing (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	uint8_t header[] = {0x04, 0xa5, 0x00, 0x01};
+	uint8_t blank[] = {0xff, 0xff, 0xff, 0xff};
+	uint8_t old_header[] = {0x80, 0x00, 0x00, 0x01};
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage_decreasing (&store.test,
+		&store.state, &store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (header)));
+	status |= mock_expect_output (&store.flash.mock, 1, header, sizeof (header), 2);
+
+	status |= mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0xf000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&store.flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0xe000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (old_header)));
+	status |= mock_expect_output (&store.flash.mock, 1, old_header, sizeof (old_header), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_contiguous_blocks_build_directory (&store.test, directory, 3);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&store.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 0);
+	CuAssertIntEquals (test, 256, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 1);
+	CuAssertIntEquals (test, FLASH_STORE_NO_DATA, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 2);
+	CuAssertIntEquals (test, 0x80, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 0);
+	CuAssertIntEquals (test, 1, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 2);
+	CuAssertIntEquals (test, 1, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_build_directory_fixed_storage (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_fixed_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_contiguous_blocks_build_directory (&store.test, directory, 3);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 1);
+	CuAssertIntEquals (test, 256, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 1);
+	CuAssertIntEquals (test, 1, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_build_directory_null (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_contiguous_blocks_build_directory (NULL, directory, 3);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	status = flash_store_contiguous_blocks_build_directory (&store.test, NULL, 3);
+	CuAssertIntEquals (test, FLASH_STORE_INVALID_ARGUMENT, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_build_directory_too_small (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_contiguous_blocks_build_directory (&store.test, directory, 2);
+	CuAssertIntEquals (test, FLASH_STORE_BUFFER_TOO_SMALL, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_build_directory_read_error (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	uint8_t header[] = {0x04, 0xa5, 0x00, 0x01};
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (header)));
+	status |= mock_expect_output (&store.flash.mock, 1, header, sizeof (header), 2);
+
+	status |= mock_expect (&store.flash.mock, store.flash.base.read, &store.flash,
+		FLASH_READ_FAILED, MOCK_ARG (0x11000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (header)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_store_contiguous_blocks_build_directory (&store.test, directory, 3);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = mock_validate (&store.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The directory is not used if it could not be built. */
+	status = mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (header)));
+	status |= mock_expect_output (&store.flash.mock, 1, header, sizeof (header), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 0);
+	CuAssertIntEquals (test, 256, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_directory_read (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	uint8_t data[256];
+	uint8_t out[0x1000] = {0};
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
+	flash_store_contiguous_blocks_testing_build_directory (test, &store, directory, 3);
+
+	status = mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0x10000 + 4), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&store.flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0x12000 + 2), MOCK_ARG_NOT_NULL, MOCK_ARG (0x80));
+	status |= mock_expect_output (&store.flash.mock, 1, data, 0x80, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.read (&store.test.base, 0, out, sizeof (out));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = testing_validate_array (data, out, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.read (&store.test.base, 1, out, sizeof (out));
+	CuAssertIntEquals (test, FLASH_STORE_NO_DATA, status);
+
+	status = store.test.base.read (&store.test.base, 2, out, sizeof (out));
+	CuAssertIntEquals (test, 0x80, status);
+
+	status = testing_validate_array (data, out, status);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_directory_write (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	uint8_t header[] = {0x04, 0xa5, 0xc0, 0x00};
+	uint8_t data[0xc0];
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
+	flash_store_contiguous_blocks_testing_build_directory (test, &store, directory, 3);
+
+	status = flash_mock_expect_erase_flash_sector (&store.flash, 0x11000, 0x1000);
+
+	status |= mock_expect (&store.flash.mock, store.flash.base.write, &store.flash, sizeof (data),
+		MOCK_ARG (0x11000 + sizeof (header)), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)),
+		MOCK_ARG (sizeof (data)));
+	status |= flash_mock_expect_verify_flash (&store.flash, 0x11000 + sizeof (header), data,
+		sizeof (data));
+
+	status |= mock_expect (&store.flash.mock, store.flash.base.write, &store.flash, sizeof (header),
+		MOCK_ARG (0x11000), MOCK_ARG_PTR_CONTAINS (header, sizeof (header)),
+		MOCK_ARG (sizeof (header)));
+	status |= flash_mock_expect_verify_flash (&store.flash, 0x11000, header, sizeof (header));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.write (&store.test.base, 1, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&store.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 1);
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 1);
+	CuAssertIntEquals (test, 1, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_directory_write_old_header (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	uint8_t header[] = {0xc0, 0x00};
+	uint8_t data[0xc0];
+	uint8_t out[0x1000] = {0};
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
+	flash_store_contiguous_blocks_use_length_only_header (&store.test);
+
+	flash_store_contiguous_blocks_testing_build_directory (test, &store, directory, 3);
+
+	status = flash_mock_expect_erase_flash_sector (&store.flash, 0x11000, 0x1000);
+
+	status |= mock_expect (&store.flash.mock, store.flash.base.write, &store.flash, sizeof (data),
+		MOCK_ARG (0x11000 + sizeof (header)), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)),
+		MOCK_ARG (sizeof (data)));
+	status |= flash_mock_expect_verify_flash (&store.flash, 0x11000 + sizeof (header), data,
+		sizeof (data));
+
+	status |= mock_expect (&store.flash.mock, store.flash.base.write, &store.flash, sizeof (header),
+		MOCK_ARG (0x11000), MOCK_ARG_PTR_CONTAINS (header, sizeof (header)),
+		MOCK_ARG (sizeof (header)));
+	status |= flash_mock_expect_verify_flash (&store.flash, 0x11000, header, sizeof (header));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.write (&store.test.base, 1, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&store.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0x11000 + sizeof (header)), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&store.flash.mock, 1, data, sizeof (data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.read (&store.test.base, 1, out, sizeof (out));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = testing_validate_array (data, out, status);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_directory_write_error (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	uint8_t header[] = {0x04, 0xa5, 0x00, 0x01};
+	uint8_t data[0xc0];
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_build_directory (test, &store, directory, 3);
+
+	status = mock_expect (&store.flash.mock, store.flash.base.get_sector_size, &store.flash,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	memset (data, 0x55, sizeof (data));
+
+	status = store.test.base.write (&store.test.base, 0, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = mock_validate (&store.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The block contents are unknown after a failed write, so the header must be read. */
+	status = mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (header)));
+	status |= mock_expect_output (&store.flash.mock, 1, header, sizeof (header), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 0);
+	CuAssertIntEquals (test, 256, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 0);
+	CuAssertIntEquals (test, 256, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_directory_erase (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_build_directory (test, &store, directory, 3);
+
+	status = flash_mock_expect_erase_flash_sector_verify (&store.flash, 0x10000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.erase (&store.test.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&store.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.get_data_length (&store.test.base, 0);
+	CuAssertIntEquals (test, FLASH_STORE_NO_DATA, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 2);
+	CuAssertIntEquals (test, 1, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_directory_erase_error (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	uint8_t blank[] = {0xff, 0xff, 0xff, 0xff};
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_build_directory (test, &store, directory, 3);
+
+	status = mock_expect (&store.flash.mock, store.flash.base.get_sector_size, &store.flash,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.erase (&store.test.base, 0);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = mock_validate (&store.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&store.flash.mock, store.flash.base.read, &store.flash, 0,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&store.flash.mock, 1, blank, sizeof (blank), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
+static void flash_store_contiguous_blocks_test_directory_erase_all (CuTest *test)
+{
+	struct flash_store_contiguous_blocks_testing store;
+	struct flash_store_contiguous_blocks_entry directory[3];
+	int status;
+
+	TEST_START;
+
+	flash_store_contiguous_blocks_testing_prepare_init (test, &store, 0x100, 0x1000, 0x100000, 1);
+
+	status = flash_store_contiguous_blocks_init_variable_storage (&store.test, &store.state,
+		&store.flash.base, 0x10000, 3, 256, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_build_directory (test, &store, directory, 3);
+
+	status = flash_mock_expect_erase_flash_sector_verify (&store.flash, 0x10000, 0x3000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.erase_all (&store.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&store.flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = store.test.base.has_data_stored (&store.test.base, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_store_contiguous_blocks_testing_release_dependencies (test, &store);
+
+	flash_store_contiguous_blocks_release (&store.test);
+}
+
 TEST_SUITE_START (flash_store_contiguous_blocks);
 
 TEST (flash_store_contiguous_blocks_test_init_fixed_storage_no_hash);
@@ -20502,5 +21107,18 @@ TEST (flash_store_contiguous_blocks_test_has_data_stored_variable_storage_invali
 TEST (flash_store_contiguous_blocks_test_has_data_stored_variable_storage_short_header);
 TEST (flash_store_contiguous_blocks_test_has_data_stored_variable_storage_invalid_data_length);
 TEST (flash_store_contiguous_blocks_test_has_data_stored_variable_storage_old_format_invalid_data_length);
+TEST (flash_store_contiguous_blocks_test_build_directory_variable_storage);
+TEST (flash_store_contiguous_blocks_test_build_directory_variable_storage_decreasing);
+TEST (flash_store_contiguous_blocks_test_build_directory_fixed_storage);
+TEST (flash_store_contiguous_blocks_test_build_directory_null);
+TEST (flash_store_contiguous_blocks_test_build_directory_too_small);
+TEST (flash_store_contiguous_blocks_test_build_directory_read_error);
+TEST (flash_store_contiguous_blocks_test_directory_read);
+TEST (flash_store_contiguous_blocks_test_directory_write);
+TEST (flash_store_contiguous_blocks_test_directory_write_old_header);
+TEST (flash_store_contiguous_blocks_test_directory_write_error);
+TEST (flash_store_contiguous_blocks_test_directory_erase);
+TEST (flash_store_contiguous_blocks_test_directory_erase_error);
+TEST (flash_store_contiguous_blocks_test_directory_erase_all);
 
 TEST_SUITE_END;
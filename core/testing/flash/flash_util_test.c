@@ -8636,12 +8636,12 @@ static void flash_sector_erase_region_and_verify_test_erase_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test (CuTest *test)
+static void flash_mixed_erase_region_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8649,28 +8649,28 @@ static void flash_sector_program_data_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0x10000, 256);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_offset (CuTest *test)
+static void flash_mixed_erase_region_test_multiple_sectors (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8678,49 +8678,61 @@ static void flash_sector_program_data_test_offset (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10200));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10200),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x10200, data, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0x10000, (1024 * 4 * 3));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_null (CuTest *test)
+static void flash_mixed_erase_region_test_offset_start (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (NULL, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status = flash_sector_program_data (&flash.base, 0x10000, NULL, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1d000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1e000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1f000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mixed_erase_region (&flash.base, 0x1d010, (1024 * 4 * 2));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_erase_error (CuTest *test)
+static void flash_mixed_erase_region_test_full_block (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8728,26 +8740,28 @@ static void flash_sector_program_data_test_erase_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
-		MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x10000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000, (1024 * 64));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_write_error (CuTest *test)
+static void flash_mixed_erase_region_test_multiple_blocks (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8755,28 +8769,30 @@ static void flash_sector_program_data_test_write_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x30000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000, (1024 * 64 * 3));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_data_test_incomplete_write (CuTest *test)
+static void flash_mixed_erase_region_test_partial_block_sector_limit (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8784,28 +8800,29 @@ static void flash_sector_program_data_test_incomplete_write (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x100fe));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
-		MOCK_ARG (0x100fe), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x10000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_data (&flash.base, 0x100fe, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000,
+		(1024 * 4 * (FLASH_MIXED_ERASE_SECTOR_LIMIT - 1)) + 1);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test (CuTest *test)
+static void flash_mixed_erase_region_test_offset_start_sector_limit (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8813,33 +8830,28 @@ static void flash_sector_program_and_verify_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x10000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0x13800, (1024 * 4 * 8));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test_mismatch (CuTest *test)
+static void flash_mixed_erase_region_test_sectors_and_blocks (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t check[] = {0x01, 0x02, 0x13, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8847,53 +8859,64 @@ static void flash_sector_program_and_verify_test_mismatch (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, check, sizeof (check), 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1f000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x30000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x40000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x41000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x42000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	status = flash_mixed_erase_region (&flash.base, 0x1f800, (1024 * 4 * 35));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test_null (CuTest *test)
+static void flash_mixed_erase_region_test_sectors_and_blocks_end_aligned (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (NULL, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, NULL, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1e000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1f000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x20000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mixed_erase_region (&flash.base, 0x1e000, (1024 * 4 * 18));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test_error (CuTest *test)
+static void flash_mixed_erase_region_test_blocks_with_partial_end_block (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8901,26 +8924,29 @@ static void flash_sector_program_and_verify_test_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
-		MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000, (1024 * 64) + (1024 * 60));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_program_and_verify_test_verify_error (CuTest *test)
+static void flash_mixed_erase_region_test_no_length (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -8928,677 +8954,668 @@ static void flash_sector_program_and_verify_test_verify_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_mixed_erase_region (&flash.base, 0x10000, 0);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test (CuTest *test)
+static void flash_mixed_erase_region_test_not_4k_64k (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint32_t sector = (1024 * 64);
+	uint32_t block = (1024 * 128);
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x40000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x50000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0x10000, (1024 * 256) + 1);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_across_erase_blocks (CuTest *test)
+static void flash_mixed_erase_region_test_block_same_as_sector (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x13000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x14000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11fff, 0x10000, sizeof (data));
+	status = flash_mixed_erase_region (&flash.base, 0x10000, (1024 * 4 * 5));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_multiple_pages (CuTest *test)
+static void flash_mixed_erase_region_test_block_not_sector_multiple (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = (1024 * 6);
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x13000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x14000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	CuAssertIntEquals (test, 0, status);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status = flash_mixed_erase_region (&flash.base, 0x10000, (1024 * 4 * 5));
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	offset += FLASH_VERIFICATION_BLOCK;
+static void flash_mixed_erase_region_test_null (CuTest *test)
+{
+	int status;
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	TEST_START;
 
-	offset = 0;
+	status = flash_mixed_erase_region (NULL, 0x10000, 256);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+}
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+static void flash_mixed_erase_region_test_sector_size_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	TEST_START;
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	offset += page;
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status = flash_mixed_erase_region (&flash.base, 0x10000, 256);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
-	offset += page;
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+static void flash_mixed_erase_region_test_block_size_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
-		MOCK_ARG (page - 1));
+	TEST_START;
 
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, FLASH_BLOCK_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
+
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_mixed_erase_region (&flash.base, 0x10000, 256);
+	CuAssertIntEquals (test, FLASH_BLOCK_SIZE_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_full_sector (CuTest *test)
+static void flash_mixed_erase_region_test_sector_erase_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[FLASH_SECTOR_SIZE];
-	uint8_t blank[sizeof (data)];
-	int offset;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
-	memset (data, 0x55, sizeof (data));
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x1f000));
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-	}
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	status = flash_mixed_erase_region (&flash.base, 0x1f800, (1024 * 4 * 35));
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
-			MOCK_ARG (FLASH_PAGE_SIZE));
-	}
+static void flash_mixed_erase_region_test_block_erase_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+
+	TEST_START;
 
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11000, 0x10000, sizeof (data));
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x1f000));
+	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, FLASH_BLOCK_ERASE_FAILED,
+		MOCK_ARG (0x20000));
+
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_mixed_erase_region (&flash.base, 0x1f800, (1024 * 4 * 35));
+	CuAssertIntEquals (test, FLASH_BLOCK_ERASE_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_source_higher_address (CuTest *test)
+static void flash_mixed_erase_region_and_verify_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint8_t data[] = {0xff, 0xff, 0xff, 0xff};
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, sizeof (data));
+	status = flash_mixed_erase_region_and_verify (&flash.base, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_source_higher_address_full_sector (CuTest *test)
+static void flash_mixed_erase_region_and_verify_test_not_blank (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[FLASH_SECTOR_SIZE];
-	uint8_t blank[sizeof (data)];
-	int offset;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+	uint8_t data[] = {0xff, 0xff, 0x00, 0xff};
 
 	TEST_START;
 
-	memset (data, 0x55, sizeof (data));
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-	}
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	CuAssertIntEquals (test, 0, status);
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mixed_erase_region_and_verify (&flash.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
 
-		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
-			MOCK_ARG (0x10000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
-			MOCK_ARG (FLASH_PAGE_SIZE));
-	}
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_mixed_erase_region_and_verify_test_erase_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
+
+	TEST_START;
 
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, sizeof (data));
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
+
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_mixed_erase_region_and_verify (&flash.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_not_4k (CuTest *test)
+static void flash_mixed_erase_region_and_verify_test_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = flash_mixed_erase_region_and_verify (NULL, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+}
+
+static void flash_sector_program_data_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = 1024 * 2;
-	uint32_t page = FLASH_PAGE_SIZE;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10800));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10800),
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
 		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10800, 0x10000, sizeof (data));
+	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_multiple_pages_page_not_256 (CuTest *test)
+static void flash_sector_program_data_test_offset (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = 256 * 2;
-	uint8_t data[page * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10200));
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10200),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	CuAssertIntEquals (test, 0, status);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status = flash_sector_program_data (&flash.base, 0x10200, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	offset += FLASH_VERIFICATION_BLOCK;
+static void flash_sector_program_data_test_null (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	TEST_START;
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status = flash_sector_program_data (NULL, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status = flash_sector_program_data (&flash.base, 0x10000, NULL, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	offset += FLASH_VERIFICATION_BLOCK;
+static void flash_sector_program_data_test_erase_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	TEST_START;
 
-	offset = 0;
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	CuAssertIntEquals (test, 0, status);
 
-	offset += page;
+	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+static void flash_sector_program_data_test_write_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
-	offset += page;
+	TEST_START;
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
-		MOCK_ARG (page - 1));
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_sector_program_data (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_multiple_pages_page_offset (CuTest *test)
+static void flash_sector_program_data_test_incomplete_write (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x100fe));
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20010));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
+		MOCK_ARG (0x100fe), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	CuAssertIntEquals (test, 0, status);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status = flash_sector_program_data (&flash.base, 0x100fe, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	offset += FLASH_VERIFICATION_BLOCK;
+static void flash_sector_program_and_verify_test (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	TEST_START;
 
-	offset = 0;
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 0x10,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
-		MOCK_ARG (page - 0x10));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	offset += page - 0x10;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
-	offset += page;
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+static void flash_sector_program_and_verify_test_mismatch (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t check[] = {0x01, 0x02, 0x13, 0x04};
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	TEST_START;
 
-	offset += page;
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, 0x10, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, check, sizeof (check), 2);
 
-	status = flash_sector_copy (&flash.base, 0x20010, 0x10000, page * 3);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_null (CuTest *test)
+static void flash_sector_program_and_verify_test_null (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (NULL, 0x20000, 0x10000, 4);
+	status = flash_sector_program_and_verify (NULL, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, NULL, sizeof (data));
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_no_length (CuTest *test)
+static void flash_sector_program_and_verify_test_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 0);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
+
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_sector_check_error (CuTest *test)
+static void flash_sector_program_and_verify_test_verify_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+	status = flash_sector_program_and_verify (&flash.base, 0x10000, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_not_blank (CuTest *test)
+static void flash_sector_copy_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
 	memset (blank, 0xff, sizeof (blank));
-	blank[sizeof (blank) - 1] = 0;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -9612,24 +9629,36 @@ static void flash_sector_copy_test_not_blank (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (blank));
-	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_page_size_error (CuTest *test)
+static void flash_sector_copy_test_across_erase_blocks (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
@@ -9644,34 +9673,55 @@ static void flash_sector_copy_test_page_size_error (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, FLASH_PAGE_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 1,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
+	status = flash_sector_copy (&flash.base, 0x11fff, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_test_multiple_pages (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
-	uint8_t blank[4];
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
 
 	TEST_START;
 
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -9686,31 +9736,74 @@ static void flash_sector_copy_test_page_size_unsupported (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
+		MOCK_ARG (page - 1));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_read_error (CuTest *test)
+static void flash_sector_copy_test_full_sector (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t blank[4];
+	uint8_t data[FLASH_SECTOR_SIZE];
+	uint8_t blank[sizeof (data)];
+	int offset;
 
 	TEST_START;
 
+	memset (data, 0x55, sizeof (data));
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -9722,28 +9815,37 @@ static void flash_sector_copy_test_read_error (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	}
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
+			MOCK_ARG (FLASH_PAGE_SIZE));
+	}
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_sector_copy (&flash.base, 0x11000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_write_error (CuTest *test)
+static void flash_sector_copy_test_source_higher_address (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -9765,37 +9867,91 @@ static void flash_sector_copy_test_write_error (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_partial_write (CuTest *test)
+static void flash_sector_copy_test_source_higher_address_full_sector (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[FLASH_SECTOR_SIZE];
+	uint8_t blank[sizeof (data)];
+	int offset;
+
+	TEST_START;
+
+	memset (data, 0x55, sizeof (data));
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	}
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
+			MOCK_ARG (0x10000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
+			MOCK_ARG (FLASH_PAGE_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_test_not_4k (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = 1024 * 2;
+	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t blank[sizeof (data)];
 
@@ -9812,10 +9968,9 @@ static void flash_sector_copy_test_partial_write (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10800));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
@@ -9823,36 +9978,28 @@ static void flash_sector_copy_test_partial_write (CuTest *test)
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 2,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10800),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11fff, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+	status = flash_sector_copy (&flash.base, 0x10800, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_multiple_pages_error (CuTest *test)
+static void flash_sector_copy_test_multiple_pages_page_not_256 (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint32_t page = 256 * 2;
+	uint8_t data[page * 3];
 	uint8_t blank[FLASH_VERIFICATION_BLOCK];
 	int offset = 0;
 
@@ -9861,6 +10008,7 @@ static void flash_sector_copy_test_multiple_pages_error (CuTest *test)
 	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
 	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
 	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -9886,6 +10034,24 @@ static void flash_sector_copy_test_multiple_pages_error (CuTest *test)
 
 	offset += FLASH_VERIFICATION_BLOCK;
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
@@ -9908,142 +10074,219 @@ static void flash_sector_copy_test_multiple_pages_error (CuTest *test)
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
 	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page),
-		MOCK_ARG (page));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
+		MOCK_ARG (page - 1));
 
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_overlapping_regions (CuTest *test)
+static void flash_sector_copy_test_multiple_pages_page_offset (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
 
 	TEST_START;
 
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20010));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
+		MOCK_ARG (page - 0x10));
+
+	offset += page - 0x10;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, 0x10, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11000, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+	status = flash_sector_copy (&flash.base, 0x20010, 0x10000, page * 3);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_overlapping_regions_source_higher (CuTest *test)
+static void flash_sector_copy_test_null (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+	status = flash_sector_copy (NULL, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_same_erase_block (CuTest *test)
+static void flash_sector_copy_test_no_length (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 0);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10100, 0x10000, 0x10);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
-
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_same_erase_block_at_source_end (CuTest *test)
+static void flash_sector_copy_test_sector_check_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x10000, 0x11100, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_same_erase_block_at_destination_end (CuTest *test)
+static void flash_sector_copy_test_not_blank (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t blank[4];
 
 	TEST_START;
 
+	memset (blank, 0xff, sizeof (blank));
+	blank[sizeof (blank) - 1] = 0;
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x11100, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (blank));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test (CuTest *test)
+static void flash_sector_copy_test_page_size_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint8_t blank[4];
 
 	TEST_START;
 
@@ -10061,40 +10304,28 @@ static void flash_sector_copy_and_verify_test (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, FLASH_PAGE_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_mismatch (CuTest *test)
+static void flash_sector_copy_test_page_size_unsupported (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint8_t blank[4];
 
 	TEST_START;
 
@@ -10112,47 +10343,31 @@ static void flash_sector_copy_and_verify_test_mismatch (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_multiple_pages_mismatch (CuTest *test)
+static void flash_sector_copy_test_read_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint8_t blank[4];
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -10167,73 +10382,35 @@ static void flash_sector_copy_and_verify_test_multiple_pages_mismatch (CuTest *t
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	offset = 0;
-
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	offset += page;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000,
-		(page * 3) - 1);
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_full_sector (CuTest *test)
+static void flash_sector_copy_test_write_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[FLASH_SECTOR_SIZE];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t blank[sizeof (data)];
-	int offset;
 
 	TEST_START;
 
-	memset (data, 0x55, sizeof (data));
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -10245,45 +10422,36 @@ static void flash_sector_copy_and_verify_test_full_sector (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-	}
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
-			MOCK_ARG (FLASH_PAGE_SIZE));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
-			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-	}
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x11000, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_not_4k (CuTest *test)
+static void flash_sector_copy_test_partial_write (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = 1024 * 2;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 	uint8_t blank[sizeof (data)];
@@ -10301,9 +10469,10 @@ static void flash_sector_copy_and_verify_test_not_4k (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10800));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
@@ -10311,42 +10480,44 @@ static void flash_sector_copy_and_verify_test_not_4k (CuTest *test)
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10800),
-		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 2,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x10800, 0x10000, sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_sector_copy (&flash.base, 0x11fff, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTest *test)
+static void flash_sector_copy_test_multiple_pages_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = 256 * 2;
-	uint8_t data[page * 3];
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
 	uint8_t blank[FLASH_VERIFICATION_BLOCK];
 	int offset = 0;
-	int verify;
 
 	TEST_START;
 
 	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
 	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
 	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -10372,30 +10543,11 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTes
 
 	offset += FLASH_VERIFICATION_BLOCK;
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	offset = 0;
-	verify = 0;
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
@@ -10407,259 +10559,148 @@ static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTes
 	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
 		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
 	offset += page;
-	verify += FLASH_VERIFICATION_BLOCK;
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
 	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
-	offset += page;
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
-		MOCK_ARG (page - 1));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
-
-	verify += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page),
+		MOCK_ARG (page));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_multiple_pages_page_offset (CuTest *test)
+static void flash_sector_copy_test_overlapping_regions (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20010));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	offset = 0;
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 0x10,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
-		MOCK_ARG (page - 0x10));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	offset += page - 0x10;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	offset += page;
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status = flash_sector_copy (&flash.base, 0x11000, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	offset += page;
+static void flash_sector_copy_test_overlapping_regions_source_higher (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	TEST_START;
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, 0x10, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20010, 0x10000, page * 3);
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy (&flash.base, 0x10000, 0x11000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_null (CuTest *test)
+static void flash_sector_copy_test_same_erase_block (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (NULL, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy (&flash.base, 0x10100, 0x10000, 0x10);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_sector_check_error (CuTest *test)
+static void flash_sector_copy_test_same_erase_block_at_source_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
 	TEST_START;
 
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+	status = flash_sector_copy (&flash.base, 0x10000, 0x11100, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_page_size_error (CuTest *test)
+static void flash_sector_copy_test_same_erase_block_at_destination_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, FLASH_PAGE_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
+	status = flash_sector_copy (&flash.base, 0x11100, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_and_verify_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
-	uint8_t blank[4];
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
@@ -10677,28 +10718,40 @@ static void flash_sector_copy_and_verify_test_page_size_unsupported (CuTest *tes
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_read_error (CuTest *test)
+static void flash_sector_copy_and_verify_test_mismatch (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
@@ -10716,35 +10769,47 @@ static void flash_sector_copy_and_verify_test_read_error (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x20000),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_write_error (CuTest *test)
+static void flash_sector_copy_and_verify_test_multiple_pages_mismatch (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
 
 	TEST_START;
 
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -10759,39 +10824,73 @@ static void flash_sector_copy_and_verify_test_write_error (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
 	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
+	offset = 0;
+
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
 	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000,
+		(page * 3) - 1);
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_partial_write (CuTest *test)
+static void flash_sector_copy_and_verify_test_full_sector (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t data[FLASH_SECTOR_SIZE];
 	uint8_t blank[sizeof (data)];
+	int offset;
 
 	TEST_START;
 
+	memset (data, 0x55, sizeof (data));
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash);
@@ -10803,137 +10902,1905 @@ static void flash_sector_copy_and_verify_test_partial_write (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	}
 
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
-
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
+		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
+			MOCK_ARG (FLASH_PAGE_SIZE));
 
-	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 2,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000 + offset),
+			MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+	}
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x11fff, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+	status = flash_sector_copy_and_verify (&flash.base, 0x11000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_overlapping_regions (CuTest *test)
+static void flash_sector_copy_and_verify_test_not_4k (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t bytes = 1024 * 2;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
+	memset (blank, 0xff, sizeof (blank));
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x11000, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10800));
 
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
-}
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-static void flash_sector_copy_and_verify_test_overlapping_regions_source_higher (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	TEST_START;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data), MOCK_ARG (0x10800),
+		MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10800),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x10000, 0x11000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+	status = flash_sector_copy_and_verify (&flash.base, 0x10800, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_same_erase_block (CuTest *test)
+static void flash_sector_copy_and_verify_test_multiple_pages_page_not_256 (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = 256 * 2;
+	uint8_t data[page * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+	int verify;
 
 	TEST_START;
 
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
+	memset (blank, 0xff, sizeof (blank));
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	CuAssertIntEquals (test, 0, status);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x10100, 0x10000, 0x10);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
 
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
-}
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-static void flash_sector_copy_and_verify_test_same_erase_block_at_source_end (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
+	offset += FLASH_VERIFICATION_BLOCK;
 
-	TEST_START;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
+	offset += FLASH_VERIFICATION_BLOCK;
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
 
-	CuAssertIntEquals (test, 0, status);
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+	verify = 0;
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	offset += page;
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	offset += page;
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 1,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
+		MOCK_ARG (page - 1));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, (page * 3) - 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_multiple_pages_page_offset (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+
+	TEST_START;
+
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20010));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page - 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
+		MOCK_ARG (page - 0x10));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	offset += page - 0x10;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, page, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	offset += page;
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, 0x10, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x20010, 0x10000, page * 3);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_null (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (NULL, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_sector_check_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, FLASH_SECTOR_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_page_size_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, FLASH_PAGE_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_page_size_unsupported (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_read_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_write_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_partial_write (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x12000));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash.mock, 1, data + 1, sizeof (data) - 1, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data) - 2,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x11fff, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_overlapping_regions (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x11000, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_overlapping_regions_source_higher (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x10000, 0x11000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_same_erase_block (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x10100, 0x10000, 0x10);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_same_erase_block_at_source_end (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x10000, 0x11100, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_and_verify_test_same_erase_block_at_destination_end (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_and_verify (&flash.base, 0x11100, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_across_erase_blocks (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 1,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x11fff, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_multiple_pages (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+
+	TEST_START;
+
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 1,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
+		MOCK_ARG (page - 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		(page * 3) - 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_full_sector (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[FLASH_SECTOR_SIZE];
+	uint8_t blank[sizeof (data)];
+	int offset;
+
+	TEST_START;
+
+	memset (data, 0x55, sizeof (data));
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11000));
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
+		status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	}
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
+		status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0,
+			MOCK_ARG (0x10000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+		status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_PAGE_SIZE,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
+			MOCK_ARG (FLASH_PAGE_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x11000, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_source_same_address (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x10000, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_same_flash_full_sector (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[FLASH_SECTOR_SIZE];
+	uint8_t blank[sizeof (data)];
+	int offset;
+
+	TEST_START;
+
+	memset (data, 0x55, sizeof (data));
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+	}
+
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
+
+	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
+		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+			MOCK_ARG (0x10000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
+			MOCK_ARG (FLASH_PAGE_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash.base, 0x11000, &flash.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_not_4k (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = 1024 * 2;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10800));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x10800), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x10800, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = 256 * 2;
+	uint8_t data[page * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+
+	TEST_START;
+
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 1,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
+		MOCK_ARG (page - 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, (page * 3) - 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_multiple_pages_page_offset (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+
+	TEST_START;
+
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20010));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
+		MOCK_ARG (page - 0x10));
+
+	offset += page - 0x10;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20010, &flash1.base, 0x10000, page * 3);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_null (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = flash_sector_copy_ext (NULL, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, NULL, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_no_length (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_sector_check_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_not_blank (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+	blank[sizeof (blank) - 1] = 0;
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (blank));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_page_size_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, FLASH_PAGE_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_page_size_unsupported (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_read_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t blank[4];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_write_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_partial_write (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 2,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x11fff, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_multiple_pages_error (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[RSA_ENCRYPT_LEN * 3];
+	uint8_t blank[FLASH_VERIFICATION_BLOCK];
+	int offset = 0;
+
+	TEST_START;
+
+	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
+	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	offset = 0;
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	offset += page;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		(page * 3) - 1);
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_same_flash_overlapping_regions (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash.base, 0x11000, &flash.base, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_same_flash_overlapping_regions_source_higher (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash.base, 0x10000, &flash.base, 0x11000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_same_flash_same_erase_block (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash.base, 0x10100, &flash.base, 0x10000, 0x10);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_source_end (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x10000, 0x11100, 0x1001);
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext (&flash.base, 0x10000, &flash.base, 0x11100, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_same_erase_block_at_destination_end (CuTest *test)
+static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_destination_end (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -10949,14 +12816,14 @@ static void flash_sector_copy_and_verify_test_same_erase_block_at_destination_en
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x11100, 0x10000, 0x1001);
+	status = flash_sector_copy_ext (&flash.base, 0x11100, &flash.base, 0x10000, 0x1001);
 	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -10997,9 +12864,14 @@ static void flash_sector_copy_ext_test (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
 		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -11009,7 +12881,7 @@ static void flash_sector_copy_ext_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_across_erase_blocks (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -11034,10 +12906,9 @@ static void flash_sector_copy_ext_test_across_erase_blocks (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
@@ -11045,25 +12916,80 @@ static void flash_sector_copy_ext_test_across_erase_blocks (CuTest *test)
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 1,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
+	CuAssertIntEquals (test, 0, status);
 
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x10000, &flash1.base, 0x10000,
+		sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x11fff, &flash1.base, 0x10000, sizeof (data));
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_mismatch (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t blank[sizeof (data)];
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
@@ -11071,7 +12997,7 @@ static void flash_sector_copy_ext_test_across_erase_blocks (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_multiple_pages (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_multiple_pages_mismatch (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -11130,6 +13056,10 @@ static void flash_sector_copy_ext_test_multiple_pages (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
 	offset += page;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
@@ -11139,21 +13069,15 @@ static void flash_sector_copy_ext_test_multiple_pages (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	offset += page;
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 1,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
-		MOCK_ARG (page - 1));
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000,
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
 		(page * 3) - 1);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -11162,7 +13086,7 @@ static void flash_sector_copy_ext_test_multiple_pages (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_full_sector (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_full_sector (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -11208,64 +13132,16 @@ static void flash_sector_copy_ext_test_full_sector (CuTest *test)
 		status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_PAGE_SIZE,
 			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
 			MOCK_ARG (FLASH_PAGE_SIZE));
-	}
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x11000, &flash1.base, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_source_same_address (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
-
-	TEST_START;
-
-	memset (blank, 0xff, sizeof (blank));
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+		status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0,
+			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
+		status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+	}
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x10000, &flash1.base, 0x10000, sizeof (data));
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x11000, &flash1.base, 0x10000,
+		sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -11275,61 +13151,7 @@ static void flash_sector_copy_ext_test_source_same_address (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_same_flash_full_sector (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[FLASH_SECTOR_SIZE];
-	uint8_t blank[sizeof (data)];
-	int offset;
-
-	TEST_START;
-
-	memset (data, 0x55, sizeof (data));
-	memset (blank, 0xff, sizeof (blank));
-
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
-
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
-	}
-
-	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
-
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
-			MOCK_ARG (0x10000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-		status |= mock_expect (&flash.mock, flash.base.write, &flash, FLASH_PAGE_SIZE,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
-			MOCK_ARG (FLASH_PAGE_SIZE));
-	}
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash.base, 0x11000, &flash.base, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_not_4k (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -11370,9 +13192,14 @@ static void flash_sector_copy_ext_test_not_4k (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
 		MOCK_ARG (0x10800), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x10800, &flash1.base, 0x10000, sizeof (data));
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x10800, &flash1.base, 0x10000,
+		sizeof (data));
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -11382,7 +13209,7 @@ static void flash_sector_copy_ext_test_not_4k (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -11392,6 +13219,7 @@ static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test
 	uint8_t data[page * 3];
 	uint8_t blank[FLASH_VERIFICATION_BLOCK];
 	int offset = 0;
+	int verify;
 
 	TEST_START;
 
@@ -11449,6 +13277,7 @@ static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
 	offset = 0;
+	verify = 0;
 
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
@@ -11460,7 +13289,18 @@ static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
 	offset += page;
+	verify += FLASH_VERIFICATION_BLOCK;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
@@ -11469,7 +13309,18 @@ static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
 	offset += page;
+	verify += FLASH_VERIFICATION_BLOCK;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
@@ -11479,9 +13330,20 @@ static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test
 		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
 		MOCK_ARG (page - 1));
 
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
+	verify += FLASH_VERIFICATION_BLOCK;
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, (page * 3) - 1);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		(page * 3) - 1);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -11491,7 +13353,7 @@ static void flash_sector_copy_ext_test_multiple_pages_page_not_256 (CuTest *test
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_multiple_pages_page_offset (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -11551,6 +13413,10 @@ static void flash_sector_copy_ext_test_multiple_pages_page_offset (CuTest *test)
 		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
 		MOCK_ARG (page - 0x10));
 
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
+	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+
 	offset += page - 0x10;
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
@@ -11560,245 +13426,41 @@ static void flash_sector_copy_ext_test_multiple_pages_page_offset (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
 		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	offset += page;
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 0x10,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20010, &flash1.base, 0x10000, page * 3);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_null (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-
-	TEST_START;
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = flash_sector_copy_ext (NULL, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, NULL, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_no_length (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-
-	TEST_START;
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 0);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_sector_check_error (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-
-	TEST_START;
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2,
-		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_not_blank (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
-
-	TEST_START;
-
-	memset (blank, 0xff, sizeof (blank));
-	blank[sizeof (blank) - 1] = 0;
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (blank));
-	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_page_size_error (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
-
-	TEST_START;
-
-	memset (blank, 0xff, sizeof (blank));
-
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
-
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
-
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, FLASH_PAGE_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_page_size_unsupported (CuTest *test)
-{
-	struct flash_mock flash1;
-	struct flash_mock flash2;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
-	uint8_t blank[4];
+	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	TEST_START;
+	offset += page;
 
-	memset (blank, 0xff, sizeof (blank));
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status = flash_mock_init (&flash1);
-	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
 
-	status = flash_mock_init (&flash2);
-	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
+	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+	offset += page;
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20010, &flash1.base, 0x10000,
+		page * 3);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -11807,19 +13469,14 @@ static void flash_sector_copy_ext_test_page_size_unsupported (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_read_error (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_null (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t blank[4];
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 	flash1.mock.name = "flash1";
@@ -11828,25 +13485,11 @@ static void flash_sector_copy_ext_test_read_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy_ext_and_verify (NULL, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, NULL, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -11855,20 +13498,14 @@ static void flash_sector_copy_ext_test_read_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_write_error (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_sector_check_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 	flash1.mock.name = "flash1";
@@ -11877,29 +13514,13 @@ static void flash_sector_copy_ext_test_write_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -11908,19 +13529,18 @@ static void flash_sector_copy_ext_test_write_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_partial_write (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_not_blank (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint8_t blank[4];
 
 	TEST_START;
 
 	memset (blank, 0xff, sizeof (blank));
+	blank[sizeof (blank) - 1] = 0;
 
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -11933,35 +13553,17 @@ static void flash_sector_copy_ext_test_partial_write (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 2,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
-
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x11fff, &flash1.base, 0x10000, sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (blank));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -11970,22 +13572,16 @@ static void flash_sector_copy_ext_test_partial_write (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_multiple_pages_error (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	uint8_t blank[4];
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash1);
@@ -12002,179 +13598,77 @@ static void flash_sector_copy_ext_test_multiple_pages_error (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	offset = 0;
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	offset += page;
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		(page * 3) - 1);
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
-
-	status = flash_mock_validate_and_release (&flash1);
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_mock_validate_and_release (&flash2);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_same_flash_overlapping_regions (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-
-	TEST_START;
-
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash.base, 0x11000, &flash.base, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
-
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_same_flash_overlapping_regions_source_higher (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-
-	TEST_START;
-
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
-
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
-
-	CuAssertIntEquals (test, 0, status);
-
-	status = flash_sector_copy_ext (&flash.base, 0x10000, &flash.base, 0x11000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
-
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
-}
-
-static void flash_sector_copy_ext_test_same_flash_same_erase_block (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-
-	TEST_START;
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, FLASH_PAGE_SIZE_FAILED,
+		MOCK_ARG_NOT_NULL);
 
-	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
 
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash.base, 0x10100, &flash.base, 0x10000, 0x10);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
-
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_source_end (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest *test)
 {
-	struct flash_mock flash;
+	struct flash_mock flash1;
+	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint8_t blank[4];
 
 	TEST_START;
 
-	status = flash_mock_init (&flash);
-	CuAssertIntEquals (test, 0, status);
+	memset (blank, 0xff, sizeof (blank));
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
+	status = flash_mock_init (&flash2);
 	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status = flash_sector_copy_ext (&flash.base, 0x10000, &flash.base, 0x11100, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = flash_mock_validate_and_release (&flash);
-	CuAssertIntEquals (test, 0, status);
-}
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
 
-static void flash_sector_copy_ext_test_same_flash_same_erase_block_at_destination_end (CuTest *test)
-{
-	struct flash_mock flash;
-	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	TEST_START;
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
 
-	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
 
+	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash.base, 0x11100, &flash.base, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
-
-	status = flash_mock_validate_and_release (&flash);
+	status = flash_mock_validate_and_release (&flash2);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_read_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t blank[sizeof (data)];
+	uint8_t blank[4];
 
 	TEST_START;
 
@@ -12194,28 +13688,19 @@ static void flash_sector_copy_ext_and_verify_test (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12224,7 +13709,7 @@ static void flash_sector_copy_ext_and_verify_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12249,9 +13734,9 @@ static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
@@ -12262,18 +13747,14 @@ static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x10000, &flash1.base, 0x10000,
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
 		sizeof (data));
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12282,7 +13763,7 @@ static void flash_sector_copy_ext_and_verify_test_same_address (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_mismatch (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -12307,9 +13788,10 @@ static void flash_sector_copy_ext_and_verify_test_mismatch (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
@@ -12317,21 +13799,29 @@ static void flash_sector_copy_ext_and_verify_test_mismatch (CuTest *test)
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
 	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
+		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 2,
+		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
+		MOCK_ARG (sizeof (data) - 1));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x11fff, &flash1.base, 0x10000,
 		sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12340,111 +13830,136 @@ static void flash_sector_copy_ext_and_verify_test_mismatch (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_multiple_pages_mismatch (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_regions (CuTest *test)
 {
-	struct flash_mock flash1;
-	struct flash_mock flash2;
+	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
-	flash1.mock.name = "flash1";
 
-	status = flash_mock_init (&flash2);
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x11000, &flash.base, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
-	flash2.mock.name = "flash2";
+}
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
+static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_source_higher (
+	CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	TEST_START;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	CuAssertIntEquals (test, 0, status);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10000, &flash.base, 0x11000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	offset = 0;
+static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+	TEST_START;
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+	CuAssertIntEquals (test, 0, status);
 
-	offset += page;
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10100, &flash.base, 0x10000, 0x10);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_source_end (
+	CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+	TEST_START;
 
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		(page * 3) - 1);
-	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10000, &flash.base, 0x11100, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_destination_end (
+	CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_sector_copy_ext_and_verify (&flash.base, 0x11100, &flash.base, 0x10000, 0x1001);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_full_sector (CuTest *test)
+static void flash_sector_copy_ext_differential_test (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[FLASH_SECTOR_SIZE];
-	uint8_t blank[sizeof (data)];
-	int offset;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	size_t skipped;
 
 	TEST_START;
 
-	memset (data, 0x55, sizeof (data));
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 	flash1.mock.name = "flash1";
@@ -12456,36 +13971,18 @@ static void flash_sector_copy_ext_and_verify_test_full_sector (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11000));
-
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_VERIFICATION_BLOCK) {
-		status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-		status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-	}
-
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	for (offset = 0; offset < FLASH_SECTOR_SIZE; offset += FLASH_PAGE_SIZE) {
-		status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0,
-			MOCK_ARG (0x10000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-		status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_PAGE_SIZE,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_PAGE_SIZE),
-			MOCK_ARG (FLASH_PAGE_SIZE));
-
-		status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0,
-			MOCK_ARG (0x11000 + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_PAGE_SIZE));
-		status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
-	}
+	status |= flash_mock_expect_verify_copy (&flash2, 0x20000, data, &flash1, 0x10000, data,
+		sizeof (data));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x11000, &flash1.base, 0x10000,
-		sizeof (data));
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &skipped);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, skipped);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12494,15 +13991,17 @@ static void flash_sector_copy_ext_and_verify_test_full_sector (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
+static void flash_sector_copy_ext_differential_test_sector_different (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
-	uint32_t bytes = 1024 * 2;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t old[] = {0x01, 0x02, 0x03, 0x05};
 	uint8_t blank[sizeof (data)];
+	size_t skipped;
 
 	TEST_START;
 
@@ -12519,31 +14018,31 @@ static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x10800));
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
+	status |= flash_mock_expect_verify_copy (&flash2, 0x20000, old, &flash1, 0x10000, data,
+		sizeof (data));
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
 	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
-		MOCK_ARG (0x10800), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x10800),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x10800, &flash1.base, 0x10000,
-		sizeof (data));
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &skipped);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, skipped);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12552,24 +14051,20 @@ static void flash_sector_copy_ext_and_verify_test_not_4k (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (CuTest *test)
+static void flash_sector_copy_ext_differential_test_multiple_sectors (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = 256 * 2;
-	uint8_t data[page * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
-	int verify;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+	uint8_t old[] = {0x03, 0x04, 0x05, 0x06, 0x07, 0x09};
+	uint8_t blank[sizeof (old)];
+	size_t skipped;
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 3], data, RSA_ENCRYPT_LEN * 3);
 	memset (blank, 0xff, sizeof (blank));
 
 	status = flash_mock_init (&flash1);
@@ -12583,137 +14078,110 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_not_256 (C
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status |= flash_mock_expect_verify_copy (&flash2, 0x20ffe, data, &flash1, 0x10000, data, 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= flash_mock_expect_verify_copy (&flash2, 0x21000, old, &flash1, 0x10002, &data[2],
+		sizeof (old));
 
-	offset += FLASH_VERIFICATION_BLOCK;
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x21000));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x21000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (old)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	offset = 0;
-	verify = 0;
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10002),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (old)));
+	status |= mock_expect_output (&flash1.mock, 1, &data[2], sizeof (old), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (old),
+		MOCK_ARG (0x21000), MOCK_ARG_PTR_CONTAINS (&data[2], sizeof (old)),
+		MOCK_ARG (sizeof (old)));
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+	CuAssertIntEquals (test, 0, status);
 
-	verify += FLASH_VERIFICATION_BLOCK;
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20ffe, &flash1.base, 0x10000,
+		sizeof (data), &skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, skipped);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
 
-	offset += page;
-	verify += FLASH_VERIFICATION_BLOCK;
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+static void flash_sector_copy_ext_differential_test_same_flash (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	size_t skipped;
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+	TEST_START;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
 
-	verify += FLASH_VERIFICATION_BLOCK;
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (page), -1);
 
-	offset += page;
-	verify += FLASH_VERIFICATION_BLOCK;
+	status |= flash_mock_expect_verify_copy (&flash, 0x20000, data, &flash, 0x10000, data,
+		sizeof (data));
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 1,
-		MOCK_ARG (0x20000 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 1),
-		MOCK_ARG (page - 1));
+	status = flash_sector_copy_ext_differential (&flash.base, 0x20000, &flash.base, 0x10000,
+		sizeof (data), &skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, skipped);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	verify += FLASH_VERIFICATION_BLOCK;
+static void flash_sector_copy_ext_differential_test_same_flash_same_erase_block (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	size_t skipped;
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000 + verify),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK - 1));
-	status |= mock_expect_output (&flash2.mock, 1, data + verify, sizeof (data) - verify, 2);
+	TEST_START;
 
+	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		(page * 3) - 1);
-	CuAssertIntEquals (test, 0, status);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_validate_and_release (&flash2);
+	status = flash_sector_copy_ext_differential (&flash.base, 0x10100, &flash.base, 0x10000, 4,
+		&skipped);
+	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+
+	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (CuTest *test)
+static void flash_sector_copy_ext_differential_test_zero_length (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
-	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t data[RSA_ENCRYPT_LEN * 3];
-	uint8_t blank[FLASH_VERIFICATION_BLOCK];
-	int offset = 0;
+	size_t skipped = 5;
 
 	TEST_START;
 
-	memcpy (data, RSA_ENCRYPT_TEST, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN], RSA_ENCRYPT_TEST2, RSA_ENCRYPT_LEN);
-	memcpy (&data[RSA_ENCRYPT_LEN * 2], RSA_ENCRYPT_BAD, RSA_ENCRYPT_LEN);
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 	flash1.mock.name = "flash1";
@@ -12722,87 +14190,50 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (Cu
 	CuAssertIntEquals (test, 0, status);
 	flash2.mock.name = "flash2";
 
-	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
-
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20010));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset += FLASH_VERIFICATION_BLOCK;
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
-	offset = 0;
-
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page - 0x10,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page - 0x10),
-		MOCK_ARG (page - 0x10));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page - 0x10));
-	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	offset += page - 0x10;
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
-
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000, 0,
+		&skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, skipped);
 
-	offset += page;
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, page,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, page), MOCK_ARG (page));
+static void flash_sector_copy_ext_differential_test_null_skipped (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (page));
-	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+	TEST_START;
 
-	offset += page;
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 0x10,
-		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20010 + offset),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
-	status |= mock_expect_output (&flash2.mock, 1, data + offset, sizeof (data) - offset, 2);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= flash_mock_expect_verify_copy (&flash2, 0x20000, data, &flash1, 0x10000, data,
+		sizeof (data));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20010, &flash1.base, 0x10000,
-		page * 3);
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), NULL);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12812,11 +14243,12 @@ static void flash_sector_copy_ext_and_verify_test_multiple_pages_page_offset (Cu
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_null (CuTest *test)
+static void flash_sector_copy_ext_differential_test_null (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
+	size_t skipped = 5;
 
 	TEST_START;
 
@@ -12828,10 +14260,13 @@ static void flash_sector_copy_ext_and_verify_test_null (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 	flash2.mock.name = "flash2";
 
-	status = flash_sector_copy_ext_and_verify (NULL, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_ext_differential (NULL, 0x20000, &flash1.base, 0x10000, 4,
+		&skipped);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, skipped);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, NULL, 0x10000, 4);
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, NULL, 0x10000, 4,
+		&skipped);
 	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12841,11 +14276,12 @@ static void flash_sector_copy_ext_and_verify_test_null (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_sector_check_error (CuTest *test)
+static void flash_sector_copy_ext_differential_test_sector_size_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
+	size_t skipped;
 
 	TEST_START;
 
@@ -12862,7 +14298,8 @@ static void flash_sector_copy_ext_and_verify_test_sector_check_error (CuTest *te
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000, 4,
+		&skipped);
 	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
@@ -12872,19 +14309,17 @@ static void flash_sector_copy_ext_and_verify_test_sector_check_error (CuTest *te
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_not_blank (CuTest *test)
+static void flash_sector_copy_ext_differential_test_page_size_unsupported (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
+	size_t skipped;
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-	blank[sizeof (blank) - 1] = 0;
-
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 	flash1.mock.name = "flash1";
@@ -12896,17 +14331,14 @@ static void flash_sector_copy_ext_and_verify_test_not_blank (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		sizeof (blank));
-	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000, 4,
+		&skipped);
+	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12915,18 +14347,17 @@ static void flash_sector_copy_ext_and_verify_test_not_blank (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
+static void flash_sector_copy_ext_differential_test_compare_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint8_t blank[4];
+	uint32_t page = FLASH_PAGE_SIZE;
+	size_t skipped;
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 	flash1.mock.name = "flash1";
@@ -12938,19 +14369,17 @@ static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, FLASH_PAGE_SIZE_FAILED,
-		MOCK_ARG_NOT_NULL);
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, FLASH_READ_FAILED,
+		MOCK_ARG (0x20000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_PAGE_SIZE_FAILED, status);
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000, 4,
+		&skipped);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12959,19 +14388,19 @@ static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_ext_differential_test_erase_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
-	uint8_t blank[4];
+	uint32_t page = FLASH_PAGE_SIZE;
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t old[] = {0x01, 0x02, 0x03, 0x05};
+	size_t skipped;
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 	flash1.mock.name = "flash1";
@@ -12983,19 +14412,20 @@ static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
+	status |= flash_mock_expect_verify_copy (&flash2, 0x20000, old, &flash1, 0x10000, data,
+		sizeof (data));
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2,
+		FLASH_SECTOR_ERASE_FAILED, MOCK_ARG (0x20000));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &skipped);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -13004,19 +14434,19 @@ static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_read_error (CuTest *test)
+static void flash_sector_copy_ext_differential_test_not_blank (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
-	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t old[] = {0x01, 0x02, 0x03, 0x05};
+	size_t skipped;
 
 	TEST_START;
 
-	memset (blank, 0xff, sizeof (blank));
-
 	status = flash_mock_init (&flash1);
 	CuAssertIntEquals (test, 0, status);
 	flash1.mock.name = "flash1";
@@ -13028,22 +14458,23 @@ static void flash_sector_copy_ext_and_verify_test_read_error (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (4));
-	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
-
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, FLASH_READ_FAILED,
-		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (4));
+	status |= flash_mock_expect_verify_copy (&flash2, 0x20000, old, &flash1, 0x10000, data,
+		sizeof (data));
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	status = flash_sector_copy_ext_differential (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data), &skipped);
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -13052,7 +14483,7 @@ static void flash_sector_copy_ext_and_verify_test_read_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
+static void flash_sector_copy_ext_differential_and_verify_test_sector_different (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -13060,7 +14491,9 @@ static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t old[] = {0x01, 0x02, 0x03, 0x05};
 	uint8_t blank[sizeof (data)];
+	size_t skipped;
 
 	TEST_START;
 
@@ -13077,27 +14510,35 @@ static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	status |= flash_mock_expect_verify_copy (&flash2, 0x20000, old, &flash1, 0x10000, data,
+		sizeof (data));
+
 	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
 
 	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_WRITE_FAILED,
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
 		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
-		sizeof (data));
-	CuAssertIntEquals (test, FLASH_WRITE_FAILED, status);
+	status = flash_sector_copy_ext_differential_and_verify (&flash2.base, 0x20000, &flash1.base,
+		0x10000, sizeof (data), &skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, skipped);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -13106,7 +14547,7 @@ static void flash_sector_copy_ext_and_verify_test_write_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
+static void flash_sector_copy_ext_differential_and_verify_test_verify_error (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
@@ -13114,7 +14555,9 @@ static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
 	uint32_t bytes = FLASH_SECTOR_SIZE;
 	uint32_t page = FLASH_PAGE_SIZE;
 	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t old[] = {0x01, 0x02, 0x03, 0x05};
 	uint8_t blank[sizeof (data)];
+	size_t skipped;
 
 	TEST_START;
 
@@ -13131,40 +14574,34 @@ static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
 	status = mock_expect (&flash2.mock, flash2.base.get_sector_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &bytes, sizeof (bytes), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x11fff));
-	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x12000));
+	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
 
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
+	status |= flash_mock_expect_verify_copy (&flash2, 0x20000, old, &flash1, 0x10000, data,
+		sizeof (data));
+
+	status |= mock_expect (&flash2.mock, flash2.base.sector_erase, &flash2, 0, MOCK_ARG (0x20000));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
 		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash2.mock, 1, blank, sizeof (blank), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
-	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
-
 	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
 	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 1, MOCK_ARG (0x11fff),
-		MOCK_ARG_PTR_CONTAINS (data, 1), MOCK_ARG (1));
-
-	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x11fff),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (1));
-	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
-
-	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10001),
-		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data) - 1));
-	status |= mock_expect_output (&flash1.mock, 1, data + 1, sizeof (data) - 1, 2);
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
-	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data) - 2,
-		MOCK_ARG (0x12000), MOCK_ARG_PTR_CONTAINS (data + 1, sizeof (data) - 1),
-		MOCK_ARG (sizeof (data) - 1));
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, old, sizeof (old), 2);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x11fff, &flash1.base, 0x10000,
-		sizeof (data));
-	CuAssertIntEquals (test, FLASH_UTIL_INCOMPLETE_WRITE, status);
+	status = flash_sector_copy_ext_differential_and_verify (&flash2.base, 0x20000, &flash1.base,
+		0x10000, sizeof (data), &skipped);
+	CuAssertIntEquals (test, FLASH_UTIL_DATA_MISMATCH, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -13173,54 +14610,84 @@ static void flash_sector_copy_ext_and_verify_test_partial_write (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_regions (CuTest *test)
+static void flash_sector_erase_region_differential_test (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[FLASH_VERIFICATION_BLOCK];
+	size_t skipped;
 
 	TEST_START;
 
+	memset (data, 0, sizeof (data));
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= flash_mock_expect_blank_check (&flash, 0x10000, FLASH_SECTOR_SIZE);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+	status |= flash_mock_expect_blank_check (&flash, 0x11000, FLASH_SECTOR_SIZE);
+
+	status |= flash_mock_expect_blank_check (&flash, 0x12000, 0x100);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x11000, &flash.base, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+	status = flash_sector_erase_region_differential (&flash.base, 0x10000,
+		(FLASH_SECTOR_SIZE * 2) + 0x100, &skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, skipped);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_overlapping_source_higher (
-	CuTest *test)
+static void flash_sector_erase_region_differential_test_offset_start (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[0x10];
+	size_t skipped;
 
 	TEST_START;
 
+	memset (data, 0, sizeof (data));
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10ff0),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10ff0));
+	status |= flash_mock_expect_blank_check (&flash, 0x10ff0, 0x10);
+
+	status |= flash_mock_expect_blank_check (&flash, 0x11000, 0x10);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10000, &flash.base, 0x11000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_COPY_OVERLAP, status);
+	status = flash_sector_erase_region_differential (&flash.base, 0x10ff0, 0x20, &skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, skipped);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block (CuTest *test)
+static void flash_sector_erase_region_differential_test_null_skipped (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
@@ -13234,21 +14701,58 @@ static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block (C
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= flash_mock_expect_blank_check (&flash, 0x10000, 0x100);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10100, &flash.base, 0x10000, 0x10);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_erase_region_differential (&flash.base, 0x10000, 0x100, NULL);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_source_end (
-	CuTest *test)
+static void flash_sector_erase_region_differential_test_null (CuTest *test)
+{
+	int status;
+	size_t skipped = 5;
+
+	TEST_START;
+
+	status = flash_sector_erase_region_differential (NULL, 0x10000, 0x100, &skipped);
+	CuAssertIntEquals (test, FLASH_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, skipped);
+}
+
+static void flash_sector_erase_region_differential_test_sector_size_error (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_sector_erase_region_differential (&flash.base, 0x10000, 0x100, &skipped);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_sector_erase_region_differential_test_read_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	size_t skipped;
 
 	TEST_START;
 
@@ -13258,34 +14762,47 @@ static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (0x100));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x10000, &flash.base, 0x11100, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_erase_region_differential (&flash.base, 0x10000, 0x100, &skipped);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_destination_end (
-	CuTest *test)
+static void flash_sector_erase_region_differential_test_erase_error (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
+	uint8_t data[0x100];
+	size_t skipped;
 
 	TEST_START;
 
+	memset (data, 0, sizeof (data));
+
 	status = flash_mock_init (&flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x100));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash.base, 0x11100, &flash.base, 0x10000, 0x1001);
-	CuAssertIntEquals (test, FLASH_UTIL_SAME_ERASE_BLOCK, status);
+	status = flash_sector_erase_region_differential (&flash.base, 0x10000, 0x100, &skipped);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -18479,6 +19996,29 @@ TEST (flash_sector_erase_region_and_verify_test_not_blank);
 TEST (flash_sector_erase_region_and_verify_test_null);
 TEST (flash_sector_erase_region_and_verify_test_sector_check_error);
 TEST (flash_sector_erase_region_and_verify_test_erase_error);
+TEST (flash_mixed_erase_region_test);
+TEST (flash_mixed_erase_region_test_multiple_sectors);
+TEST (flash_mixed_erase_region_test_offset_start);
+TEST (flash_mixed_erase_region_test_full_block);
+TEST (flash_mixed_erase_region_test_multiple_blocks);
+TEST (flash_mixed_erase_region_test_partial_block_sector_limit);
+TEST (flash_mixed_erase_region_test_offset_start_sector_limit);
+TEST (flash_mixed_erase_region_test_sectors_and_blocks);
+TEST (flash_mixed_erase_region_test_sectors_and_blocks_end_aligned);
+TEST (flash_mixed_erase_region_test_blocks_with_partial_end_block);
+TEST (flash_mixed_erase_region_test_no_length);
+TEST (flash_mixed_erase_region_test_not_4k_64k);
+TEST (flash_mixed_erase_region_test_block_same_as_sector);
+TEST (flash_mixed_erase_region_test_block_not_sector_multiple);
+TEST (flash_mixed_erase_region_test_null);
+TEST (flash_mixed_erase_region_test_sector_size_error);
+TEST (flash_mixed_erase_region_test_block_size_error);
+TEST (flash_mixed_erase_region_test_sector_erase_error);
+TEST (flash_mixed_erase_region_test_block_erase_error);
+TEST (flash_mixed_erase_region_and_verify_test);
+TEST (flash_mixed_erase_region_and_verify_test_not_blank);
+TEST (flash_mixed_erase_region_and_verify_test_erase_error);
+TEST (flash_mixed_erase_region_and_verify_test_null);
 TEST (flash_sector_program_data_test);
 TEST (flash_sector_program_data_test_offset);
 TEST (flash_sector_program_data_test_null);
@@ -18578,6 +20118,28 @@ TEST (flash_sector_copy_ext_and_verify_test_same_flash_overlapping_source_higher
 TEST (flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block);
 TEST (flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_source_end);
 TEST (flash_sector_copy_ext_and_verify_test_same_flash_same_erase_block_at_destination_end);
+TEST (flash_sector_copy_ext_differential_test);
+TEST (flash_sector_copy_ext_differential_test_sector_different);
+TEST (flash_sector_copy_ext_differential_test_multiple_sectors);
+TEST (flash_sector_copy_ext_differential_test_same_flash);
+TEST (flash_sector_copy_ext_differential_test_same_flash_same_erase_block);
+TEST (flash_sector_copy_ext_differential_test_zero_length);
+TEST (flash_sector_copy_ext_differential_test_null_skipped);
+TEST (flash_sector_copy_ext_differential_test_null);
+TEST (flash_sector_copy_ext_differential_test_sector_size_error);
+TEST (flash_sector_copy_ext_differential_test_page_size_unsupported);
+TEST (flash_sector_copy_ext_differential_test_compare_error);
+TEST (flash_sector_copy_ext_differential_test_erase_error);
+TEST (flash_sector_copy_ext_differential_test_not_blank);
+TEST (flash_sector_copy_ext_differential_and_verify_test_sector_different);
+TEST (flash_sector_copy_ext_differential_and_verify_test_verify_error);
+TEST (flash_sector_erase_region_differential_test);
+TEST (flash_sector_erase_region_differential_test_offset_start);
+TEST (flash_sector_erase_region_differential_test_null_skipped);
+TEST (flash_sector_erase_region_differential_test_null);
+TEST (flash_sector_erase_region_differential_test_sector_size_error);
+TEST (flash_sector_erase_region_differential_test_read_error);
+TEST (flash_sector_erase_region_differential_test_erase_error);
 TEST (flash_contents_verification_test_sha256);
 TEST (flash_contents_verification_test_sha256_with_hash_out);
 TEST (flash_contents_verification_test_sha256_no_match_signature);
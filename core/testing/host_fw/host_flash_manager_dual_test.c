@@ -12594,6 +12594,235 @@ static void host_flash_manager_dual_test_restore_flash_read_write_regions_cs0_mu
 	host_flash_manager_dual_testing_validate_and_release (test, &manager);
 }
 
+static void host_flash_manager_dual_test_restore_flash_read_write_regions_differential_cs1 (
+	CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_host;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init (test, &manager, false);
+	host_flash_manager_dual_set_differential_restore (&manager.test, true);
+
+	rw_region.start_addr = 0x20000;
+	rw_region.length = 0x2000;
+
+	rw_prop.on_failure = PFM_RW_ERASE;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	rw_host.pfm = &manager.pfm.base;
+	rw_host.writable = &rw_list;
+	rw_host.count = 1;
+
+	status = flash_master_mock_expect_blank_check (&manager.flash_mock1, 0x20000, 0x1000);
+	status |= flash_master_mock_expect_value_check (&manager.flash_mock1, 0x21000,
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_erase_flash_sector (&manager.flash_mock1, 0x21000);
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0x21000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.restore_flash_read_write_regions (&manager.test.base, &rw_host);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
+static void host_flash_manager_dual_test_restore_flash_read_write_regions_differential_cs0 (
+	CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_host;
+	int status;
+	uint8_t data[0x1100];
+	uint8_t bad[0x100];
+	size_t i;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
+	memset (bad, 0x55, sizeof (bad));
+
+	host_flash_manager_dual_testing_init (test, &manager, true);
+	host_flash_manager_dual_set_differential_restore (&manager.test, true);
+
+	rw_region.start_addr = 0x20000;
+	rw_region.length = 0x1100;
+
+	rw_prop.on_failure = PFM_RW_RESTORE;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	rw_host.pfm = &manager.pfm.base;
+	rw_host.writable = &rw_list;
+	rw_host.count = 1;
+
+	status = flash_master_mock_expect_verify_copy (&manager.flash_mock0, &manager.flash_mock1,
+		0x20000, 0x20000, data, NULL, 0x1000);
+	status |= flash_master_mock_expect_verify_copy (&manager.flash_mock0, &manager.flash_mock1,
+		0x21000, 0x21000, bad, &data[0x1000], 0x100);
+	status |= flash_master_mock_expect_erase_flash_sector (&manager.flash_mock0, 0x21000);
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock0, 0x21000, 0x100);
+	status |= flash_master_mock_expect_copy_flash_verify (&manager.flash_mock0,
+		&manager.flash_mock1, 0x21000, 0x21000, &data[0x1000], 0x100);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.restore_flash_read_write_regions (&manager.test.base, &rw_host);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
+static void host_flash_manager_dual_test_restore_flash_read_write_regions_differential_multiple_fw (
+	CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list[3];
+	struct host_flash_manager_rw_regions rw_host;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init (test, &manager, false);
+	host_flash_manager_dual_set_differential_restore (&manager.test, true);
+
+	rw_region[0].start_addr = 0;
+	rw_region[0].length = 0x1000;
+	rw_region[1].start_addr = 0x40000;
+	rw_region[1].length = 0x1000;
+	rw_region[2].start_addr = 0x100000;
+	rw_region[2].length = 0x1000;
+
+	rw_prop[0].on_failure = PFM_RW_ERASE;
+	rw_prop[1].on_failure = PFM_RW_ERASE;
+	rw_prop[2].on_failure = PFM_RW_ERASE;
+
+	rw_list[0].regions = &rw_region[0];
+	rw_list[0].properties = &rw_prop[0];
+	rw_list[0].count = 1;
+
+	rw_list[1].regions = &rw_region[1];
+	rw_list[1].properties = &rw_prop[1];
+	rw_list[1].count = 1;
+
+	rw_list[2].regions = &rw_region[2];
+	rw_list[2].properties = &rw_prop[2];
+	rw_list[2].count = 1;
+
+	rw_host.pfm = &manager.pfm.base;
+	rw_host.writable = rw_list;
+	rw_host.count = 3;
+
+	status = flash_master_mock_expect_blank_check (&manager.flash_mock1, 0x00000, 0x1000);
+	status |= flash_master_mock_expect_value_check (&manager.flash_mock1, 0x40000,
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_erase_flash_sector (&manager.flash_mock1, 0x40000);
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0x40000, 0x1000);
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0x100000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.restore_flash_read_write_regions (&manager.test.base, &rw_host);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
+static void host_flash_manager_dual_test_restore_flash_read_write_regions_differential_disabled (
+	CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_host;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init (test, &manager, false);
+	host_flash_manager_dual_set_differential_restore (&manager.test, true);
+	host_flash_manager_dual_set_differential_restore (&manager.test, false);
+
+	rw_region.start_addr = 0x20000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_ERASE;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	rw_host.pfm = &manager.pfm.base;
+	rw_host.writable = &rw_list;
+	rw_host.count = 1;
+
+	status = flash_master_mock_expect_erase_flash_verify (&manager.flash_mock1, 0x20000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.restore_flash_read_write_regions (&manager.test.base, &rw_host);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
+static void host_flash_manager_dual_test_restore_flash_read_write_regions_differential_flash_error (
+	CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_host;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init (test, &manager, false);
+	host_flash_manager_dual_set_differential_restore (&manager.test, true);
+
+	rw_region.start_addr = 0x20000;
+	rw_region.length = 0x1000;
+
+	rw_prop.on_failure = PFM_RW_ERASE;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	rw_host.pfm = &manager.pfm.base;
+	rw_host.writable = &rw_list;
+	rw_host.count = 1;
+
+	status = flash_master_mock_expect_xfer (&manager.flash_mock1, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.restore_flash_read_write_regions (&manager.test.base, &rw_host);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
 static void host_flash_manager_dual_test_restore_flash_read_write_regions_null (CuTest *test)
 {
 	struct host_flash_manager_dual_testing manager;
@@ -12626,6 +12855,8 @@ static void host_flash_manager_dual_test_restore_flash_read_write_regions_null (
 	status = manager.test.base.restore_flash_read_write_regions (&manager.test.base, NULL);
 	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
 
+	host_flash_manager_dual_set_differential_restore (NULL, true);
+
 	host_flash_manager_dual_testing_validate_and_release (test, &manager);
 }
 
@@ -12933,6 +13164,11 @@ TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_cs1_multiple
 TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_cs0_multiple_fw);
 TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_null);
 TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_flash_error);
+TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_differential_cs1);
+TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_differential_cs0);
+TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_differential_multiple_fw);
+TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_differential_disabled);
+TEST (host_flash_manager_dual_test_restore_flash_read_write_regions_differential_flash_error);
 TEST (host_flash_manager_dual_test_reset_flash);
 TEST (host_flash_manager_dual_test_reset_flash_null);
 TEST (host_flash_manager_dual_test_reset_flash_cs0_error);
@@ -8778,615 +8778,1568 @@ static void host_fw_restore_flash_device_test_hashes_copy_error (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_config_spi_filter_read_write_regions_test (CuTest *test)
+static void host_fw_restore_flash_device_differential_test (CuTest *test)
 {
-	struct spi_filter_interface_mock filter;
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
 	int status;
+	char *data = "Test";
+	size_t skipped;
 
 	TEST_START;
 
-	status = spi_filter_interface_mock_init (&filter);
+	status = flash_master_mock_init (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
-
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
-
-	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter, 0);
-	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
-		MOCK_ARG (1), MOCK_ARG (0x10000), MOCK_ARG (0x20000));
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_config_spi_filter_read_write_regions (&filter.base, &rw_list);
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_filter_interface_mock_validate_and_release (&filter);
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
-}
 
-static void host_fw_config_spi_filter_read_write_regions_test_multiple_regions (CuTest *test)
-{
-	struct spi_filter_interface_mock filter;
-	struct flash_region rw_region[3];
-	struct pfm_read_write rw_prop[3];
-	struct pfm_read_write_regions rw_list;
-	int status;
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, NULL, strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, strlen (data),
+		0x1000 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x1000, 0x1000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x3000, 0x1000);
 
-	status = spi_filter_interface_mock_init (&filter);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region[0].start_addr = 0x10000;
-	rw_region[0].length = 0x10000;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	rw_region[1].start_addr = 0x30000;
-	rw_region[1].length = 0x20000;
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	rw_region[2].start_addr = 0x60000;
-	rw_region[2].length = 0x30000;
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 3;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter, 0);
-	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
-		MOCK_ARG (1), MOCK_ARG (0x10000), MOCK_ARG (0x20000));
-	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
-		MOCK_ARG (2), MOCK_ARG (0x30000), MOCK_ARG (0x50000));
-	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
-		MOCK_ARG (3), MOCK_ARG (0x60000), MOCK_ARG (0x90000));
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 3, skipped);
 
-	status = host_fw_config_spi_filter_read_write_regions (&filter.base, &rw_list);
+	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_filter_interface_mock_validate_and_release (&filter);
+	status = flash_master_mock_validate_and_release (&flash_mock2);
 	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_config_spi_filter_read_write_regions_test_null (CuTest *test)
+static void host_fw_restore_flash_device_differential_test_image_mismatch (CuTest *test)
 {
-	struct spi_filter_interface_mock filter;
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
 	int status;
+	char *data = "Test";
+	char *bad = "Tesx";
+	size_t skipped;
 
 	TEST_START;
 
-	status = spi_filter_interface_mock_init (&filter);
+	status = flash_master_mock_init (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
-
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
-
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_config_spi_filter_read_write_regions (NULL, &rw_list);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_config_spi_filter_read_write_regions (&filter.base, NULL);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_filter_interface_mock_validate_and_release (&filter);
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
-}
 
-static void host_fw_config_spi_filter_read_write_regions_test_filter_error (CuTest *test)
-{
-	struct spi_filter_interface_mock filter;
-	struct flash_region rw_region[3];
-	struct pfm_read_write rw_prop[3];
-	struct pfm_read_write_regions rw_list;
-	int status;
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) bad, (uint8_t*) data, strlen (data));
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0);
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, strlen (data), 0);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x1000, 0x1000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x3000, 0x1000);
 
-	status = spi_filter_interface_mock_init (&filter);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region[0].start_addr = 0x10000;
-	rw_region[0].length = 0x10000;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	rw_region[1].start_addr = 0x30000;
-	rw_region[1].length = 0x20000;
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	rw_region[2].start_addr = 0x60000;
-	rw_region[2].length = 0x30000;
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 3;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter, 0);
-	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
-		MOCK_ARG (1), MOCK_ARG (0x10000), MOCK_ARG (0x20000));
-	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter,
-		SPI_FILTER_SET_RW_FAILED, MOCK_ARG (2), MOCK_ARG (0x30000), MOCK_ARG (0x50000));
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, skipped);
 
-	status = host_fw_config_spi_filter_read_write_regions (&filter.base, &rw_list);
-	CuAssertIntEquals (test, SPI_FILTER_SET_RW_FAILED, status);
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	status = spi_filter_interface_mock_validate_and_release (&filter);
+	status = flash_master_mock_validate_and_release (&flash_mock2);
 	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_config_spi_filter_read_write_regions_test_clear_error (CuTest *test)
+static void host_fw_restore_flash_device_differential_test_not_blank (CuTest *test)
 {
-	struct spi_filter_interface_mock filter;
-	struct flash_region rw_region[3];
-	struct pfm_read_write rw_prop[3];
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
 	int status;
+	char *data = "Test";
+	size_t skipped;
 
 	TEST_START;
 
-	status = spi_filter_interface_mock_init (&filter);
+	status = flash_master_mock_init (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region[0].start_addr = 0x10000;
-	rw_region[0].length = 0x10000;
-
-	rw_region[1].start_addr = 0x30000;
-	rw_region[1].length = 0x20000;
-
-	rw_region[2].start_addr = 0x60000;
-	rw_region[2].length = 0x30000;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 3;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter,
-		SPI_FILTER_CLEAR_RW_FAILED);
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_device_size (&flash2, 0x4000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_config_spi_filter_read_write_regions (&filter.base, &rw_list);
-	CuAssertIntEquals (test, SPI_FILTER_CLEAR_RW_FAILED, status);
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, NULL, strlen (data));
+	status |= flash_master_mock_expect_value_check (&flash_mock2, strlen (data),
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0);
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, strlen (data), 0);
+	status |= flash_master_mock_expect_value_check (&flash_mock2, 0x1000,
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0x1000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x3000, 0x1000);
 
-	status = spi_filter_interface_mock_validate_and_release (&filter);
 	CuAssertIntEquals (test, 0, status);
-}
 
-static void host_fw_are_images_different_test (CuTest *test)
-{
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	TEST_START;
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, skipped);
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, false, status);
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_different_key_mod_length (CuTest *test)
+static void host_fw_restore_flash_device_differential_test_image_across_sectors (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	uint8_t data[0x20];
+	uint8_t bad[0x10];
+	size_t skipped;
+	size_t i;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	memset (bad, 0x55, sizeof (bad));
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	sig2.key.mod_length -= 1;
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
-}
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-static void host_fw_are_images_different_test_different_key_exponent (CuTest *test)
-{
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	status = flash_master_mock_expect_blank_check (&flash_mock2, 0, 0xff0);
+	status |= flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0xff0, 0xff0,
+		data, NULL, 0x10);
+	status |= flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0x1000, 0x1000,
+		bad, &data[0x10], 0x10);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0x1000);
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0x1000, 0x1000,
+		&data[0x10], 0x10, 0);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x3000, 0x1000);
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	CuAssertIntEquals (test, 0, status);
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	img_region.start_addr = 0xff0;
+	img_region.length = sizeof (data);
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	sig2.key.exponent = 3;
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, skipped);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_different_key_modulus (CuTest *test)
+static void host_fw_restore_flash_device_differential_test_hashes (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region img_region;
+	struct pfm_image_hash img_hash;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+	char *bad = "Tesx";
+	size_t skipped;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY2, sizeof (RSA_PUBLIC_KEY2));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
-}
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) bad, (uint8_t*) data, strlen (data));
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0);
+	status |= flash_master_mock_expect_copy_flash (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, strlen (data), 0);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x1000, 0x1000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x3000, 0x1000);
 
-static void host_fw_are_images_different_test_different_sig_length (CuTest *test)
-{
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	img_hash.regions = &img_region;
+	img_hash.count = 1;
+	memcpy (img_hash.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	img_hash.hash_length = SHA256_HASH_LENGTH;
+	img_hash.hash_type = HASH_TYPE_SHA256;
+	img_hash.always_validate = 1;
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	img_list.images_hash = &img_hash;
+	img_list.images_sig = NULL;
+	img_list.count = 1;
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN - 1;
-	sig2.always_validate = 1;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, skipped);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
-}
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-static void host_fw_are_images_different_test_different_signature (CuTest *test)
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_differential_test_null_skipped (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
-}
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, NULL, strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, strlen (data),
+		0x1000 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x1000, 0x1000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x3000, 0x1000);
 
-static void host_fw_are_images_different_test_different_validate_flag (CuTest *test)
-{
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 0;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		NULL);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_different_region_addr (CuTest *test)
+static void host_fw_restore_flash_device_differential_test_null (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+	size_t skipped;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region2.start_addr = 0x20000;
-	region2.length = 0x100;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
-}
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
 
-static void host_fw_are_images_different_test_different_region_length (CuTest *test)
-{
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
 
-	TEST_START;
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x200;
+	skipped = 5;
+	status = host_fw_restore_flash_device_differential (NULL, &flash1, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, skipped);
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	status = host_fw_restore_flash_device_differential (&flash2, NULL, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, NULL, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, NULL,
+		&skipped);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_multiple_images (CuTest *test)
+static void host_fw_restore_flash_device_differential_test_check_error (CuTest *test)
 {
-	struct flash_region region11;
-	struct flash_region region12;
-	struct flash_region region13;
-	struct pfm_image_signature sig1[3];
-	struct pfm_image_list list1;
-	struct flash_region region21;
-	struct flash_region region22;
-	struct flash_region region23;
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, skipped);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_differential_test_erase_error (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+	char *bad = "Tesx";
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) bad, (uint8_t*) data, strlen (data));
+	status |= flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, skipped);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_differential_test_copy_error (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+	char *bad = "Tesx";
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) bad, (uint8_t*) data, strlen (data));
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0);
+	status |= flash_master_mock_expect_xfer (&flash_mock1, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, skipped);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_flash_device_differential_test_last_region_error (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	char *data = "Test";
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x4000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0, 0,
+		(uint8_t*) data, NULL, strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, strlen (data),
+		0x1000 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x1000, 0x1000);
+	status |= flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x2000;
+	rw_region.length = 0x1000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_flash_device_differential (&flash2, &flash1, &img_list, &rw_list,
+		&skipped);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 2, skipped);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_config_spi_filter_read_write_regions_test (CuTest *test)
+{
+	struct spi_filter_interface_mock filter;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	int status;
+
+	TEST_START;
+
+	status = spi_filter_interface_mock_init (&filter);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter, 0);
+	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
+		MOCK_ARG (1), MOCK_ARG (0x10000), MOCK_ARG (0x20000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_config_spi_filter_read_write_regions (&filter.base, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_filter_interface_mock_validate_and_release (&filter);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void host_fw_config_spi_filter_read_write_regions_test_multiple_regions (CuTest *test)
+{
+	struct spi_filter_interface_mock filter;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list;
+	int status;
+
+	TEST_START;
+
+	status = spi_filter_interface_mock_init (&filter);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = 0x10000;
+
+	rw_region[1].start_addr = 0x30000;
+	rw_region[1].length = 0x20000;
+
+	rw_region[2].start_addr = 0x60000;
+	rw_region[2].length = 0x30000;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 3;
+
+	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter, 0);
+	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
+		MOCK_ARG (1), MOCK_ARG (0x10000), MOCK_ARG (0x20000));
+	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
+		MOCK_ARG (2), MOCK_ARG (0x30000), MOCK_ARG (0x50000));
+	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
+		MOCK_ARG (3), MOCK_ARG (0x60000), MOCK_ARG (0x90000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_config_spi_filter_read_write_regions (&filter.base, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_filter_interface_mock_validate_and_release (&filter);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void host_fw_config_spi_filter_read_write_regions_test_null (CuTest *test)
+{
+	struct spi_filter_interface_mock filter;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	int status;
+
+	TEST_START;
+
+	status = spi_filter_interface_mock_init (&filter);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_config_spi_filter_read_write_regions (NULL, &rw_list);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+
+	status = host_fw_config_spi_filter_read_write_regions (&filter.base, NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+
+	status = spi_filter_interface_mock_validate_and_release (&filter);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void host_fw_config_spi_filter_read_write_regions_test_filter_error (CuTest *test)
+{
+	struct spi_filter_interface_mock filter;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list;
+	int status;
+
+	TEST_START;
+
+	status = spi_filter_interface_mock_init (&filter);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = 0x10000;
+
+	rw_region[1].start_addr = 0x30000;
+	rw_region[1].length = 0x20000;
+
+	rw_region[2].start_addr = 0x60000;
+	rw_region[2].length = 0x30000;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 3;
+
+	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter, 0);
+	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
+		MOCK_ARG (1), MOCK_ARG (0x10000), MOCK_ARG (0x20000));
+	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter,
+		SPI_FILTER_SET_RW_FAILED, MOCK_ARG (2), MOCK_ARG (0x30000), MOCK_ARG (0x50000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_config_spi_filter_read_write_regions (&filter.base, &rw_list);
+	CuAssertIntEquals (test, SPI_FILTER_SET_RW_FAILED, status);
+
+	status = spi_filter_interface_mock_validate_and_release (&filter);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void host_fw_config_spi_filter_read_write_regions_test_clear_error (CuTest *test)
+{
+	struct spi_filter_interface_mock filter;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list;
+	int status;
+
+	TEST_START;
+
+	status = spi_filter_interface_mock_init (&filter);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = 0x10000;
+
+	rw_region[1].start_addr = 0x30000;
+	rw_region[1].length = 0x20000;
+
+	rw_region[2].start_addr = 0x60000;
+	rw_region[2].length = 0x30000;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 3;
+
+	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter,
+		SPI_FILTER_CLEAR_RW_FAILED);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_config_spi_filter_read_write_regions (&filter.base, &rw_list);
+	CuAssertIntEquals (test, SPI_FILTER_CLEAR_RW_FAILED, status);
+
+	status = spi_filter_interface_mock_validate_and_release (&filter);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void host_fw_are_images_different_test (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, false, status);
+}
+
+static void host_fw_are_images_different_test_different_key_mod_length (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	sig2.key.mod_length -= 1;
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_key_exponent (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	sig2.key.exponent = 3;
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_key_modulus (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY2, sizeof (RSA_PUBLIC_KEY2));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_sig_length (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN - 1;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_signature (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST2, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_validate_flag (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 0;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_region_addr (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x20000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_region_length (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x200;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_multiple_images (CuTest *test)
+{
+	struct flash_region region11;
+	struct flash_region region12;
+	struct flash_region region13;
+	struct pfm_image_signature sig1[3];
+	struct pfm_image_list list1;
+	struct flash_region region21;
+	struct flash_region region22;
+	struct flash_region region23;
 	struct pfm_image_signature sig2[3];
 	struct pfm_image_list list2;
 	bool status;
@@ -10699,10 +11652,54 @@ static void host_fw_are_images_different_test_hashes_different_hash (CuTest *tes
 
 	hash2.regions = &region2;
 	hash2.count = 1;
-	memcpy (hash2.hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	memcpy (hash2.hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2.hash_length = SHA256_HASH_LENGTH;
+	hash2.hash_type = HASH_TYPE_SHA256;
+	hash2.always_validate = 1;
+
+	list2.images_hash = &hash2;
+	list2.images_sig = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_hashes_different_validate_flag (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_hash hash1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_hash hash2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	hash1.regions = &region1;
+	hash1.count = 1;
+	memcpy (hash1.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1.hash_length = SHA256_HASH_LENGTH;
+	hash1.hash_type = HASH_TYPE_SHA256;
+	hash1.always_validate = 1;
+
+	list1.images_hash = &hash1;
+	list1.images_sig = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	hash2.regions = &region2;
+	hash2.count = 1;
+	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
 	hash2.hash_length = SHA256_HASH_LENGTH;
 	hash2.hash_type = HASH_TYPE_SHA256;
-	hash2.always_validate = 1;
+	hash2.always_validate = 0;
 
 	list2.images_hash = &hash2;
 	list2.images_sig = NULL;
@@ -10712,7 +11709,7 @@ static void host_fw_are_images_different_test_hashes_different_hash (CuTest *tes
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_hashes_different_validate_flag (CuTest *test)
+static void host_fw_are_images_different_test_hashes_different_region_addr (CuTest *test)
 {
 	struct flash_region region1;
 	struct pfm_image_hash hash1;
@@ -10738,7 +11735,7 @@ static void host_fw_are_images_different_test_hashes_different_validate_flag (Cu
 	list1.images_sig = NULL;
 	list1.count = 1;
 
-	region2.start_addr = 0x10000;
+	region2.start_addr = 0x20000;
 	region2.length = 0x100;
 
 	hash2.regions = &region2;
@@ -10746,7 +11743,7 @@ static void host_fw_are_images_different_test_hashes_different_validate_flag (Cu
 	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
 	hash2.hash_length = SHA256_HASH_LENGTH;
 	hash2.hash_type = HASH_TYPE_SHA256;
-	hash2.always_validate = 0;
+	hash2.always_validate = 1;
 
 	list2.images_hash = &hash2;
 	list2.images_sig = NULL;
@@ -10756,7 +11753,7 @@ static void host_fw_are_images_different_test_hashes_different_validate_flag (Cu
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_hashes_different_region_addr (CuTest *test)
+static void host_fw_are_images_different_test_hashes_different_region_length (CuTest *test)
 {
 	struct flash_region region1;
 	struct pfm_image_hash hash1;
@@ -10782,8 +11779,8 @@ static void host_fw_are_images_different_test_hashes_different_region_addr (CuTe
 	list1.images_sig = NULL;
 	list1.count = 1;
 
-	region2.start_addr = 0x20000;
-	region2.length = 0x100;
+	region2.start_addr = 0x10000;
+	region2.length = 0x200;
 
 	hash2.regions = &region2;
 	hash2.count = 1;
@@ -10800,51 +11797,273 @@ static void host_fw_are_images_different_test_hashes_different_region_addr (CuTe
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_hashes_different_region_length (CuTest *test)
+static void host_fw_are_images_different_test_multiple_images_hashes (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_hash hash1;
+	struct flash_region region11;
+	struct flash_region region12;
+	struct flash_region region13;
+	struct pfm_image_hash hash1[3];
 	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_hash hash2;
+	struct flash_region region21;
+	struct flash_region region22;
+	struct flash_region region23;
+	struct pfm_image_hash hash2[3];
 	struct pfm_image_list list2;
 	bool status;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	region11.start_addr = 0x10000;
+	region11.length = 0x100;
 
-	hash1.regions = &region1;
-	hash1.count = 1;
-	memcpy (hash1.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1.hash_length = SHA256_HASH_LENGTH;
-	hash1.hash_type = HASH_TYPE_SHA256;
-	hash1.always_validate = 1;
+	hash1[0].regions = &region11;
+	hash1[0].count = 1;
+	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1[0].hash_length = SHA256_HASH_LENGTH;
+	hash1[0].hash_type = HASH_TYPE_SHA256;
+	hash1[0].always_validate = 1;
+
+	region12.start_addr = 0x30000;
+	region12.length = 32;
+
+	hash1[1].regions = &region12;
+	hash1[1].count = 1;
+	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[1].hash_length = SHA256_HASH_LENGTH;
+	hash1[1].hash_type = HASH_TYPE_SHA256;
+	hash1[1].always_validate = 1;
+
+	region13.start_addr = 0x50000;
+	region13.length = 16;
+
+	hash1[2].regions = &region13;
+	hash1[2].count = 1;
+	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[2].hash_length = SHA256_HASH_LENGTH;
+	hash1[2].hash_type = HASH_TYPE_SHA256;
+	hash1[2].always_validate = 1;
+
+	list1.images_hash = hash1;
+	list1.images_sig = NULL;
+	list1.count = 3;
+
+	region21.start_addr = 0x10000;
+	region21.length = 0x100;
+
+	hash2[0].regions = &region21;
+	hash2[0].count = 1;
+	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash2[0].hash_length = SHA256_HASH_LENGTH;
+	hash2[0].hash_type = HASH_TYPE_SHA256;
+	hash2[0].always_validate = 1;
+
+	region22.start_addr = 0x30000;
+	region22.length = 32;
+
+	hash2[1].regions = &region22;
+	hash2[1].count = 1;
+	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[1].hash_length = SHA256_HASH_LENGTH;
+	hash2[1].hash_type = HASH_TYPE_SHA256;
+	hash2[1].always_validate = 1;
+
+	region23.start_addr = 0x50000;
+	region23.length = 16;
+
+	hash2[2].regions = &region23;
+	hash2[2].count = 1;
+	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[2].hash_length = SHA256_HASH_LENGTH;
+	hash2[2].hash_type = HASH_TYPE_SHA256;
+	hash2[2].always_validate = 1;
+
+	list2.images_hash = hash2;
+	list2.images_sig = NULL;
+	list2.count = 3;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, false, status);
+}
+
+static void host_fw_are_images_different_test_multiple_images_hashes_different_hash_length (
+	CuTest *test)
+{
+	struct flash_region region11;
+	struct flash_region region12;
+	struct flash_region region13;
+	struct pfm_image_hash hash1[3];
+	struct pfm_image_list list1;
+	struct flash_region region21;
+	struct flash_region region22;
+	struct flash_region region23;
+	struct pfm_image_hash hash2[3];
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region11.start_addr = 0x10000;
+	region11.length = 0x100;
+
+	hash1[0].regions = &region11;
+	hash1[0].count = 1;
+	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1[0].hash_length = SHA256_HASH_LENGTH;
+	hash1[0].hash_type = HASH_TYPE_SHA256;
+	hash1[0].always_validate = 1;
+
+	region12.start_addr = 0x30000;
+	region12.length = 32;
+
+	hash1[1].regions = &region12;
+	hash1[1].count = 1;
+	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[1].hash_length = SHA256_HASH_LENGTH;
+	hash1[1].hash_type = HASH_TYPE_SHA256;
+	hash1[1].always_validate = 1;
+
+	region13.start_addr = 0x50000;
+	region13.length = 16;
+
+	hash1[2].regions = &region13;
+	hash1[2].count = 1;
+	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[2].hash_length = SHA256_HASH_LENGTH;
+	hash1[2].hash_type = HASH_TYPE_SHA256;
+	hash1[2].always_validate = 1;
+
+	list1.images_hash = hash1;
+	list1.images_sig = NULL;
+	list1.count = 3;
+
+	region21.start_addr = 0x10000;
+	region21.length = 0x100;
+
+	hash2[0].regions = &region21;
+	hash2[0].count = 1;
+	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash2[0].hash_length = SHA256_HASH_LENGTH;
+	hash2[0].hash_type = HASH_TYPE_SHA256;
+	hash2[0].always_validate = 1;
+
+	region22.start_addr = 0x30000;
+	region22.length = 32;
+
+	hash2[1].regions = &region22;
+	hash2[1].count = 1;
+	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[1].hash_length = SHA256_HASH_LENGTH;
+	hash2[1].hash_type = HASH_TYPE_SHA256;
+	hash2[1].always_validate = 1;
+
+	region23.start_addr = 0x50000;
+	region23.length = 16;
+
+	hash2[2].regions = &region23;
+	hash2[2].count = 1;
+	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[2].hash_length = SHA256_HASH_LENGTH - 1;
+	hash2[2].hash_type = HASH_TYPE_SHA256;
+	hash2[2].always_validate = 1;
+
+	list2.images_hash = hash2;
+	list2.images_sig = NULL;
+	list2.count = 3;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_multiple_images_hashes_different_hash_type (
+	CuTest *test)
+{
+	struct flash_region region11;
+	struct flash_region region12;
+	struct flash_region region13;
+	struct pfm_image_hash hash1[3];
+	struct pfm_image_list list1;
+	struct flash_region region21;
+	struct flash_region region22;
+	struct flash_region region23;
+	struct pfm_image_hash hash2[3];
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region11.start_addr = 0x10000;
+	region11.length = 0x100;
+
+	hash1[0].regions = &region11;
+	hash1[0].count = 1;
+	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1[0].hash_length = SHA256_HASH_LENGTH;
+	hash1[0].hash_type = HASH_TYPE_SHA256;
+	hash1[0].always_validate = 1;
+
+	region12.start_addr = 0x30000;
+	region12.length = 32;
+
+	hash1[1].regions = &region12;
+	hash1[1].count = 1;
+	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[1].hash_length = SHA256_HASH_LENGTH;
+	hash1[1].hash_type = HASH_TYPE_SHA256;
+	hash1[1].always_validate = 1;
+
+	region13.start_addr = 0x50000;
+	region13.length = 16;
+
+	hash1[2].regions = &region13;
+	hash1[2].count = 1;
+	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash1[2].hash_length = SHA256_HASH_LENGTH;
+	hash1[2].hash_type = HASH_TYPE_SHA256;
+	hash1[2].always_validate = 1;
+
+	list1.images_hash = hash1;
+	list1.images_sig = NULL;
+	list1.count = 3;
+
+	region21.start_addr = 0x10000;
+	region21.length = 0x100;
+
+	hash2[0].regions = &region21;
+	hash2[0].count = 1;
+	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash2[0].hash_length = SHA256_HASH_LENGTH;
+	hash2[0].hash_type = HASH_TYPE_SHA256;
+	hash2[0].always_validate = 1;
 
-	list1.images_hash = &hash1;
-	list1.images_sig = NULL;
-	list1.count = 1;
+	region22.start_addr = 0x30000;
+	region22.length = 32;
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x200;
+	hash2[1].regions = &region22;
+	hash2[1].count = 1;
+	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[1].hash_length = SHA256_HASH_LENGTH;
+	hash2[1].hash_type = HASH_TYPE_SHA384;
+	hash2[1].always_validate = 1;
 
-	hash2.regions = &region2;
-	hash2.count = 1;
-	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2.hash_length = SHA256_HASH_LENGTH;
-	hash2.hash_type = HASH_TYPE_SHA256;
-	hash2.always_validate = 1;
+	region23.start_addr = 0x50000;
+	region23.length = 16;
 
-	list2.images_hash = &hash2;
+	hash2[2].regions = &region23;
+	hash2[2].count = 1;
+	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[2].hash_length = SHA256_HASH_LENGTH;
+	hash2[2].hash_type = HASH_TYPE_SHA256;
+	hash2[2].always_validate = 1;
+
+	list2.images_hash = hash2;
 	list2.images_sig = NULL;
-	list2.count = 1;
+	list2.count = 3;
 
 	status = host_fw_are_images_different (&list1, &list2);
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes (CuTest *test)
+static void host_fw_are_images_different_test_multiple_images_hashes_different_hash (CuTest *test)
 {
 	struct flash_region region11;
 	struct flash_region region12;
@@ -10919,7 +12138,7 @@ static void host_fw_are_images_different_test_multiple_images_hashes (CuTest *te
 
 	hash2[2].regions = &region23;
 	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	memcpy (hash2[2].hash, SHA384_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
 	hash2[2].hash_length = SHA256_HASH_LENGTH;
 	hash2[2].hash_type = HASH_TYPE_SHA256;
 	hash2[2].always_validate = 1;
@@ -10929,10 +12148,10 @@ static void host_fw_are_images_different_test_multiple_images_hashes (CuTest *te
 	list2.count = 3;
 
 	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, false, status);
+	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_hash_length (
+static void host_fw_are_images_different_test_multiple_images_hashes_different_validate_flash (
 	CuTest *test)
 {
 	struct flash_region region11;
@@ -11001,7 +12220,7 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
 	hash2[1].hash_length = SHA256_HASH_LENGTH;
 	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 1;
+	hash2[1].always_validate = 0;
 
 	region23.start_addr = 0x50000;
 	region23.length = 16;
@@ -11009,7 +12228,7 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	hash2[2].regions = &region23;
 	hash2[2].count = 1;
 	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH - 1;
+	hash2[2].hash_length = SHA256_HASH_LENGTH;
 	hash2[2].hash_type = HASH_TYPE_SHA256;
 	hash2[2].always_validate = 1;
 
@@ -11021,7 +12240,7 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_hash_type (
+static void host_fw_are_images_different_test_multiple_images_hashes_different_region_addr (
 	CuTest *test)
 {
 	struct flash_region region11;
@@ -11089,10 +12308,10 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	hash2[1].count = 1;
 	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
 	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA384;
+	hash2[1].hash_type = HASH_TYPE_SHA256;
 	hash2[1].always_validate = 1;
 
-	region23.start_addr = 0x50000;
+	region23.start_addr = 0x80000;
 	region23.length = 16;
 
 	hash2[2].regions = &region23;
@@ -11110,7 +12329,8 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	CuAssertIntEquals (test, true, status);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_hash (CuTest *test)
+static void host_fw_are_images_different_test_multiple_images_hashes_different_region_length (
+	CuTest *test)
 {
 	struct flash_region region11;
 	struct flash_region region12;
@@ -11170,440 +12390,544 @@ static void host_fw_are_images_different_test_multiple_images_hashes_different_h
 	hash2[0].hash_type = HASH_TYPE_SHA256;
 	hash2[0].always_validate = 1;
 
-	region22.start_addr = 0x30000;
-	region22.length = 32;
+	region22.start_addr = 0x30000;
+	region22.length = 48;
+
+	hash2[1].regions = &region22;
+	hash2[1].count = 1;
+	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[1].hash_length = SHA256_HASH_LENGTH;
+	hash2[1].hash_type = HASH_TYPE_SHA256;
+	hash2[1].always_validate = 1;
+
+	region23.start_addr = 0x50000;
+	region23.length = 16;
+
+	hash2[2].regions = &region23;
+	hash2[2].count = 1;
+	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
+	hash2[2].hash_length = SHA256_HASH_LENGTH;
+	hash2[2].hash_type = HASH_TYPE_SHA256;
+	hash2[2].always_validate = 1;
+
+	list2.images_hash = hash2;
+	list2.images_sig = NULL;
+	list2.count = 3;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_auth_types (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_hash hash2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	hash2.regions = &region2;
+	hash2.count = 1;
+	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash2.hash_length = SHA256_HASH_LENGTH;
+	hash2.hash_type = HASH_TYPE_SHA256;
+	hash2.always_validate = 1;
+
+	list2.images_hash = &hash2;
+	list2.images_sig = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_different_auth_types_hash_first (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_hash hash1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	hash1.regions = &region1;
+	hash1.count = 1;
+	memcpy (hash1.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	hash1.hash_length = SHA256_HASH_LENGTH;
+	hash1.hash_type = HASH_TYPE_SHA256;
+	hash1.always_validate = 1;
+
+	list1.images_hash = &hash1;
+	list1.images_sig = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, &list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_images_different_test_null (CuTest *test)
+{
+	struct flash_region region1;
+	struct pfm_image_signature sig1;
+	struct pfm_image_list list1;
+	struct flash_region region2;
+	struct pfm_image_signature sig2;
+	struct pfm_image_list list2;
+	bool status;
+
+	TEST_START;
+
+	region1.start_addr = 0x10000;
+	region1.length = 0x100;
+
+	sig1.regions = &region1;
+	sig1.count = 1;
+	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig1.sig_length = RSA_ENCRYPT_LEN;
+	sig1.always_validate = 1;
+
+	list1.images_sig = &sig1;
+	list1.images_hash = NULL;
+	list1.count = 1;
+
+	region2.start_addr = 0x10000;
+	region2.length = 0x100;
+
+	sig2.regions = &region2;
+	sig2.count = 1;
+	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig2.sig_length = RSA_ENCRYPT_LEN;
+	sig2.always_validate = 1;
+
+	list2.images_sig = &sig2;
+	list2.images_hash = NULL;
+	list2.count = 1;
+
+	status = host_fw_are_images_different (&list1, NULL);
+	CuAssertIntEquals (test, true, status);
+
+	status = host_fw_are_images_different (NULL, &list2);
+	CuAssertIntEquals (test, true, status);
+
+	status = host_fw_are_images_different (NULL, NULL);
+	CuAssertIntEquals (test, false, status);
+}
+
+static void host_fw_restore_read_write_data_test_do_nothing (CuTest *test)
+{
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
-	hash2[1].regions = &region22;
-	hash2[1].count = 1;
-	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 1;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	region23.start_addr = 0x50000;
-	region23.length = 16;
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[2].regions = &region23;
-	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA384_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH;
-	hash2[2].hash_type = HASH_TYPE_SHA256;
-	hash2[2].always_validate = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = hash2;
-	list2.images_sig = NULL;
-	list2.count = 3;
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_validate_flash (
-	CuTest *test)
+static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
 {
-	struct flash_region region11;
-	struct flash_region region12;
-	struct flash_region region13;
-	struct pfm_image_hash hash1[3];
-	struct pfm_image_list list1;
-	struct flash_region region21;
-	struct flash_region region22;
-	struct flash_region region23;
-	struct pfm_image_hash hash2[3];
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
-	region11.start_addr = 0x10000;
-	region11.length = 0x100;
-
-	hash1[0].regions = &region11;
-	hash1[0].count = 1;
-	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1[0].hash_length = SHA256_HASH_LENGTH;
-	hash1[0].hash_type = HASH_TYPE_SHA256;
-	hash1[0].always_validate = 1;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	region12.start_addr = 0x30000;
-	region12.length = 32;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[1].regions = &region12;
-	hash1[1].count = 1;
-	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[1].hash_length = SHA256_HASH_LENGTH;
-	hash1[1].hash_type = HASH_TYPE_SHA256;
-	hash1[1].always_validate = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region13.start_addr = 0x50000;
-	region13.length = 16;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[2].regions = &region13;
-	hash1[2].count = 1;
-	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[2].hash_length = SHA256_HASH_LENGTH;
-	hash1[2].hash_type = HASH_TYPE_SHA256;
-	hash1[2].always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_hash = hash1;
-	list1.images_sig = NULL;
-	list1.count = 3;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	region21.start_addr = 0x10000;
-	region21.length = 0x100;
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[0].regions = &region21;
-	hash2[0].count = 1;
-	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2[0].hash_length = SHA256_HASH_LENGTH;
-	hash2[0].hash_type = HASH_TYPE_SHA256;
-	hash2[0].always_validate = 1;
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
 
-	region22.start_addr = 0x30000;
-	region22.length = 32;
+	rw_prop.on_failure = PFM_RW_ERASE;
 
-	hash2[1].regions = &region22;
-	hash2[1].count = 1;
-	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 0;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	region23.start_addr = 0x50000;
-	region23.length = 16;
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[2].regions = &region23;
-	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH;
-	hash2[2].hash_type = HASH_TYPE_SHA256;
-	hash2[2].always_validate = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = hash2;
-	list2.images_sig = NULL;
-	list2.count = 3;
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_region_addr (
-	CuTest *test)
+static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 {
-	struct flash_region region11;
-	struct flash_region region12;
-	struct flash_region region13;
-	struct pfm_image_hash hash1[3];
-	struct pfm_image_list list1;
-	struct flash_region region21;
-	struct flash_region region22;
-	struct flash_region region23;
-	struct pfm_image_hash hash2[3];
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	uint8_t data[0x10000];
+	size_t i;
 
 	TEST_START;
 
-	region11.start_addr = 0x10000;
-	region11.length = 0x100;
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
 
-	hash1[0].regions = &region11;
-	hash1[0].count = 1;
-	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1[0].hash_length = SHA256_HASH_LENGTH;
-	hash1[0].hash_type = HASH_TYPE_SHA256;
-	hash1[0].always_validate = 1;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	region12.start_addr = 0x30000;
-	region12.length = 32;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[1].regions = &region12;
-	hash1[1].count = 1;
-	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[1].hash_length = SHA256_HASH_LENGTH;
-	hash1[1].hash_type = HASH_TYPE_SHA256;
-	hash1[1].always_validate = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region13.start_addr = 0x50000;
-	region13.length = 16;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[2].regions = &region13;
-	hash1[2].count = 1;
-	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[2].hash_length = SHA256_HASH_LENGTH;
-	hash1[2].hash_type = HASH_TYPE_SHA256;
-	hash1[2].always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_hash = hash1;
-	list1.images_sig = NULL;
-	list1.count = 3;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	region21.start_addr = 0x10000;
-	region21.length = 0x100;
+	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, 0x10000);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
+		0x10000, data, sizeof (data));
 
-	hash2[0].regions = &region21;
-	hash2[0].count = 1;
-	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2[0].hash_length = SHA256_HASH_LENGTH;
-	hash2[0].hash_type = HASH_TYPE_SHA256;
-	hash2[0].always_validate = 1;
+	CuAssertIntEquals (test, 0, status);
 
-	region22.start_addr = 0x30000;
-	region22.length = 32;
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
 
-	hash2[1].regions = &region22;
-	hash2[1].count = 1;
-	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 1;
+	rw_prop.on_failure = PFM_RW_RESTORE;
 
-	region23.start_addr = 0x80000;
-	region23.length = 16;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	hash2[2].regions = &region23;
-	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH;
-	hash2[2].hash_type = HASH_TYPE_SHA256;
-	hash2[2].always_validate = 1;
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = hash2;
-	list2.images_sig = NULL;
-	list2.count = 3;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_multiple_images_hashes_different_region_length (
-	CuTest *test)
+static void host_fw_restore_read_write_data_test_restore_flash_no_source_device (CuTest *test)
 {
-	struct flash_region region11;
-	struct flash_region region12;
-	struct flash_region region13;
-	struct pfm_image_hash hash1[3];
-	struct pfm_image_list list1;
-	struct flash_region region21;
-	struct flash_region region22;
-	struct flash_region region23;
-	struct pfm_image_hash hash2[3];
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
-	region11.start_addr = 0x10000;
-	region11.length = 0x100;
-
-	hash1[0].regions = &region11;
-	hash1[0].count = 1;
-	memcpy (hash1[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1[0].hash_length = SHA256_HASH_LENGTH;
-	hash1[0].hash_type = HASH_TYPE_SHA256;
-	hash1[0].always_validate = 1;
-
-	region12.start_addr = 0x30000;
-	region12.length = 32;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[1].regions = &region12;
-	hash1[1].count = 1;
-	memcpy (hash1[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[1].hash_length = SHA256_HASH_LENGTH;
-	hash1[1].hash_type = HASH_TYPE_SHA256;
-	hash1[1].always_validate = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	region13.start_addr = 0x50000;
-	region13.length = 16;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	hash1[2].regions = &region13;
-	hash1[2].count = 1;
-	memcpy (hash1[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash1[2].hash_length = SHA256_HASH_LENGTH;
-	hash1[2].hash_type = HASH_TYPE_SHA256;
-	hash1[2].always_validate = 1;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_hash = hash1;
-	list1.images_sig = NULL;
-	list1.count = 3;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	region21.start_addr = 0x10000;
-	region21.length = 0x100;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[0].regions = &region21;
-	hash2[0].count = 1;
-	memcpy (hash2[0].hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2[0].hash_length = SHA256_HASH_LENGTH;
-	hash2[0].hash_type = HASH_TYPE_SHA256;
-	hash2[0].always_validate = 1;
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
 
-	region22.start_addr = 0x30000;
-	region22.length = 48;
+	rw_prop.on_failure = PFM_RW_RESTORE;
 
-	hash2[1].regions = &region22;
-	hash2[1].count = 1;
-	memcpy (hash2[1].hash, SHA256_ZERO_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[1].hash_length = SHA256_HASH_LENGTH;
-	hash2[1].hash_type = HASH_TYPE_SHA256;
-	hash2[1].always_validate = 1;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	region23.start_addr = 0x50000;
-	region23.length = 16;
+	status = host_fw_restore_read_write_data (&flash2, NULL, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2[2].regions = &region23;
-	hash2[2].count = 1;
-	memcpy (hash2[2].hash, SHA256_EMPTY_BUFFER_HASH, SHA256_HASH_LENGTH);
-	hash2[2].hash_length = SHA256_HASH_LENGTH;
-	hash2[2].hash_type = HASH_TYPE_SHA256;
-	hash2[2].always_validate = 1;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = hash2;
-	list2.images_sig = NULL;
-	list2.count = 3;
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_different_auth_types (CuTest *test)
+static void host_fw_restore_read_write_data_test_reserved (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_hash hash2;
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	hash2.regions = &region2;
-	hash2.count = 1;
-	memcpy (hash2.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash2.hash_length = SHA256_HASH_LENGTH;
-	hash2.hash_type = HASH_TYPE_SHA256;
-	hash2.always_validate = 1;
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_hash = &hash2;
-	list2.images_sig = NULL;
-	list2.count = 1;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_RESERVED;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_are_images_different_test_different_auth_types_hash_first (CuTest *test)
+static void host_fw_restore_read_write_data_test_multiple_regions (CuTest *test)
 {
-	struct flash_region region1;
-	struct pfm_image_hash hash1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	struct flash_region rw_region[4];
+	struct pfm_read_write rw_prop[4];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	uint8_t data[0x10000];
+	size_t i;
 
 	TEST_START;
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
-
-	hash1.regions = &region1;
-	hash1.count = 1;
-	memcpy (hash1.hash, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
-	hash1.hash_length = SHA256_HASH_LENGTH;
-	hash1.hash_type = HASH_TYPE_SHA256;
-	hash1.always_validate = 1;
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
 
-	list1.images_hash = &hash1;
-	list1.images_sig = NULL;
-	list1.count = 1;
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, &list2);
-	CuAssertIntEquals (test, true, status);
-}
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-static void host_fw_are_images_different_test_null (CuTest *test)
-{
-	struct flash_region region1;
-	struct pfm_image_signature sig1;
-	struct pfm_image_list list1;
-	struct flash_region region2;
-	struct pfm_image_signature sig2;
-	struct pfm_image_list list2;
-	bool status;
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	for (i = 0; i < 3; i++) {
+		status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000 + (0x10000 * i));
+	}
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x40000, 0x30000);
 
-	region1.start_addr = 0x10000;
-	region1.length = 0x100;
+	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x100000, 0x10000);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x100000,
+		0x100000, data, sizeof (data));
 
-	sig1.regions = &region1;
-	sig1.count = 1;
-	memcpy (&sig1.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig1.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig1.sig_length = RSA_ENCRYPT_LEN;
-	sig1.always_validate = 1;
+	CuAssertIntEquals (test, 0, status);
 
-	list1.images_sig = &sig1;
-	list1.images_hash = NULL;
-	list1.count = 1;
+	rw_region[0].start_addr = 0;
+	rw_region[0].length = 0x10000;
+	rw_region[1].start_addr = 0x40000;
+	rw_region[1].length = 0x30000;
+	rw_region[2].start_addr = 0x100000;
+	rw_region[2].length = 0x10000;
+	rw_region[3].start_addr = 0x500000;
+	rw_region[3].length = 0x100000;
 
-	region2.start_addr = 0x10000;
-	region2.length = 0x100;
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_ERASE;
+	rw_prop[2].on_failure = PFM_RW_RESTORE;
+	rw_prop[3].on_failure = PFM_RW_RESERVED;
 
-	sig2.regions = &region2;
-	sig2.count = 1;
-	memcpy (&sig2.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
-	memcpy (&sig2.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
-	sig2.sig_length = RSA_ENCRYPT_LEN;
-	sig2.always_validate = 1;
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 4;
 
-	list2.images_sig = &sig2;
-	list2.images_hash = NULL;
-	list2.count = 1;
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (&list1, NULL);
-	CuAssertIntEquals (test, true, status);
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (NULL, &list2);
-	CuAssertIntEquals (test, true, status);
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	status = host_fw_are_images_different (NULL, NULL);
-	CuAssertIntEquals (test, false, status);
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_do_nothing (CuTest *test)
+static void host_fw_restore_read_write_data_test_null (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -11645,8 +12969,11 @@ static void host_fw_restore_read_write_data_test_do_nothing (CuTest *test)
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	status = host_fw_restore_read_write_data (NULL, &flash1, &rw_list);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+
+	status = host_fw_restore_read_write_data (&flash2, &flash1, NULL);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11658,7 +12985,7 @@ static void host_fw_restore_read_write_data_test_do_nothing (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
+static void host_fw_restore_read_write_data_test_erase_flash_error (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -11691,7 +13018,8 @@ static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, 0x10000);
+	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
 	CuAssertIntEquals (test, 0, status);
 
 	rw_region.start_addr = 0x10000;
@@ -11704,7 +13032,7 @@ static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
 	rw_list.count = 1;
 
 	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11716,7 +13044,7 @@ static void host_fw_restore_read_write_data_test_erase_flash (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
+static void host_fw_restore_read_write_data_test_restore_flash_error (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -11728,15 +13056,9 @@ static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
-	uint8_t data[0x10000];
-	size_t i;
 
 	TEST_START;
 
-	for (i = 0; i < sizeof (data); i++) {
-		data[i] = i;
-	}
-
 	status = flash_master_mock_init (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
@@ -11755,10 +13077,8 @@ static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x10000, 0x10000);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x10000,
-		0x10000, data, sizeof (data));
-
+	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
 	CuAssertIntEquals (test, 0, status);
 
 	rw_region.start_addr = 0x10000;
@@ -11771,8 +13091,76 @@ static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 	rw_list.count = 1;
 
 	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_read_write_data_test_multiple_regions_error (CuTest *test)
+{
+	struct flash_region rw_region[4];
+	struct pfm_read_write rw_prop[4];
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region[0].start_addr = 0;
+	rw_region[0].length = 0x10000;
+	rw_region[1].start_addr = 0x40000;
+	rw_region[1].length = 0x30000;
+	rw_region[2].start_addr = 0x100000;
+	rw_region[2].length = 0x10000;
+	rw_region[3].start_addr = 0x500000;
+	rw_region[3].length = 0x100000;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_ERASE;
+	rw_prop[2].on_failure = PFM_RW_RESTORE;
+	rw_prop[3].on_failure = PFM_RW_RESERVED;
+
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 4;
+
+	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
@@ -11783,7 +13171,7 @@ static void host_fw_restore_read_write_data_test_restore_flash (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_restore_flash_no_source_device (CuTest *test)
+static void host_fw_restore_read_write_data_differential_test_do_nothing (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -11795,6 +13183,7 @@ static void host_fw_restore_read_write_data_test_restore_flash_no_source_device
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
+	size_t skipped;
 
 	TEST_START;
 
@@ -11819,14 +13208,15 @@ static void host_fw_restore_read_write_data_test_restore_flash_no_source_device
 	rw_region.start_addr = 0x10000;
 	rw_region.length = 0x10000;
 
-	rw_prop.on_failure = PFM_RW_RESTORE;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
 	rw_list.regions = &rw_region;
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, NULL, &rw_list);
+	status = host_fw_restore_read_write_data_differential (&flash2, &flash1, &rw_list, &skipped);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, skipped);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11838,7 +13228,7 @@ static void host_fw_restore_read_write_data_test_restore_flash_no_source_device
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_reserved (CuTest *test)
+static void host_fw_restore_read_write_data_differential_test_erase_flash (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -11850,6 +13240,7 @@ static void host_fw_restore_read_write_data_test_reserved (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
+	size_t skipped;
 
 	TEST_START;
 
@@ -11871,17 +13262,26 @@ static void host_fw_restore_read_write_data_test_reserved (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = flash_master_mock_expect_blank_check (&flash_mock2, 0x10000, 0x1000);
+	status |= flash_master_mock_expect_value_check (&flash_mock2, 0x11000,
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0x11000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x11000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
 	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	rw_region.length = 0x2000;
 
-	rw_prop.on_failure = PFM_RW_RESERVED;
+	rw_prop.on_failure = PFM_RW_ERASE;
 
 	rw_list.regions = &rw_region;
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	status = host_fw_restore_read_write_data_differential (&flash2, &flash1, &rw_list, &skipped);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, skipped);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11893,10 +13293,10 @@ static void host_fw_restore_read_write_data_test_reserved (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_multiple_regions (CuTest *test)
+static void host_fw_restore_read_write_data_differential_test_restore_flash (CuTest *test)
 {
-	struct flash_region rw_region[4];
-	struct pfm_read_write rw_prop[4];
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
@@ -11905,7 +13305,9 @@ static void host_fw_restore_read_write_data_test_multiple_regions (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
-	uint8_t data[0x10000];
+	uint8_t data[0x1100];
+	uint8_t bad[0x100];
+	size_t skipped;
 	size_t i;
 
 	TEST_START;
@@ -11914,6 +13316,8 @@ static void host_fw_restore_read_write_data_test_multiple_regions (CuTest *test)
 		data[i] = i;
 	}
 
+	memset (bad, 0x55, sizeof (bad));
+
 	status = flash_master_mock_init (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
@@ -11932,37 +13336,86 @@ static void host_fw_restore_read_write_data_test_multiple_regions (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	for (i = 0; i < 3; i++) {
-		status |= flash_master_mock_expect_erase_flash (&flash_mock2, 0x40000 + (0x10000 * i));
-	}
-	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x40000, 0x30000);
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0x10000, 0x10000,
+		data, NULL, 0x1000);
+	status |= flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0x11000, 0x11000,
+		bad, &data[0x1000], 0x100);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0x11000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x11000, 0x100);
+	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x11000,
+		0x11000, &data[0x1000], 0x100);
 
-	status |= flash_master_mock_expect_erase_flash_verify (&flash_mock2, 0x100000, 0x10000);
-	status |= flash_master_mock_expect_copy_flash_verify (&flash_mock2, &flash_mock1, 0x100000,
-		0x100000, data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x1100;
+
+	rw_prop.on_failure = PFM_RW_RESTORE;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
+	status = host_fw_restore_read_write_data_differential (&flash2, &flash1, &rw_list, &skipped);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, skipped);
 
-	rw_region[0].start_addr = 0;
-	rw_region[0].length = 0x10000;
-	rw_region[1].start_addr = 0x40000;
-	rw_region[1].length = 0x30000;
-	rw_region[2].start_addr = 0x100000;
-	rw_region[2].length = 0x10000;
-	rw_region[3].start_addr = 0x500000;
-	rw_region[3].length = 0x100000;
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_ERASE;
-	rw_prop[2].on_failure = PFM_RW_RESTORE;
-	rw_prop[3].on_failure = PFM_RW_RESERVED;
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 4;
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_read_write_data_differential_test_restore_flash_no_source_device (CuTest *test)
+{
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x1100;
+
+	rw_prop.on_failure = PFM_RW_RESTORE;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	status = host_fw_restore_read_write_data_differential (&flash2, NULL, &rw_list, &skipped);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, skipped);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -11974,10 +13427,10 @@ static void host_fw_restore_read_write_data_test_multiple_regions (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_null (CuTest *test)
+static void host_fw_restore_read_write_data_differential_test_multiple_regions (CuTest *test)
 {
-	struct flash_region rw_region;
-	struct pfm_read_write rw_prop;
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
@@ -11986,9 +13439,16 @@ static void host_fw_restore_read_write_data_test_null (CuTest *test)
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
+	uint8_t data[0x1100];
+	size_t skipped;
+	size_t i;
 
 	TEST_START;
 
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
 	status = flash_master_mock_init (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
@@ -12007,20 +13467,36 @@ static void host_fw_restore_read_write_data_test_null (CuTest *test)
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	status = flash_master_mock_expect_blank_check (&flash_mock2, 0x10000, 0x1000);
+	status |= flash_master_mock_expect_value_check (&flash_mock2, 0x11000,
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0x11000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x11000, 0x1000);
+	status |= flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0x30000, 0x30000,
+		data, NULL, 0x1000);
+	status |= flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0x31000, 0x31000,
+		&data[0x1000], NULL, 0x100);
 
-	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+	CuAssertIntEquals (test, 0, status);
 
-	rw_list.regions = &rw_region;
-	rw_list.properties = &rw_prop;
-	rw_list.count = 1;
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = 0x2000;
+	rw_region[1].start_addr = 0x20000;
+	rw_region[1].length = 0x10000;
+	rw_region[2].start_addr = 0x30000;
+	rw_region[2].length = 0x1100;
 
-	status = host_fw_restore_read_write_data (NULL, &flash1, &rw_list);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	rw_prop[0].on_failure = PFM_RW_ERASE;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_RESTORE;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, NULL);
-	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	rw_list.regions = rw_region;
+	rw_list.properties = rw_prop;
+	rw_list.count = 3;
+
+	status = host_fw_restore_read_write_data_differential (&flash2, &flash1, &rw_list, &skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 3, skipped);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -12032,7 +13508,7 @@ static void host_fw_restore_read_write_data_test_null (CuTest *test)
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_erase_flash_error (CuTest *test)
+static void host_fw_restore_read_write_data_differential_test_null (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -12044,6 +13520,7 @@ static void host_fw_restore_read_write_data_test_erase_flash_error (CuTest *test
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
+	size_t skipped;
 
 	TEST_START;
 
@@ -12065,21 +13542,22 @@ static void host_fw_restore_read_write_data_test_erase_flash_error (CuTest *test
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_STATUS_REG);
-	CuAssertIntEquals (test, 0, status);
-
 	rw_region.start_addr = 0x10000;
 	rw_region.length = 0x10000;
 
-	rw_prop.on_failure = PFM_RW_ERASE;
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
 
 	rw_list.regions = &rw_region;
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	skipped = 5;
+	status = host_fw_restore_read_write_data_differential (NULL, &flash1, &rw_list, &skipped);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, skipped);
+
+	status = host_fw_restore_read_write_data_differential (&flash2, &flash1, NULL, &skipped);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -12091,7 +13569,7 @@ static void host_fw_restore_read_write_data_test_erase_flash_error (CuTest *test
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_restore_flash_error (CuTest *test)
+static void host_fw_restore_read_write_data_differential_test_erase_flash_error (CuTest *test)
 {
 	struct flash_region rw_region;
 	struct pfm_read_write rw_prop;
@@ -12103,6 +13581,7 @@ static void host_fw_restore_read_write_data_test_restore_flash_error (CuTest *te
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
+	size_t skipped;
 
 	TEST_START;
 
@@ -12124,21 +13603,26 @@ static void host_fw_restore_read_write_data_test_restore_flash_error (CuTest *te
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+	status = flash_master_mock_expect_blank_check (&flash_mock2, 0x10000, 0x1000);
+	status |= flash_master_mock_expect_value_check (&flash_mock2, 0x11000,
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
 		FLASH_EXP_READ_STATUS_REG);
+
 	CuAssertIntEquals (test, 0, status);
 
 	rw_region.start_addr = 0x10000;
-	rw_region.length = 0x10000;
+	rw_region.length = 0x2000;
 
-	rw_prop.on_failure = PFM_RW_RESTORE;
+	rw_prop.on_failure = PFM_RW_ERASE;
 
 	rw_list.regions = &rw_region;
 	rw_list.properties = &rw_prop;
 	rw_list.count = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	status = host_fw_restore_read_write_data_differential (&flash2, &flash1, &rw_list, &skipped);
 	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, skipped);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -12150,10 +13634,10 @@ static void host_fw_restore_read_write_data_test_restore_flash_error (CuTest *te
 	spi_flash_release (&flash2);
 }
 
-static void host_fw_restore_read_write_data_test_multiple_regions_error (CuTest *test)
+static void host_fw_restore_read_write_data_differential_test_restore_flash_error (CuTest *test)
 {
-	struct flash_region rw_region[4];
-	struct pfm_read_write rw_prop[4];
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
 	struct pfm_read_write_regions rw_list;
 	struct flash_master_mock flash_mock1;
 	struct spi_flash_state state1;
@@ -12162,9 +13646,19 @@ static void host_fw_restore_read_write_data_test_multiple_regions_error (CuTest
 	struct spi_flash_state state2;
 	struct spi_flash flash2;
 	int status;
+	uint8_t data[0x1100];
+	uint8_t bad[0x100];
+	size_t skipped;
+	size_t i;
 
 	TEST_START;
 
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
+	memset (bad, 0x55, sizeof (bad));
+
 	status = flash_master_mock_init (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
 
@@ -12183,30 +13677,29 @@ static void host_fw_restore_read_write_data_test_multiple_regions_error (CuTest
 	status = spi_flash_set_device_size (&flash2, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&flash_mock2, FLASH_MASTER_XFER_FAILED,
+	status = flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0x10000, 0x10000,
+		data, NULL, 0x1000);
+	status |= flash_master_mock_expect_verify_copy (&flash_mock2, &flash_mock1, 0x11000, 0x11000,
+		bad, &data[0x1000], 0x100);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0x11000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x11000, 0x100);
+	status |= flash_master_mock_expect_xfer (&flash_mock1, FLASH_MASTER_XFER_FAILED,
 		FLASH_EXP_READ_STATUS_REG);
+
 	CuAssertIntEquals (test, 0, status);
 
-	rw_region[0].start_addr = 0;
-	rw_region[0].length = 0x10000;
-	rw_region[1].start_addr = 0x40000;
-	rw_region[1].length = 0x30000;
-	rw_region[2].start_addr = 0x100000;
-	rw_region[2].length = 0x10000;
-	rw_region[3].start_addr = 0x500000;
-	rw_region[3].length = 0x100000;
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x1100;
 
-	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
-	rw_prop[1].on_failure = PFM_RW_ERASE;
-	rw_prop[2].on_failure = PFM_RW_RESTORE;
-	rw_prop[3].on_failure = PFM_RW_RESERVED;
+	rw_prop.on_failure = PFM_RW_RESTORE;
 
-	rw_list.regions = rw_region;
-	rw_list.properties = rw_prop;
-	rw_list.count = 4;
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
 
-	status = host_fw_restore_read_write_data (&flash2, &flash1, &rw_list);
+	status = host_fw_restore_read_write_data_differential (&flash2, &flash1, &rw_list, &skipped);
 	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, skipped);
 
 	status = flash_master_mock_validate_and_release (&flash_mock1);
 	CuAssertIntEquals (test, 0, status);
@@ -14212,6 +15705,207 @@ static void host_fw_restore_read_write_data_multiple_fw_test_error (CuTest *test
 	spi_flash_release (&flash2);
 }
 
+static void host_fw_restore_read_write_data_multiple_fw_differential_test (CuTest *test)
+{
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_blank_check (&flash_mock2, 0x10000, 0x1000);
+	status |= flash_master_mock_expect_value_check (&flash_mock2, 0x11000,
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0x11000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x11000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x2000;
+
+	rw_prop.on_failure = PFM_RW_ERASE;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = host_fw_restore_read_write_data_multiple_fw_differential (&flash2, &flash1, &rw_list, 1, &skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, skipped);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_read_write_data_multiple_fw_differential_test_multiple (CuTest *test)
+{
+	struct flash_region rw_region[2];
+	struct pfm_read_write rw_prop[2];
+	struct pfm_read_write_regions rw_list[2];
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_blank_check (&flash_mock2, 0x10000, 0x1000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x11000, 0x1000);
+	status |= flash_master_mock_expect_value_check (&flash_mock2, 0x30000,
+		FLASH_VERIFICATION_BLOCK, 0);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock2, 0x30000);
+	status |= flash_master_mock_expect_blank_check (&flash_mock2, 0x30000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = 0x2000;
+	rw_region[1].start_addr = 0x30000;
+	rw_region[1].length = 0x1000;
+
+	rw_prop[0].on_failure = PFM_RW_ERASE;
+	rw_prop[1].on_failure = PFM_RW_ERASE;
+
+	rw_list[0].regions = &rw_region[0];
+	rw_list[0].properties = &rw_prop[0];
+	rw_list[0].count = 1;
+
+	rw_list[1].regions = &rw_region[1];
+	rw_list[1].properties = &rw_prop[1];
+	rw_list[1].count = 1;
+
+	status = host_fw_restore_read_write_data_multiple_fw_differential (&flash2, &flash1, rw_list, 2, &skipped);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, skipped);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
+static void host_fw_restore_read_write_data_multiple_fw_differential_test_null (CuTest *test)
+{
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct flash_master_mock flash_mock1;
+	struct spi_flash_state state1;
+	struct spi_flash flash1;
+	struct flash_master_mock flash_mock2;
+	struct spi_flash_state state2;
+	struct spi_flash flash2;
+	int status;
+	size_t skipped;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash1, &state1, &flash_mock1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash2, &state2, &flash_mock2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash1, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash2, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region.start_addr = 0x10000;
+	rw_region.length = 0x10000;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	skipped = 5;
+	status = host_fw_restore_read_write_data_multiple_fw_differential (NULL, &flash1, &rw_list, 1,
+		&skipped);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, skipped);
+
+	status = host_fw_restore_read_write_data_multiple_fw_differential (&flash2, &flash1, NULL, 1,
+		&skipped);
+	CuAssertIntEquals (test, HOST_FW_UTIL_INVALID_ARGUMENT, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock2);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash1);
+	spi_flash_release (&flash2);
+}
+
 static void host_fw_config_spi_filter_read_write_regions_multiple_fw_test (CuTest *test)
 {
 	struct spi_filter_interface_mock filter;
@@ -15487,6 +17181,17 @@ TEST (host_fw_restore_flash_device_test_erase_error);
 TEST (host_fw_restore_flash_device_test_last_erase_error);
 TEST (host_fw_restore_flash_device_test_copy_error);
 TEST (host_fw_restore_flash_device_test_hashes_copy_error);
+TEST (host_fw_restore_flash_device_differential_test);
+TEST (host_fw_restore_flash_device_differential_test_image_mismatch);
+TEST (host_fw_restore_flash_device_differential_test_not_blank);
+TEST (host_fw_restore_flash_device_differential_test_image_across_sectors);
+TEST (host_fw_restore_flash_device_differential_test_hashes);
+TEST (host_fw_restore_flash_device_differential_test_null_skipped);
+TEST (host_fw_restore_flash_device_differential_test_null);
+TEST (host_fw_restore_flash_device_differential_test_check_error);
+TEST (host_fw_restore_flash_device_differential_test_erase_error);
+TEST (host_fw_restore_flash_device_differential_test_copy_error);
+TEST (host_fw_restore_flash_device_differential_test_last_region_error);
 TEST (host_fw_config_spi_filter_read_write_regions_test);
 TEST (host_fw_config_spi_filter_read_write_regions_test_multiple_regions);
 TEST (host_fw_config_spi_filter_read_write_regions_test_null);
@@ -15543,6 +17248,14 @@ TEST (host_fw_restore_read_write_data_test_null);
 TEST (host_fw_restore_read_write_data_test_erase_flash_error);
 TEST (host_fw_restore_read_write_data_test_restore_flash_error);
 TEST (host_fw_restore_read_write_data_test_multiple_regions_error);
+TEST (host_fw_restore_read_write_data_differential_test_do_nothing);
+TEST (host_fw_restore_read_write_data_differential_test_erase_flash);
+TEST (host_fw_restore_read_write_data_differential_test_restore_flash);
+TEST (host_fw_restore_read_write_data_differential_test_restore_flash_no_source_device);
+TEST (host_fw_restore_read_write_data_differential_test_multiple_regions);
+TEST (host_fw_restore_read_write_data_differential_test_null);
+TEST (host_fw_restore_read_write_data_differential_test_erase_flash_error);
+TEST (host_fw_restore_read_write_data_differential_test_restore_flash_error);
 TEST (host_fw_verify_images_multiple_fw_test);
 TEST (host_fw_verify_images_multiple_fw_test_invalid);
 TEST (host_fw_verify_images_multiple_fw_test_multiple);
@@ -15569,6 +17282,9 @@ TEST (host_fw_restore_read_write_data_multiple_fw_test_no_source_device);
 TEST (host_fw_restore_read_write_data_multiple_fw_test_multiple);
 TEST (host_fw_restore_read_write_data_multiple_fw_test_null);
 TEST (host_fw_restore_read_write_data_multiple_fw_test_error);
+TEST (host_fw_restore_read_write_data_multiple_fw_differential_test);
+TEST (host_fw_restore_read_write_data_multiple_fw_differential_test_multiple);
+TEST (host_fw_restore_read_write_data_multiple_fw_differential_test_null);
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test);
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_multiple_regions);
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_multiple_fw);
@@ -0,0 +1,535 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "logging/debug_log_compact.h"
+
+
+TEST_SUITE_LABEL ("debug_log_compact");
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void debug_log_compact_test_encode (CuTest *test)
+{
+	struct debug_log_entry_info entry = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = 1,
+		.component = 2,
+		.msg_index = 3,
+		.arg1 = 4,
+		.arg2 = 0x7f,
+		.time = 0
+	};
+	uint8_t expected[] = {DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3, 4, 0x7f, 0};
+	uint8_t buffer[DEBUG_LOG_COMPACT_MAX_LENGTH];
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_encode (&entry, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, sizeof (expected), status);
+
+	status = testing_validate_array (expected, buffer, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void debug_log_compact_test_encode_multi_byte_values (CuTest *test)
+{
+	struct debug_log_entry_info entry = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = 0,
+		.component = DEBUG_LOG_COMPONENT_DEVICE_SPECIFIC,
+		.msg_index = 0xff,
+		.arg1 = 0x80,
+		.arg2 = 0x12345678,
+		.time = 1000000
+	};
+	uint8_t expected[] = {
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 0, 0xf0, 0xff,
+		0x80, 0x01,
+		0xf8, 0xac, 0xd1, 0x91, 0x01,
+		0xc0, 0x84, 0x3d
+	};
+	uint8_t buffer[DEBUG_LOG_COMPACT_MAX_LENGTH];
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_encode (&entry, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, sizeof (expected), status);
+
+	status = testing_validate_array (expected, buffer, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void debug_log_compact_test_encode_max_values (CuTest *test)
+{
+	struct debug_log_entry_info entry = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = 2,
+		.component = 0xff,
+		.msg_index = 0xff,
+		.arg1 = 0xffffffff,
+		.arg2 = 0xffffffff,
+		.time = 0xffffffffffffffffULL
+	};
+	uint8_t expected[] = {
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 2, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x0f,
+		0xff, 0xff, 0xff, 0xff, 0x0f,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01
+	};
+	uint8_t buffer[DEBUG_LOG_COMPACT_MAX_LENGTH];
+	int status;
+
+	TEST_START;
+
+	CuAssertIntEquals (test, DEBUG_LOG_COMPACT_MAX_LENGTH, sizeof (expected));
+
+	status = debug_log_compact_encode (&entry, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, sizeof (expected), status);
+
+	status = testing_validate_array (expected, buffer, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void debug_log_compact_test_encode_null (CuTest *test)
+{
+	struct debug_log_entry_info entry;
+	uint8_t buffer[DEBUG_LOG_COMPACT_MAX_LENGTH];
+	int status;
+
+	TEST_START;
+
+	memset (&entry, 0, sizeof (entry));
+
+	status = debug_log_compact_encode (NULL, buffer, sizeof (buffer));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = debug_log_compact_encode (&entry, NULL, sizeof (buffer));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+}
+
+static void debug_log_compact_test_encode_buffer_too_small (CuTest *test)
+{
+	struct debug_log_entry_info entry = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = 1,
+		.component = 2,
+		.msg_index = 3,
+		.arg1 = 0x80,
+		.arg2 = 5,
+		.time = 6
+	};
+	uint8_t buffer[DEBUG_LOG_COMPACT_MAX_LENGTH];
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_encode (&entry, buffer, 7);
+	CuAssertIntEquals (test, LOGGING_ENTRY_BUFFER_TOO_SMALL, status);
+}
+
+static void debug_log_compact_test_decode (CuTest *test)
+{
+	uint8_t data[] = {
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3,
+		0x80, 0x01,
+		0xf8, 0xac, 0xd1, 0x91, 0x01,
+		0xc0, 0x84, 0x3d
+	};
+	struct debug_log_entry_info entry;
+	int status;
+
+	TEST_START;
+
+	memset (&entry, 0x55, sizeof (entry));
+
+	status = debug_log_compact_decode (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	CuAssertIntEquals (test, DEBUG_LOG_ENTRY_FORMAT, entry.format);
+	CuAssertIntEquals (test, 1, entry.severity);
+	CuAssertIntEquals (test, 2, entry.component);
+	CuAssertIntEquals (test, 3, entry.msg_index);
+	CuAssertIntEquals (test, 0x80, entry.arg1);
+	CuAssertIntEquals (test, 0x12345678, entry.arg2);
+	CuAssertInt64Equals (test, 1000000, entry.time);
+}
+
+static void debug_log_compact_test_decode_extra_data (CuTest *test)
+{
+	uint8_t data[] = {DEBUG_LOG_ENTRY_FORMAT_COMPACT, 0, 1, 2, 3, 4, 5, 0xaa, 0xbb};
+	struct debug_log_entry_info entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_decode (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, sizeof (data) - 2, status);
+
+	CuAssertIntEquals (test, DEBUG_LOG_ENTRY_FORMAT, entry.format);
+	CuAssertIntEquals (test, 0, entry.severity);
+	CuAssertIntEquals (test, 1, entry.component);
+	CuAssertIntEquals (test, 2, entry.msg_index);
+	CuAssertIntEquals (test, 3, entry.arg1);
+	CuAssertIntEquals (test, 4, entry.arg2);
+	CuAssertInt64Equals (test, 5, entry.time);
+}
+
+static void debug_log_compact_test_decode_max_values (CuTest *test)
+{
+	uint8_t data[] = {
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 2, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x0f,
+		0xff, 0xff, 0xff, 0xff, 0x0f,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01
+	};
+	struct debug_log_entry_info entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_decode (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	CuAssertIntEquals (test, 0xffffffff, entry.arg1);
+	CuAssertIntEquals (test, 0xffffffff, entry.arg2);
+	CuAssertTrue (test, (entry.time == 0xffffffffffffffffULL));
+}
+
+static void debug_log_compact_test_encode_decode (CuTest *test)
+{
+	struct debug_log_entry_info entry = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_WARNING,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = 0x21,
+		.arg1 = 0x3fff,
+		.arg2 = 0x4000,
+		.time = 0x123456789aULL
+	};
+	struct debug_log_entry_info decoded;
+	uint8_t buffer[DEBUG_LOG_COMPACT_MAX_LENGTH];
+	int length;
+	int status;
+
+	TEST_START;
+
+	length = debug_log_compact_encode (&entry, buffer, sizeof (buffer));
+	CuAssertTrue (test, !ROT_IS_ERROR (length));
+
+	status = debug_log_compact_decode (buffer, length, &decoded);
+	CuAssertIntEquals (test, length, status);
+
+	status = testing_validate_array ((uint8_t*) &entry, (uint8_t*) &decoded, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void debug_log_compact_test_decode_null (CuTest *test)
+{
+	uint8_t data[] = {DEBUG_LOG_ENTRY_FORMAT_COMPACT, 0, 1, 2, 3, 4, 5};
+	struct debug_log_entry_info entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_decode (NULL, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = debug_log_compact_decode (data, sizeof (data), NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+}
+
+static void debug_log_compact_test_decode_unsupported_format (CuTest *test)
+{
+	uint8_t data[] = {DEBUG_LOG_ENTRY_FORMAT, 0, 1, 2, 3, 4, 5};
+	struct debug_log_entry_info entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_decode (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_UNSUPPORTED_ENTRY_FORMAT, status);
+}
+
+static void debug_log_compact_test_decode_truncated (CuTest *test)
+{
+	uint8_t data[] = {
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3,
+		0x80, 0x01,
+		0xf8, 0xac, 0xd1, 0x91, 0x01,
+		0xc0, 0x84, 0x3d
+	};
+	struct debug_log_entry_info entry;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (data); i++) {
+		status = debug_log_compact_decode (data, i, &entry);
+		CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+	}
+}
+
+static void debug_log_compact_test_decode_arg_too_large (CuTest *test)
+{
+	uint8_t arg1[] = {
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3,
+		0xff, 0xff, 0xff, 0xff, 0x1f,
+		0, 0
+	};
+	uint8_t arg2[] = {
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3,
+		0,
+		0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+		0
+	};
+	struct debug_log_entry_info entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_decode (arg1, sizeof (arg1), &entry);
+	CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+
+	status = debug_log_compact_decode (arg2, sizeof (arg2), &entry);
+	CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+}
+
+static void debug_log_compact_test_decode_time_too_large (CuTest *test)
+{
+	uint8_t data[] = {
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3, 0, 0,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03
+	};
+	struct debug_log_entry_info entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_decode (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+}
+
+static void debug_log_compact_test_expand_entry (CuTest *test)
+{
+	uint8_t data[] = {
+		0xcb, 0x0e, 0x00, 0x78, 0x56, 0x34, 0x12,
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3, 4, 5, 6
+	};
+	struct debug_log_entry entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_expand_entry (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	CuAssertIntEquals (test, 0xcb, entry.header.log_magic);
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry), entry.header.length);
+	CuAssertIntEquals (test, 0x12345678, entry.header.entry_id);
+	CuAssertIntEquals (test, DEBUG_LOG_ENTRY_FORMAT, entry.entry.format);
+	CuAssertIntEquals (test, 1, entry.entry.severity);
+	CuAssertIntEquals (test, 2, entry.entry.component);
+	CuAssertIntEquals (test, 3, entry.entry.msg_index);
+	CuAssertIntEquals (test, 4, entry.entry.arg1);
+	CuAssertIntEquals (test, 5, entry.entry.arg2);
+	CuAssertInt64Equals (test, 6, entry.entry.time);
+}
+
+static void debug_log_compact_test_expand_entry_standard_format (CuTest *test)
+{
+	struct debug_log_entry data = {
+		.header = {
+			.log_magic = 0xcb,
+			.length = sizeof (struct debug_log_entry),
+			.entry_id = 10
+		},
+		.entry = {
+			.format = DEBUG_LOG_ENTRY_FORMAT,
+			.severity = 1,
+			.component = 2,
+			.msg_index = 3,
+			.arg1 = 4,
+			.arg2 = 5,
+			.time = 6
+		}
+	};
+	struct debug_log_entry entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_expand_entry ((uint8_t*) &data, sizeof (data), &entry);
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = testing_validate_array ((uint8_t*) &data, (uint8_t*) &entry, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void debug_log_compact_test_expand_entry_multiple_entries (CuTest *test)
+{
+	uint8_t data[] = {
+		0xcb, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x00,
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3, 4, 5, 6,
+		0xcb, 0x0f, 0x00, 0x02, 0x00, 0x00, 0x00,
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 0, 4, 5, 0x80, 0x01, 7, 8
+	};
+	struct debug_log_entry entry;
+	int offset;
+	int status;
+
+	TEST_START;
+
+	offset = debug_log_compact_expand_entry (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, 14, offset);
+
+	CuAssertIntEquals (test, 1, entry.header.entry_id);
+	CuAssertIntEquals (test, 4, entry.entry.arg1);
+
+	status = debug_log_compact_expand_entry (&data[offset], sizeof (data) - offset, &entry);
+	CuAssertIntEquals (test, 15, status);
+
+	CuAssertIntEquals (test, 2, entry.header.entry_id);
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry), entry.header.length);
+	CuAssertIntEquals (test, 0, entry.entry.severity);
+	CuAssertIntEquals (test, 4, entry.entry.component);
+	CuAssertIntEquals (test, 5, entry.entry.msg_index);
+	CuAssertIntEquals (test, 0x80, entry.entry.arg1);
+	CuAssertIntEquals (test, 7, entry.entry.arg2);
+	CuAssertInt64Equals (test, 8, entry.entry.time);
+}
+
+static void debug_log_compact_test_expand_entry_null (CuTest *test)
+{
+	uint8_t data[] = {
+		0xcb, 0x0e, 0x00, 0x78, 0x56, 0x34, 0x12,
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3, 4, 5, 6
+	};
+	struct debug_log_entry entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_expand_entry (NULL, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = debug_log_compact_expand_entry (data, sizeof (data), NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+}
+
+static void debug_log_compact_test_expand_entry_bad_header (CuTest *test)
+{
+	uint8_t data[] = {
+		0x00, 0x0e, 0x00, 0x78, 0x56, 0x34, 0x12,
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3, 4, 5, 6
+	};
+	struct debug_log_entry entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_expand_entry (data, sizeof (struct logging_entry_header) - 1,
+		&entry);
+	CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+
+	status = debug_log_compact_expand_entry (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_UNSUPPORTED_ENTRY_FORMAT, status);
+
+	data[0] = 0xcb;
+	data[1] = 0x06;
+	status = debug_log_compact_expand_entry (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+
+	data[1] = 0x0f;
+	status = debug_log_compact_expand_entry (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+}
+
+static void debug_log_compact_test_expand_entry_length_mismatch (CuTest *test)
+{
+	uint8_t data[] = {
+		0xcb, 0x0f, 0x00, 0x78, 0x56, 0x34, 0x12,
+		DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3, 4, 5, 6, 7
+	};
+	struct debug_log_entry entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_expand_entry (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+
+	data[1] = 0x0d;
+	status = debug_log_compact_expand_entry (data, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_MALFORMED_ENTRY, status);
+}
+
+static void debug_log_compact_test_expand_entry_unsupported_format (CuTest *test)
+{
+	struct debug_log_entry data = {
+		.header = {
+			.log_magic = 0xcb,
+			.length = sizeof (struct debug_log_entry),
+			.entry_id = 10
+		},
+		.entry = {
+			.format = 3,
+			.severity = 1,
+			.component = 2,
+			.msg_index = 3,
+			.arg1 = 4,
+			.arg2 = 5,
+			.time = 6
+		}
+	};
+	uint8_t short_entry[] = {
+		0xcb, 0x0c, 0x00, 0x78, 0x56, 0x34, 0x12,
+		DEBUG_LOG_ENTRY_FORMAT, 0, 1, 2, 3
+	};
+	struct debug_log_entry entry;
+	int status;
+
+	TEST_START;
+
+	status = debug_log_compact_expand_entry ((uint8_t*) &data, sizeof (data), &entry);
+	CuAssertIntEquals (test, LOGGING_UNSUPPORTED_ENTRY_FORMAT, status);
+
+	status = debug_log_compact_expand_entry (short_entry, sizeof (short_entry), &entry);
+	CuAssertIntEquals (test, LOGGING_UNSUPPORTED_ENTRY_FORMAT, status);
+}
+
+
+TEST_SUITE_START (debug_log_compact);
+
+TEST (debug_log_compact_test_encode);
+TEST (debug_log_compact_test_encode_multi_byte_values);
+TEST (debug_log_compact_test_encode_max_values);
+TEST (debug_log_compact_test_encode_null);
+TEST (debug_log_compact_test_encode_buffer_too_small);
+TEST (debug_log_compact_test_decode);
+TEST (debug_log_compact_test_decode_extra_data);
+TEST (debug_log_compact_test_decode_max_values);
+TEST (debug_log_compact_test_encode_decode);
+TEST (debug_log_compact_test_decode_null);
+TEST (debug_log_compact_test_decode_unsupported_format);
+TEST (debug_log_compact_test_decode_truncated);
+TEST (debug_log_compact_test_decode_arg_too_large);
+TEST (debug_log_compact_test_decode_time_too_large);
+TEST (debug_log_compact_test_expand_entry);
+TEST (debug_log_compact_test_expand_entry_standard_format);
+TEST (debug_log_compact_test_expand_entry_multiple_entries);
+TEST (debug_log_compact_test_expand_entry_null);
+TEST (debug_log_compact_test_expand_entry_bad_header);
+TEST (debug_log_compact_test_expand_entry_length_mismatch);
+TEST (debug_log_compact_test_expand_entry_unsupported_format);
+
+TEST_SUITE_END;
@@ -8,6 +8,8 @@
 #include "platform_api.h"
 #include "testing.h"
 #include "logging/debug_log.h"
+#include "logging/debug_log_compact.h"
+#include "logging/logging_memory.h"
 #include "testing/mock/logging/logging_mock.h"
 #include "testing/logging/debug_log_testing.h"
 
@@ -61,6 +63,7 @@ static void debug_log_testing_suite_tear_down (CuTest *test)
  * Test cases
  *******************/
 
+#ifndef LOGGING_DEBUG_LOG_COMPACT_ENTRIES
 static void debug_log_test_create_entry (CuTest *test)
 {
 	struct logging_mock logger;
@@ -88,6 +91,69 @@ static void debug_log_test_create_entry (CuTest *test)
 
 	complete_debug_log_mock_test (test, &logger);
 }
+#else
+static void debug_log_test_create_entry_compact (CuTest *test)
+{
+	struct logging_mock logger;
+	uint8_t entry[] = {DEBUG_LOG_ENTRY_FORMAT_COMPACT, 1, 2, 3, 0x84, 0x01, 5};
+	int status;
+
+	TEST_START;
+
+	setup_debug_log_mock_test (test, &logger);
+
+	status = mock_expect (&logger.mock, logger.base.create_entry, &logger, 0,
+		MOCK_ARG_PTR_CONTAINS (entry, sizeof (entry)), MOCK_ARG_ANY);
+	CuAssertIntEquals (test, 0, status);
+
+	status = debug_log_create_entry (1, 2, 3, 0x84, 5);
+	CuAssertIntEquals (test, 0, status);
+
+	complete_debug_log_mock_test (test, &logger);
+}
+
+static void debug_log_test_create_entry_compact_bad_entry_length (CuTest *test)
+{
+	struct logging_mock logger;
+	int status;
+
+	TEST_START;
+
+	setup_debug_log_mock_test (test, &logger);
+
+	status = mock_expect (&logger.mock, logger.base.create_entry, &logger,
+		LOGGING_BAD_ENTRY_LENGTH, MOCK_ARG_NOT_NULL, MOCK_ARG_ANY);
+	CuAssertIntEquals (test, 0, status);
+
+	status = debug_log_create_entry (1, 2, 3, 4, 5);
+	CuAssertIntEquals (test, LOGGING_UNSUPPORTED_ENTRY_FORMAT, status);
+
+	complete_debug_log_mock_test (test, &logger);
+}
+
+static void debug_log_test_create_entry_compact_memory_log (CuTest *test)
+{
+	struct logging_memory logger;
+	struct logging_memory_state state;
+	int status;
+
+	TEST_START;
+
+	status = logging_memory_init (&logger, &state, 4, sizeof (struct debug_log_entry_info));
+	CuAssertIntEquals (test, 0, status);
+
+	debug_log = &logger.base;
+
+	status = debug_log_create_entry (1, 2, 3, 4, 5);
+	CuAssertIntEquals (test, LOGGING_UNSUPPORTED_ENTRY_FORMAT, status);
+
+	status = debug_log_get_size ();
+	CuAssertIntEquals (test, 0, status);
+
+	debug_log = NULL;
+	logging_memory_release (&logger);
+}
+#endif
 
 static void debug_log_test_create_entry_no_log (CuTest *test)
 {
@@ -239,10 +305,73 @@ static void debug_log_test_read_contents_no_log (CuTest *test)
 	CuAssertIntEquals (test, LOGGING_NO_LOG_AVAILABLE, status);
 }
 
+static void debug_log_test_get_entry_offset (CuTest *test)
+{
+	struct logging_mock logger;
+	int status;
+
+	TEST_START;
+
+	setup_debug_log_mock_test (test, &logger);
+
+	status = mock_expect (&logger.mock, logger.base.get_entry_offset, &logger, 32, MOCK_ARG (5));
+	CuAssertIntEquals (test, 0, status);
+
+	status = debug_log_get_entry_offset (5);
+	CuAssertIntEquals (test, 32, status);
+
+	complete_debug_log_mock_test (test, &logger);
+}
+
+static void debug_log_test_get_entry_offset_no_log (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	debug_log = NULL;
+
+	status = debug_log_get_entry_offset (5);
+	CuAssertIntEquals (test, LOGGING_NO_LOG_AVAILABLE, status);
+}
+
+
+#ifndef LOGGING_DEBUG_LOG_COMPACT_ENTRIES
+static void debug_log_test_get_entry_length (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry), debug_log_get_entry_length (0, 0));
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry),
+		debug_log_get_entry_length (0xffffffff, 0xffffffff));
+}
+#else
+static void debug_log_test_get_entry_length_compact (CuTest *test)
+{
+	size_t min_len = sizeof (struct logging_entry_header) + 4 + 1 + 1 + 1;
+	size_t length;
+
+	TEST_START;
+
+	length = debug_log_get_entry_length (0, 0);
+	CuAssertTrue (test, (length >= min_len));
+	CuAssertTrue (test, (length <= (min_len + 9)));
+
+	/* Each argument needs 4 extra bytes to encode the maximum value. */
+	CuAssertIntEquals (test, length + 8, debug_log_get_entry_length (0xffffffff, 0xffffffff));
+}
+#endif
+
 
 TEST_SUITE_START (debug_log);
 
+#ifndef LOGGING_DEBUG_LOG_COMPACT_ENTRIES
 TEST (debug_log_test_create_entry);
+#else
+TEST (debug_log_test_create_entry_compact);
+TEST (debug_log_test_create_entry_compact_bad_entry_length);
+TEST (debug_log_test_create_entry_compact_memory_log);
+#endif
 TEST (debug_log_test_create_entry_no_log);
 TEST (debug_log_test_create_entry_invalid_severity);
 TEST (debug_log_test_flush);
@@ -253,6 +382,13 @@ TEST (debug_log_test_get_size);
 TEST (debug_log_test_get_size_no_log);
 TEST (debug_log_test_read_contents);
 TEST (debug_log_test_read_contents_no_log);
+TEST (debug_log_test_get_entry_offset);
+TEST (debug_log_test_get_entry_offset_no_log);
+#ifndef LOGGING_DEBUG_LOG_COMPACT_ENTRIES
+TEST (debug_log_test_get_entry_length);
+#else
+TEST (debug_log_test_get_entry_length_compact);
+#endif
 
 /* Tear down after the tests in this suite have run. */
 TEST (debug_log_testing_suite_tear_down);
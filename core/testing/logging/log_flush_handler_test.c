@@ -8,6 +8,7 @@
 #include "platform_api.h"
 #include "logging/log_flush_handler.h"
 #include "logging/log_flush_handler_static.h"
+#include "logging/logging_staging.h"
 #include "testing/mock/logging/logging_mock.h"
 
 
@@ -21,6 +22,12 @@ struct log_flush_handler_testing {
 	struct logging_mock log1;				/**< Log for testing. */
 	struct logging_mock log2;				/**< Log for testing. */
 	struct logging_mock log3;				/**< Log for testing. */
+	struct logging_staging_state staging1_state;	/**< Context for the first staging log. */
+	struct logging_staging staging1;		/**< Staging log for testing. */
+	uint8_t ring1[64];						/**< Buffer for the first staging log. */
+	struct logging_staging_state staging2_state;	/**< Context for the second staging log. */
+	struct logging_staging staging2;		/**< Staging log for testing. */
+	uint8_t ring2[64];						/**< Buffer for the second staging log. */
 	struct log_flush_handler_state state;	/**< Context for the test being tested. */
 	struct log_flush_handler test;			/**< Log flush task for testing. */
 };
@@ -50,6 +57,37 @@ static void log_flush_handler_testing_init_dependencies (CuTest *test,
 	mock_set_name (&handler->log3.mock, "log3");
 }
 
+/**
+ * Initialize staging logs for testing.  Both staging logs add entries to the first log.
+ *
+ * @param test The testing framework.
+ * @param handler The testing components to initialize.
+ */
+static void log_flush_handler_testing_init_staging (CuTest *test,
+	struct log_flush_handler_testing *handler)
+{
+	int status;
+
+	status = logging_staging_init (&handler->staging1, &handler->staging1_state,
+		&handler->log1.base, handler->ring1, sizeof (handler->ring1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_init (&handler->staging2, &handler->staging2_state,
+		&handler->log1.base, handler->ring2, sizeof (handler->ring2));
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release staging logs used for testing.
+ *
+ * @param handler The testing components to release.
+ */
+static void log_flush_handler_testing_release_staging (struct log_flush_handler_testing *handler)
+{
+	logging_staging_release (&handler->staging1);
+	logging_staging_release (&handler->staging2);
+}
+
 /**
  * Initialize an instance for testing.
  *
@@ -228,6 +266,99 @@ static void log_flush_handler_test_static_init_null (CuTest *test)
 	log_flush_handler_testing_release_dependencies (test, &handler);
 }
 
+static void log_flush_handler_test_init_with_staging (CuTest *test)
+{
+	struct log_flush_handler_testing handler;
+	const struct logging_staging *staging_list[] = {&handler.staging1, &handler.staging2};
+	const size_t staging_count = sizeof (staging_list) / sizeof (staging_list[0]);
+	const struct logging *log_list[] = {&handler.log1.base};
+	const size_t log_count = sizeof (log_list) / sizeof (log_list[0]);
+	int status;
+
+	TEST_START;
+
+	log_flush_handler_testing_init_dependencies (test, &handler);
+	log_flush_handler_testing_init_staging (test, &handler);
+
+	status = log_flush_handler_init_with_staging (&handler.test, &handler.state, staging_list,
+		staging_count, log_list, log_count, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, handler.test.base.prepare);
+	CuAssertPtrNotNull (test, handler.test.base.get_next_execution);
+	CuAssertPtrNotNull (test, handler.test.base.execute);
+
+	log_flush_handler_testing_release_staging (&handler);
+	log_flush_handler_testing_validate_and_release (test, &handler);
+}
+
+static void log_flush_handler_test_init_with_staging_null (CuTest *test)
+{
+	struct log_flush_handler_testing handler;
+	const struct logging_staging *staging_list[] = {&handler.staging1, &handler.staging2};
+	const size_t staging_count = sizeof (staging_list) / sizeof (staging_list[0]);
+	const struct logging *log_list[] = {&handler.log1.base};
+	const size_t log_count = sizeof (log_list) / sizeof (log_list[0]);
+	int status;
+
+	TEST_START;
+
+	log_flush_handler_testing_init_dependencies (test, &handler);
+
+	status = log_flush_handler_init_with_staging (NULL, &handler.state, staging_list,
+		staging_count, log_list, log_count, 100);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log_flush_handler_init_with_staging (&handler.test, NULL, staging_list,
+		staging_count, log_list, log_count, 100);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log_flush_handler_init_with_staging (&handler.test, &handler.state, NULL,
+		staging_count, log_list, log_count, 100);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log_flush_handler_init_with_staging (&handler.test, &handler.state, staging_list,
+		staging_count, NULL, log_count, 100);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log_flush_handler_init_with_staging (&handler.test, &handler.state, staging_list,
+		staging_count, log_list, 0, 100);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	log_flush_handler_testing_release_dependencies (test, &handler);
+}
+
+static void log_flush_handler_test_static_init_with_staging (CuTest *test)
+{
+	struct log_flush_handler_testing handler;
+	const struct logging_staging *staging_list[] = {&handler.staging1, &handler.staging2};
+	const size_t staging_count = sizeof (staging_list) / sizeof (staging_list[0]);
+	const struct logging *log_list[] = {&handler.log1.base};
+	const size_t log_count = sizeof (log_list) / sizeof (log_list[0]);
+	struct log_flush_handler test_static =
+		log_flush_handler_static_init_with_staging (&handler.state, staging_list, staging_count,
+		log_list, log_count, 500);
+	int status;
+
+	TEST_START;
+
+	log_flush_handler_testing_init_dependencies (test, &handler);
+
+	CuAssertPtrNotNull (test, test_static.base.prepare);
+	CuAssertPtrNotNull (test, test_static.base.get_next_execution);
+	CuAssertPtrNotNull (test, test_static.base.execute);
+
+	status = log_flush_handler_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	test_static.staging = NULL;
+	status = log_flush_handler_init_state (&test_static);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	log_flush_handler_testing_release_dependencies (test, &handler);
+	log_flush_handler_release (&test_static);
+}
+
 static void log_flush_handler_test_release_null (CuTest *test)
 {
 	TEST_START;
@@ -415,6 +546,100 @@ static void log_flush_handler_test_execute_static_init (CuTest *test)
 	log_flush_handler_release (&test_static);
 }
 
+static void log_flush_handler_test_execute_with_staging (CuTest *test)
+{
+	struct log_flush_handler_testing handler;
+	const struct logging_staging *staging_list[] = {&handler.staging1, &handler.staging2};
+	const size_t staging_count = sizeof (staging_list) / sizeof (staging_list[0]);
+	const struct logging *log_list[] = {&handler.log1.base, &handler.log2.base};
+	const size_t log_count = sizeof (log_list) / sizeof (log_list[0]);
+	uint8_t entry1[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t entry2[] = {0x11, 0x12};
+	uint8_t entry3[] = {0x21, 0x22, 0x23};
+	const platform_clock *next_time;
+	uint32_t msec;
+	int status;
+
+	TEST_START;
+
+	log_flush_handler_testing_init_dependencies (test, &handler);
+	log_flush_handler_testing_init_staging (test, &handler);
+
+	status = log_flush_handler_init_with_staging (&handler.test, &handler.state, staging_list,
+		staging_count, log_list, log_count, 1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.staging1.base.create_entry (&handler.staging1.base, entry1, sizeof (entry1));
+	status |= handler.staging2.base.create_entry (&handler.staging2.base, entry2, sizeof (entry2));
+	status |= handler.staging1.base.create_entry (&handler.staging1.base, entry3, sizeof (entry3));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Staged entries are drained before any log is flushed. */
+	status = mock_expect (&handler.log1.mock, handler.log1.base.create_entry, &handler.log1, 0,
+		MOCK_ARG_PTR_CONTAINS (entry1, sizeof (entry1)), MOCK_ARG (sizeof (entry1)));
+	status |= mock_expect (&handler.log1.mock, handler.log1.base.create_entry, &handler.log1, 0,
+		MOCK_ARG_PTR_CONTAINS (entry3, sizeof (entry3)), MOCK_ARG (sizeof (entry3)));
+	status |= mock_expect (&handler.log1.mock, handler.log1.base.create_entry, &handler.log1, 0,
+		MOCK_ARG_PTR_CONTAINS (entry2, sizeof (entry2)), MOCK_ARG (sizeof (entry2)));
+	status |= mock_expect (&handler.log1.mock, handler.log1.base.flush, &handler.log1, 0);
+	status |= mock_expect (&handler.log2.mock, handler.log2.base.flush, &handler.log2, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	/* Create initial timeout. */
+	handler.test.base.prepare (&handler.test.base);
+	platform_msleep (200);
+
+	handler.test.base.execute (&handler.test.base);
+
+	/* Check the the timeout has been updated. */
+	next_time = handler.test.base.get_next_execution (&handler.test.base);
+	CuAssertPtrNotNull (test, (void*) next_time);
+
+	status = platform_get_timeout_remaining (next_time, &msec);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (msec <= 1000));
+	CuAssertTrue (test, (msec > 950));	/* Apply reasonable bounds for testing. */
+
+	log_flush_handler_testing_release_staging (&handler);
+	log_flush_handler_testing_validate_and_release (test, &handler);
+}
+
+static void log_flush_handler_test_execute_with_staging_static_init (CuTest *test)
+{
+	struct log_flush_handler_testing handler;
+	const struct logging_staging *staging_list[] = {&handler.staging1, &handler.staging2};
+	const size_t staging_count = sizeof (staging_list) / sizeof (staging_list[0]);
+	const struct logging *log_list[] = {&handler.log1.base};
+	const size_t log_count = sizeof (log_list) / sizeof (log_list[0]);
+	struct log_flush_handler test_static =
+		log_flush_handler_static_init_with_staging (&handler.state, staging_list, staging_count,
+		log_list, log_count, 5000);
+	uint8_t entry1[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	log_flush_handler_testing_init_static (test, &handler, &test_static);
+	log_flush_handler_testing_init_staging (test, &handler);
+
+	status = handler.staging2.base.create_entry (&handler.staging2.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&handler.log1.mock, handler.log1.base.create_entry, &handler.log1, 0,
+		MOCK_ARG_PTR_CONTAINS (entry1, sizeof (entry1)), MOCK_ARG (sizeof (entry1)));
+	status |= mock_expect (&handler.log1.mock, handler.log1.base.flush, &handler.log1, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	test_static.base.prepare (&test_static.base);
+	test_static.base.execute (&test_static.base);
+
+	log_flush_handler_testing_release_staging (&handler);
+	log_flush_handler_testing_release_dependencies (test, &handler);
+	log_flush_handler_release (&test_static);
+}
+
 
 TEST_SUITE_START (log_flush_handler);
 
@@ -422,6 +647,9 @@ TEST (log_flush_handler_test_init);
 TEST (log_flush_handler_test_init_null);
 TEST (log_flush_handler_test_static_init);
 TEST (log_flush_handler_test_static_init_null);
+TEST (log_flush_handler_test_init_with_staging);
+TEST (log_flush_handler_test_init_with_staging_null);
+TEST (log_flush_handler_test_static_init_with_staging);
 TEST (log_flush_handler_test_release_null);
 TEST (log_flush_handler_test_get_next_execution);
 TEST (log_flush_handler_test_get_next_execution_no_prepare);
@@ -429,5 +657,7 @@ TEST (log_flush_handler_test_get_next_execution_static_init);
 TEST (log_flush_handler_test_execute);
 TEST (log_flush_handler_test_execute_multiple_logs);
 TEST (log_flush_handler_test_execute_static_init);
+TEST (log_flush_handler_test_execute_with_staging);
+TEST (log_flush_handler_test_execute_with_staging_static_init);
 
 TEST_SUITE_END;
@@ -68,6 +68,7 @@ static void logging_flash_test_init_empty (CuTest *test)
 	CuAssertPtrNotNull (test, logging.base.clear);
 	CuAssertPtrNotNull (test, logging.base.get_size);
 	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
 
 	status = logging.base.get_size (&logging.base);
 	CuAssertIntEquals (test, 0, status);
@@ -2505,6 +2506,105 @@ static void logging_flash_test_init_flash_read_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
+static void logging_flash_test_init_double_buffered (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	int i;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, logging.base.create_entry);
+	CuAssertPtrNotNull (test, logging.base.flush);
+	CuAssertPtrNotNull (test, logging.base.clear);
+	CuAssertPtrNotNull (test, logging.base.get_size);
+	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
+
+	CuAssertPtrEquals (test, write_buffer, logging.write_buffer);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Make sure the lock has been released. */
+	logging.base.get_size (&logging.base);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_init_double_buffered_null (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init_double_buffered (NULL, &state, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_flash_init_double_buffered (&logging, NULL, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_flash_init_double_buffered (&logging, &state, NULL, 0x10000, write_buffer);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
 static void logging_flash_test_static_init_empty (CuTest *test)
 {
 	struct flash_master_mock flash_mock;
@@ -2525,6 +2625,7 @@ static void logging_flash_test_static_init_empty (CuTest *test)
 	CuAssertPtrNotNull (test, logging.base.clear);
 	CuAssertPtrNotNull (test, logging.base.get_size);
 	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
 
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -4990,6 +5091,108 @@ static void logging_flash_test_static_init_flash_read_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
+static void logging_flash_test_static_init_double_buffered (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
+	struct logging_flash logging = logging_flash_static_init_double_buffered (&state, &flash,
+		0x10000, write_buffer);
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	uint8_t entry[entry_count + 1][entry_size];
+	uint8_t entry_data[entry_full + entry_len];
+	struct logging_entry_header *header;
+	int i;
+	uint8_t *pos;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	CuAssertPtrNotNull (test, logging.base.create_entry);
+	CuAssertPtrNotNull (test, logging.base.flush);
+	CuAssertPtrNotNull (test, logging.base.clear);
+	CuAssertPtrNotNull (test, logging.base.get_size);
+	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
+
+	pos = entry_data;
+	for (i = 0; i < entry_count + 1; ++i, pos += entry_len) {
+		header = (struct logging_entry_header*) pos;
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+
+		memset (entry[i], i, entry_size);
+		memcpy (&pos[sizeof (struct logging_entry_header)], entry[i], entry_size);
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init_state (&logging);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count + 1; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* The full buffer is handed off without waiting for flash. */
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		entry_full);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x11000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x11000, &entry_data[entry_full],
+		entry_len);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
 static void logging_flash_test_release_null (CuTest *test)
 {
 	TEST_START;
@@ -12102,21 +12305,44 @@ static void logging_flash_test_create_entry_full_buffer_flush_after_incomplete_f
 	spi_flash_release (&flash);
 }
 
-static void logging_flash_test_flush_no_data (CuTest *test)
+static void logging_flash_test_create_entry_double_buffered_full_buffer (CuTest *test)
 {
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state flash_state;
 	struct spi_flash flash;
 	struct logging_flash_state state;
 	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
 	int status;
 	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	uint8_t entry[entry_count + 1][entry_size];
+	uint8_t entry_data[entry_full + entry_len];
+	uint8_t output[entry_full + entry_len];
+	struct logging_entry_header *header;
 	int i;
+	uint8_t *pos;
 
 	TEST_START;
 
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE, entry_full);
+
 	memset (log_empty, 0xff, sizeof (log_empty));
 
+	pos = entry_data;
+	for (i = 0; i < entry_count + 1; ++i, pos += entry_len) {
+		header = (struct logging_entry_header*) pos;
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+
+		memset (entry[i], i, entry_size);
+		memcpy (&pos[sizeof (struct logging_entry_header)], entry[i], entry_size);
+	}
+
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -12135,18 +12361,51 @@ static void logging_flash_test_flush_no_data (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count + 1; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* The full buffer is handed off without waiting for flash. */
+	status = mock_validate (&flash_mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
 	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = logging.base.read_contents (&logging.base, 0, output, sizeof (output));
+	CuAssertIntEquals (test, sizeof (output), status);
+
+	status = testing_validate_array (entry_data, output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		entry_full);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x11000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x11000, &entry_data[entry_full],
+		entry_len);
+
 	CuAssertIntEquals (test, 0, status);
 
 	status = logging.base.flush (&logging.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging.base.get_size (&logging.base);
+	status = mock_validate (&flash_mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -12155,21 +12414,52 @@ static void logging_flash_test_flush_no_data (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void logging_flash_test_flush_null (CuTest *test)
+static void logging_flash_test_create_entry_double_buffered_full_buffer_terminator (CuTest *test)
 {
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state flash_state;
 	struct spi_flash flash;
 	struct logging_flash_state state;
 	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
 	int status;
 	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header) - 2;
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	uint8_t entry[entry_count + 1][entry_size];
+	uint8_t entry_data[entry_full + entry_len];
+	uint8_t flash_data[entry_full + sizeof (struct logging_entry_header)];
+	uint8_t output[entry_full + entry_len];
+	struct logging_entry_header *header;
 	int i;
+	uint8_t *pos;
 
 	TEST_START;
 
+	CuAssertTrue (test, (entry_empty >= (int) sizeof (struct logging_entry_header)));
+
 	memset (log_empty, 0xff, sizeof (log_empty));
 
+	pos = entry_data;
+	for (i = 0; i < entry_count + 1; ++i, pos += entry_len) {
+		header = (struct logging_entry_header*) pos;
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+
+		memset (entry[i], i, entry_size);
+		memcpy (&pos[sizeof (struct logging_entry_header)], entry[i], entry_size);
+	}
+
+	memcpy (flash_data, entry_data, entry_full);
+	header = (struct logging_entry_header*) &flash_data[entry_full];
+	header->log_magic = 0xCB;
+	header->length = 0x8000 | sizeof (struct logging_entry_header);
+	header->entry_id = 0;
+
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
 
@@ -12188,14 +12478,262 @@ static void logging_flash_test_flush_null (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging.base.get_size (&logging.base);
+	status = mock_validate (&flash_mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging.base.flush (NULL);
-	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+	for (i = 0; i < entry_count + 1; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The termination entry is not reported as part of the log. */
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = logging.base.read_contents (&logging.base, 0, output, sizeof (output));
+	CuAssertIntEquals (test, sizeof (output), status);
+
+	status = testing_validate_array (entry_data, output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, flash_data,
+		sizeof (flash_data));
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x11000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x11000, &entry_data[entry_full],
+		entry_len);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_create_entry_double_buffered_both_buffers_full (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	uint8_t entry[(entry_count * 2) + 1][entry_size];
+	uint8_t entry_data[(entry_full * 2) + entry_len];
+	struct logging_entry_header *header;
+	int i;
+	uint8_t *pos;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	pos = entry_data;
+	for (i = 0; i < (entry_count * 2) + 1; ++i, pos += entry_len) {
+		header = (struct logging_entry_header*) pos;
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+
+		memset (entry[i], i, entry_size);
+		memcpy (&pos[sizeof (struct logging_entry_header)], entry[i], entry_size);
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count * 2; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* With data still waiting to be written, the new entry has to wait for flash. */
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		entry_full);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x11000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x11000, &entry_data[entry_full],
+		entry_full);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x12000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x12000, &entry_data[entry_full * 2],
+		entry_len);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_flush_no_data (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	int i;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_flush_null (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	int i;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
 
 	/* Make sure the lock has been released. */
 	logging.base.get_size (&logging.base);
@@ -13186,29 +13724,40 @@ static void logging_flash_test_flush_after_incomplete_write_unused_bytes_termina
 	spi_flash_release (&flash);
 }
 
-static void logging_flash_test_read_contents (CuTest *test)
+static void logging_flash_test_flush_double_buffered_erase_ahead (CuTest *test)
 {
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state flash_state;
 	struct spi_flash flash;
 	struct logging_flash_state state;
 	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
 	int status;
 	uint8_t log_empty[FLASH_SECTOR_SIZE];
-	uint8_t log_partial[FLASH_SECTOR_SIZE];
-	struct logging_entry_header *entry;
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	uint8_t entry[entry_count + 1][entry_size];
+	uint8_t entry_data[entry_full + entry_len];
+	struct logging_entry_header *header;
 	int i;
-	uint8_t output[LOGGING_FLASH_SECTORS * FLASH_SECTOR_SIZE];
+	uint8_t *pos;
 
 	TEST_START;
 
 	memset (log_empty, 0xff, sizeof (log_empty));
-	memset (log_partial, 0xff, sizeof (log_partial));
 
-	entry = (struct logging_entry_header*) log_partial;
-	entry->log_magic = 0xCB;
-	entry->length = 10 + sizeof (struct logging_entry_header);
-	entry->entry_id = 0;
+	pos = entry_data;
+	for (i = 0; i < entry_count + 1; ++i, pos += entry_len) {
+		header = (struct logging_entry_header*) pos;
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+
+		memset (entry[i], i, entry_size);
+		memcpy (&pos[sizeof (struct logging_entry_header)], entry[i], entry_size);
+	}
 
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13219,8 +13768,201 @@ static void logging_flash_test_read_contents (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The next sector gets erased after the full buffer has been written. */
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		entry_full);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x11000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, entry_full, status);
+
+	status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_write (&flash_mock, 0x11000, &entry_data[entry_full],
+		entry_len);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Nothing to write or erase. */
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_flush_double_buffered_write_error (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	uint8_t entry[] = {0, 1, 2, 3, 4};
+	uint8_t entry_data[sizeof (entry) + sizeof (struct logging_entry_header)];
+	struct logging_entry_header *header;
+	int i;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	header = (struct logging_entry_header*) entry_data;
+	header->log_magic = 0xCB;
+	header->length = sizeof (entry_data);
+	header->entry_id = 0;
+	memcpy (&entry_data[sizeof (struct logging_entry_header)], entry, sizeof (entry));
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.create_entry (&logging.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_xfer (&flash_mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	/* The data will be written on the next flush. */
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		sizeof (entry_data));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_read_contents (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	uint8_t log_partial[FLASH_SECTOR_SIZE];
+	struct logging_entry_header *entry;
+	int i;
+	uint8_t output[LOGGING_FLASH_SECTORS * FLASH_SECTOR_SIZE];
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+	memset (log_partial, 0xff, sizeof (log_partial));
+
+	entry = (struct logging_entry_header*) log_partial;
+	entry->log_magic = 0xCB;
+	entry->length = 10 + sizeof (struct logging_entry_header);
+	entry->entry_id = 0;
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_partial, FLASH_SECTOR_SIZE,
 		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, FLASH_SECTOR_SIZE));
 
@@ -18374,7 +19116,1146 @@ static void logging_flash_test_read_contents_static_init (CuTest *test)
 	status = logging.base.read_contents (&logging.base, 0, output, sizeof (output));
 	CuAssertIntEquals (test, 10 + sizeof (struct logging_entry_header), status);
 
-	status = testing_validate_array (log_partial, output, status);
+	status = testing_validate_array (log_partial, output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_read_contents_null (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	uint8_t log_partial[FLASH_SECTOR_SIZE];
+	struct logging_entry_header *entry;
+	int i;
+	uint8_t output[LOGGING_FLASH_SECTORS * FLASH_SECTOR_SIZE];
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+	memset (log_partial, 0xff, sizeof (log_partial));
+
+	entry = (struct logging_entry_header*) log_partial;
+	entry->log_magic = 0xCB;
+	entry->length = 10 + sizeof (struct logging_entry_header);
+	entry->entry_id = 0;
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_partial, FLASH_SECTOR_SIZE,
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, FLASH_SECTOR_SIZE));
+
+	for (i = 1; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, (10 + sizeof (struct logging_entry_header)), status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (NULL, 0, output, sizeof (output));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging.base.read_contents (&logging.base, 0, NULL, sizeof (output));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_read_contents_read_error (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_full[LOGGING_FLASH_SECTORS][FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	const int full_size = entry_full * LOGGING_FLASH_SECTORS;
+	struct logging_entry_header *entry;
+	int i;
+	int j;
+	uint8_t output[LOGGING_FLASH_SECTORS * FLASH_SECTOR_SIZE];
+
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, entry_empty);
+
+	memset (log_full, 0xff, sizeof (log_full));
+
+	for (j = 0; j < LOGGING_FLASH_SECTORS; ++j) {
+		for (i = 0; i < entry_count; ++i) {
+			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
+			entry->log_magic = 0xCB;
+			entry->length = entry_len;
+			entry->entry_id = i + (j * entry_count);
+		}
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_full[i], FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, full_size, status);
+
+	status = flash_master_mock_expect_xfer (&flash_mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, 0, output, sizeof (output));
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_read_contents_double_buffered (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	uint8_t entry[(entry_count * 2) + 1][entry_size];
+	uint8_t entry_data[(entry_full * 2) + entry_len];
+	uint8_t output[(entry_full * 2) + entry_len];
+	struct logging_entry_header *header;
+	int i;
+	uint8_t *pos;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	pos = entry_data;
+	for (i = 0; i < (entry_count * 2) + 1; ++i, pos += entry_len) {
+		header = (struct logging_entry_header*) pos;
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+
+		memset (entry[i], i, entry_size);
+		memcpy (&pos[sizeof (struct logging_entry_header)], entry[i], entry_size);
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		entry_full);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x11000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = entry_count; i < (entry_count * 2) + 1; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Entries on flash, waiting to be written, and still being buffered. */
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, entry_data, entry_full,
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, entry_full));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, 0, output, sizeof (output));
+	CuAssertIntEquals (test, sizeof (output), status);
+
+	status = testing_validate_array (entry_data, output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, entry_full + 8, output, entry_len);
+	CuAssertIntEquals (test, entry_len, status);
+
+	status = testing_validate_array (&entry_data[entry_full + 8], output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, (entry_full * 2) - 4, output,
+		entry_len + 4);
+	CuAssertIntEquals (test, entry_len + 4, status);
+
+	status = testing_validate_array (&entry_data[(entry_full * 2) - 4], output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_read_contents_sequential_reads (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_full[LOGGING_FLASH_SECTORS][FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	const int full_size = entry_full * LOGGING_FLASH_SECTORS;
+	const int chunk = 1000;
+	struct logging_entry_header *entry;
+	int i;
+	int j;
+	int offset;
+	int pos;
+	int remain;
+	int read_len;
+	int expected_len;
+	uint8_t output[chunk];
+
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, entry_empty);
+
+	memset (log_full, 0xff, sizeof (log_full));
+
+	for (j = 0; j < LOGGING_FLASH_SECTORS; ++j) {
+		for (i = 0; i < entry_count; ++i) {
+			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
+			entry->log_magic = 0xCB;
+			entry->length = entry_len;
+			entry->entry_id = i + (j * entry_count);
+		}
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_full[i], FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, full_size, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (offset = 0; offset < full_size; offset += chunk) {
+		expected_len = ((full_size - offset) < chunk) ? (full_size - offset) : chunk;
+
+		pos = offset;
+		remain = expected_len;
+		while (remain != 0) {
+			j = pos / entry_full;
+			i = pos % entry_full;
+			read_len = (remain < (entry_full - i)) ? remain : (entry_full - i);
+
+			status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+				FLASH_EXP_READ_STATUS_REG);
+			status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &log_full[j][i], read_len,
+				FLASH_EXP_READ_CMD (0x03, 0x10000 + (j * FLASH_SECTOR_SIZE) + i, 0, -1,
+				read_len));
+			CuAssertIntEquals (test, 0, status);
+
+			pos += read_len;
+			remain -= read_len;
+		}
+
+		status = logging.base.read_contents (&logging.base, offset, output, sizeof (output));
+		CuAssertIntEquals (test, expected_len, status);
+
+		status = testing_validate_array (&log_full[0][offset], output, status);
+		CuAssertIntEquals (test, 0, status);
+
+		status = mock_validate (&flash_mock.mock);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = logging.base.read_contents (&logging.base, full_size, output, sizeof (output));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_read_contents_offset_before_previous_read (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_full[LOGGING_FLASH_SECTORS][FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	const int full_size = entry_full * LOGGING_FLASH_SECTORS;
+	struct logging_entry_header *entry;
+	int i;
+	int j;
+	uint8_t output[entry_len * 2];
+
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, entry_empty);
+
+	memset (log_full, 0xff, sizeof (log_full));
+
+	for (j = 0; j < LOGGING_FLASH_SECTORS; ++j) {
+		for (i = 0; i < entry_count; ++i) {
+			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
+			entry->log_magic = 0xCB;
+			entry->length = entry_len;
+			entry->entry_id = i + (j * entry_count);
+		}
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_full[i], FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, full_size, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Read from the middle of the log. */
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &log_full[5][entry_len],
+		sizeof (output), FLASH_EXP_READ_CMD (0x03, 0x15000 + entry_len, 0, -1, sizeof (output)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, (entry_full * 5) + entry_len, output,
+		sizeof (output));
+	CuAssertIntEquals (test, sizeof (output), status);
+
+	status = testing_validate_array (&log_full[5][entry_len], output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Read from an earlier sector. */
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &log_full[2][entry_len * 3],
+		sizeof (output), FLASH_EXP_READ_CMD (0x03, 0x12000 + (entry_len * 3), 0, -1,
+		sizeof (output)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, (entry_full * 2) + (entry_len * 3), output,
+		sizeof (output));
+	CuAssertIntEquals (test, sizeof (output), status);
+
+	status = testing_validate_array (&log_full[2][entry_len * 3], output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_read_contents_after_clear_following_read (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_full[LOGGING_FLASH_SECTORS][FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	const int full_size = entry_full * LOGGING_FLASH_SECTORS;
+	uint8_t entry_data[entry_size];
+	struct logging_entry_header *entry;
+	int i;
+	int j;
+	uint8_t output[entry_len * 2];
+
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, entry_empty);
+
+	memset (log_full, 0xff, sizeof (log_full));
+	memset (entry_data, 0x11, sizeof (entry_data));
+
+	for (j = 0; j < LOGGING_FLASH_SECTORS; ++j) {
+		for (i = 0; i < entry_count; ++i) {
+			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
+			entry->log_magic = 0xCB;
+			entry->length = entry_len;
+			entry->entry_id = i + (j * entry_count);
+		}
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_full[i], FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, full_size, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_full[3], sizeof (output),
+		FLASH_EXP_READ_CMD (0x03, 0x13000, 0, -1, sizeof (output)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, entry_full * 3, output, sizeof (output));
+	CuAssertIntEquals (test, sizeof (output), status);
+
+	status = testing_validate_array (log_full[3], output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash (&flash_mock, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.clear (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.create_entry (&logging.base, entry_data, sizeof (entry_data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, entry_len, status);
+
+	status = logging.base.read_contents (&logging.base, entry_full * 3, output, sizeof (output));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, 0, output, sizeof (output));
+	CuAssertIntEquals (test, entry_len, status);
+
+	status = testing_validate_array (entry_data, &output[sizeof (struct logging_entry_header)],
+		entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_get_entry_offset (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_full[LOGGING_FLASH_SECTORS][FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	const int full_size = entry_full * LOGGING_FLASH_SECTORS;
+	struct logging_entry_header *entry;
+	int i;
+	int j;
+
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, entry_empty);
+
+	memset (log_full, 0xff, sizeof (log_full));
+
+	for (j = 0; j < LOGGING_FLASH_SECTORS; ++j) {
+		for (i = 0; i < entry_count; ++i) {
+			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
+			entry->log_magic = 0xCB;
+			entry->length = entry_len;
+			entry->entry_id = i + (j * entry_count);
+		}
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_full[i], FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, full_size, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 5; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &log_full[5][i * entry_len],
+			sizeof (struct logging_entry_header),
+			FLASH_EXP_READ_CMD (0x03, 0x15000 + (i * entry_len), 0, -1,
+			sizeof (struct logging_entry_header)));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, (entry_count * 5) + 3);
+	CuAssertIntEquals (test, (entry_full * 5) + (entry_len * 4), status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_get_entry_offset_last_entry_in_sector (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_full[LOGGING_FLASH_SECTORS][FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	const int full_size = entry_full * LOGGING_FLASH_SECTORS;
+	struct logging_entry_header *entry;
+	int i;
+	int j;
+
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, entry_empty);
+
+	memset (log_full, 0xff, sizeof (log_full));
+
+	for (j = 0; j < LOGGING_FLASH_SECTORS; ++j) {
+		for (i = 0; i < entry_count; ++i) {
+			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
+			entry->log_magic = 0xCB;
+			entry->length = entry_len;
+			entry->entry_id = i + (j * entry_count);
+		}
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_full[i], FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, full_size, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &log_full[1][i * entry_len],
+			sizeof (struct logging_entry_header),
+			FLASH_EXP_READ_CMD (0x03, 0x11000 + (i * entry_len), 0, -1,
+			sizeof (struct logging_entry_header)));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, (entry_count * 2) - 1);
+	CuAssertIntEquals (test, entry_full * 2, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_get_entry_offset_first_entry_newer (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_full[LOGGING_FLASH_SECTORS][FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	const int full_size = entry_full * LOGGING_FLASH_SECTORS;
+	struct logging_entry_header *entry;
+	int i;
+	int j;
+
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, entry_empty);
+
+	memset (log_full, 0xff, sizeof (log_full));
+
+	for (j = 0; j < LOGGING_FLASH_SECTORS; ++j) {
+		for (i = 0; i < entry_count; ++i) {
+			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
+			entry->log_magic = 0xCB;
+			entry->length = entry_len;
+			entry->entry_id = i + (j * entry_count);
+		}
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_full[i], FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, full_size, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 0xffffffff);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_get_entry_offset_buffered_entries (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	uint8_t entry[] = {0, 1, 2, 3, 4};
+	const int entry_len = sizeof (entry) + sizeof (struct logging_entry_header);
+	int i;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 4; ++i) {
+		status = logging.base.create_entry (&logging.base, entry, sizeof (entry));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, entry_len * 4, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 0xffffffff);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 0);
+	CuAssertIntEquals (test, entry_len, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 2);
+	CuAssertIntEquals (test, entry_len * 3, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 3);
+	CuAssertIntEquals (test, entry_len * 4, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_get_entry_offset_flash_and_buffered_entries (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	uint8_t log_partial[FLASH_SECTOR_SIZE];
+	uint8_t entry[] = {0, 1, 2, 3, 4};
+	const int entry_len = sizeof (entry) + sizeof (struct logging_entry_header);
+	struct logging_entry_header *header;
+	int i;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+	memset (log_partial, 0xff, sizeof (log_partial));
+
+	for (i = 0; i < 2; ++i) {
+		header = (struct logging_entry_header*) &log_partial[i * entry_len];
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+	}
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_partial, FLASH_SECTOR_SIZE,
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, FLASH_SECTOR_SIZE));
+
+	for (i = 1; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 2; ++i) {
+		status = logging.base.create_entry (&logging.base, entry, sizeof (entry));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, entry_len * 4, status);
+
+	status = 0;
+	for (i = 0; i < 2; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &log_partial[i * entry_len],
+			sizeof (struct logging_entry_header),
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * entry_len), 0, -1,
+			sizeof (struct logging_entry_header)));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 2);
+	CuAssertIntEquals (test, entry_len * 3, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_get_entry_offset_after_flush (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	const int entry_empty = FLASH_SECTOR_SIZE - entry_full;
+	uint8_t entry[entry_count + 1][entry_size];
+	uint8_t entry_data[entry_full];
+	uint8_t entry_data2[entry_len];
+	struct logging_entry_header *header;
+	int i;
+	uint8_t *pos;
+
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, entry_empty);
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	pos = entry_data;
+	for (i = 0; i < entry_count; ++i, pos += entry_size) {
+		header = (struct logging_entry_header*) pos;
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+		pos += sizeof (struct logging_entry_header);
+
+		memset (entry[i], i, entry_size);
+		memcpy (pos, entry[i], entry_size);
+	}
+
+	header = (struct logging_entry_header*) entry_data2;
+	header->log_magic = 0xCB;
+	header->length = entry_len;
+	header->entry_id = i;
+	memset (entry[i], i, entry_size);
+	memcpy (&entry_data2[sizeof (struct logging_entry_header)], entry[i], entry_size);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, entry_full, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		sizeof (entry_data));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, entry_full + sizeof (entry_data2), status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x11000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x11000, entry_data2,
+		sizeof (entry_data2));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, entry_full + sizeof (entry_data2), status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, entry_data,
+		sizeof (struct logging_entry_header),
+		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, sizeof (struct logging_entry_header)));
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &entry_data[entry_len],
+		sizeof (struct logging_entry_header),
+		FLASH_EXP_READ_CMD (0x03, 0x10000 + entry_len, 0, -1,
+		sizeof (struct logging_entry_header)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 0);
+	CuAssertIntEquals (test, entry_len, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, entry_data2,
+		sizeof (struct logging_entry_header),
+		FLASH_EXP_READ_CMD (0x03, 0x11000, 0, -1, sizeof (struct logging_entry_header)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, entry_count);
+	CuAssertIntEquals (test, entry_full + sizeof (entry_data2), status);
+
+	status = logging.base.get_entry_offset (&logging.base, 0xffffffff);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
@@ -18385,29 +20266,40 @@ static void logging_flash_test_read_contents_static_init (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void logging_flash_test_read_contents_null (CuTest *test)
+static void logging_flash_test_get_entry_offset_double_buffered (CuTest *test)
 {
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state flash_state;
 	struct spi_flash flash;
 	struct logging_flash_state state;
 	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
 	int status;
 	uint8_t log_empty[FLASH_SECTOR_SIZE];
-	uint8_t log_partial[FLASH_SECTOR_SIZE];
-	struct logging_entry_header *entry;
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	const int entry_full = entry_len * entry_count;
+	uint8_t entry[(entry_count * 2) + 1][entry_size];
+	uint8_t entry_data[(entry_full * 2) + entry_len];
+	struct logging_entry_header *header;
 	int i;
-	uint8_t output[LOGGING_FLASH_SECTORS * FLASH_SECTOR_SIZE];
+	uint8_t *pos;
 
 	TEST_START;
 
 	memset (log_empty, 0xff, sizeof (log_empty));
-	memset (log_partial, 0xff, sizeof (log_partial));
 
-	entry = (struct logging_entry_header*) log_partial;
-	entry->log_magic = 0xCB;
-	entry->length = 10 + sizeof (struct logging_entry_header);
-	entry->entry_id = 0;
+	pos = entry_data;
+	for (i = 0; i < (entry_count * 2) + 1; ++i, pos += entry_len) {
+		header = (struct logging_entry_header*) pos;
+		header->log_magic = 0xCB;
+		header->length = entry_len;
+		header->entry_id = i;
+
+		memset (entry[i], i, entry_size);
+		memcpy (&pos[sizeof (struct logging_entry_header)], entry[i], entry_size);
+	}
 
 	status = flash_master_mock_init (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -18418,12 +20310,7 @@ static void logging_flash_test_read_contents_null (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_partial, FLASH_SECTOR_SIZE,
-		FLASH_EXP_READ_CMD (0x03, 0x10000, 0, -1, FLASH_SECTOR_SIZE));
-
-	for (i = 1; i < 16; ++i) {
+	for (i = 0; i < 16; ++i) {
 		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
 			FLASH_EXP_READ_STATUS_REG);
 		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
@@ -18432,20 +20319,95 @@ static void logging_flash_test_read_contents_null (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging.base.get_size (&logging.base);
-	CuAssertIntEquals (test, (10 + sizeof (struct logging_entry_header)), status);
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x10000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		entry_full);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x11000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = entry_count; i < (entry_count * 2) + 1; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
 
 	status = mock_validate (&flash_mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging.base.read_contents (NULL, 0, output, sizeof (output));
-	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+	/* Entry waiting to be written to flash. */
+	for (i = 0; i < entry_count; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &entry_data[i * entry_len],
+			sizeof (struct logging_entry_header),
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * entry_len), 0, -1,
+			sizeof (struct logging_entry_header)));
+	}
 
-	status = logging.base.read_contents (&logging.base, 0, NULL, sizeof (output));
-	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, entry_count + 44);
+	CuAssertIntEquals (test, entry_full + (entry_len * 45), status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Entry on flash after the pending data has been written. */
+	status = flash_master_mock_expect_write (&flash_mock, 0x11000, &entry_data[entry_full],
+		entry_full);
+	status |= flash_master_mock_expect_erase_flash_sector (&flash_mock, 0x12000);
+	status |= flash_master_mock_expect_write (&flash_mock, 0x12000, &entry_data[entry_full * 2],
+		entry_len);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 46; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0,
+			&entry_data[entry_full + (i * entry_len)], sizeof (struct logging_entry_header),
+			FLASH_EXP_READ_CMD (0x03, 0x11000 + (i * entry_len), 0, -1,
+			sizeof (struct logging_entry_header)));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, entry_count + 44);
+	CuAssertIntEquals (test, entry_full + (entry_len * 45), status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &entry_data[entry_full * 2],
+		sizeof (struct logging_entry_header),
+		FLASH_EXP_READ_CMD (0x03, 0x12000, 0, -1, sizeof (struct logging_entry_header)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, entry_count * 2);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -18455,7 +20417,7 @@ static void logging_flash_test_read_contents_null (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void logging_flash_test_read_contents_read_error (CuTest *test)
+static void logging_flash_test_get_entry_offset_all_sectors_full_overwrite (CuTest *test)
 {
 	struct flash_master_mock flash_mock;
 	struct spi_flash_state flash_state;
@@ -18473,7 +20435,6 @@ static void logging_flash_test_read_contents_read_error (CuTest *test)
 	struct logging_entry_header *entry;
 	int i;
 	int j;
-	uint8_t output[LOGGING_FLASH_SECTORS * FLASH_SECTOR_SIZE];
 
 	TEST_START;
 
@@ -18481,7 +20442,17 @@ static void logging_flash_test_read_contents_read_error (CuTest *test)
 
 	memset (log_full, 0xff, sizeof (log_full));
 
-	for (j = 0; j < LOGGING_FLASH_SECTORS; ++j) {
+	for (j = 0; j < 8; ++j) {
+		for (i = 0; i < entry_count; ++i) {
+			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
+			entry->log_magic = 0xCB;
+			entry->length = entry_len;
+			entry->entry_id = (LOGGING_FLASH_SECTORS * entry_count) + i +
+				(j * entry_count);
+		}
+	}
+
+	for (j = 8; j < LOGGING_FLASH_SECTORS; ++j) {
 		for (i = 0; i < entry_count; ++i) {
 			entry = (struct logging_entry_header*) &log_full[j][i * entry_len];
 			entry->log_magic = 0xCB;
@@ -18514,12 +20485,71 @@ static void logging_flash_test_read_contents_read_error (CuTest *test)
 	status = logging.base.get_size (&logging.base);
 	CuAssertIntEquals (test, full_size, status);
 
-	status = flash_master_mock_expect_xfer (&flash_mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_STATUS_REG);
+	status = 0;
+	for (i = 0; i < 5; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &log_full[2][i * entry_len],
+			sizeof (struct logging_entry_header),
+			FLASH_EXP_READ_CMD (0x03, 0x12000 + (i * entry_len), 0, -1,
+			sizeof (struct logging_entry_header)));
+	}
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = logging.base.read_contents (&logging.base, 0, output, sizeof (output));
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	status = logging.base.get_entry_offset (&logging.base,
+		(LOGGING_FLASH_SECTORS * entry_count) + (entry_count * 2) + 3);
+	CuAssertIntEquals (test, (entry_full * 10) + (entry_len * 4), status);
+
+	status = logging.base.get_entry_offset (&logging.base, (entry_count * 8) - 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
+static void logging_flash_test_get_entry_offset_null (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	int i;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&logging, &state, &flash, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (NULL, 0);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
 
 	status = flash_master_mock_validate_and_release (&flash_mock);
 	CuAssertIntEquals (test, 0, status);
@@ -21570,6 +23600,108 @@ static void logging_flash_test_clear_erase_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
+static void logging_flash_test_clear_double_buffered (CuTest *test)
+{
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state flash_state;
+	struct spi_flash flash;
+	struct logging_flash_state state;
+	struct logging_flash logging;
+	uint8_t write_buffer[FLASH_SECTOR_SIZE];
+	int status;
+	uint8_t log_empty[FLASH_SECTOR_SIZE];
+	const int entry_size = 16 - sizeof (struct logging_entry_header);
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = FLASH_SECTOR_SIZE / entry_len;
+	uint8_t entry[entry_count + 2][entry_size];
+	uint8_t entry_data[entry_len];
+	struct logging_entry_header *header;
+	int i;
+
+	TEST_START;
+
+	memset (log_empty, 0xff, sizeof (log_empty));
+
+	for (i = 0; i < entry_count + 2; ++i) {
+		memset (entry[i], i, entry_size);
+	}
+
+	header = (struct logging_entry_header*) entry_data;
+	header->log_magic = 0xCB;
+	header->length = entry_len;
+	header->entry_id = entry_count + 1;
+	memcpy (&entry_data[sizeof (struct logging_entry_header)], entry[entry_count + 1], entry_size);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &flash_state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 16; ++i) {
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+			FLASH_EXP_READ_STATUS_REG);
+		status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, log_empty, FLASH_SECTOR_SIZE,
+			FLASH_EXP_READ_CMD (0x03, 0x10000 + (i * FLASH_SECTOR_SIZE), 0, -1, FLASH_SECTOR_SIZE));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init_double_buffered (&logging, &state, &flash, 0x10000, write_buffer);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count + 1; ++i) {
+		status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_erase_flash (&flash_mock, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.clear (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.create_entry (&logging.base, entry[i], entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The first sector doesn't need to be erased again. */
+	status = flash_master_mock_expect_write (&flash_mock, 0x10000, entry_data,
+		sizeof (entry_data));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash_mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_release (&logging);
+
+	spi_flash_release (&flash);
+}
+
 
 TEST_SUITE_START (logging_flash);
 
@@ -21607,6 +23739,8 @@ TEST (logging_flash_test_init_partial_unused_not_blank);
 TEST (logging_flash_test_init_null);
 TEST (logging_flash_test_init_not_block_aligned);
 TEST (logging_flash_test_init_flash_read_error);
+TEST (logging_flash_test_init_double_buffered);
+TEST (logging_flash_test_init_double_buffered_null);
 TEST (logging_flash_test_static_init_empty);
 TEST (logging_flash_test_static_init_first_sector_partial);
 TEST (logging_flash_test_static_init_first_sector_partial_different_lengths);
@@ -21641,6 +23775,7 @@ TEST (logging_flash_test_static_init_partial_unused_not_blank);
 TEST (logging_flash_test_static_init_null);
 TEST (logging_flash_test_static_init_not_block_aligned);
 TEST (logging_flash_test_static_init_flash_read_error);
+TEST (logging_flash_test_static_init_double_buffered);
 TEST (logging_flash_test_release_null);
 TEST (logging_flash_test_get_size_null);
 TEST (logging_flash_test_create_entry);
@@ -21702,6 +23837,9 @@ TEST (logging_flash_test_create_entry_full_buffer_flush_after_incomplete_flush);
 TEST (logging_flash_test_create_entry_full_buffer_flush_after_incomplete_flush_unused_bytes);
 TEST (logging_flash_test_create_entry_full_buffer_flush_after_incomplete_flush_unused_bytes_terminator);
 TEST (logging_flash_test_create_entry_full_buffer_flush_after_incomplete_flush_unused_bytes_terminator_large);
+TEST (logging_flash_test_create_entry_double_buffered_full_buffer);
+TEST (logging_flash_test_create_entry_double_buffered_full_buffer_terminator);
+TEST (logging_flash_test_create_entry_double_buffered_both_buffers_full);
 TEST (logging_flash_test_flush_no_data);
 TEST (logging_flash_test_flush_null);
 TEST (logging_flash_test_flush_erase_error);
@@ -21714,6 +23852,8 @@ TEST (logging_flash_test_flush_after_incomplete_write);
 TEST (logging_flash_test_flush_after_incomplete_write_unused_bytes);
 TEST (logging_flash_test_flush_after_incomplete_write_unused_bytes_terminator);
 TEST (logging_flash_test_flush_after_incomplete_write_unused_bytes_terminator_large);
+TEST (logging_flash_test_flush_double_buffered_erase_ahead);
+TEST (logging_flash_test_flush_double_buffered_write_error);
 TEST (logging_flash_test_read_contents);
 TEST (logging_flash_test_read_contents_empty);
 TEST (logging_flash_test_read_contents_buffered_entry_only);
@@ -21764,6 +23904,19 @@ TEST (logging_flash_test_read_contents_full_buffer_flush_after_incomplete_flush_
 TEST (logging_flash_test_read_contents_static_init);
 TEST (logging_flash_test_read_contents_null);
 TEST (logging_flash_test_read_contents_read_error);
+TEST (logging_flash_test_read_contents_double_buffered);
+TEST (logging_flash_test_read_contents_sequential_reads);
+TEST (logging_flash_test_read_contents_offset_before_previous_read);
+TEST (logging_flash_test_read_contents_after_clear_following_read);
+TEST (logging_flash_test_get_entry_offset);
+TEST (logging_flash_test_get_entry_offset_last_entry_in_sector);
+TEST (logging_flash_test_get_entry_offset_first_entry_newer);
+TEST (logging_flash_test_get_entry_offset_buffered_entries);
+TEST (logging_flash_test_get_entry_offset_flash_and_buffered_entries);
+TEST (logging_flash_test_get_entry_offset_after_flush);
+TEST (logging_flash_test_get_entry_offset_double_buffered);
+TEST (logging_flash_test_get_entry_offset_all_sectors_full_overwrite);
+TEST (logging_flash_test_get_entry_offset_null);
 TEST (logging_flash_test_clear);
 TEST (logging_flash_test_clear_buffered_entry);
 TEST (logging_flash_test_clear_flushed_entry);
@@ -21786,5 +23939,6 @@ TEST (logging_flash_test_clear_full_buffer_flush_after_incomplete_flush_unused_b
 TEST (logging_flash_test_clear_static_init);
 TEST (logging_flash_test_clear_null);
 TEST (logging_flash_test_clear_erase_error);
+TEST (logging_flash_test_clear_double_buffered);
 
 TEST_SUITE_END;
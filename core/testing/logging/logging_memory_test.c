@@ -35,6 +35,7 @@ static void logging_memory_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, logging.base.clear);
 	CuAssertPtrNotNull (test, logging.base.get_size);
 	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
 
 	status = logging.base.get_size (&logging.base);
 	CuAssertIntEquals (test, 0, status);
@@ -90,6 +91,7 @@ static void logging_memory_test_init_from_buffer (CuTest *test)
 	CuAssertPtrNotNull (test, logging.base.clear);
 	CuAssertPtrNotNull (test, logging.base.get_size);
 	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
 
 	status = logging.base.get_size (&logging.base);
 	CuAssertIntEquals (test, 0, status);
@@ -176,6 +178,7 @@ static void logging_memory_test_init_append_existing (CuTest *test)
 	CuAssertPtrNotNull (test, logging.base.clear);
 	CuAssertPtrNotNull (test, logging.base.get_size);
 	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
 
 	status = logging.base.get_size (&logging.base);
 	CuAssertIntEquals (test, 0, status);
@@ -256,6 +259,7 @@ static void logging_memory_test_dynamic_buffer_static_init (CuTest *test)
 	CuAssertPtrNotNull (test, logging.base.clear);
 	CuAssertPtrNotNull (test, logging.base.get_size);
 	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
 
 	status = logging_memory_init_dynamic_state (&logging);
 	CuAssertIntEquals (test, 0, status);
@@ -304,6 +308,7 @@ static void logging_memory_test_static_init (CuTest *test)
 	CuAssertPtrNotNull (test, logging.base.clear);
 	CuAssertPtrNotNull (test, logging.base.get_size);
 	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
 
 	status = logging_memory_init_state (&logging);
 	CuAssertIntEquals (test, 0, status);
@@ -385,6 +390,7 @@ static void logging_memory_test_static_init_append_existing (CuTest *test)
 	CuAssertPtrNotNull (test, logging.base.clear);
 	CuAssertPtrNotNull (test, logging.base.get_size);
 	CuAssertPtrNotNull (test, logging.base.read_contents);
+	CuAssertPtrNotNull (test, logging.base.get_entry_offset);
 
 	status = logging_memory_init_state_append_existing (&logging);
 	CuAssertIntEquals (test, 0, status);
@@ -1114,6 +1120,70 @@ static void logging_memory_test_create_entry_append_existing_multiple_entries (C
 	logging_memory_release (&logging);
 }
 
+static void logging_memory_test_create_entry_append_existing_stale_entries_after_end (CuTest *test)
+{
+	struct logging_memory logging;
+	struct logging_memory_state state;
+	int status;
+	const int entry_size = 11;
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = 32;
+	const int entry_full = entry_len * entry_count;
+	uint8_t buffer[entry_full];
+	uint8_t entry[entry_size];
+	uint8_t entry_data[entry_len * 11];
+	struct logging_entry_header *header;
+	int i;
+	uint8_t output[entry_full];
+
+	TEST_START;
+
+	memset (buffer, 0, sizeof (buffer));
+	memset (entry, 0x55, sizeof (entry));
+
+	/* Entries from the current log, followed by an empty entry and older entries. */
+	for (i = 0; i < entry_count; i++) {
+		if (i != 10) {
+			header = (struct logging_entry_header*) &buffer[i * entry_len];
+			header->log_magic = 0xCB;
+			header->length = entry_len;
+			header->entry_id = (i < 10) ? (i + 100) : i;
+			memcpy (&buffer[(i * entry_len) + sizeof (struct logging_entry_header)], entry,
+				entry_size);
+		}
+	}
+
+	memcpy (entry_data, buffer, entry_len * 10);
+
+	header = (struct logging_entry_header*) &entry_data[entry_len * 10];
+	header->log_magic = 0xCB;
+	header->length = entry_len;
+	header->entry_id = 110;
+	memcpy (&entry_data[(entry_len * 10) + sizeof (struct logging_entry_header)], entry,
+		entry_size);
+
+	status = logging_memory_init_append_existing (&logging, &state, buffer, sizeof (buffer),
+		entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, entry_len * 10, status);
+
+	status = logging.base.create_entry (&logging.base, entry, entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = logging.base.read_contents (&logging.base, 0, output, sizeof (output));
+	CuAssertIntEquals (test, sizeof (entry_data), status);
+
+	status = testing_validate_array (entry_data, output, status);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_memory_release (&logging);
+}
+
 static void logging_memory_test_create_entry_append_existing_full_log (CuTest *test)
 {
 	struct logging_memory logging;
@@ -2274,6 +2344,168 @@ static void logging_memory_test_read_contents_partial_read_with_offset_across_wr
 	logging_memory_release (&logging);
 }
 
+static void logging_memory_test_get_entry_offset (CuTest *test)
+{
+	struct logging_memory logging;
+	struct logging_memory_state state;
+	int status;
+	const int entry_size = 11;
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = 32;
+	uint8_t entry[entry_size];
+	int i;
+
+	TEST_START;
+
+	memset (entry, 0x11, sizeof (entry));
+
+	status = logging_memory_init (&logging, &state, entry_count, entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 10; i++) {
+		status = logging.base.create_entry (&logging.base, entry, entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = logging.base.get_entry_offset (&logging.base, 0);
+	CuAssertIntEquals (test, entry_len, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 4);
+	CuAssertIntEquals (test, entry_len * 5, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 8);
+	CuAssertIntEquals (test, entry_len * 9, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 9);
+	CuAssertIntEquals (test, entry_len * 10, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 100);
+	CuAssertIntEquals (test, entry_len * 10, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 0xffffffff);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_memory_release (&logging);
+}
+
+static void logging_memory_test_get_entry_offset_with_wrap (CuTest *test)
+{
+	struct logging_memory logging;
+	struct logging_memory_state state;
+	int status;
+	const int entry_size = 11;
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = 32;
+	const int entry_full = entry_len * entry_count;
+	uint8_t entry[entry_size];
+	uint8_t output[entry_len];
+	struct logging_entry_header *header = (struct logging_entry_header*) output;
+	int i;
+
+	TEST_START;
+
+	memset (entry, 0x11, sizeof (entry));
+
+	status = logging_memory_init (&logging, &state, entry_count, entry_size);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < entry_count + 3; i++) {
+		status = logging.base.create_entry (&logging.base, entry, entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = logging.base.get_entry_offset (&logging.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 10);
+	CuAssertIntEquals (test, entry_len * 8, status);
+
+	status = logging.base.read_contents (&logging.base, status, output, sizeof (output));
+	CuAssertIntEquals (test, entry_len, status);
+	CuAssertIntEquals (test, 11, header->entry_id);
+
+	status = logging.base.get_entry_offset (&logging.base, 30);
+	CuAssertIntEquals (test, entry_len * 28, status);
+
+	status = logging.base.read_contents (&logging.base, status, output, sizeof (output));
+	CuAssertIntEquals (test, entry_len, status);
+	CuAssertIntEquals (test, 31, header->entry_id);
+
+	status = logging.base.get_entry_offset (&logging.base, 34);
+	CuAssertIntEquals (test, entry_full, status);
+
+	logging_memory_release (&logging);
+}
+
+static void logging_memory_test_get_entry_offset_empty (CuTest *test)
+{
+	struct logging_memory logging;
+	struct logging_memory_state state;
+	int status;
+
+	TEST_START;
+
+	status = logging_memory_init (&logging, &state, 32, 11);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (&logging.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_memory_release (&logging);
+}
+
+static void logging_memory_test_get_entry_offset_static_init (CuTest *test)
+{
+	struct logging_memory_state state;
+	const int entry_size = 11;
+	const int entry_len = entry_size + sizeof (struct logging_entry_header);
+	const int entry_count = 32;
+	const int entry_full = entry_len * entry_count;
+	uint8_t buffer[entry_full];
+	struct logging_memory logging = logging_memory_static_init (&state, buffer, entry_full,
+		entry_size);
+	uint8_t entry[entry_size];
+	int status;
+	int i;
+
+	TEST_START;
+
+	memset (entry, 0x11, sizeof (entry));
+
+	status = logging_memory_init_state (&logging);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 4; i++) {
+		status = logging.base.create_entry (&logging.base, entry, entry_size);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = logging.base.get_entry_offset (&logging.base, 1);
+	CuAssertIntEquals (test, entry_len * 2, status);
+
+	logging_memory_release (&logging);
+}
+
+static void logging_memory_test_get_entry_offset_null (CuTest *test)
+{
+	struct logging_memory logging;
+	struct logging_memory_state state;
+	int status;
+
+	TEST_START;
+
+	status = logging_memory_init (&logging, &state, 32, 11);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_entry_offset (NULL, 0);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_memory_release (&logging);
+}
+
 static void logging_memory_test_clear (CuTest *test)
 {
 	struct logging_memory logging;
@@ -2660,6 +2892,7 @@ TEST (logging_memory_test_create_entry_log_wrap_appending_existing_empty_not_ent
 TEST (logging_memory_test_create_entry_log_wrap_twice);
 TEST (logging_memory_test_create_entry_append_existing_one_entry);
 TEST (logging_memory_test_create_entry_append_existing_multiple_entries);
+TEST (logging_memory_test_create_entry_append_existing_stale_entries_after_end);
 TEST (logging_memory_test_create_entry_append_existing_full_log);
 TEST (logging_memory_test_create_entry_append_existing_full_log_not_entry_aligned);
 TEST (logging_memory_test_create_entry_append_existing_full_log_start_in_middle);
@@ -2683,6 +2916,11 @@ TEST (logging_memory_test_read_contents_offset_across_wrap);
 TEST (logging_memory_test_read_contents_offset_past_end);
 TEST (logging_memory_test_read_contents_partial_read_with_offset);
 TEST (logging_memory_test_read_contents_partial_read_with_offset_across_wrap);
+TEST (logging_memory_test_get_entry_offset);
+TEST (logging_memory_test_get_entry_offset_with_wrap);
+TEST (logging_memory_test_get_entry_offset_empty);
+TEST (logging_memory_test_get_entry_offset_static_init);
+TEST (logging_memory_test_get_entry_offset_null);
 TEST (logging_memory_test_clear);
 TEST (logging_memory_test_clear_from_buffer);
 TEST (logging_memory_test_clear_append_existing);
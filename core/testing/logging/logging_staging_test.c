@@ -0,0 +1,856 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "logging/logging_staging.h"
+#include "logging/logging_staging_static.h"
+#include "testing/mock/logging/logging_mock.h"
+
+
+TEST_SUITE_LABEL ("logging_staging");
+
+
+/**
+ * Size of the staging buffer used for testing.
+ */
+#define	LOGGING_STAGING_TESTING_RING_SIZE	32
+
+
+/**
+ * Dependencies for testing.
+ */
+struct logging_staging_testing {
+	struct logging_mock log;						/**< Mock for the shared log. */
+	uint8_t ring[LOGGING_STAGING_TESTING_RING_SIZE];	/**< Staging buffer. */
+	struct logging_staging_state state;				/**< Context for the log being tested. */
+	struct logging_staging test;					/**< Staging log for testing. */
+};
+
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param test The testing framework.
+ * @param logging The testing components to initialize.
+ */
+static void logging_staging_testing_init_dependencies (CuTest *test,
+	struct logging_staging_testing *logging)
+{
+	int status;
+
+	status = logging_mock_init (&logging->log);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (logging->ring, 0x55, sizeof (logging->ring));
+}
+
+/**
+ * Initialize a staging log for testing.
+ *
+ * @param test The testing framework.
+ * @param logging The testing components to initialize.
+ */
+static void logging_staging_testing_init (CuTest *test, struct logging_staging_testing *logging)
+{
+	int status;
+
+	logging_staging_testing_init_dependencies (test, logging);
+
+	status = logging_staging_init (&logging->test, &logging->state, &logging->log.base,
+		logging->ring, sizeof (logging->ring));
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release all testing dependencies and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param logging The testing dependencies to release.
+ */
+static void logging_staging_testing_release_dependencies (CuTest *test,
+	struct logging_staging_testing *logging)
+{
+	int status;
+
+	status = logging_mock_validate_and_release (&logging->log);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release a test instance and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param logging The testing components to release.
+ */
+static void logging_staging_testing_validate_and_release (CuTest *test,
+	struct logging_staging_testing *logging)
+{
+	logging_staging_testing_release_dependencies (test, logging);
+	logging_staging_release (&logging->test);
+}
+
+/*******************
+ * Test cases
+ *******************/
+
+static void logging_staging_test_init (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init_dependencies (test, &logging);
+
+	status = logging_staging_init (&logging.test, &logging.state, &logging.log.base, logging.ring,
+		sizeof (logging.ring));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, logging.test.base.create_entry);
+#ifndef LOGGING_DISABLE_FLUSH
+	CuAssertPtrNotNull (test, logging.test.base.flush);
+#endif
+	CuAssertPtrNotNull (test, logging.test.base.clear);
+	CuAssertPtrNotNull (test, logging.test.base.get_size);
+	CuAssertPtrNotNull (test, logging.test.base.read_contents);
+	CuAssertPtrNotNull (test, logging.test.base.get_entry_offset);
+
+	CuAssertIntEquals (test, 0, logging_staging_get_dropped_count (&logging.test));
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_init_null (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init_dependencies (test, &logging);
+
+	status = logging_staging_init (NULL, &logging.state, &logging.log.base, logging.ring,
+		sizeof (logging.ring));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_staging_init (&logging.test, NULL, &logging.log.base, logging.ring,
+		sizeof (logging.ring));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_staging_init (&logging.test, &logging.state, NULL, logging.ring,
+		sizeof (logging.ring));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_staging_init (&logging.test, &logging.state, &logging.log.base, NULL,
+		sizeof (logging.ring));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_staging_testing_release_dependencies (test, &logging);
+}
+
+static void logging_staging_test_init_bad_ring_size (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init_dependencies (test, &logging);
+
+	status = logging_staging_init (&logging.test, &logging.state, &logging.log.base, logging.ring,
+		sizeof (logging.ring) - 1);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_staging_init (&logging.test, &logging.state, &logging.log.base, logging.ring,
+		sizeof (uint16_t));
+	CuAssertIntEquals (test, LOGGING_INSUFFICIENT_STORAGE, status);
+
+	status = logging_staging_init (&logging.test, &logging.state, &logging.log.base, logging.ring,
+		0);
+	CuAssertIntEquals (test, LOGGING_INSUFFICIENT_STORAGE, status);
+
+	logging_staging_testing_release_dependencies (test, &logging);
+}
+
+static void logging_staging_test_static_init (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	struct logging_staging test_static = logging_staging_static_init (&logging.state,
+		&logging.log.base, logging.ring, sizeof (logging.ring));
+	int status;
+
+	TEST_START;
+
+	CuAssertPtrNotNull (test, test_static.base.create_entry);
+#ifndef LOGGING_DISABLE_FLUSH
+	CuAssertPtrNotNull (test, test_static.base.flush);
+#endif
+	CuAssertPtrNotNull (test, test_static.base.clear);
+	CuAssertPtrNotNull (test, test_static.base.get_size);
+	CuAssertPtrNotNull (test, test_static.base.read_contents);
+	CuAssertPtrNotNull (test, test_static.base.get_entry_offset);
+
+	logging_staging_testing_init_dependencies (test, &logging);
+
+	status = logging_staging_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_release_dependencies (test, &logging);
+	logging_staging_release (&test_static);
+}
+
+static void logging_staging_test_static_init_null (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	struct logging_staging null_state = logging_staging_static_init (NULL, &logging.log.base,
+		logging.ring, sizeof (logging.ring));
+	struct logging_staging null_log = logging_staging_static_init (&logging.state, NULL,
+		logging.ring, sizeof (logging.ring));
+	struct logging_staging null_ring = logging_staging_static_init (&logging.state,
+		&logging.log.base, NULL, sizeof (logging.ring));
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init_dependencies (test, &logging);
+
+	status = logging_staging_init_state (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_staging_init_state (&null_state);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_staging_init_state (&null_log);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_staging_init_state (&null_ring);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_staging_testing_release_dependencies (test, &logging);
+}
+
+static void logging_staging_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	logging_staging_release (NULL);
+}
+
+static void logging_staging_test_create_entry (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	/* Adding entries must not touch the shared log. */
+	status = logging.test.base.create_entry (&logging.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&logging.log.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry, sizeof (entry)), MOCK_ARG (sizeof (entry)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_create_entry_static_init (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	struct logging_staging test_static = logging_staging_static_init (&logging.state,
+		&logging.log.base, logging.ring, sizeof (logging.ring));
+	uint8_t entry[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init_dependencies (test, &logging);
+
+	status = logging_staging_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	status = test_static.base.create_entry (&test_static.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry, sizeof (entry)), MOCK_ARG (sizeof (entry)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_drain (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_release_dependencies (test, &logging);
+	logging_staging_release (&test_static);
+}
+
+static void logging_staging_test_create_entry_multiple (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry1[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	uint8_t entry3[] = {0x21, 0x22, 0x23, 0x24, 0x25};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry3, sizeof (entry3));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry1, sizeof (entry1)), MOCK_ARG (sizeof (entry1)));
+	status |= mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry2, sizeof (entry2)), MOCK_ARG (sizeof (entry2)));
+	status |= mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry3, sizeof (entry3)), MOCK_ARG (sizeof (entry3)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Nothing left after draining. */
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_create_entry_wrap_around (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry1[24];
+	uint8_t entry2[8];
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (entry1); i++) {
+		entry1[i] = i;
+	}
+
+	for (i = 0; i < sizeof (entry2); i++) {
+		entry2[i] = ~i;
+	}
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry1, sizeof (entry1)), MOCK_ARG (sizeof (entry1)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The second entry doesn't fit before the end of the buffer, so it will be stored at the
+	 * beginning. */
+	status = logging.test.base.create_entry (&logging.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry2, sizeof (entry2)), MOCK_ARG (sizeof (entry2)));
+	status |= mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry2, sizeof (entry2)), MOCK_ARG (sizeof (entry2)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0, logging_staging_get_dropped_count (&logging.test));
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_create_entry_full (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry[14] = {0};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_BUFFER_FULL, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry, 1);
+	CuAssertIntEquals (test, LOGGING_BUFFER_FULL, status);
+
+	CuAssertIntEquals (test, 2, logging_staging_get_dropped_count (&logging.test));
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry, sizeof (entry)), MOCK_ARG (sizeof (entry)));
+	status |= mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry, sizeof (entry)), MOCK_ARG (sizeof (entry)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	/* There is space again after draining. */
+	status = logging.test.base.create_entry (&logging.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 2, logging_staging_get_dropped_count (&logging.test));
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_create_entry_null (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (NULL, entry, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, NULL, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_create_entry_bad_length (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry[LOGGING_STAGING_TESTING_RING_SIZE] = {0};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry, 0);
+	CuAssertIntEquals (test, LOGGING_BAD_ENTRY_LENGTH, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry,
+		sizeof (entry) - sizeof (uint16_t) + 1);
+	CuAssertIntEquals (test, LOGGING_BAD_ENTRY_LENGTH, status);
+
+	CuAssertIntEquals (test, 0, logging_staging_get_dropped_count (&logging.test));
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_drain_no_entries (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_drain_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = logging_staging_drain (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+}
+
+static void logging_staging_test_drain_create_entry_error (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry1[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log,
+		LOGGING_CREATE_ENTRY_FAILED, MOCK_ARG_PTR_CONTAINS_TMP (entry1, sizeof (entry1)),
+		MOCK_ARG (sizeof (entry1)));
+	status |= mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry2, sizeof (entry2)), MOCK_ARG (sizeof (entry2)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, LOGGING_CREATE_ENTRY_FAILED, status);
+
+	/* The failed entry is not retried. */
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+#ifndef LOGGING_DISABLE_FLUSH
+static void logging_staging_test_flush (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry, sizeof (entry)), MOCK_ARG (sizeof (entry)));
+	status |= mock_expect (&logging.log.mock, logging.log.base.flush, &logging.log, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.flush (&logging.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_flush_no_entries (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.flush, &logging.log, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.flush (&logging.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_flush_null (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.flush (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_flush_create_entry_error (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log,
+		LOGGING_CREATE_ENTRY_FAILED, MOCK_ARG_PTR_CONTAINS_TMP (entry, sizeof (entry)),
+		MOCK_ARG (sizeof (entry)));
+	status |= mock_expect (&logging.log.mock, logging.log.base.flush, &logging.log, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.flush (&logging.test.base);
+	CuAssertIntEquals (test, LOGGING_CREATE_ENTRY_FAILED, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_flush_error (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry[] = {0x01, 0x02, 0x03, 0x04};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry, sizeof (entry)), MOCK_ARG (sizeof (entry)));
+	status |= mock_expect (&logging.log.mock, logging.log.base.flush, &logging.log,
+		LOGGING_FLUSH_FAILED);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.flush (&logging.test.base);
+	CuAssertIntEquals (test, LOGGING_FLUSH_FAILED, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+#endif
+
+static void logging_staging_test_clear (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t entry1[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.create_entry (&logging.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.clear, &logging.log, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.clear (&logging.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Only entries added after the clear are kept. */
+	status = logging.test.base.create_entry (&logging.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.create_entry, &logging.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry2, sizeof (entry2)), MOCK_ARG (sizeof (entry2)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_staging_drain (&logging.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_clear_null (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.clear (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_clear_error (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.clear, &logging.log,
+		LOGGING_CLEAR_FAILED);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.clear (&logging.test.base);
+	CuAssertIntEquals (test, LOGGING_CLEAR_FAILED, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_get_size (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.get_size, &logging.log, 64);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.get_size (&logging.test.base);
+	CuAssertIntEquals (test, 64, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_get_size_null (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.get_size (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_read_contents (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t contents[16];
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.read_contents, &logging.log,
+		sizeof (contents), MOCK_ARG (8), MOCK_ARG_PTR (contents), MOCK_ARG (sizeof (contents)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.read_contents (&logging.test.base, 8, contents, sizeof (contents));
+	CuAssertIntEquals (test, sizeof (contents), status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_read_contents_null (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	uint8_t contents[16];
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.read_contents (NULL, 0, contents, sizeof (contents));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_get_entry_offset (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = mock_expect (&logging.log.mock, logging.log.base.get_entry_offset, &logging.log, 64,
+		MOCK_ARG (10));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.test.base.get_entry_offset (&logging.test.base, 10);
+	CuAssertIntEquals (test, 64, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_get_entry_offset_null (CuTest *test)
+{
+	struct logging_staging_testing logging;
+	int status;
+
+	TEST_START;
+
+	logging_staging_testing_init (test, &logging);
+
+	status = logging.test.base.get_entry_offset (NULL, 10);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_staging_testing_validate_and_release (test, &logging);
+}
+
+static void logging_staging_test_get_dropped_count_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, logging_staging_get_dropped_count (NULL));
+}
+
+
+TEST_SUITE_START (logging_staging);
+
+TEST (logging_staging_test_init);
+TEST (logging_staging_test_init_null);
+TEST (logging_staging_test_init_bad_ring_size);
+TEST (logging_staging_test_static_init);
+TEST (logging_staging_test_static_init_null);
+TEST (logging_staging_test_release_null);
+TEST (logging_staging_test_create_entry);
+TEST (logging_staging_test_create_entry_static_init);
+TEST (logging_staging_test_create_entry_multiple);
+TEST (logging_staging_test_create_entry_wrap_around);
+TEST (logging_staging_test_create_entry_full);
+TEST (logging_staging_test_create_entry_null);
+TEST (logging_staging_test_create_entry_bad_length);
+TEST (logging_staging_test_drain_no_entries);
+TEST (logging_staging_test_drain_null);
+TEST (logging_staging_test_drain_create_entry_error);
+#ifndef LOGGING_DISABLE_FLUSH
+TEST (logging_staging_test_flush);
+TEST (logging_staging_test_flush_no_entries);
+TEST (logging_staging_test_flush_null);
+TEST (logging_staging_test_flush_create_entry_error);
+TEST (logging_staging_test_flush_error);
+#endif
+TEST (logging_staging_test_clear);
+TEST (logging_staging_test_clear_null);
+TEST (logging_staging_test_clear_error);
+TEST (logging_staging_test_get_size);
+TEST (logging_staging_test_get_size_null);
+TEST (logging_staging_test_read_contents);
+TEST (logging_staging_test_read_contents_null);
+TEST (logging_staging_test_get_entry_offset);
+TEST (logging_staging_test_get_entry_offset_null);
+TEST (logging_staging_test_get_dropped_count_null);
+
+TEST_SUITE_END;
@@ -0,0 +1,277 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "logging/trace_ring.h"
+
+
+TEST_SUITE_LABEL ("trace_ring");
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void trace_ring_test_init (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[8];
+	int status;
+
+	TEST_START;
+
+	memset (&ring, 0x55, sizeof (ring));
+
+	status = trace_ring_init (&ring, events, 8, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, events, ring.events);
+	CuAssertIntEquals (test, 10, ring.thread_id);
+	CuAssertIntEquals (test, 0, trace_ring_get_event_count (&ring));
+	CuAssertPtrEquals (test, NULL, (void*) trace_ring_get_event (&ring, 0));
+}
+
+static void trace_ring_test_init_single_event (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[1];
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, 1, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0, trace_ring_get_event_count (&ring));
+}
+
+static void trace_ring_test_init_null (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[8];
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (NULL, events, 8, 10);
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+
+	status = trace_ring_init (&ring, NULL, 8, 10);
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+
+	status = trace_ring_init (&ring, events, 0, 10);
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+}
+
+static void trace_ring_test_init_count_not_power_of_two (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[8];
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, 3, 10);
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+
+	status = trace_ring_init (&ring, events, 6, 10);
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+}
+
+static void trace_ring_test_record (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[4];
+	const struct trace_ring_event *event;
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, 4, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	trace_ring_record (&ring, TRACE_RING_POINT_FLASH_READ, TRACE_RING_EVENT_BEGIN, 256, 1000);
+	CuAssertIntEquals (test, 1, trace_ring_get_event_count (&ring));
+
+	trace_ring_record (&ring, TRACE_RING_POINT_FLASH_READ, TRACE_RING_EVENT_END, 0, 2000);
+	CuAssertIntEquals (test, 2, trace_ring_get_event_count (&ring));
+
+	event = trace_ring_get_event (&ring, 0);
+	CuAssertPtrNotNull (test, event);
+	CuAssertInt64Equals (test, 1000, event->timestamp);
+	CuAssertIntEquals (test, 256, event->arg);
+	CuAssertIntEquals (test, TRACE_RING_POINT_FLASH_READ, event->point);
+	CuAssertIntEquals (test, TRACE_RING_EVENT_BEGIN, event->type);
+
+	event = trace_ring_get_event (&ring, 1);
+	CuAssertPtrNotNull (test, event);
+	CuAssertInt64Equals (test, 2000, event->timestamp);
+	CuAssertIntEquals (test, 0, event->arg);
+	CuAssertIntEquals (test, TRACE_RING_POINT_FLASH_READ, event->point);
+	CuAssertIntEquals (test, TRACE_RING_EVENT_END, event->type);
+
+	event = trace_ring_get_event (&ring, 2);
+	CuAssertPtrEquals (test, NULL, (void*) event);
+}
+
+static void trace_ring_test_record_full (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[4];
+	const struct trace_ring_event *event;
+	int status;
+	int i;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, 4, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 4; i++) {
+		trace_ring_record (&ring, TRACE_RING_POINT_HASH_UPDATE, TRACE_RING_EVENT_BEGIN, i, i * 10);
+	}
+
+	CuAssertIntEquals (test, 4, trace_ring_get_event_count (&ring));
+
+	for (i = 0; i < 4; i++) {
+		event = trace_ring_get_event (&ring, i);
+		CuAssertPtrNotNull (test, event);
+		CuAssertIntEquals (test, i, event->arg);
+		CuAssertInt64Equals (test, i * 10, event->timestamp);
+	}
+
+	event = trace_ring_get_event (&ring, 4);
+	CuAssertPtrEquals (test, NULL, (void*) event);
+}
+
+static void trace_ring_test_record_overwrite_oldest (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[4];
+	const struct trace_ring_event *event;
+	int status;
+	int i;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, 4, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 11; i++) {
+		trace_ring_record (&ring, TRACE_RING_POINT_HASH_UPDATE, TRACE_RING_EVENT_BEGIN, i, i * 10);
+	}
+
+	CuAssertIntEquals (test, 4, trace_ring_get_event_count (&ring));
+
+	for (i = 0; i < 4; i++) {
+		event = trace_ring_get_event (&ring, i);
+		CuAssertPtrNotNull (test, event);
+		CuAssertIntEquals (test, i + 7, event->arg);
+		CuAssertInt64Equals (test, (i + 7) * 10, event->timestamp);
+	}
+}
+
+static void trace_ring_test_record_single_event (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[1];
+	const struct trace_ring_event *event;
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, 1, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	trace_ring_record (&ring, TRACE_RING_POINT_MCTP_PROCESS_PACKET, TRACE_RING_EVENT_BEGIN, 1, 10);
+	trace_ring_record (&ring, TRACE_RING_POINT_MCTP_PROCESS_PACKET, TRACE_RING_EVENT_END, 2, 20);
+
+	CuAssertIntEquals (test, 1, trace_ring_get_event_count (&ring));
+
+	event = trace_ring_get_event (&ring, 0);
+	CuAssertPtrNotNull (test, event);
+	CuAssertIntEquals (test, 2, event->arg);
+	CuAssertInt64Equals (test, 20, event->timestamp);
+	CuAssertIntEquals (test, TRACE_RING_EVENT_END, event->type);
+}
+
+static void trace_ring_test_record_null (CuTest *test)
+{
+	TEST_START;
+
+	trace_ring_record (NULL, TRACE_RING_POINT_FLASH_READ, TRACE_RING_EVENT_BEGIN, 256, 1000);
+}
+
+static void trace_ring_test_clear (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[4];
+	const struct trace_ring_event *event;
+	int status;
+	int i;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, 4, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 6; i++) {
+		trace_ring_record (&ring, TRACE_RING_POINT_HASH_UPDATE, TRACE_RING_EVENT_BEGIN, i, i * 10);
+	}
+
+	trace_ring_clear (&ring);
+	CuAssertIntEquals (test, 0, trace_ring_get_event_count (&ring));
+	CuAssertPtrEquals (test, NULL, (void*) trace_ring_get_event (&ring, 0));
+
+	trace_ring_record (&ring, TRACE_RING_POINT_CMD_PROCESS_REQUEST, TRACE_RING_EVENT_BEGIN, 0x12,
+		100);
+	CuAssertIntEquals (test, 1, trace_ring_get_event_count (&ring));
+
+	event = trace_ring_get_event (&ring, 0);
+	CuAssertPtrNotNull (test, event);
+	CuAssertIntEquals (test, 0x12, event->arg);
+	CuAssertIntEquals (test, TRACE_RING_POINT_CMD_PROCESS_REQUEST, event->point);
+}
+
+static void trace_ring_test_clear_null (CuTest *test)
+{
+	TEST_START;
+
+	trace_ring_clear (NULL);
+}
+
+static void trace_ring_test_get_event_count_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, trace_ring_get_event_count (NULL));
+}
+
+static void trace_ring_test_get_event_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertPtrEquals (test, NULL, (void*) trace_ring_get_event (NULL, 0));
+}
+
+
+TEST_SUITE_START (trace_ring);
+
+TEST (trace_ring_test_init);
+TEST (trace_ring_test_init_single_event);
+TEST (trace_ring_test_init_null);
+TEST (trace_ring_test_init_count_not_power_of_two);
+TEST (trace_ring_test_record);
+TEST (trace_ring_test_record_full);
+TEST (trace_ring_test_record_overwrite_oldest);
+TEST (trace_ring_test_record_single_event);
+TEST (trace_ring_test_record_null);
+TEST (trace_ring_test_clear);
+TEST (trace_ring_test_clear_null);
+TEST (trace_ring_test_get_event_count_null);
+TEST (trace_ring_test_get_event_null);
+
+TEST_SUITE_END;
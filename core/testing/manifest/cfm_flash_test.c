@@ -7,6 +7,7 @@
 #include "testing.h"
 #include "manifest/cfm/cfm_flash.h"
 #include "manifest/cfm/cfm_format.h"
+#include "common/array_size.h"
 #include "testing/engines/hash_testing_engine.h"
 #include "flash/flash.h"
 #include "manifest_flash_v2_testing.h"
@@ -2964,6 +2965,75 @@ static void cfm_flash_test_get_component_pmr_digest (CuTest *test)
 	cfm_flash_testing_validate_and_release (test, &cfm);
 }
 
+static void cfm_flash_test_get_component_pmr_digest_with_pools (CuTest *test)
+{
+	struct cfm_pmr_digest pmr_digest;
+	struct cfm_flash_testing cfm;
+	struct object_pool_state digests_state;
+	struct object_pool digests_pool;
+	uint8_t digests_blocks[2][64];
+	struct cfm_flash_pools pools;
+	struct object_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&digests_pool, &digests_state, (uint8_t*) digests_blocks,
+		sizeof (digests_blocks[0]), ARRAY_SIZE (digests_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&pools, 0, sizeof (pools));
+	pools.digests = &digests_pool;
+
+	cfm_flash_testing_init_and_verify (test, &cfm, 0x10000, &CFM_TESTING, 0, false, 0);
+
+	cfm_flash_use_pools (&cfm.test, &pools);
+
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest,
+		CFM_TESTING.component_device1_entry, 0, CFM_TESTING.component_device1_hash,
+		CFM_TESTING.component_device1_offset, CFM_TESTING.component_device1_len,
+		CFM_TESTING.component_device1_len, 0);
+
+	manifest_flash_v2_testing_iterate_manifest_toc (test, &cfm.manifest, &CFM_TESTING.manifest, 2,
+		26);
+
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 5, 2, 5,
+		0x6e4, 0x44, sizeof (struct cfm_pmr_digest_element), 0);
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 5, 5, 5,
+		0x6e4, 0x44, 0x44 - sizeof (struct cfm_pmr_digest_element),
+		sizeof (struct cfm_pmr_digest_element));
+
+	status = cfm.test.base.get_component_pmr_digest (&cfm.test.base, 3, 0, &pmr_digest);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, pmr_digest.pmr_id);
+	CuAssertIntEquals (test, HASH_TYPE_SHA256, pmr_digest.digests.hash_type);
+	CuAssertIntEquals (test, 2, pmr_digest.digests.digest_count);
+
+	status = testing_validate_array (PMR_DIGEST_0_DEVICE_1_1, pmr_digest.digests.digests,
+		sizeof (PMR_DIGEST_0_DEVICE_1_1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (PMR_DIGEST_0_DEVICE_1_2, pmr_digest.digests.digests +
+		sizeof (PMR_DIGEST_0_DEVICE_1_1), sizeof (PMR_DIGEST_0_DEVICE_1_2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_get_stats (&digests_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	cfm.test.base.free_component_pmr_digest (&cfm.test.base, &pmr_digest);
+
+	status = object_pool_get_stats (&digests_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+	CuAssertIntEquals (test, 1, stats.high_water);
+
+	cfm_flash_testing_validate_and_release (test, &cfm);
+
+	object_pool_release (&digests_pool);
+}
+
 static void cfm_flash_test_get_component_pmr_digest_second_component (CuTest *test)
 {
 	struct cfm_pmr_digest pmr_digest;
@@ -4190,6 +4260,114 @@ static void cfm_flash_test_get_next_measurement_or_measurement_data_measurement_
 	cfm_flash_testing_validate_and_release (test, &cfm);
 }
 
+static void cfm_flash_test_get_next_measurement_or_measurement_data_measurement_first_with_pools (
+	CuTest *test)
+{
+	struct cfm_flash_testing cfm;
+	struct cfm_measurement_container container;
+	struct object_pool_state digests_state;
+	struct object_pool digests_pool;
+	uint8_t digests_blocks[2][64];
+	struct object_pool_state contexts_state;
+	struct object_pool contexts_pool;
+	uint8_t contexts_blocks[1][32];
+	struct cfm_flash_pools pools;
+	struct object_pool_stats stats;
+	size_t bytes_read = 0;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&digests_pool, &digests_state, (uint8_t*) digests_blocks,
+		sizeof (digests_blocks[0]), ARRAY_SIZE (digests_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_init (&contexts_pool, &contexts_state, (uint8_t*) contexts_blocks,
+		sizeof (contexts_blocks[0]), ARRAY_SIZE (contexts_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&pools, 0, sizeof (pools));
+	pools.digests = &digests_pool;
+	pools.contexts = &contexts_pool;
+
+	cfm_flash_testing_init_and_verify (test, &cfm, 0x10000, &CFM_TESTING, 0, false, 0);
+
+	cfm_flash_use_pools (&cfm.test, &pools);
+
+	// Read Component element
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest,
+		CFM_TESTING.component_device1_entry, 0, CFM_TESTING.component_device1_hash,
+		CFM_TESTING.component_device1_offset, CFM_TESTING.component_device1_len,
+		CFM_TESTING.component_device1_len, 0);
+
+	manifest_flash_v2_testing_iterate_manifest_toc (test, &cfm.manifest, &CFM_TESTING.manifest, 2,
+		7);
+
+	manifest_flash_v2_testing_iterate_manifest_toc (test, &cfm.manifest, &CFM_TESTING.manifest, 2,
+		9);
+
+	manifest_flash_v2_testing_iterate_manifest_toc (test, &cfm.manifest, &CFM_TESTING.manifest, 2,
+		26);
+
+	// Read Measurement element
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 7, 2, 7,
+		0x74c, 0x48, sizeof (struct cfm_measurement_element), bytes_read);
+	bytes_read += sizeof (struct cfm_measurement_element);
+
+	// Read Allowable Digest 1
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 7, 7, 7,
+		0x74c, 0x48, sizeof (struct cfm_allowable_digest_element), bytes_read);
+	bytes_read += sizeof (struct cfm_allowable_digest_element);
+
+	// Read Allowable Digest 1 digests
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 7, 7, 7,
+		0x74c, 0x48, 2 * SHA256_HASH_LENGTH, bytes_read);
+
+	status = cfm.test.base.get_next_measurement_or_measurement_data (&cfm.test.base, 3, &container,
+		true);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CFM_MEASUREMENT_TYPE_DIGEST, container.measurement_type);
+	CuAssertIntEquals (test, 1, container.measurement.digest.pmr_id);
+	CuAssertIntEquals (test, 2, container.measurement.digest.measurement_id);
+	CuAssertIntEquals (test, 1,	container.measurement.digest.allowable_digests_count);
+	CuAssertIntEquals (test, 2,
+		container.measurement.digest.allowable_digests[0].digests.digest_count);
+
+	status = testing_validate_array (MEASUREMENT_PMR_1_MEASUREMENT_2_DEVICE_1,
+		container.measurement.digest.allowable_digests[0].digests.digests,
+		sizeof (MEASUREMENT_PMR_1_MEASUREMENT_2_DEVICE_1));
+	status |= testing_validate_array (MEASUREMENT_PMR_1_MEASUREMENT_2_DEVICE_1_2,
+		container.measurement.digest.allowable_digests[0].digests.digests + \
+		sizeof (MEASUREMENT_PMR_1_MEASUREMENT_2_DEVICE_1),
+		sizeof (MEASUREMENT_PMR_1_MEASUREMENT_2_DEVICE_1_2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_get_stats (&digests_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	status = object_pool_get_stats (&contexts_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	cfm.test.base.free_measurement_container (&cfm.test.base, &container);
+
+	status = object_pool_get_stats (&digests_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+
+	status = object_pool_get_stats (&contexts_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+
+	cfm_flash_testing_validate_and_release (test, &cfm);
+
+	object_pool_release (&digests_pool);
+	object_pool_release (&contexts_pool);
+}
+
 static void cfm_flash_test_get_next_measurement_or_measurement_data_measurement_nonzero_version_set (CuTest *test)
 {
 	struct cfm_flash_testing cfm;
@@ -11001,6 +11179,7 @@ TEST (cfm_flash_test_get_component_pmr_get_num_pmr_fail);
 TEST (cfm_flash_test_get_component_pmr_pmr_read_fail);
 TEST (cfm_flash_test_get_component_pmr_pmr_not_found);
 TEST (cfm_flash_test_get_component_pmr_digest);
+TEST (cfm_flash_test_get_component_pmr_digest_with_pools);
 TEST (cfm_flash_test_get_component_pmr_digest_second_component);
 TEST (cfm_flash_test_get_component_pmr_digest_second_digest);
 TEST (cfm_flash_test_get_component_pmr_digest_null);
@@ -11038,6 +11217,7 @@ TEST (cfm_flash_test_get_component_device_malformed_component_device);
 TEST (cfm_flash_test_get_component_device_malformed_pmr_digest);
 TEST (cfm_flash_test_free_component_device_null);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_measurement_first);
+TEST (cfm_flash_test_get_next_measurement_or_measurement_data_measurement_first_with_pools);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_measurement_nonzero_version_set);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_second_measurement);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_measurement_after_measurement_data);
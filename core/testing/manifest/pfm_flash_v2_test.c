@@ -7,6 +7,7 @@
 #include "testing.h"
 #include "manifest/pfm/pfm_flash.h"
 #include "manifest/pfm/pfm_format.h"
+#include "common/array_size.h"
 #include "testing/mock/crypto/signature_verification_mock.h"
 #include "testing/mock/flash/flash_mock.h"
 #include "testing/engines/hash_testing_engine.h"
@@ -6938,6 +6939,73 @@ static void pfm_flash_v2_test_get_firmware_multiple (CuTest *test)
 	pfm_flash_v2_testing_validate_and_release (test, &pfm);
 }
 
+static void pfm_flash_v2_test_get_firmware_multiple_with_pools (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_THREE_FW_NO_VER;
+	struct object_pool_state strings_state;
+	struct object_pool strings_pool;
+	uint8_t strings_blocks[4][64];
+	struct pfm_flash_pools pools;
+	struct object_pool_stats stats;
+	int status;
+	struct pfm_firmware fw;
+	int i;
+
+	TEST_START;
+
+	status = object_pool_init (&strings_pool, &strings_state, (uint8_t*) strings_blocks,
+		sizeof (strings_blocks[0]), ARRAY_SIZE (strings_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&pools, 0, sizeof (pools));
+	pools.strings = &strings_pool;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_use_pools (&pfm.test, &pools);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[0].fw_entry, 0, test_pfm->fw[0].fw_hash, test_pfm->fw[0].fw_offset,
+		test_pfm->fw[0].fw_len, test_pfm->fw[0].fw_len, 0);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[1].fw_entry, test_pfm->fw[0].fw_entry + 1, test_pfm->fw[1].fw_hash,
+		test_pfm->fw[1].fw_offset, test_pfm->fw[1].fw_len, test_pfm->fw[1].fw_len, 0);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[2].fw_entry, test_pfm->fw[1].fw_entry + 1, test_pfm->fw[2].fw_hash,
+		test_pfm->fw[2].fw_offset, test_pfm->fw[2].fw_len, test_pfm->fw[2].fw_len, 0);
+
+	memset (&fw, 0, sizeof (fw));
+
+	status = pfm.test.base.get_firmware (&pfm.test.base, &fw);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw_count, fw.count);
+	CuAssertPtrNotNull (test, fw.ids);
+
+	for (i = 0; i < test_pfm->fw_count; i++) {
+		CuAssertPtrNotNull (test, fw.ids[i]);
+		CuAssertStrEquals (test, test_pfm->fw[i].fw_id_str, fw.ids[i]);
+	}
+
+	status = object_pool_get_stats (&strings_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw_count + 1, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	pfm.test.base.free_firmware (&pfm.test.base, &fw);
+
+	status = object_pool_get_stats (&strings_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+	CuAssertIntEquals (test, test_pfm->fw_count + 1, stats.high_water);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+
+	object_pool_release (&strings_pool);
+}
+
 static void pfm_flash_v2_test_get_firmware_no_flash_dev_element (CuTest *test)
 {
 	struct pfm_flash_v2_testing pfm;
@@ -7358,6 +7426,203 @@ static void pfm_flash_v2_test_get_supported_versions_multiple_versions (CuTest *
 	pfm_flash_v2_testing_validate_and_release (test, &pfm);
 }
 
+static void pfm_flash_v2_test_get_supported_versions_multiple_versions_with_pools (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_MULTIPLE;
+	int fw_index = 2;
+	struct object_pool_state versions_state;
+	struct object_pool versions_pool;
+	uint8_t versions_blocks[2][256];
+	struct object_pool_state strings_state;
+	struct object_pool strings_pool;
+	uint8_t strings_blocks[4][64];
+	struct pfm_flash_pools pools;
+	struct object_pool_stats stats;
+	int status;
+	struct pfm_firmware_versions ver_list;
+	int i;
+
+	TEST_START;
+
+	status = object_pool_init (&versions_pool, &versions_state, (uint8_t*) versions_blocks,
+		sizeof (versions_blocks[0]), ARRAY_SIZE (versions_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_init (&strings_pool, &strings_state, (uint8_t*) strings_blocks,
+		sizeof (strings_blocks[0]), ARRAY_SIZE (strings_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&pools, 0, sizeof (pools));
+	pools.versions = &versions_pool;
+	pools.strings = &strings_pool;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_use_pools (&pfm.test, &pools);
+
+	pfm_flash_v2_testing_find_firmware_entry (test, &pfm, test_pfm, fw_index);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[fw_index].version[0].fw_version_entry, test_pfm->fw[fw_index].fw_entry + 1,
+		test_pfm->fw[fw_index].version[0].fw_version_hash,
+		test_pfm->fw[fw_index].version[0].fw_version_offset,
+		test_pfm->fw[fw_index].version[0].fw_version_len,
+		test_pfm->fw[fw_index].version[0].fw_version_len, 0);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[fw_index].version[1].fw_version_entry,
+		test_pfm->fw[fw_index].version[0].fw_version_entry + 1,
+		test_pfm->fw[fw_index].version[1].fw_version_hash,
+		test_pfm->fw[fw_index].version[1].fw_version_offset,
+		test_pfm->fw[fw_index].version[1].fw_version_len,
+		test_pfm->fw[fw_index].version[1].fw_version_len, 0);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[fw_index].version[2].fw_version_entry,
+		test_pfm->fw[fw_index].version[1].fw_version_entry + 1,
+		test_pfm->fw[fw_index].version[2].fw_version_hash,
+		test_pfm->fw[fw_index].version[2].fw_version_offset,
+		test_pfm->fw[fw_index].version[2].fw_version_len,
+		test_pfm->fw[fw_index].version[2].fw_version_len, 0);
+
+	status = pfm.test.base.get_supported_versions (&pfm.test.base, test_pfm->fw[fw_index].fw_id_str,
+		&ver_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[fw_index].version_count, ver_list.count);
+	CuAssertPtrNotNull (test, ver_list.versions);
+
+	for (i = 0; i < test_pfm->fw[fw_index].version_count; i++) {
+		CuAssertStrEquals (test, test_pfm->fw[fw_index].version[i].version_str,
+			ver_list.versions[i].fw_version_id);
+		CuAssertIntEquals (test, test_pfm->fw[fw_index].version[i].version_addr,
+			ver_list.versions[i].version_addr);
+		CuAssertIntEquals (test, test_pfm->blank_byte, ver_list.versions[i].blank_byte);
+	}
+
+	status = object_pool_get_stats (&versions_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	status = object_pool_get_stats (&strings_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[fw_index].version_count, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	pfm.test.base.free_fw_versions (&pfm.test.base, &ver_list);
+
+	status = object_pool_get_stats (&versions_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+
+	status = object_pool_get_stats (&strings_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+
+	object_pool_release (&versions_pool);
+	object_pool_release (&strings_pool);
+}
+
+static void pfm_flash_v2_test_get_supported_versions_multiple_versions_pool_too_small (
+	CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2_MULTIPLE;
+	int fw_index = 2;
+	struct object_pool_state versions_state;
+	struct object_pool versions_pool;
+	uint8_t versions_blocks[2][sizeof (struct pfm_firmware_version)];
+	struct object_pool_state strings_state;
+	struct object_pool strings_pool;
+	uint8_t strings_blocks[1][64];
+	struct pfm_flash_pools pools;
+	struct object_pool_stats stats;
+	int status;
+	struct pfm_firmware_versions ver_list;
+	int i;
+
+	TEST_START;
+
+	status = object_pool_init (&versions_pool, &versions_state, (uint8_t*) versions_blocks,
+		sizeof (versions_blocks[0]), ARRAY_SIZE (versions_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_init (&strings_pool, &strings_state, (uint8_t*) strings_blocks,
+		sizeof (strings_blocks[0]), ARRAY_SIZE (strings_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&pools, 0, sizeof (pools));
+	pools.versions = &versions_pool;
+	pools.strings = &strings_pool;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_use_pools (&pfm.test, &pools);
+
+	pfm_flash_v2_testing_find_firmware_entry (test, &pfm, test_pfm, fw_index);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[fw_index].version[0].fw_version_entry, test_pfm->fw[fw_index].fw_entry + 1,
+		test_pfm->fw[fw_index].version[0].fw_version_hash,
+		test_pfm->fw[fw_index].version[0].fw_version_offset,
+		test_pfm->fw[fw_index].version[0].fw_version_len,
+		test_pfm->fw[fw_index].version[0].fw_version_len, 0);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[fw_index].version[1].fw_version_entry,
+		test_pfm->fw[fw_index].version[0].fw_version_entry + 1,
+		test_pfm->fw[fw_index].version[1].fw_version_hash,
+		test_pfm->fw[fw_index].version[1].fw_version_offset,
+		test_pfm->fw[fw_index].version[1].fw_version_len,
+		test_pfm->fw[fw_index].version[1].fw_version_len, 0);
+
+	manifest_flash_v2_testing_read_element (test, &pfm.manifest, &test_pfm->manifest,
+		test_pfm->fw[fw_index].version[2].fw_version_entry,
+		test_pfm->fw[fw_index].version[1].fw_version_entry + 1,
+		test_pfm->fw[fw_index].version[2].fw_version_hash,
+		test_pfm->fw[fw_index].version[2].fw_version_offset,
+		test_pfm->fw[fw_index].version[2].fw_version_len,
+		test_pfm->fw[fw_index].version[2].fw_version_len, 0);
+
+	status = pfm.test.base.get_supported_versions (&pfm.test.base, test_pfm->fw[fw_index].fw_id_str,
+		&ver_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[fw_index].version_count, ver_list.count);
+	CuAssertPtrNotNull (test, ver_list.versions);
+
+	for (i = 0; i < test_pfm->fw[fw_index].version_count; i++) {
+		CuAssertStrEquals (test, test_pfm->fw[fw_index].version[i].version_str,
+			ver_list.versions[i].fw_version_id);
+		CuAssertIntEquals (test, test_pfm->fw[fw_index].version[i].version_addr,
+			ver_list.versions[i].version_addr);
+		CuAssertIntEquals (test, test_pfm->blank_byte, ver_list.versions[i].blank_byte);
+	}
+
+	status = object_pool_get_stats (&versions_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+	CuAssertIntEquals (test, 1, stats.fallback);
+
+	status = object_pool_get_stats (&strings_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.in_use);
+	CuAssertIntEquals (test, test_pfm->fw[fw_index].version_count - 1, stats.fallback);
+
+	pfm.test.base.free_fw_versions (&pfm.test.base, &ver_list);
+
+	status = object_pool_get_stats (&strings_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+
+	object_pool_release (&versions_pool);
+	object_pool_release (&strings_pool);
+}
+
 static void pfm_flash_v2_test_get_supported_versions_null_firmware_id (CuTest *test)
 {
 	struct pfm_flash_v2_testing pfm;
@@ -8094,6 +8359,70 @@ static void pfm_flash_v2_test_get_read_write_regions (CuTest *test)
 	pfm_flash_v2_testing_validate_and_release (test, &pfm);
 }
 
+static void pfm_flash_v2_test_get_read_write_regions_with_pools (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int fw_index = 0;
+	int ver_index = 0;
+	struct object_pool_state regions_state;
+	struct object_pool regions_pool;
+	uint8_t regions_blocks[2][128];
+	struct pfm_flash_pools pools;
+	struct object_pool_stats stats;
+	int status;
+	struct pfm_read_write_regions writable;
+	int i;
+
+	TEST_START;
+
+	status = object_pool_init (&regions_pool, &regions_state, (uint8_t*) regions_blocks,
+		sizeof (regions_blocks[0]), ARRAY_SIZE (regions_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&pools, 0, sizeof (pools));
+	pools.regions = &regions_pool;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_use_pools (&pfm.test, &pools);
+
+	pfm_flash_v2_testing_find_version_entry (test, &pfm, test_pfm, fw_index, ver_index);
+
+	status = pfm.test.base.get_read_write_regions (&pfm.test.base, test_pfm->fw[fw_index].fw_id_str,
+		test_pfm->fw[fw_index].version[ver_index].version_str, &writable);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[fw_index].version[ver_index].rw_count, writable.count);
+	CuAssertPtrNotNull (test, writable.regions);
+	CuAssertPtrNotNull (test, writable.properties);
+
+	for (i = 0; i < test_pfm->fw[fw_index].version[ver_index].rw_count; i++) {
+		CuAssertIntEquals (test, test_pfm->fw[fw_index].version[ver_index].rw[i].start_addr,
+			writable.regions[i].start_addr);
+		CuAssertIntEquals (test,
+			PFM_V2_TESTING_REGION_LENGTH (&test_pfm->fw[fw_index].version[ver_index].rw[i]),
+			writable.regions[i].length);
+		CuAssertIntEquals (test, test_pfm->fw[fw_index].version[ver_index].rw[i].flags,
+			writable.properties[i].on_failure);
+	}
+
+	status = object_pool_get_stats (&regions_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	pfm.test.base.free_read_write_regions (&pfm.test.base, &writable);
+
+	status = object_pool_get_stats (&regions_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+	CuAssertIntEquals (test, 2, stats.high_water);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+
+	object_pool_release (&regions_pool);
+}
+
 static void pfm_flash_v2_test_get_read_write_regions_multiple_firmware (CuTest *test)
 {
 	struct pfm_flash_v2_testing pfm;
@@ -9253,6 +9582,97 @@ static void pfm_flash_v2_test_get_firmware_images_sha256 (CuTest *test)
 	pfm_flash_v2_testing_validate_and_release (test, &pfm);
 }
 
+static void pfm_flash_v2_test_get_firmware_images_sha256_with_pools (CuTest *test)
+{
+	struct pfm_flash_v2_testing pfm;
+	const struct pfm_v2_testing_data *test_pfm = &PFM_V2;
+	int fw_index = 0;
+	int ver_index = 0;
+	struct object_pool_state images_state;
+	struct object_pool images_pool;
+	uint8_t images_blocks[1][512];
+	struct object_pool_state regions_state;
+	struct object_pool regions_pool;
+	uint8_t regions_blocks[4][128];
+	struct pfm_flash_pools pools;
+	struct object_pool_stats stats;
+	int status;
+	struct pfm_image_list img_list;
+	int i;
+	int j;
+
+	TEST_START;
+
+	status = object_pool_init (&images_pool, &images_state, (uint8_t*) images_blocks,
+		sizeof (images_blocks[0]), ARRAY_SIZE (images_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_init (&regions_pool, &regions_state, (uint8_t*) regions_blocks,
+		sizeof (regions_blocks[0]), ARRAY_SIZE (regions_blocks));
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&pools, 0, sizeof (pools));
+	pools.images = &images_pool;
+	pools.regions = &regions_pool;
+
+	pfm_flash_v2_testing_init_and_verify (test, &pfm, 0x10000, test_pfm, 0, false, 0);
+
+	pfm_flash_use_pools (&pfm.test, &pools);
+
+	pfm_flash_v2_testing_find_version_entry (test, &pfm, test_pfm, fw_index, ver_index);
+
+	status = pfm.test.base.get_firmware_images (&pfm.test.base, test_pfm->fw[fw_index].fw_id_str,
+		test_pfm->fw[fw_index].version[ver_index].version_str, &img_list);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[fw_index].version[ver_index].img_count, img_list.count);
+	CuAssertPtrNotNull (test, img_list.images_hash);
+	CuAssertPtrEquals (test, NULL, (void*) img_list.images_sig);
+
+	for (i = 0; i < test_pfm->fw[fw_index].version[ver_index].img_count; i++) {
+		CuAssertPtrNotNull (test, img_list.images_hash[i].regions);
+		CuAssertIntEquals (test, test_pfm->fw[fw_index].version[ver_index].img[i].region_count,
+			img_list.images_hash[i].count);
+		for (j = 0; j < test_pfm->fw[fw_index].version[ver_index].img[i].region_count; j++) {
+			CuAssertIntEquals (test,
+				test_pfm->fw[fw_index].version[ver_index].img[i].region[j].start_addr,
+				img_list.images_hash[i].regions[j].start_addr);
+			CuAssertIntEquals (test,
+				PFM_V2_TESTING_REGION_LENGTH (
+					&test_pfm->fw[fw_index].version[ver_index].img[i].region[j]),
+				img_list.images_hash[i].regions[j].length);
+		}
+
+		status = testing_validate_array (test_pfm->fw[fw_index].version[ver_index].img[i].hash,
+			img_list.images_hash[i].hash, img_list.images_hash[i].hash_length);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = object_pool_get_stats (&images_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	status = object_pool_get_stats (&regions_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, test_pfm->fw[fw_index].version[ver_index].img_count, stats.in_use);
+	CuAssertIntEquals (test, 0, stats.fallback);
+
+	pfm.test.base.free_firmware_images (&pfm.test.base, &img_list);
+
+	status = object_pool_get_stats (&images_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+
+	status = object_pool_get_stats (&regions_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.in_use);
+
+	pfm_flash_v2_testing_validate_and_release (test, &pfm);
+
+	object_pool_release (&images_pool);
+	object_pool_release (&regions_pool);
+}
+
 static void pfm_flash_v2_test_get_firmware_images_multiple_firmware_sha384 (CuTest *test)
 {
 	struct pfm_flash_v2_testing pfm;
@@ -12501,6 +12921,7 @@ TEST (pfm_flash_v2_test_get_signature);
 TEST (pfm_flash_v2_test_get_signature_null);
 TEST (pfm_flash_v2_test_get_firmware);
 TEST (pfm_flash_v2_test_get_firmware_multiple);
+TEST (pfm_flash_v2_test_get_firmware_multiple_with_pools);
 TEST (pfm_flash_v2_test_get_firmware_no_flash_dev_element);
 TEST (pfm_flash_v2_test_get_firmware_no_firmware_entries);
 TEST (pfm_flash_v2_test_get_firmware_null);
@@ -12511,6 +12932,8 @@ TEST (pfm_flash_v2_test_get_firmware_bad_firmware_element_length_less_than_id);
 TEST (pfm_flash_v2_test_get_supported_versions);
 TEST (pfm_flash_v2_test_get_supported_versions_multiple_firmware);
 TEST (pfm_flash_v2_test_get_supported_versions_multiple_versions);
+TEST (pfm_flash_v2_test_get_supported_versions_multiple_versions_with_pools);
+TEST (pfm_flash_v2_test_get_supported_versions_multiple_versions_pool_too_small);
 TEST (pfm_flash_v2_test_get_supported_versions_null_firmware_id);
 TEST (pfm_flash_v2_test_get_supported_versions_no_versions);
 TEST (pfm_flash_v2_test_get_supported_versions_no_flash_dev_element_null_firmware_id);
@@ -12528,6 +12951,7 @@ TEST (pfm_flash_v2_test_get_supported_versions_bad_fw_version_element_length_les
 TEST (pfm_flash_v2_test_get_supported_versions_bad_fw_version_element_length_less_than_version);
 TEST (pfm_flash_v2_test_get_supported_versions_bad_fw_version_element_length_less_than_rw);
 TEST (pfm_flash_v2_test_get_read_write_regions);
+TEST (pfm_flash_v2_test_get_read_write_regions_with_pools);
 TEST (pfm_flash_v2_test_get_read_write_regions_multiple_firmware);
 TEST (pfm_flash_v2_test_get_read_write_regions_multiple_versions);
 TEST (pfm_flash_v2_test_get_read_write_regions_multiple_regions);
@@ -12556,6 +12980,7 @@ TEST (pfm_flash_v2_test_get_read_write_regions_bad_fw_version_element_length_les
 TEST (pfm_flash_v2_test_get_read_write_regions_end_before_start);
 TEST (pfm_flash_v2_test_get_read_write_regions_end_equals_start);
 TEST (pfm_flash_v2_test_get_firmware_images_sha256);
+TEST (pfm_flash_v2_test_get_firmware_images_sha256_with_pools);
 TEST (pfm_flash_v2_test_get_firmware_images_multiple_firmware_sha384);
 TEST (pfm_flash_v2_test_get_firmware_images_multiple_firmware_sha512);
 TEST (pfm_flash_v2_test_get_firmware_images_multiple_versions);
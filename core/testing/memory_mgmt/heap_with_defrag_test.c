@@ -3650,6 +3650,297 @@ static void heap_with_defrag_test_free_null (CuTest *test)
 	heap_with_defrag_testing_check_stats_constant_size_alloc (test, 1, 4);
 }
 
+static void heap_with_defrag_test_allocate_reuse_freed_block_same_size (CuTest *test)
+{
+	void* block1;
+	void* block2;
+	void* block3;
+	void* block4;
+	void* block5;
+	void* block6;
+	int status;
+
+	TEST_START;
+
+	status = heap_with_defrag_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_with_defrag_allocate (64);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_with_defrag_allocate (16);
+	CuAssertPtrNotNull (test, block2);
+
+	block3 = heap_with_defrag_allocate (64);
+	CuAssertPtrNotNull (test, block3);
+
+	block4 = heap_with_defrag_allocate (16);
+	CuAssertPtrNotNull (test, block4);
+
+	heap_with_defrag_free (block1);
+	heap_with_defrag_free (block3);
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 3, stats.num_free_blocks);
+
+	/* Blocks of the same size are reused without splitting the remaining free memory. */
+	block5 = heap_with_defrag_allocate (64);
+	CuAssertPtrEquals (test, block3, block5);
+
+	block6 = heap_with_defrag_allocate (61);
+	CuAssertPtrEquals (test, block1, block6);
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 4, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 1, stats.num_free_blocks);
+
+	heap_with_defrag_free (block2);
+	heap_with_defrag_free (block6);
+	heap_with_defrag_free (block4);
+	heap_with_defrag_free (block5);
+
+	heap_with_defrag_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_with_defrag_test_allocate_exact_size_before_larger_block (CuTest *test)
+{
+	void* block1;
+	void* block2;
+	void* block3;
+	void* block4;
+	void* block5;
+	int status;
+
+	TEST_START;
+
+	status = heap_with_defrag_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_with_defrag_allocate (200);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_with_defrag_allocate (16);
+	CuAssertPtrNotNull (test, block2);
+
+	block3 = heap_with_defrag_allocate (100);
+	CuAssertPtrNotNull (test, block3);
+
+	block4 = heap_with_defrag_allocate (16);
+	CuAssertPtrNotNull (test, block4);
+
+	heap_with_defrag_free (block1);
+	heap_with_defrag_free (block3);
+
+	/* The free block at the start of the heap is large enough, but the exact size is used. */
+	block5 = heap_with_defrag_allocate (100);
+	CuAssertPtrEquals (test, block3, block5);
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 3, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+	CuAssertIntEquals (test, 200 + sizeof (heap) -
+		(4 * HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN) - 200 - 16 - 100 - 16 -
+		HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN, stats.total_free_size);
+
+	heap_with_defrag_free (block2);
+	heap_with_defrag_free (block4);
+	heap_with_defrag_free (block5);
+
+	heap_with_defrag_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_with_defrag_test_allocate_free_block_too_small_for_split (CuTest *test)
+{
+	size_t size = 200 - HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN + 4;
+	void* block1;
+	void* block2;
+	void* block3;
+	int status;
+
+	TEST_START;
+
+	status = heap_with_defrag_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_with_defrag_allocate (200);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_with_defrag_allocate (16);
+	CuAssertPtrNotNull (test, block2);
+
+	heap_with_defrag_free (block1);
+
+	/* The free block is larger than the request, but not large enough to split. */
+	block3 = heap_with_defrag_allocate (size);
+	CuAssertPtrNotNull (test, block3);
+	CuAssertTrue (test, (block3 < block2));
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 16 + size, stats.total_allocated_size);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+
+	heap_with_defrag_free (block3);
+	heap_with_defrag_free (block2);
+
+	heap_with_defrag_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_with_defrag_test_allocate_from_larger_size_class (CuTest *test)
+{
+	void* block1;
+	void* block2;
+	void* block3;
+	void* block4;
+	int status;
+
+	TEST_START;
+
+	status = heap_with_defrag_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_with_defrag_allocate (1024);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_with_defrag_allocate (16);
+	CuAssertPtrNotNull (test, block2);
+
+	block3 = heap_with_defrag_allocate (sizeof (heap) - 1024 - 16 -
+		(4 * HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN));
+	CuAssertPtrNotNull (test, block3);
+
+	heap_with_defrag_free (block1);
+
+	/* The only other free block has no space, so the freed block will be split. */
+	block4 = heap_with_defrag_allocate (8);
+	CuAssertPtrNotNull (test, block4);
+	CuAssertTrue (test, ((uint8_t*) block4 > (uint8_t*) block1));
+	CuAssertTrue (test, ((uint8_t*) block4 < ((uint8_t*) block1 + 1024)));
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 3, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+
+	heap_with_defrag_free (block4);
+	heap_with_defrag_free (block2);
+	heap_with_defrag_free (block3);
+
+	heap_with_defrag_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_with_defrag_test_allocate_workload_replay (CuTest *test)
+{
+	/* Allocation sizes seen while parsing a PFM and handling attestation requests.  Element
+	 * parsing uses many small, short-lived buffers, while each attestation request holds a
+	 * transcript and certificate chain buffer until the request completes. */
+	const size_t manifest_sizes[] = {
+		8, 12, 16, 24, 32, 48, 64, 12, 16, 8, 96, 128, 24, 32, 256, 16
+	};
+	const size_t attestation_sizes[] = {
+		48, 64, 512, 1024, 32, 72
+	};
+	static uint8_t workload_heap[16384];
+	void *manifest[sizeof (manifest_sizes) / sizeof (manifest_sizes[0])];
+	void *attestation[sizeof (attestation_sizes) / sizeof (attestation_sizes[0])];
+	size_t num_manifest = sizeof (manifest_sizes) / sizeof (manifest_sizes[0]);
+	size_t num_attestation = sizeof (attestation_sizes) / sizeof (attestation_sizes[0]);
+	int round;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	status = heap_with_defrag_init (workload_heap, sizeof (workload_heap));
+	CuAssertIntEquals (test, 0, status);
+
+	for (round = 0; round < 64; round++) {
+		for (i = 0; i < num_attestation; i++) {
+			attestation[i] = heap_with_defrag_allocate (attestation_sizes[i]);
+			CuAssertPtrNotNull (test, attestation[i]);
+
+			memset (attestation[i], 0x80 + i, attestation_sizes[i]);
+		}
+
+		for (i = 0; i < num_manifest; i++) {
+			manifest[i] = heap_with_defrag_allocate (manifest_sizes[i]);
+			CuAssertPtrNotNull (test, manifest[i]);
+
+			memset (manifest[i], i, manifest_sizes[i]);
+
+			/* Parsing releases every other buffer before moving to the next element. */
+			if ((i % 2) == 1) {
+				heap_with_defrag_testing_check_value (test, i - 1, manifest[i - 1],
+					manifest_sizes[i - 1]);
+				heap_with_defrag_free (manifest[i - 1]);
+				manifest[i - 1] = NULL;
+			}
+		}
+
+		for (i = (round % 2); i < num_attestation; i += 2) {
+			heap_with_defrag_testing_check_value (test, 0x80 + i, attestation[i],
+				attestation_sizes[i]);
+			heap_with_defrag_free (attestation[i]);
+		}
+
+		for (i = 0; i < num_manifest; i++) {
+			if (manifest[i] != NULL) {
+				heap_with_defrag_testing_check_value (test, i, manifest[i], manifest_sizes[i]);
+				heap_with_defrag_free (manifest[i]);
+			}
+		}
+
+		for (i = ((round + 1) % 2); i < num_attestation; i += 2) {
+			heap_with_defrag_testing_check_value (test, 0x80 + i, attestation[i],
+				attestation_sizes[i]);
+			heap_with_defrag_free (attestation[i]);
+		}
+
+		heap_with_defrag_testing_check_stats_empty (test, sizeof (workload_heap));
+	}
+}
+
+static void heap_with_defrag_test_free_twice (CuTest *test)
+{
+	void* block1;
+	void* block2;
+	int status;
+
+	TEST_START;
+
+	status = heap_with_defrag_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_with_defrag_allocate (64);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_with_defrag_allocate (16);
+	CuAssertPtrNotNull (test, block2);
+
+	heap_with_defrag_free (block1);
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+
+	heap_with_defrag_free (block1);
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+
+	heap_with_defrag_free (block2);
+
+	heap_with_defrag_testing_check_stats_empty (test, sizeof (heap));
+}
+
 static void heap_with_defrag_test_get_stats_null (CuTest *test)
 {
 	int status;
@@ -3721,6 +4012,12 @@ TEST (heap_with_defrag_test_reallocate_zero_new_and_old_size);
 TEST (heap_with_defrag_test_reallocate_null_ptr);
 TEST (heap_with_defrag_test_free);
 TEST (heap_with_defrag_test_free_null);
+TEST (heap_with_defrag_test_allocate_reuse_freed_block_same_size);
+TEST (heap_with_defrag_test_allocate_exact_size_before_larger_block);
+TEST (heap_with_defrag_test_allocate_free_block_too_small_for_split);
+TEST (heap_with_defrag_test_allocate_from_larger_size_class);
+TEST (heap_with_defrag_test_allocate_workload_replay);
+TEST (heap_with_defrag_test_free_twice);
 TEST (heap_with_defrag_test_get_stats_null);
 
 TEST_SUITE_END;
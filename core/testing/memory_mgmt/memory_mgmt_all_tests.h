@@ -29,6 +29,12 @@ static void add_all_memory_mgmt_tests (CuSuite *suite)
 #endif
 
 */
+#if (defined TESTING_RUN_OBJECT_POOL_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_OBJECT_POOL_SUITE
+	TESTING_RUN_SUITE (object_pool);
+#endif
 }
 
 
@@ -0,0 +1,477 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "testing.h"
+#include "memory_mgmt/object_pool.h"
+#include "memory_mgmt/object_pool_static.h"
+
+
+TEST_SUITE_LABEL ("object_pool");
+
+
+/**
+ * Number of blocks in the test pool.
+ */
+#define	OBJECT_POOL_TESTING_BLOCKS		4
+
+/**
+ * Size of each block in the test pool.
+ */
+#define	OBJECT_POOL_TESTING_BLOCK_SIZE	32
+
+
+/**
+ * Dependencies for testing the object pool.
+ */
+struct object_pool_testing {
+	struct object_pool_state state;		/**< Context for the pool. */
+	uint64_t blocks[(OBJECT_POOL_TESTING_BLOCKS * OBJECT_POOL_TESTING_BLOCK_SIZE) / 8];	/**< Pool storage. */
+	struct object_pool test;			/**< Pool under test. */
+};
+
+
+/**
+ * Initialize an object pool for testing.
+ *
+ * @param test The test framework.
+ * @param pool Testing components to initialize.
+ */
+static void object_pool_testing_init (CuTest *test, struct object_pool_testing *pool)
+{
+	int status;
+
+	status = object_pool_init (&pool->test, &pool->state, (uint8_t*) pool->blocks,
+		OBJECT_POOL_TESTING_BLOCK_SIZE, OBJECT_POOL_TESTING_BLOCKS);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Check that a block was allocated from the test pool.
+ *
+ * @param test The test framework.
+ * @param pool Testing components for the pool.
+ * @param block The block to check.
+ */
+static void object_pool_testing_check_pool_block (CuTest *test, struct object_pool_testing *pool,
+	void *block)
+{
+	uint8_t *start = (uint8_t*) pool->blocks;
+
+	CuAssertPtrNotNull (test, block);
+	CuAssertTrue (test, ((uint8_t*) block >= start));
+	CuAssertTrue (test, ((uint8_t*) block < (start + sizeof (pool->blocks))));
+	CuAssertIntEquals (test, 0, ((uint8_t*) block - start) % OBJECT_POOL_TESTING_BLOCK_SIZE);
+}
+
+/**
+ * Check the usage statistics for the test pool.
+ *
+ * @param test The test framework.
+ * @param pool Testing components for the pool.
+ * @param in_use Expected number of blocks in use.
+ * @param high_water Expected high-water mark.
+ * @param fallback Expected number of allocations from the system heap.
+ */
+static void object_pool_testing_check_stats (CuTest *test, struct object_pool_testing *pool,
+	size_t in_use, size_t high_water, uint32_t fallback)
+{
+	struct object_pool_stats stats;
+	int status;
+
+	status = object_pool_get_stats (&pool->test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, in_use, stats.in_use);
+	CuAssertIntEquals (test, high_water, stats.high_water);
+	CuAssertIntEquals (test, fallback, stats.fallback);
+}
+
+/*******************
+ * Test cases
+ *******************/
+
+static void object_pool_test_init (CuTest *test)
+{
+	struct object_pool_testing pool;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+	object_pool_testing_check_stats (test, &pool, 0, 0, 0);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_init_null (CuTest *test)
+{
+	struct object_pool_testing pool;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (NULL, &pool.state, (uint8_t*) pool.blocks,
+		OBJECT_POOL_TESTING_BLOCK_SIZE, OBJECT_POOL_TESTING_BLOCKS);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init (&pool.test, NULL, (uint8_t*) pool.blocks,
+		OBJECT_POOL_TESTING_BLOCK_SIZE, OBJECT_POOL_TESTING_BLOCKS);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init (&pool.test, &pool.state, NULL, OBJECT_POOL_TESTING_BLOCK_SIZE,
+		OBJECT_POOL_TESTING_BLOCKS);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init (&pool.test, &pool.state, (uint8_t*) pool.blocks, 0,
+		OBJECT_POOL_TESTING_BLOCKS);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init (&pool.test, &pool.state, (uint8_t*) pool.blocks,
+		OBJECT_POOL_TESTING_BLOCK_SIZE, 0);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+}
+
+static void object_pool_test_init_bad_block_size (CuTest *test)
+{
+	struct object_pool_testing pool;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool.test, &pool.state, (uint8_t*) pool.blocks,
+		sizeof (uint8_t*) + 1, OBJECT_POOL_TESTING_BLOCKS);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+}
+
+static void object_pool_test_static_init (CuTest *test)
+{
+	struct object_pool_testing pool = {
+		.test = object_pool_static_init (&pool.state, (uint8_t*) pool.blocks,
+			OBJECT_POOL_TESTING_BLOCK_SIZE, OBJECT_POOL_TESTING_BLOCKS)
+	};
+	void *block;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init_state (&pool.test);
+	CuAssertIntEquals (test, 0, status);
+
+	block = object_pool_allocate (&pool.test, OBJECT_POOL_TESTING_BLOCK_SIZE);
+	object_pool_testing_check_pool_block (test, &pool, block);
+
+	object_pool_testing_check_stats (test, &pool, 1, 1, 0);
+
+	object_pool_free (&pool.test, block);
+	object_pool_testing_check_stats (test, &pool, 0, 1, 0);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_static_init_null (CuTest *test)
+{
+	struct object_pool_testing pool;
+	struct object_pool null_state = object_pool_static_init (NULL, (uint8_t*) pool.blocks,
+		OBJECT_POOL_TESTING_BLOCK_SIZE, OBJECT_POOL_TESTING_BLOCKS);
+	struct object_pool null_blocks = object_pool_static_init (&pool.state, NULL,
+		OBJECT_POOL_TESTING_BLOCK_SIZE, OBJECT_POOL_TESTING_BLOCKS);
+	struct object_pool bad_size = object_pool_static_init (&pool.state, (uint8_t*) pool.blocks,
+		3, OBJECT_POOL_TESTING_BLOCKS);
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init_state (NULL);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init_state (&null_state);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init_state (&null_blocks);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init_state (&bad_size);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+}
+
+static void object_pool_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	object_pool_release (NULL);
+}
+
+static void object_pool_test_allocate (CuTest *test)
+{
+	struct object_pool_testing pool;
+	void *block[OBJECT_POOL_TESTING_BLOCKS];
+	size_t i;
+	size_t j;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	for (i = 0; i < OBJECT_POOL_TESTING_BLOCKS; i++) {
+		block[i] = object_pool_allocate (&pool.test, OBJECT_POOL_TESTING_BLOCK_SIZE - i);
+		object_pool_testing_check_pool_block (test, &pool, block[i]);
+
+		for (j = 0; j < i; j++) {
+			CuAssertTrue (test, (block[i] != block[j]));
+		}
+
+		memset (block[i], i, OBJECT_POOL_TESTING_BLOCK_SIZE);
+	}
+
+	object_pool_testing_check_stats (test, &pool, OBJECT_POOL_TESTING_BLOCKS,
+		OBJECT_POOL_TESTING_BLOCKS, 0);
+
+	for (i = 0; i < OBJECT_POOL_TESTING_BLOCKS; i++) {
+		for (j = 0; j < OBJECT_POOL_TESTING_BLOCK_SIZE; j++) {
+			CuAssertIntEquals (test, i, ((uint8_t*) block[i])[j]);
+		}
+
+		object_pool_free (&pool.test, block[i]);
+	}
+
+	object_pool_testing_check_stats (test, &pool, 0, OBJECT_POOL_TESTING_BLOCKS, 0);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_allocate_reuse_freed_block (CuTest *test)
+{
+	struct object_pool_testing pool;
+	void *block1;
+	void *block2;
+	void *block3;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	block1 = object_pool_allocate (&pool.test, 16);
+	object_pool_testing_check_pool_block (test, &pool, block1);
+
+	block2 = object_pool_allocate (&pool.test, 16);
+	object_pool_testing_check_pool_block (test, &pool, block2);
+
+	object_pool_free (&pool.test, block1);
+	object_pool_testing_check_stats (test, &pool, 1, 2, 0);
+
+	block3 = object_pool_allocate (&pool.test, 16);
+	CuAssertPtrEquals (test, block1, block3);
+
+	object_pool_testing_check_stats (test, &pool, 2, 2, 0);
+
+	object_pool_free (&pool.test, block2);
+	object_pool_free (&pool.test, block3);
+
+	object_pool_testing_check_stats (test, &pool, 0, 2, 0);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_allocate_pool_empty (CuTest *test)
+{
+	struct object_pool_testing pool;
+	void *block[OBJECT_POOL_TESTING_BLOCKS];
+	void *heap;
+	size_t i;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	for (i = 0; i < OBJECT_POOL_TESTING_BLOCKS; i++) {
+		block[i] = object_pool_allocate (&pool.test, OBJECT_POOL_TESTING_BLOCK_SIZE);
+		object_pool_testing_check_pool_block (test, &pool, block[i]);
+	}
+
+	heap = object_pool_allocate (&pool.test, OBJECT_POOL_TESTING_BLOCK_SIZE);
+	CuAssertPtrNotNull (test, heap);
+	CuAssertTrue (test, ((uint8_t*) heap < (uint8_t*) pool.blocks) ||
+		((uint8_t*) heap >= ((uint8_t*) pool.blocks + sizeof (pool.blocks))));
+
+	memset (heap, 0x55, OBJECT_POOL_TESTING_BLOCK_SIZE);
+
+	object_pool_testing_check_stats (test, &pool, OBJECT_POOL_TESTING_BLOCKS,
+		OBJECT_POOL_TESTING_BLOCKS, 1);
+
+	object_pool_free (&pool.test, heap);
+
+	object_pool_testing_check_stats (test, &pool, OBJECT_POOL_TESTING_BLOCKS,
+		OBJECT_POOL_TESTING_BLOCKS, 1);
+
+	for (i = 0; i < OBJECT_POOL_TESTING_BLOCKS; i++) {
+		object_pool_free (&pool.test, block[i]);
+	}
+
+	object_pool_testing_check_stats (test, &pool, 0, OBJECT_POOL_TESTING_BLOCKS, 1);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_allocate_larger_than_block (CuTest *test)
+{
+	struct object_pool_testing pool;
+	void *heap;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	heap = object_pool_allocate (&pool.test, OBJECT_POOL_TESTING_BLOCK_SIZE + 1);
+	CuAssertPtrNotNull (test, heap);
+	CuAssertTrue (test, ((uint8_t*) heap < (uint8_t*) pool.blocks) ||
+		((uint8_t*) heap >= ((uint8_t*) pool.blocks + sizeof (pool.blocks))));
+
+	memset (heap, 0x55, OBJECT_POOL_TESTING_BLOCK_SIZE + 1);
+
+	object_pool_testing_check_stats (test, &pool, 0, 0, 1);
+
+	object_pool_free (&pool.test, heap);
+
+	object_pool_testing_check_stats (test, &pool, 0, 0, 1);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_allocate_null (CuTest *test)
+{
+	void *heap;
+
+	TEST_START;
+
+	heap = object_pool_allocate (NULL, OBJECT_POOL_TESTING_BLOCK_SIZE);
+	CuAssertPtrNotNull (test, heap);
+
+	memset (heap, 0x55, OBJECT_POOL_TESTING_BLOCK_SIZE);
+
+	object_pool_free (NULL, heap);
+}
+
+static void object_pool_test_allocate_zeroize (CuTest *test)
+{
+	struct object_pool_testing pool;
+	uint8_t zero[OBJECT_POOL_TESTING_BLOCK_SIZE] = {0};
+	void *block;
+	int status;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	memset (pool.blocks, 0xff, sizeof (pool.blocks));
+
+	block = object_pool_allocate_zeroize (&pool.test, 4, OBJECT_POOL_TESTING_BLOCK_SIZE / 4);
+	object_pool_testing_check_pool_block (test, &pool, block);
+
+	status = testing_validate_array (zero, block, sizeof (zero));
+	CuAssertIntEquals (test, 0, status);
+
+	object_pool_testing_check_stats (test, &pool, 1, 1, 0);
+
+	object_pool_free (&pool.test, block);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_allocate_zeroize_larger_than_block (CuTest *test)
+{
+	struct object_pool_testing pool;
+	uint8_t zero[OBJECT_POOL_TESTING_BLOCK_SIZE * 2] = {0};
+	void *heap;
+	int status;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	heap = object_pool_allocate_zeroize (&pool.test, 2, OBJECT_POOL_TESTING_BLOCK_SIZE);
+	CuAssertPtrNotNull (test, heap);
+
+	status = testing_validate_array (zero, heap, sizeof (zero));
+	CuAssertIntEquals (test, 0, status);
+
+	object_pool_testing_check_stats (test, &pool, 0, 0, 1);
+
+	object_pool_free (&pool.test, heap);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_allocate_zeroize_overflow (CuTest *test)
+{
+	struct object_pool_testing pool;
+	void *block;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	block = object_pool_allocate_zeroize (&pool.test, SIZE_MAX / 2, 4);
+	CuAssertPtrEquals (test, NULL, block);
+
+	object_pool_testing_check_stats (test, &pool, 0, 0, 0);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_free_null (CuTest *test)
+{
+	struct object_pool_testing pool;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	object_pool_free (&pool.test, NULL);
+	object_pool_free (NULL, NULL);
+
+	object_pool_testing_check_stats (test, &pool, 0, 0, 0);
+
+	object_pool_release (&pool.test);
+}
+
+static void object_pool_test_get_stats_null (CuTest *test)
+{
+	struct object_pool_testing pool;
+	struct object_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	object_pool_testing_init (test, &pool);
+
+	status = object_pool_get_stats (NULL, &stats);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_get_stats (&pool.test, NULL);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	object_pool_release (&pool.test);
+}
+
+
+TEST_SUITE_START (object_pool);
+
+TEST (object_pool_test_init);
+TEST (object_pool_test_init_null);
+TEST (object_pool_test_init_bad_block_size);
+TEST (object_pool_test_static_init);
+TEST (object_pool_test_static_init_null);
+TEST (object_pool_test_release_null);
+TEST (object_pool_test_allocate);
+TEST (object_pool_test_allocate_reuse_freed_block);
+TEST (object_pool_test_allocate_pool_empty);
+TEST (object_pool_test_allocate_larger_than_block);
+TEST (object_pool_test_allocate_null);
+TEST (object_pool_test_allocate_zeroize);
+TEST (object_pool_test_allocate_zeroize_larger_than_block);
+TEST (object_pool_test_allocate_zeroize_overflow);
+TEST (object_pool_test_free_null);
+TEST (object_pool_test_get_stats_null);
+
+TEST_SUITE_END;
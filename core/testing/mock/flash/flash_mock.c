@@ -443,6 +443,71 @@ int flash_mock_expect_erase_flash_sector_ext (struct flash_mock *mock, uint32_t
 	return status;
 }
 
+/**
+ * Set up expectations for successfully erasing flash with a mix of blocks and sectors.
+ *
+ * @param mock The mock to update.
+ * @param addr The starting address of the region.
+ * @param length The length of the region to erase.
+ *
+ * @return 0 if the expectations were added successfully or non-zero if not.
+ */
+int flash_mock_expect_erase_flash_mixed (struct flash_mock *mock, uint32_t addr, size_t length)
+{
+	return flash_mock_expect_erase_flash_mixed_ext (mock, addr, length, FLASH_SECTOR_SIZE,
+		FLASH_BLOCK_SIZE);
+}
+
+/**
+ * Set up expectations for successfully erasing flash with a mix of blocks and sectors.
+ *
+ * @param mock The mock to update.
+ * @param addr The starting address of the region.
+ * @param length The length of the region to erase.
+ * @param sector_size The erase sector size.
+ * @param block_size The erase block size.
+ *
+ * @return 0 if the expectations were added successfully or non-zero if not.
+ */
+int flash_mock_expect_erase_flash_mixed_ext (struct flash_mock *mock, uint32_t addr, size_t length,
+	uint32_t sector_size, uint32_t block_size)
+{
+	int status;
+	size_t block_length;
+	size_t erase_length;
+
+	status = mock_expect (&mock->mock, mock->base.get_sector_size, mock, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&mock->mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	status |= mock_expect (&mock->mock, mock->base.get_block_size, mock, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&mock->mock, 0, &block_size, sizeof (block_size), -1);
+
+	if (length > 0) {
+		length += FLASH_REGION_OFFSET (addr, sector_size);
+		addr = FLASH_REGION_BASE (addr, sector_size);
+	}
+
+	while ((status == 0) && (length > 0)) {
+		block_length = block_size - FLASH_REGION_OFFSET (addr, block_size);
+		erase_length = (length > block_length) ? block_length : length;
+
+		if ((block_size > sector_size) && ((erase_length == block_size) ||
+			(((erase_length + sector_size - 1) / sector_size) >= FLASH_MIXED_ERASE_SECTOR_LIMIT))) {
+			status |= mock_expect (&mock->mock, mock->base.block_erase, mock, 0,
+				MOCK_ARG (FLASH_REGION_BASE (addr, block_size)));
+		}
+		else {
+			block_length = sector_size;
+			status |= mock_expect (&mock->mock, mock->base.sector_erase, mock, 0, MOCK_ARG (addr));
+		}
+
+		addr += block_length;
+		length -= (length > block_length) ? block_length : length;
+	}
+
+	return status;
+}
+
 /**
  * Set up expectations for successfully erasing a region of flash blocks with a blank check.
  *
@@ -514,6 +579,46 @@ int flash_mock_expect_erase_flash_sector_verify_ext (struct flash_mock *mock, ui
 	return status;
 }
 
+/**
+ * Set up expectations for successfully erasing a region of flash with a mix of blocks and sectors
+ * and a blank check.
+ *
+ * @param mock The mock to update.
+ * @param addr The starting address of the region.
+ * @param length The length of the region.
+ *
+ * @return 0 if the expectations were added successfully or non-zero if not.
+ */
+int flash_mock_expect_erase_flash_mixed_verify (struct flash_mock *mock, uint32_t addr,
+	size_t length)
+{
+	return flash_mock_expect_erase_flash_mixed_verify_ext (mock, addr, length, FLASH_SECTOR_SIZE,
+		FLASH_BLOCK_SIZE);
+}
+
+/**
+ * Set up expectations for successfully erasing a region of flash with a mix of blocks and sectors
+ * and a blank check.
+ *
+ * @param mock The mock to update.
+ * @param addr The starting address of the region.
+ * @param length The length of the region.
+ * @param sector_size The erase sector size.
+ * @param block_size The erase block size.
+ *
+ * @return 0 if the expectations were added successfully or non-zero if not.
+ */
+int flash_mock_expect_erase_flash_mixed_verify_ext (struct flash_mock *mock, uint32_t addr,
+	size_t length, uint32_t sector_size, uint32_t block_size)
+{
+	int status;
+
+	status = flash_mock_expect_erase_flash_mixed_ext (mock, addr, length, sector_size, block_size);
+	status |= flash_mock_expect_blank_check (mock, addr, length);
+
+	return status;
+}
+
 /**
  * Set up expectations for successfully copying flash data.
  *
@@ -65,6 +65,17 @@ static int logging_mock_read_contents (const struct logging *logging, uint32_t o
 		MOCK_ARG_PTR_CALL (contents), MOCK_ARG_CALL (length));
 }
 
+static int logging_mock_get_entry_offset (const struct logging *logging, uint32_t entry_id)
+{
+	struct logging_mock *mock = (struct logging_mock*) logging;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, logging_mock_get_entry_offset, logging, MOCK_ARG_CALL (entry_id));
+}
+
 static int logging_mock_func_arg_count (void *func)
 {
 	if (func == logging_mock_read_contents) {
@@ -73,6 +84,9 @@ static int logging_mock_func_arg_count (void *func)
 	else if (func == logging_mock_create_entry) {
 		return 2;
 	}
+	else if (func == logging_mock_get_entry_offset) {
+		return 1;
+	}
 	else {
 		return 0;
 	}
@@ -95,6 +109,9 @@ static const char* logging_mock_func_name_map (void *func)
 	else if (func == logging_mock_read_contents) {
 		return "read_contents";
 	}
+	else if (func == logging_mock_get_entry_offset) {
+		return "get_entry_offset";
+	}
 	else {
 		return "unknown";
 	}
@@ -123,6 +140,12 @@ static const char* logging_mock_arg_name_map (void *func, int arg)
 				return "length";
 		}
 	}
+	else if (func == logging_mock_get_entry_offset) {
+		switch (arg) {
+			case 0:
+				return "entry_id";
+		}
+	}
 
 	return "unknown";
 }
@@ -156,6 +179,7 @@ int logging_mock_init (struct logging_mock *mock)
 	mock->base.clear = logging_mock_clear;
 	mock->base.get_size = logging_mock_get_size;
 	mock->base.read_contents = logging_mock_read_contents;
+	mock->base.get_entry_offset = logging_mock_get_entry_offset;
 
 	mock->mock.func_arg_count = logging_mock_func_arg_count;
 	mock->mock.func_name_map = logging_mock_func_name_map;
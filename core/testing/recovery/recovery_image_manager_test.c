@@ -4526,7 +4526,7 @@ static void recovery_image_manager_test_erase_all_recovery_regions (CuTest *test
 		&verification.base, &pfm_manager.base, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000,
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
 		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
@@ -4661,7 +4661,7 @@ static void recovery_image_manager_test_erase_all_recovery_regions_image_in_use
 
 	manager.free_recovery_image (&manager, active);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000,
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
 		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
@@ -4735,7 +4735,7 @@ static void recovery_image_manager_test_erase_all_recovery_regions_during_update
 	status = manager.clear_recovery_image_region (&manager, RECOVERY_IMAGE_DATA_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000,
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
 		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
@@ -4774,6 +4774,8 @@ static void recovery_image_manager_test_erase_all_recovery_regions_erase_error (
 	struct pfm_manager_mock pfm_manager;
 	struct flash_mock flash;
 	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -4804,8 +4806,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_erase_error (
 		&verification.base, &pfm_manager.base, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0,
-        MOCK_ARG_NOT_NULL);
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 
 	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, FLASH_BLOCK_ERASE_FAILED,
         MOCK_ARG (0x10000));
@@ -4881,7 +4885,7 @@ static void recovery_image_manager_test_erase_all_recovery_regions_valid_image_n
 	status = recovery_image_manager_add_observer (&manager, &observer.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000,
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
 		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	status |= mock_expect (&observer.mock, observer.base.on_recovery_image_deactivated, &observer,
 		0);
@@ -4961,7 +4965,7 @@ static void recovery_image_manager_test_erase_all_recovery_regions_invalid_image
 	status = recovery_image_manager_add_observer (&manager, &observer.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000,
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
 		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
@@ -14253,8 +14257,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_region1 (CuTe
 		&hash.base, &verification.base, &pfm_manager.base, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -14346,8 +14352,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_region2 (CuTe
 		&hash.base, &verification.base, &pfm_manager.base, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -14616,7 +14624,8 @@ static void recovery_image_manager_test_erase_all_recovery_regions_in_use_region
 
 	active = manager.get_active_recovery_image (&manager);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
 	status = manager.erase_all_recovery_regions (&manager);
@@ -14624,8 +14633,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_in_use_region
 
 	manager.free_recovery_image (&manager, active);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -14720,7 +14731,8 @@ static void recovery_image_manager_test_erase_all_recovery_regions_in_use_region
 
 	active = manager.get_active_recovery_image (&manager);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
 	status = manager.erase_all_recovery_regions (&manager);
@@ -14728,8 +14740,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_in_use_region
 
 	manager.free_recovery_image (&manager, active);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -14782,6 +14796,8 @@ static void recovery_image_manager_test_erase_all_recovery_regions_erase_error_r
 	struct flash_mock flash;
 	struct host_state_manager state;
 	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -14822,9 +14838,12 @@ static void recovery_image_manager_test_erase_all_recovery_regions_erase_error_r
 		&hash.base, &verification.base, &pfm_manager.base, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0,
-        MOCK_ARG_NOT_NULL);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, FLASH_BLOCK_ERASE_FAILED,
         MOCK_ARG (0x10000));
 
@@ -14878,6 +14897,8 @@ static void recovery_image_manager_test_erase_all_recovery_regions_erase_error_r
 	struct flash_mock flash;
 	struct host_state_manager state;
 	int status;
+	uint32_t sector = FLASH_SECTOR_SIZE;
+	uint32_t block = FLASH_BLOCK_SIZE;
 
 	TEST_START;
 
@@ -14918,9 +14939,12 @@ static void recovery_image_manager_test_erase_all_recovery_regions_erase_error_r
 		&hash.base, &verification.base, &pfm_manager.base, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0,
-        MOCK_ARG_NOT_NULL);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector, sizeof (sector), -1);
+	status |= mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block, sizeof (block), -1);
 	status |= mock_expect (&flash.mock, flash.base.block_erase, &flash, FLASH_BLOCK_ERASE_FAILED,
         MOCK_ARG (0x20000));
 
@@ -15021,8 +15045,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_valid_image_n
 	status = recovery_image_manager_add_observer (&manager, &observer.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	status |= mock_expect (&observer.mock, observer.base.on_recovery_image_deactivated, &observer,
 		0);
 
@@ -15128,8 +15154,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_invalid_image
 	status = recovery_image_manager_add_observer (&manager, &observer.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -15232,8 +15260,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_valid_image_n
 	status = recovery_image_manager_add_observer (&manager, &observer.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 	status |= mock_expect (&observer.mock, observer.base.on_recovery_image_deactivated, &observer,
 		0);
 
@@ -15339,8 +15369,10 @@ static void recovery_image_manager_test_erase_all_recovery_regions_invalid_image
 	status = recovery_image_manager_add_observer (&manager, &observer.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_mock_expect_erase_flash (&flash, 0x10000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
-	status |= flash_mock_expect_erase_flash (&flash, 0x20000, RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status = flash_mock_expect_erase_flash_mixed (&flash, 0x10000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
+	status |= flash_mock_expect_erase_flash_mixed (&flash, 0x20000,
+		RECOVERY_IMAGE_MANAGER_IMAGE_MAX_LEN);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -23,6 +23,17 @@ const uint8_t RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0[] = {
 const size_t RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_TOTAL_LEN =
 	sizeof (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0);
 
+/**
+ * Example section header using format 1.
+ */
+const uint8_t RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1[] = {
+	0x15,0x00,0x01,0x00,0x31,0x2f,0x17,0x4b,0x00,0x04,0x00,0x00,0x00,0x10,0x00,0x00,
+	0x00,0x00,0x08,0x00,0x01
+};
+
+const size_t RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN =
+	sizeof (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1);
+
 /**
  * The host write address in the example section header.
  */
@@ -33,6 +44,11 @@ const uint32_t RECOVERY_IMAGE_SECTION_HEADER_WRITE_ADDRESS = 0x400;
  */
 const int RECOVERY_IMAGE_SECTION_HEADER_IMAGE_LENGTH = 0x80000;
 
+/**
+ * The compressed section image length in the example format 1 section header.
+ */
+const int RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_IMAGE_LENGTH = 0x1000;
+
 
 /*******************
  * Test cases
@@ -71,6 +87,86 @@ static void recovery_image_section_header_test_init_format0 (CuTest *test)
 	recovery_image_section_header_release (&header);
 }
 
+static void recovery_image_section_header_test_init_format1 (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
+static void recovery_image_section_header_test_init_format1_uncompressed (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	uint8_t header_data[RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN];
+	enum recovery_image_section_compression compression;
+	size_t length;
+	int status;
+
+	TEST_START;
+
+	memcpy (header_data, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1, sizeof (header_data));
+	*((uint32_t*) &header_data[IMAGE_HEADER_BASE_LEN + 8]) = 0x1000;
+	header_data[IMAGE_HEADER_BASE_LEN + 12] = RECOVERY_IMAGE_SECTION_COMPRESSION_NONE;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, header_data, sizeof (header_data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, header_data + IMAGE_HEADER_BASE_LEN,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_compression (&header, &compression);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_COMPRESSION_NONE, compression);
+
+	status = recovery_image_section_header_get_host_length (&header, &length);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0x1000, length);
+
+	recovery_image_section_header_release (&header);
+}
+
 static void recovery_image_section_header_test_init_unknown_format_max_length (CuTest *test)
 {
 	struct flash_mock flash;
@@ -295,6 +391,100 @@ static void recovery_image_section_header_test_init_format0_too_long (CuTest *te
 	CuAssertIntEquals (test, 0, status);
 }
 
+static void recovery_image_section_header_test_init_format1_too_short (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	int status;
+	uint8_t bad_header[RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN];
+
+	TEST_START;
+
+	memcpy (bad_header, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN);
+	bad_header[0] -= 1;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, bad_header, sizeof (bad_header), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_BAD_FORMAT_LENGTH, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void recovery_image_section_header_test_init_format1_too_long (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	int status;
+	uint8_t bad_header[RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN];
+
+	TEST_START;
+
+	memcpy (bad_header, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN);
+	bad_header[0] += 1;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, bad_header, sizeof (bad_header), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_BAD_FORMAT_LENGTH, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void recovery_image_section_header_test_init_format1_uncompressed_host_length_mismatch (
+	CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	int status;
+	uint8_t bad_header[RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN];
+
+	TEST_START;
+
+	memcpy (bad_header, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN);
+	bad_header[IMAGE_HEADER_BASE_LEN + 12] = RECOVERY_IMAGE_SECTION_COMPRESSION_NONE;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, bad_header, sizeof (bad_header), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, bad_header + IMAGE_HEADER_BASE_LEN,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_BAD_HOST_LENGTH, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
 static void recovery_image_section_header_test_init_unknown_format_too_short (CuTest *test)
 {
 	struct flash_mock flash;
@@ -402,6 +592,47 @@ static void recovery_image_section_header_test_get_section_image_length_format0
 	recovery_image_section_header_release (&header);
 }
 
+static void recovery_image_section_header_test_get_section_image_length_format1 (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	size_t length;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_section_image_length (&header, &length);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_IMAGE_LENGTH, length);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
 static void recovery_image_section_header_test_get_section_image_length_unknown_format (CuTest *test)
 {
 	struct flash_mock flash;
@@ -532,6 +763,47 @@ static void recovery_image_section_header_test_get_host_write_addr_format0 (CuTe
 	recovery_image_section_header_release (&header);
 }
 
+static void recovery_image_section_header_test_get_host_write_addr_format1 (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	uint32_t addr;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_host_write_addr (&header, &addr);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_WRITE_ADDRESS, addr);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
 static void recovery_image_section_header_test_get_host_write_addr_unknown_format (CuTest *test)
 {
 	struct flash_mock flash;
@@ -705,10 +977,262 @@ static void recovery_image_section_header_test_get_length_null (CuTest *test)
 	recovery_image_section_header_release (&header);
 }
 
+static void recovery_image_section_header_test_get_host_length_format0 (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	size_t length;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_host_length (&header, &length);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_IMAGE_LENGTH, length);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
+static void recovery_image_section_header_test_get_host_length_format1 (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	size_t length;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_host_length (&header, &length);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_IMAGE_LENGTH, length);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
+static void recovery_image_section_header_test_get_host_length_null (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	int status;
+	size_t length;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_host_length (NULL, &length);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_INVALID_ARGUMENT, status);
+
+	status = recovery_image_section_header_get_host_length (&header, NULL);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
+static void recovery_image_section_header_test_get_compression_format0 (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	enum recovery_image_section_compression compression;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_compression (&header, &compression);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_COMPRESSION_NONE, compression);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
+static void recovery_image_section_header_test_get_compression_format1 (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	enum recovery_image_section_compression compression;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_compression (&header, &compression);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_COMPRESSION_LZ, compression);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
+static void recovery_image_section_header_test_get_compression_null (CuTest *test)
+{
+	struct flash_mock flash;
+	struct recovery_image_section_header header;
+	int status;
+	enum recovery_image_section_compression compression;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1 +
+		IMAGE_HEADER_BASE_LEN, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_init (&header, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_section_header_get_compression (NULL, &compression);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_INVALID_ARGUMENT, status);
+
+	status = recovery_image_section_header_get_compression (&header, NULL);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_SECTION_HEADER_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_section_header_release (&header);
+}
+
 
 TEST_SUITE_START (recovery_image_section_header);
 
 TEST (recovery_image_section_header_test_init_format0);
+TEST (recovery_image_section_header_test_init_format1);
+TEST (recovery_image_section_header_test_init_format1_uncompressed);
 TEST (recovery_image_section_header_test_init_unknown_format_max_length);
 TEST (recovery_image_section_header_test_init_null);
 TEST (recovery_image_section_header_test_init_bad_marker);
@@ -717,16 +1241,27 @@ TEST (recovery_image_section_header_test_init_read_data_error);
 TEST (recovery_image_section_header_test_init_less_than_min_length);
 TEST (recovery_image_section_header_test_init_format0_too_short);
 TEST (recovery_image_section_header_test_init_format0_too_long);
+TEST (recovery_image_section_header_test_init_format1_too_short);
+TEST (recovery_image_section_header_test_init_format1_too_long);
+TEST (recovery_image_section_header_test_init_format1_uncompressed_host_length_mismatch);
 TEST (recovery_image_section_header_test_init_unknown_format_too_short);
 TEST (recovery_image_section_header_test_init_unknown_format_too_long);
 TEST (recovery_image_section_header_test_release_null);
 TEST (recovery_image_section_header_test_get_section_image_length_format0);
+TEST (recovery_image_section_header_test_get_section_image_length_format1);
 TEST (recovery_image_section_header_test_get_section_image_length_unknown_format);
 TEST (recovery_image_section_header_test_get_section_image_length_null);
 TEST (recovery_image_section_header_test_get_host_write_addr_format0);
+TEST (recovery_image_section_header_test_get_host_write_addr_format1);
 TEST (recovery_image_section_header_test_get_host_write_addr_unknown_format);
 TEST (recovery_image_section_header_test_get_host_write_addr_null);
 TEST (recovery_image_section_header_test_get_length);
 TEST (recovery_image_section_header_test_get_length_null);
+TEST (recovery_image_section_header_test_get_host_length_format0);
+TEST (recovery_image_section_header_test_get_host_length_format1);
+TEST (recovery_image_section_header_test_get_host_length_null);
+TEST (recovery_image_section_header_test_get_compression_format0);
+TEST (recovery_image_section_header_test_get_compression_format1);
+TEST (recovery_image_section_header_test_get_compression_null);
 
 TEST_SUITE_END;
@@ -14,5 +14,14 @@ extern const size_t RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_TOTAL_LEN;
 #define	RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_LEN	\
 	(RECOVERY_IMAGE_SECTION_HEADER_FORMAT_0_TOTAL_LEN - IMAGE_HEADER_BASE_LEN)
 
+extern const uint8_t RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1[];
+extern const size_t RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN;
+
+/**
+ * The size of the information added for example section header format 1.
+ */
+#define	RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN	\
+	(RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN - IMAGE_HEADER_BASE_LEN)
+
 
 #endif /* RECOVERY_IMAGE_SECTION_HEADER_TESTING_H_ */
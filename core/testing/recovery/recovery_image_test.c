@@ -325,6 +325,106 @@ static int setup_expect_copy_to_host_flash (struct flash_master_mock *mock_dest,
 
 }
 
+/**
+ * Compressed section data used for testing.  This decompresses to RECOVERY_IMAGE_DECOMPRESSED.
+ */
+static const uint8_t RECOVERY_IMAGE_COMPRESSED[] = {
+	0x4f,0x41,0x42,0x43,0x44,0x04,0x00,0xff,0x12,0x40,0x57,0x58,0x59,0x5a
+};
+
+/**
+ * Length of the test section data after decompression.
+ */
+#define	RECOVERY_IMAGE_DECOMPRESSED_LEN		300
+
+/**
+ * Helper function to generate the expected decompressed section data.
+ *
+ * @param data Output for the decompressed data.  This must be RECOVERY_IMAGE_DECOMPRESSED_LEN
+ * bytes long.
+ */
+static void setup_decompressed_section_data (uint8_t *data)
+{
+	size_t i;
+
+	for (i = 0; i < (RECOVERY_IMAGE_DECOMPRESSED_LEN - 4); i++) {
+		data[i] = 'A' + (i % 4);
+	}
+
+	memcpy (&data[i], "WXYZ", 4);
+}
+
+/**
+ * Helper function to build a recovery image that contains a single section using section header
+ * format 1.
+ *
+ * @param image Output for the recovery image.
+ * @param section The section image data.
+ * @param length Length of the section image data.
+ * @param host_length The length of the section data written to host flash.
+ * @param compression The compression type for the section.
+ */
+static void setup_compressed_recovery_image (uint8_t *image, const uint8_t *section, size_t length,
+	uint32_t host_length, uint8_t compression)
+{
+	uint8_t *section_header = image + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN;
+	uint32_t *image_length =
+		(uint32_t*) &image[IMAGE_HEADER_BASE_LEN + CERBERUS_PROTOCOL_FW_VERSION_LEN];
+
+	memcpy (image, RECOVERY_IMAGE_DATA, RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN);
+	*image_length = RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN +
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN + length + image_length[1];
+
+	memcpy (section_header, RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN);
+	*((uint32_t*) &section_header[IMAGE_HEADER_BASE_LEN + 4]) = length;
+	*((uint32_t*) &section_header[IMAGE_HEADER_BASE_LEN + 8]) = host_length;
+	section_header[IMAGE_HEADER_BASE_LEN + 12] = compression;
+
+	memcpy (section_header + RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, section, length);
+}
+
+/**
+ * Helper function to set up expectations for reading the headers of a recovery image with a single
+ * section using section header format 1.
+ *
+ * @param flash The mock for the recovery image flash.
+ * @param image The recovery image data.
+ *
+ * @return 0 if the mock expectation set-up was successful or an error code.
+ */
+static int setup_expect_compressed_recovery_image_headers (struct flash_mock *flash,
+	const uint8_t *image)
+{
+	int status;
+
+	status = mock_expect (&flash->mock, flash->base.read, flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash->mock, 1, image, RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN,
+		2);
+
+	status |= mock_expect (&flash->mock, flash->base.read, flash, 0,
+		MOCK_ARG (0x10000 + IMAGE_HEADER_BASE_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (RECOVERY_IMAGE_HEADER_FORMAT_0_LEN));
+	status |= mock_expect_output (&flash->mock, 1, image + IMAGE_HEADER_BASE_LEN,
+		RECOVERY_IMAGE_HEADER_FORMAT_0_LEN, 2);
+
+	status |= mock_expect (&flash->mock, flash->base.read, flash, 0,
+		MOCK_ARG (0x10000 + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (IMAGE_HEADER_BASE_LEN));
+	status |= mock_expect_output (&flash->mock, 1, image + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN, 2);
+
+	status |= mock_expect (&flash->mock, flash->base.read, flash, 0,
+		MOCK_ARG (0x10000 + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN + IMAGE_HEADER_BASE_LEN),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN));
+	status |= mock_expect_output (&flash->mock, 1,
+		image + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN + IMAGE_HEADER_BASE_LEN,
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_LEN, 2);
+
+	return status;
+}
+
 /**
  * Helper function to setup the recovery image to use mocks.
  *
@@ -3478,6 +3578,361 @@ static void recovery_image_test_apply_to_flash_read_data_error (CuTest *test)
 	spi_flash_release (&host_flash);
 }
 
+static void recovery_image_test_apply_to_flash_compressed (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_master_mock host_flash_mock;
+	struct spi_flash_state host_flash_state;
+	struct spi_flash host_flash;
+	struct recovery_image recovery_image;
+	uint8_t image[RECOVERY_IMAGE_DATA_LEN];
+	uint8_t decompressed[RECOVERY_IMAGE_DECOMPRESSED_LEN];
+	uint32_t src_addr;
+	int status;
+
+	TEST_START;
+
+	setup_decompressed_section_data (decompressed);
+	setup_compressed_recovery_image (image, RECOVERY_IMAGE_COMPRESSED,
+		sizeof (RECOVERY_IMAGE_COMPRESSED), RECOVERY_IMAGE_DECOMPRESSED_LEN,
+		RECOVERY_IMAGE_SECTION_COMPRESSION_LZ);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&host_flash, &host_flash_state, &host_flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&host_flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_init (&recovery_image, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = setup_expect_compressed_recovery_image_headers (&flash, image);
+
+	src_addr = 0x10000 + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN +
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (src_addr),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (RECOVERY_IMAGE_COMPRESSED)));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_COMPRESSED,
+		sizeof (RECOVERY_IMAGE_COMPRESSED), 2);
+
+	status |= flash_master_mock_expect_write (&host_flash_mock, 0x400, decompressed,
+		FLASH_VERIFICATION_BLOCK);
+	status |= flash_master_mock_expect_verify_flash (&host_flash_mock, 0x400, decompressed,
+		FLASH_VERIFICATION_BLOCK);
+
+	status |= flash_master_mock_expect_write (&host_flash_mock, 0x400 + FLASH_VERIFICATION_BLOCK,
+		&decompressed[FLASH_VERIFICATION_BLOCK],
+		RECOVERY_IMAGE_DECOMPRESSED_LEN - FLASH_VERIFICATION_BLOCK);
+	status |= flash_master_mock_expect_verify_flash (&host_flash_mock,
+		0x400 + FLASH_VERIFICATION_BLOCK, &decompressed[FLASH_VERIFICATION_BLOCK],
+		RECOVERY_IMAGE_DECOMPRESSED_LEN - FLASH_VERIFICATION_BLOCK);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image.apply_to_flash (&recovery_image, &host_flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_release (&recovery_image);
+	spi_flash_release (&host_flash);
+}
+
+static void recovery_image_test_apply_to_flash_compressed_bad_match_offset (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_master_mock host_flash_mock;
+	struct spi_flash_state host_flash_state;
+	struct spi_flash host_flash;
+	struct recovery_image recovery_image;
+	uint8_t image[RECOVERY_IMAGE_DATA_LEN];
+	uint8_t compressed[sizeof (RECOVERY_IMAGE_COMPRESSED)];
+	uint32_t src_addr;
+	int status;
+
+	TEST_START;
+
+	memcpy (compressed, RECOVERY_IMAGE_COMPRESSED, sizeof (compressed));
+	compressed[5] = 5;
+
+	setup_compressed_recovery_image (image, compressed, sizeof (compressed),
+		RECOVERY_IMAGE_DECOMPRESSED_LEN, RECOVERY_IMAGE_SECTION_COMPRESSION_LZ);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&host_flash, &host_flash_state, &host_flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&host_flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_init (&recovery_image, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = setup_expect_compressed_recovery_image_headers (&flash, image);
+
+	src_addr = 0x10000 + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN +
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (src_addr),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (compressed)));
+	status |= mock_expect_output (&flash.mock, 1, compressed, sizeof (compressed), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image.apply_to_flash (&recovery_image, &host_flash);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_BAD_COMPRESSED_DATA, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_release (&recovery_image);
+	spi_flash_release (&host_flash);
+}
+
+static void recovery_image_test_apply_to_flash_compressed_truncated (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_master_mock host_flash_mock;
+	struct spi_flash_state host_flash_state;
+	struct spi_flash host_flash;
+	struct recovery_image recovery_image;
+	uint8_t image[RECOVERY_IMAGE_DATA_LEN];
+	uint32_t src_addr;
+	int status;
+
+	TEST_START;
+
+	setup_compressed_recovery_image (image, RECOVERY_IMAGE_COMPRESSED, 6,
+		RECOVERY_IMAGE_DECOMPRESSED_LEN, RECOVERY_IMAGE_SECTION_COMPRESSION_LZ);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&host_flash, &host_flash_state, &host_flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&host_flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_init (&recovery_image, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = setup_expect_compressed_recovery_image_headers (&flash, image);
+
+	src_addr = 0x10000 + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN +
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (src_addr),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (6));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_COMPRESSED, 6, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image.apply_to_flash (&recovery_image, &host_flash);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_BAD_COMPRESSED_DATA, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_release (&recovery_image);
+	spi_flash_release (&host_flash);
+}
+
+static void recovery_image_test_apply_to_flash_compressed_host_length_too_long (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_master_mock host_flash_mock;
+	struct spi_flash_state host_flash_state;
+	struct spi_flash host_flash;
+	struct recovery_image recovery_image;
+	uint8_t image[RECOVERY_IMAGE_DATA_LEN];
+	uint8_t decompressed[RECOVERY_IMAGE_DECOMPRESSED_LEN];
+	uint32_t src_addr;
+	int status;
+
+	TEST_START;
+
+	setup_decompressed_section_data (decompressed);
+	setup_compressed_recovery_image (image, RECOVERY_IMAGE_COMPRESSED,
+		sizeof (RECOVERY_IMAGE_COMPRESSED), RECOVERY_IMAGE_DECOMPRESSED_LEN + 1,
+		RECOVERY_IMAGE_SECTION_COMPRESSION_LZ);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&host_flash, &host_flash_state, &host_flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&host_flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_init (&recovery_image, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = setup_expect_compressed_recovery_image_headers (&flash, image);
+
+	src_addr = 0x10000 + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN +
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (src_addr),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (RECOVERY_IMAGE_COMPRESSED)));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_COMPRESSED,
+		sizeof (RECOVERY_IMAGE_COMPRESSED), 2);
+
+	status |= flash_master_mock_expect_write (&host_flash_mock, 0x400, decompressed,
+		FLASH_VERIFICATION_BLOCK);
+	status |= flash_master_mock_expect_verify_flash (&host_flash_mock, 0x400, decompressed,
+		FLASH_VERIFICATION_BLOCK);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image.apply_to_flash (&recovery_image, &host_flash);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_BAD_COMPRESSED_DATA, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_release (&recovery_image);
+	spi_flash_release (&host_flash);
+}
+
+static void recovery_image_test_apply_to_flash_compressed_host_length_too_short (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_master_mock host_flash_mock;
+	struct spi_flash_state host_flash_state;
+	struct spi_flash host_flash;
+	struct recovery_image recovery_image;
+	uint8_t image[RECOVERY_IMAGE_DATA_LEN];
+	uint8_t decompressed[RECOVERY_IMAGE_DECOMPRESSED_LEN];
+	uint32_t src_addr;
+	int status;
+
+	TEST_START;
+
+	setup_decompressed_section_data (decompressed);
+	setup_compressed_recovery_image (image, RECOVERY_IMAGE_COMPRESSED,
+		sizeof (RECOVERY_IMAGE_COMPRESSED), RECOVERY_IMAGE_DECOMPRESSED_LEN - 1,
+		RECOVERY_IMAGE_SECTION_COMPRESSION_LZ);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&host_flash, &host_flash_state, &host_flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&host_flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_init (&recovery_image, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = setup_expect_compressed_recovery_image_headers (&flash, image);
+
+	src_addr = 0x10000 + RECOVERY_IMAGE_HEADER_FORMAT_0_TOTAL_LEN +
+		RECOVERY_IMAGE_SECTION_HEADER_FORMAT_1_TOTAL_LEN;
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (src_addr),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (RECOVERY_IMAGE_COMPRESSED)));
+	status |= mock_expect_output (&flash.mock, 1, RECOVERY_IMAGE_COMPRESSED,
+		sizeof (RECOVERY_IMAGE_COMPRESSED), 2);
+
+	status |= flash_master_mock_expect_write (&host_flash_mock, 0x400, decompressed,
+		FLASH_VERIFICATION_BLOCK);
+	status |= flash_master_mock_expect_verify_flash (&host_flash_mock, 0x400, decompressed,
+		FLASH_VERIFICATION_BLOCK);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image.apply_to_flash (&recovery_image, &host_flash);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_BAD_COMPRESSED_DATA, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_release (&recovery_image);
+	spi_flash_release (&host_flash);
+}
+
+static void recovery_image_test_apply_to_flash_unsupported_compression (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_master_mock host_flash_mock;
+	struct spi_flash_state host_flash_state;
+	struct spi_flash host_flash;
+	struct recovery_image recovery_image;
+	uint8_t image[RECOVERY_IMAGE_DATA_LEN];
+	int status;
+
+	TEST_START;
+
+	setup_compressed_recovery_image (image, RECOVERY_IMAGE_COMPRESSED,
+		sizeof (RECOVERY_IMAGE_COMPRESSED), RECOVERY_IMAGE_DECOMPRESSED_LEN, 2);
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&host_flash, &host_flash_state, &host_flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&host_flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image_init (&recovery_image, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = setup_expect_compressed_recovery_image_headers (&flash, image);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = recovery_image.apply_to_flash (&recovery_image, &host_flash);
+	CuAssertIntEquals (test, RECOVERY_IMAGE_UNSUPPORTED_COMPRESSION, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&host_flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	recovery_image_release (&recovery_image);
+	spi_flash_release (&host_flash);
+}
+
 static void recovery_image_test_apply_to_flash_null (CuTest *test)
 {
 	struct flash_mock flash;
@@ -3572,6 +4027,12 @@ TEST (recovery_image_test_apply_to_flash_section_image_length_too_long);
 TEST (recovery_image_test_apply_to_flash_bad_image_header);
 TEST (recovery_image_test_apply_to_flash_bad_section_header);
 TEST (recovery_image_test_apply_to_flash_read_data_error);
+TEST (recovery_image_test_apply_to_flash_compressed);
+TEST (recovery_image_test_apply_to_flash_compressed_bad_match_offset);
+TEST (recovery_image_test_apply_to_flash_compressed_truncated);
+TEST (recovery_image_test_apply_to_flash_compressed_host_length_too_long);
+TEST (recovery_image_test_apply_to_flash_compressed_host_length_too_short);
+TEST (recovery_image_test_apply_to_flash_unsupported_compression);
 TEST (recovery_image_test_apply_to_flash_null);
 
 TEST_SUITE_END;
@@ -5010,6 +5010,621 @@ static void state_manager_test_store_non_volatile_state_last_entry_second_sector
 	state_manager_release (&manager);
 }
 
+static void state_manager_test_store_non_volatile_state_store_window (CuTest *test)
+{
+	struct flash_mock flash;
+	struct state_manager manager;
+	struct state_manager_stats stats;
+	int status;
+	uint16_t state[4] = {0xff82, 0xff82, 0xff82, 0};
+	uint16_t end[4] = {0xffff, 0xffff, 0xffff, 0xffff};
+	uint16_t expected[4] = {0xff81, 0xff81, 0xff81, 0};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10008),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_init (&manager, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_set_store_window (&manager, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc3;
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc1;
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (100 + 10);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (expected),
+		MOCK_ARG (0x10008), MOCK_ARG_PTR_CONTAINS (&expected, sizeof (expected)),
+		MOCK_ARG (sizeof (expected)));
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_get_stats (&manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.entry_writes);
+	CuAssertIntEquals (test, 1, stats.sector_erases);
+	CuAssertIntEquals (test, 2, stats.deferred);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	state_manager_release (&manager);
+}
+
+static void state_manager_test_store_non_volatile_state_store_window_state_restored (CuTest *test)
+{
+	struct flash_mock flash;
+	struct state_manager manager;
+	struct state_manager_stats stats;
+	uint16_t current[4] = {0xff82, 0xff82, 0xff82, 0};
+	int status;
+	uint16_t state[4] = {0xff82, 0xff82, 0xff82, 0};
+	uint16_t end[4] = {0xffff, 0xffff, 0xffff, 0xffff};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10008),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_init (&manager, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_set_store_window (&manager, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc1;
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, current, sizeof (current), 2);
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc2;
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_get_stats (&manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.entry_writes);
+	CuAssertIntEquals (test, 1, stats.deferred);
+
+	/* A new change after the state was restored starts a new window. */
+	platform_msleep (100 + 10);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc1;
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_get_stats (&manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.entry_writes);
+	CuAssertIntEquals (test, 2, stats.deferred);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	state_manager_release (&manager);
+}
+
+static void state_manager_test_store_non_volatile_state_store_window_disabled (CuTest *test)
+{
+	struct flash_mock flash;
+	struct state_manager manager;
+	struct state_manager_stats stats;
+	int status;
+	uint16_t state[4] = {0xff82, 0xff82, 0xff82, 0};
+	uint16_t end[4] = {0xffff, 0xffff, 0xffff, 0xffff};
+	uint16_t expected[4] = {0xff81, 0xff81, 0xff81, 0};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10008),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_init (&manager, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_set_store_window (&manager, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc1;
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_set_store_window (&manager, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (expected),
+		MOCK_ARG (0x10008), MOCK_ARG_PTR_CONTAINS (&expected, sizeof (expected)),
+		MOCK_ARG (sizeof (expected)));
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_get_stats (&manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.entry_writes);
+	CuAssertIntEquals (test, 1, stats.deferred);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	state_manager_release (&manager);
+}
+
+static void state_manager_test_flush_non_volatile_state (CuTest *test)
+{
+	struct flash_mock flash;
+	struct state_manager manager;
+	int status;
+	uint16_t state[4] = {0xff82, 0xff82, 0xff82, 0};
+	uint16_t end[4] = {0xffff, 0xffff, 0xffff, 0xffff};
+	uint16_t expected[4] = {0xff81, 0xff81, 0xff81, 0};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10008),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_init (&manager, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (expected),
+		MOCK_ARG (0x10008), MOCK_ARG_PTR_CONTAINS (&expected, sizeof (expected)),
+		MOCK_ARG (sizeof (expected)));
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc1;
+
+	status = state_manager_flush_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	state_manager_release (&manager);
+}
+
+static void state_manager_test_flush_non_volatile_state_store_window (CuTest *test)
+{
+	struct flash_mock flash;
+	struct state_manager manager;
+	struct state_manager_stats stats;
+	int status;
+	uint16_t state[4] = {0xff82, 0xff82, 0xff82, 0};
+	uint16_t end[4] = {0xffff, 0xffff, 0xffff, 0xffff};
+	uint16_t expected[4] = {0xff81, 0xff81, 0xff81, 0};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10008),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_init (&manager, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_set_store_window (&manager, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc1;
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (expected),
+		MOCK_ARG (0x10008), MOCK_ARG_PTR_CONTAINS (&expected, sizeof (expected)),
+		MOCK_ARG (sizeof (expected)));
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_flush_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The flushed state does not need to be written again. */
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10008),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, expected, sizeof (expected), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_get_stats (&manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.entry_writes);
+	CuAssertIntEquals (test, 1, stats.deferred);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	state_manager_release (&manager);
+}
+
+static void state_manager_test_flush_non_volatile_state_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = state_manager_flush_non_volatile_state (NULL);
+	CuAssertIntEquals (test, STATE_MANAGER_INVALID_ARGUMENT, status);
+}
+
+static void state_manager_test_set_store_window_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = state_manager_set_store_window (NULL, 100);
+	CuAssertIntEquals (test, STATE_MANAGER_INVALID_ARGUMENT, status);
+}
+
+static void state_manager_test_get_stats (CuTest *test)
+{
+	struct flash_mock flash;
+	struct state_manager manager;
+	struct state_manager_stats stats;
+	int status;
+	uint16_t state[4] = {0xff82, 0xff82, 0xff82, 0};
+	uint16_t end[4] = {0xffff, 0xffff, 0xffff, 0xffff};
+	uint16_t expected[4] = {0xff81, 0xff81, 0xff81, 0};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10008),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_init (&manager, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_get_stats (&manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.entry_writes);
+	CuAssertIntEquals (test, 0, stats.sector_erases);
+	CuAssertIntEquals (test, 0, stats.deferred);
+	CuAssertIntEquals (test, 0, stats.last_flush_ms);
+	CuAssertIntEquals (test, 0, stats.max_flush_ms);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (expected),
+		MOCK_ARG (0x10008), MOCK_ARG_PTR_CONTAINS (&expected, sizeof (expected)),
+		MOCK_ARG (sizeof (expected)));
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x1000);
+
+	CuAssertIntEquals (test, 0, status);
+
+	manager.nv_state = 0xffc1;
+
+	status = state_manager_store_non_volatile_state (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_get_stats (&manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.entry_writes);
+	CuAssertIntEquals (test, 1, stats.sector_erases);
+	CuAssertIntEquals (test, 0, stats.deferred);
+	CuAssertTrue (test, (stats.max_flush_ms >= stats.last_flush_ms));
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	state_manager_release (&manager);
+}
+
+static void state_manager_test_get_stats_null (CuTest *test)
+{
+	struct flash_mock flash;
+	struct state_manager manager;
+	struct state_manager_stats stats;
+	int status;
+	uint16_t state[4] = {0xff82, 0xff82, 0xff82, 0};
+	uint16_t end[4] = {0xffff, 0xffff, 0xffff, 0xffff};
+	uint32_t bytes = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, state, sizeof (state), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10008),
+		MOCK_ARG_NOT_NULL, MOCK_ARG(8));
+	status |= mock_expect_output (&flash.mock, 1, end, sizeof (end), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_init (&manager, &flash.base, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = state_manager_get_stats (NULL, &stats);
+	CuAssertIntEquals (test, STATE_MANAGER_INVALID_ARGUMENT, status);
+
+	status = state_manager_get_stats (&manager, NULL);
+	CuAssertIntEquals (test, STATE_MANAGER_INVALID_ARGUMENT, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	state_manager_release (&manager);
+}
+
 static void state_manager_test_store_non_volatile_state_last_entry_first_sector_not_blank (
 	CuTest *test)
 {
@@ -5387,6 +6002,15 @@ TEST (state_manager_test_store_non_volatile_state_sector2_erase_error);
 TEST (state_manager_test_store_non_volatile_state_none_blank);
 TEST (state_manager_test_store_non_volatile_state_last_entry_second_sector_not_blank);
 TEST (state_manager_test_store_non_volatile_state_last_entry_second_sector_not_blank_sector_not_4k);
+TEST (state_manager_test_store_non_volatile_state_store_window);
+TEST (state_manager_test_store_non_volatile_state_store_window_state_restored);
+TEST (state_manager_test_store_non_volatile_state_store_window_disabled);
+TEST (state_manager_test_flush_non_volatile_state);
+TEST (state_manager_test_flush_non_volatile_state_store_window);
+TEST (state_manager_test_flush_non_volatile_state_null);
+TEST (state_manager_test_set_store_window_null);
+TEST (state_manager_test_get_stats);
+TEST (state_manager_test_get_stats_null);
 TEST (state_manager_test_store_non_volatile_state_last_entry_first_sector_not_blank);
 TEST (state_manager_test_store_non_volatile_state_last_entry_first_sector_not_blank_sector_not_4k);
 TEST (state_manager_test_store_non_volatile_state_same_state_read_error);
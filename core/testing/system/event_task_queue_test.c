@@ -0,0 +1,568 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "system/event_task_queue.h"
+
+
+TEST_SUITE_LABEL ("event_task_queue");
+
+
+/**
+ * Number of event slots in the test queue.
+ */
+#define	EVENT_TASK_QUEUE_TESTING_SLOTS		4
+
+
+/**
+ * Submit an event to the queue.
+ *
+ * @param test The testing framework.
+ * @param queue The queue to submit to.
+ * @param handler Index of the handler for the event.
+ * @param priority Priority of the event.
+ * @param action Action identifier to store in the event context.
+ */
+static void event_task_queue_testing_submit (CuTest *test, struct event_task_queue *queue,
+	int handler, uint8_t priority, uint32_t action)
+{
+	struct event_task_context *context;
+	int status;
+
+	status = event_task_queue_reserve (queue, &context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, context);
+
+	context->action = action;
+
+	status = event_task_queue_commit (queue, handler, priority);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Take the next event from the queue and check that it is the expected event.
+ *
+ * @param test The testing framework.
+ * @param queue The queue to take from.
+ * @param handler Expected handler index for the event.
+ * @param action Expected action identifier for the event.
+ */
+static void event_task_queue_testing_take_and_complete (CuTest *test,
+	struct event_task_queue *queue, int handler, uint32_t action)
+{
+	struct event_task_context *context;
+	int running;
+	int status;
+
+	status = event_task_queue_take (queue, &running, &context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, handler, running);
+	CuAssertPtrNotNull (test, context);
+	CuAssertIntEquals (test, action, context->action);
+
+	event_task_queue_complete (queue, context);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void event_task_queue_test_init (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, event_task_queue_get_pending_count (&queue));
+}
+
+static void event_task_queue_test_init_null (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (NULL, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_queue_init (&queue, NULL, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_queue_init (&queue, slots, 0);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+}
+
+static void event_task_queue_test_submit_and_take (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 2, 0, 0x10);
+	CuAssertIntEquals (test, 1, event_task_queue_get_pending_count (&queue));
+
+	event_task_queue_testing_take_and_complete (test, &queue, 2, 0x10);
+	CuAssertIntEquals (test, 0, event_task_queue_get_pending_count (&queue));
+}
+
+static void event_task_queue_test_take_in_submission_order (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+	event_task_queue_testing_submit (test, &queue, 1, 0, 0x11);
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x12);
+	CuAssertIntEquals (test, 3, event_task_queue_get_pending_count (&queue));
+
+	event_task_queue_testing_take_and_complete (test, &queue, 0, 0x10);
+	event_task_queue_testing_take_and_complete (test, &queue, 1, 0x11);
+	event_task_queue_testing_take_and_complete (test, &queue, 0, 0x12);
+	CuAssertIntEquals (test, 0, event_task_queue_get_pending_count (&queue));
+}
+
+static void event_task_queue_test_take_highest_priority_first (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 0, 1, 0x10);
+	event_task_queue_testing_submit (test, &queue, 1, 5, 0x11);
+	event_task_queue_testing_submit (test, &queue, 2, 1, 0x12);
+	event_task_queue_testing_submit (test, &queue, 3, 5, 0x13);
+
+	event_task_queue_testing_take_and_complete (test, &queue, 1, 0x11);
+	event_task_queue_testing_take_and_complete (test, &queue, 3, 0x13);
+	event_task_queue_testing_take_and_complete (test, &queue, 0, 0x10);
+	event_task_queue_testing_take_and_complete (test, &queue, 2, 0x12);
+}
+
+static void event_task_queue_test_submit_while_running (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *running_context;
+	int running;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+
+	status = event_task_queue_take (&queue, &running, &running_context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, running);
+
+	/* A new event can be submitted while the first is still being processed. */
+	event_task_queue_testing_submit (test, &queue, 1, 0, 0x11);
+	CuAssertIntEquals (test, 1, event_task_queue_get_pending_count (&queue));
+	CuAssertIntEquals (test, 0x10, running_context->action);
+
+	event_task_queue_complete (&queue, running_context);
+
+	event_task_queue_testing_take_and_complete (test, &queue, 1, 0x11);
+}
+
+static void event_task_queue_test_priority_does_not_preempt_running (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *running_context;
+	int running;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+	event_task_queue_testing_submit (test, &queue, 1, 0, 0x11);
+
+	status = event_task_queue_take (&queue, &running, &running_context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, running);
+
+	event_task_queue_testing_submit (test, &queue, 2, 3, 0x12);
+
+	event_task_queue_complete (&queue, running_context);
+
+	event_task_queue_testing_take_and_complete (test, &queue, 2, 0x12);
+	event_task_queue_testing_take_and_complete (test, &queue, 1, 0x11);
+}
+
+static void event_task_queue_test_sequence_wrap (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	queue.next_sequence = 0xfffffffe;
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+	event_task_queue_testing_submit (test, &queue, 1, 0, 0x11);
+	event_task_queue_testing_submit (test, &queue, 2, 0, 0x12);
+
+	event_task_queue_testing_take_and_complete (test, &queue, 0, 0x10);
+	event_task_queue_testing_take_and_complete (test, &queue, 1, 0x11);
+	event_task_queue_testing_take_and_complete (test, &queue, 2, 0x12);
+}
+
+static void event_task_queue_test_reserve_full (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *context;
+	int i;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < EVENT_TASK_QUEUE_TESTING_SLOTS; i++) {
+		event_task_queue_testing_submit (test, &queue, i, 0, 0x10 + i);
+	}
+
+	status = event_task_queue_reserve (&queue, &context);
+	CuAssertIntEquals (test, EVENT_TASK_BUSY, status);
+
+	/* Once an event has been processed, its slot can be reused. */
+	event_task_queue_testing_take_and_complete (test, &queue, 0, 0x10);
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x20);
+	CuAssertIntEquals (test, EVENT_TASK_QUEUE_TESTING_SLOTS,
+		event_task_queue_get_pending_count (&queue));
+}
+
+static void event_task_queue_test_reserve_full_with_running_event (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[2];
+	struct event_task_context *context;
+	int running;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+
+	status = event_task_queue_take (&queue, &running, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 1, 0, 0x11);
+
+	status = event_task_queue_reserve (&queue, &context);
+	CuAssertIntEquals (test, EVENT_TASK_BUSY, status);
+}
+
+static void event_task_queue_test_reserve_twice (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_reserve (&queue, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_reserve (&queue, &context);
+	CuAssertIntEquals (test, EVENT_TASK_BUSY, status);
+}
+
+static void event_task_queue_test_reserve_null (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_reserve (NULL, &context);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_queue_reserve (&queue, NULL);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+}
+
+static void event_task_queue_test_commit_not_reserved (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_commit (&queue, 0, 0);
+	CuAssertIntEquals (test, EVENT_TASK_NOT_READY, status);
+	CuAssertIntEquals (test, 0, event_task_queue_get_pending_count (&queue));
+}
+
+static void event_task_queue_test_commit_null (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_reserve (&queue, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_commit (NULL, 0, 0);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_queue_commit (&queue, -1, 0);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	CuAssertIntEquals (test, 0, event_task_queue_get_pending_count (&queue));
+}
+
+static void event_task_queue_test_cancel (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[1];
+	struct event_task_context *context;
+	int running;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_reserve (&queue, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_cancel (&queue);
+	CuAssertIntEquals (test, 0, event_task_queue_get_pending_count (&queue));
+
+	status = event_task_queue_take (&queue, &running, &context);
+	CuAssertIntEquals (test, EVENT_TASK_NO_EVENTS, status);
+
+	/* The cancelled slot is available again. */
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+	event_task_queue_testing_take_and_complete (test, &queue, 0, 0x10);
+}
+
+static void event_task_queue_test_cancel_not_reserved (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+
+	event_task_queue_cancel (&queue);
+	CuAssertIntEquals (test, 1, event_task_queue_get_pending_count (&queue));
+
+	event_task_queue_testing_take_and_complete (test, &queue, 0, 0x10);
+}
+
+static void event_task_queue_test_cancel_null (CuTest *test)
+{
+	TEST_START;
+
+	event_task_queue_cancel (NULL);
+}
+
+static void event_task_queue_test_take_empty (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *context;
+	int running;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_take (&queue, &running, &context);
+	CuAssertIntEquals (test, EVENT_TASK_NO_EVENTS, status);
+}
+
+static void event_task_queue_test_take_ignores_reserved_slot (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *context;
+	int running;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_reserve (&queue, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_queue_take (&queue, &running, &context);
+	CuAssertIntEquals (test, EVENT_TASK_NO_EVENTS, status);
+}
+
+static void event_task_queue_test_take_null (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context *context;
+	int running;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+
+	status = event_task_queue_take (NULL, &running, &context);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_queue_take (&queue, NULL, &context);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_queue_take (&queue, &running, NULL);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	CuAssertIntEquals (test, 1, event_task_queue_get_pending_count (&queue));
+}
+
+static void event_task_queue_test_complete_unknown_context (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[1];
+	struct event_task_context other;
+	struct event_task_context *context;
+	int running;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_testing_submit (test, &queue, 0, 0, 0x10);
+
+	status = event_task_queue_take (&queue, &running, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_complete (&queue, &other);
+
+	status = event_task_queue_reserve (&queue, &context);
+	CuAssertIntEquals (test, EVENT_TASK_BUSY, status);
+}
+
+static void event_task_queue_test_complete_null (CuTest *test)
+{
+	struct event_task_queue queue;
+	struct event_task_queue_slot slots[EVENT_TASK_QUEUE_TESTING_SLOTS];
+	struct event_task_context context;
+	int status;
+
+	TEST_START;
+
+	status = event_task_queue_init (&queue, slots, EVENT_TASK_QUEUE_TESTING_SLOTS);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_queue_complete (NULL, &context);
+	event_task_queue_complete (&queue, NULL);
+}
+
+static void event_task_queue_test_get_pending_count_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, event_task_queue_get_pending_count (NULL));
+}
+
+
+TEST_SUITE_START (event_task_queue);
+
+TEST (event_task_queue_test_init);
+TEST (event_task_queue_test_init_null);
+TEST (event_task_queue_test_submit_and_take);
+TEST (event_task_queue_test_take_in_submission_order);
+TEST (event_task_queue_test_take_highest_priority_first);
+TEST (event_task_queue_test_submit_while_running);
+TEST (event_task_queue_test_priority_does_not_preempt_running);
+TEST (event_task_queue_test_sequence_wrap);
+TEST (event_task_queue_test_reserve_full);
+TEST (event_task_queue_test_reserve_full_with_running_event);
+TEST (event_task_queue_test_reserve_twice);
+TEST (event_task_queue_test_reserve_null);
+TEST (event_task_queue_test_commit_not_reserved);
+TEST (event_task_queue_test_commit_null);
+TEST (event_task_queue_test_cancel);
+TEST (event_task_queue_test_cancel_not_reserved);
+TEST (event_task_queue_test_cancel_null);
+TEST (event_task_queue_test_take_empty);
+TEST (event_task_queue_test_take_ignores_reserved_slot);
+TEST (event_task_queue_test_take_null);
+TEST (event_task_queue_test_complete_unknown_context);
+TEST (event_task_queue_test_complete_null);
+TEST (event_task_queue_test_get_pending_count_null);
+
+TEST_SUITE_END;
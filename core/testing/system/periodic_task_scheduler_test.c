@@ -0,0 +1,1145 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "system/periodic_task_scheduler.h"
+#include "system/periodic_task_scheduler_static.h"
+#include "testing/mock/system/periodic_task_handler_mock.h"
+
+
+TEST_SUITE_LABEL ("periodic_task_scheduler");
+
+
+/**
+ * Dependencies for testing.
+ */
+struct periodic_task_scheduler_testing {
+	struct periodic_task_handler_mock handler1;		/**< A mock periodic handler. */
+	struct periodic_task_handler_mock handler2;		/**< A mock periodic handler. */
+	struct periodic_task_handler_mock handler3;		/**< A mock periodic handler. */
+	struct periodic_task_scheduler_state state;		/**< Variable context for the scheduler. */
+	struct periodic_task_scheduler_entry heap[3];	/**< Storage for the scheduler heap. */
+	struct periodic_task_handler_stats stats[3];	/**< Storage for handler statistics. */
+	platform_clock start;							/**< Start time of the test. */
+	platform_clock time_now;						/**< A time that has already expired. */
+	platform_clock time_500ms;						/**< A time 500ms in the future. */
+	platform_clock time_1000ms;						/**< A time 1000ms in the future. */
+	platform_clock time_1500ms;						/**< A time 1500ms in the future. */
+	platform_clock time_2000ms;						/**< A time 2000ms in the future. */
+	struct periodic_task_scheduler test;			/**< The scheduler under test. */
+};
+
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to initialize.
+ */
+static void periodic_task_scheduler_testing_init_dependencies (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler)
+{
+	int status;
+
+	status = periodic_task_handler_mock_init (&scheduler->handler1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_handler_mock_init (&scheduler->handler2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_handler_mock_init (&scheduler->handler3);
+	CuAssertIntEquals (test, 0, status);
+
+	mock_set_name (&scheduler->handler1.mock, "periodic_task_handler1");
+	mock_set_name (&scheduler->handler2.mock, "periodic_task_handler2");
+	mock_set_name (&scheduler->handler3.mock, "periodic_task_handler3");
+}
+
+/**
+ * Initialize the timeouts for the test.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to initialize.
+ */
+static void periodic_task_scheduler_testing_init_times (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler)
+{
+	int status;
+
+	status = platform_init_current_tick (&scheduler->start);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_timeout (0, &scheduler->time_now);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_timeout (500, &scheduler->time_500ms);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_timeout (1000, &scheduler->time_1000ms);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_timeout (1500, &scheduler->time_1500ms);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_timeout (2000, &scheduler->time_2000ms);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize a scheduler for testing.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to initialize.
+ * @param handlers The list of handlers to schedule.
+ * @param count The number of handlers in the list.
+ */
+static void periodic_task_scheduler_testing_init (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler,
+	const struct periodic_task_handler **handlers, size_t count)
+{
+	int status;
+
+	periodic_task_scheduler_testing_init_dependencies (test, scheduler);
+
+	status = periodic_task_scheduler_init (&scheduler->test, &scheduler->state, handlers, count,
+		scheduler->heap, scheduler->stats, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_scheduler_testing_init_times (test, scheduler);
+}
+
+/**
+ * Set an expectation for a handler to be queried for its next execution time.
+ *
+ * @param handler The handler that will be queried.
+ * @param next_time The execution time to report.
+ *
+ * @return 0 if the expectation was added or non-zero on error.
+ */
+static int periodic_task_scheduler_testing_expect_next_execution (
+	struct periodic_task_handler_mock *handler, const platform_clock *next_time)
+{
+	return mock_expect (&handler->mock, handler->base.get_next_execution, &handler->base,
+		MOCK_RETURN_PTR (next_time));
+}
+
+/**
+ * Set an expectation for a handler to be executed.
+ *
+ * @param handler The handler that will be executed.
+ *
+ * @return 0 if the expectation was added or non-zero on error.
+ */
+static int periodic_task_scheduler_testing_expect_execute (
+	struct periodic_task_handler_mock *handler)
+{
+	return mock_expect (&handler->mock, handler->base.execute, &handler->base, 0);
+}
+
+/**
+ * Release test dependencies and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to release.
+ */
+static void periodic_task_scheduler_testing_validate_and_release_dependencies (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler)
+{
+	int status;
+
+	status = periodic_task_handler_mock_validate_and_release (&scheduler->handler1);
+	status |= periodic_task_handler_mock_validate_and_release (&scheduler->handler2);
+	status |= periodic_task_handler_mock_validate_and_release (&scheduler->handler3);
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release a test instance and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to release.
+ */
+static void periodic_task_scheduler_testing_release (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler)
+{
+	periodic_task_scheduler_testing_validate_and_release_dependencies (test, scheduler);
+	periodic_task_scheduler_release (&scheduler->test);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void periodic_task_scheduler_test_init (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_handler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init_dependencies (test, &scheduler);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, list, count,
+		scheduler.heap, scheduler.stats, PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 1, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.executions);
+	CuAssertIntEquals (test, 0, stats.missed_deadlines);
+	CuAssertIntEquals (test, 0, stats.max_late_ms);
+
+	/* Nothing will execute until the handlers have been scheduled. */
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, PERIODIC_TASK_NO_HANDLERS, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_init_null (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init_dependencies (test, &scheduler);
+
+	status = periodic_task_scheduler_init (NULL, &scheduler.state, list, count, scheduler.heap,
+		scheduler.stats, PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, NULL, list, count, scheduler.heap,
+		scheduler.stats, PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, NULL, count,
+		scheduler.heap, scheduler.stats, PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, list, 0,
+		scheduler.heap, scheduler.stats, PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, list, count, NULL,
+		scheduler.stats, PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, list, count,
+		scheduler.heap, NULL, PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	periodic_task_scheduler_testing_validate_and_release_dependencies (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_static_init (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_scheduler test_static = periodic_task_scheduler_static_init (
+		&scheduler.state, list, count, scheduler.heap, scheduler.stats, 100);
+	struct periodic_task_handler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init_dependencies (test, &scheduler);
+
+	status = periodic_task_scheduler_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler1);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_handler_stats (&test_static, 0, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.executions);
+	CuAssertIntEquals (test, 0, stats.missed_deadlines);
+
+	periodic_task_scheduler_testing_validate_and_release_dependencies (test, &scheduler);
+	periodic_task_scheduler_release (&test_static);
+}
+
+static void periodic_task_scheduler_test_static_init_null (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_scheduler null_state = periodic_task_scheduler_static_init (NULL, list,
+		count, scheduler.heap, scheduler.stats, 100);
+	struct periodic_task_scheduler null_handlers = periodic_task_scheduler_static_init (
+		&scheduler.state, NULL, count, scheduler.heap, scheduler.stats, 100);
+	struct periodic_task_scheduler no_handlers = periodic_task_scheduler_static_init (
+		&scheduler.state, list, 0, scheduler.heap, scheduler.stats, 100);
+	struct periodic_task_scheduler null_heap = periodic_task_scheduler_static_init (
+		&scheduler.state, list, count, NULL, scheduler.stats, 100);
+	struct periodic_task_scheduler null_stats = periodic_task_scheduler_static_init (
+		&scheduler.state, list, count, scheduler.heap, NULL, 100);
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_scheduler_init_state (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init_state (&null_state);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init_state (&null_handlers);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init_state (&no_handlers);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init_state (&null_heap);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init_state (&null_stats);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_scheduler_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	periodic_task_scheduler_release (NULL);
+}
+
+static void periodic_task_scheduler_test_prepare_handlers (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.prepare,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.prepare,
+		&scheduler.handler2, 0);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_prepare_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_prepare_handlers_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_scheduler_prepare_handlers (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_scheduler_test_refresh_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_scheduler_refresh (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_handler_stats stats;
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_500ms);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler1);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 0, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.executions);
+	CuAssertIntEquals (test, 0, stats.missed_deadlines);
+	CuAssertTrue (test, (stats.max_late_ms < 100));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_multiple (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base, &scheduler.handler3.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_handler_stats stats;
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler3,
+		&scheduler.time_1500ms);
+
+	/* Only the next handler is queried when selecting a handler to run. */
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_2000ms);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler1);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 1000));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1500));
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 0, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.executions);
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 1, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.executions);
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 2, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.executions);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_null_execution_time (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2, NULL);
+
+	/* Handlers that are always ready take turns executing. */
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler1);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2, NULL);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2, NULL);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler1);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 100));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_same_time (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base, &scheduler.handler3.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler3,
+		&scheduler.time_500ms);
+
+	/* Handlers with the same execution time run in the order they were scheduled. */
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_2000ms);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler3,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler3);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler3,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_delayed (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_1000ms);
+
+	/* The first handler has been pushed out, so the second handler needs to run first. */
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1500ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 1000));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1500));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_moved_earlier (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_1500ms);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler1);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_null_after_future_time (
+	CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_handler_stats stats;
+	int status;
+	uint32_t delay;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_1500ms);
+
+	/* The first handler no longer has an execution time, so it is ready now. */
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1, NULL);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler1);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_next_delay (&scheduler.test, &delay);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, delay);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 500));
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 0, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.executions);
+	CuAssertIntEquals (test, 0, stats.missed_deadlines);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_missed_deadline (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_handler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_2000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_now);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_now);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Delay execution past the miss threshold. */
+	platform_msleep (200);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 1, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.executions);
+	CuAssertIntEquals (test, 1, stats.missed_deadlines);
+	CuAssertTrue (test, (stats.max_late_ms >= 200));
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 0, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.executions);
+	CuAssertIntEquals (test, 0, stats.missed_deadlines);
+	CuAssertIntEquals (test, 0, stats.max_late_ms);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_refresh (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_2000ms);
+
+	/* The second handler was rescheduled outside of execution. */
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_null_handler (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		NULL, &scheduler.handler2.base, NULL
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_handler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2, NULL);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2, NULL);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 1, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.executions);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_all_null_handlers (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		NULL, NULL
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, PERIODIC_TASK_NO_HANDLERS, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_next_handler_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_scheduler_execute_next_handler (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_scheduler_test_get_next_delay (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	uint32_t delay;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_500ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_next_delay (&scheduler.test, &delay);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (delay <= 500));
+	CuAssertTrue (test, (delay > 400));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_get_next_delay_ready (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	uint32_t delay;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_1000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2, NULL);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2, NULL);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2, NULL);
+	status |= periodic_task_scheduler_testing_expect_execute (&scheduler.handler2);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_2000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_next_delay (&scheduler.test, &delay);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, delay);
+
+	status = periodic_task_scheduler_execute_next_handler (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_get_next_delay_delayed (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	uint32_t delay;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_500ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_1000ms);
+
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler1,
+		&scheduler.time_2000ms);
+	status |= periodic_task_scheduler_testing_expect_next_execution (&scheduler.handler2,
+		&scheduler.time_1000ms);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_refresh (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_next_delay (&scheduler.test, &delay);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (delay <= 1000));
+	CuAssertTrue (test, (delay > 900));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_get_next_delay_no_handlers (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	uint32_t delay;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_get_next_delay (&scheduler.test, &delay);
+	CuAssertIntEquals (test, PERIODIC_TASK_NO_HANDLERS, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_get_next_delay_null (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	uint32_t delay;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_get_next_delay (NULL, &delay);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_get_next_delay (&scheduler.test, NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_get_handler_stats_null (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	const struct periodic_task_handler *list[] = {
+		&scheduler.handler1.base, &scheduler.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_handler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, list, count);
+
+	status = periodic_task_scheduler_get_handler_stats (NULL, 0, &stats);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, 0, NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_get_handler_stats (&scheduler.test, count, &stats);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+
+TEST_SUITE_START (periodic_task_scheduler);
+
+TEST (periodic_task_scheduler_test_init);
+TEST (periodic_task_scheduler_test_init_null);
+TEST (periodic_task_scheduler_test_static_init);
+TEST (periodic_task_scheduler_test_static_init_null);
+TEST (periodic_task_scheduler_test_release_null);
+TEST (periodic_task_scheduler_test_prepare_handlers);
+TEST (periodic_task_scheduler_test_prepare_handlers_null);
+TEST (periodic_task_scheduler_test_refresh_null);
+TEST (periodic_task_scheduler_test_execute_next_handler);
+TEST (periodic_task_scheduler_test_execute_next_handler_multiple);
+TEST (periodic_task_scheduler_test_execute_next_handler_null_execution_time);
+TEST (periodic_task_scheduler_test_execute_next_handler_same_time);
+TEST (periodic_task_scheduler_test_execute_next_handler_delayed);
+TEST (periodic_task_scheduler_test_execute_next_handler_moved_earlier);
+TEST (periodic_task_scheduler_test_execute_next_handler_null_after_future_time);
+TEST (periodic_task_scheduler_test_execute_next_handler_missed_deadline);
+TEST (periodic_task_scheduler_test_execute_next_handler_refresh);
+TEST (periodic_task_scheduler_test_execute_next_handler_null_handler);
+TEST (periodic_task_scheduler_test_execute_next_handler_all_null_handlers);
+TEST (periodic_task_scheduler_test_execute_next_handler_null);
+TEST (periodic_task_scheduler_test_get_next_delay);
+TEST (periodic_task_scheduler_test_get_next_delay_ready);
+TEST (periodic_task_scheduler_test_get_next_delay_delayed);
+TEST (periodic_task_scheduler_test_get_next_delay_no_handlers);
+TEST (periodic_task_scheduler_test_get_next_delay_null);
+TEST (periodic_task_scheduler_test_get_handler_stats_null);
+
+TEST_SUITE_END;
@@ -47,6 +47,18 @@ static void add_all_system_tests (CuSuite *suite)
 #endif
 
 */
+#if (defined TESTING_RUN_EVENT_TASK_QUEUE_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_EVENT_TASK_QUEUE_SUITE
+	TESTING_RUN_SUITE (event_task_queue);
+#endif
+#if (defined TESTING_RUN_PERIODIC_TASK_SCHEDULER_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_PERIODIC_TASK_SCHEDULER_SUITE
+	TESTING_RUN_SUITE (periodic_task_scheduler);
+#endif
 }
 
 
@@ -23,6 +23,29 @@
 		.state = state_ptr, \
 		.handlers = handlers_list, \
 		.num_handlers = count, \
+		.scheduler = NULL, \
+		.id = log_id \
+	}
+
+/**
+ * Initialize a static instance of a FreeRTOS periodic handler task that uses a scheduler to
+ * determine which handler to run next.  The FreeRTOS task itself will still be dynamically
+ * allocated.  This does not initialize the task state.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the task.
+ * @param handlers_list The list of handlers managed by the scheduler.
+ * @param count The number of handlers in the list.
+ * @param scheduler_ptr The scheduler for the handlers.
+ * @param log_id Identifier for this task in log messages.
+ */
+#define	periodic_task_freertos_scheduled_static_init(state_ptr, handlers_list, count, \
+	scheduler_ptr, log_id)	{ \
+		.state = state_ptr, \
+		.handlers = handlers_list, \
+		.num_handlers = count, \
+		.scheduler = scheduler_ptr, \
 		.id = log_id \
 	}
 
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef _GNU_SOURCE
+#define	_GNU_SOURCE
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "trace_ring_linux.h"
+
+
+/**
+ * The trace ring used by the current thread.
+ */
+static __thread struct trace_ring *trace_ring_linux_current = NULL;
+
+/**
+ * Names reported for each trace point in exported traces.
+ */
+static const char *const trace_ring_linux_point_names[] = {
+	"mctp_interface_process_packet",
+	"cmd_interface_process_request",
+	"spi_flash_read",
+	"hash_update"
+};
+
+
+struct trace_ring* trace_ring_get_current (void)
+{
+	return trace_ring_linux_current;
+}
+
+uint64_t trace_ring_get_timestamp (void)
+{
+	struct timespec now;
+
+	if (clock_gettime (CLOCK_MONOTONIC, &now) != 0) {
+		return 0;
+	}
+
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+/**
+ * Initialize a trace ring for the calling thread.  All trace events generated by the thread will be
+ * recorded in this ring.  Timestamps for the events are in nanoseconds.
+ *
+ * @param ring The trace ring to initialize.
+ * @param events Storage for the events in the ring.
+ * @param count The number of events that can be stored.  This must be a power of 2.
+ *
+ * @return 0 if the trace ring was initialized successfully or an error code.
+ */
+int trace_ring_linux_init_thread (struct trace_ring *ring, struct trace_ring_event *events,
+	size_t count)
+{
+	int status;
+
+	status = trace_ring_init (ring, events, count, (uint32_t) syscall (SYS_gettid));
+	if (status != 0) {
+		return status;
+	}
+
+	trace_ring_linux_current = ring;
+
+	return 0;
+}
+
+/**
+ * Stop recording trace events for the calling thread.  The events already in the thread's trace
+ * ring are not affected.
+ */
+void trace_ring_linux_release_thread (void)
+{
+	trace_ring_linux_current = NULL;
+}
+
+/**
+ * Write the events from a trace ring in Chrome trace event format.
+ *
+ * @param ring The trace ring to export.
+ * @param pid The process ID to report for the events.
+ * @param first Flag indicating if no events have been written yet.
+ * @param out The file to write the events to.
+ *
+ * @return 0 if the events were written successfully or an error code.
+ */
+static int trace_ring_linux_export_ring (const struct trace_ring *ring, int pid, bool *first,
+	FILE *out)
+{
+	const struct trace_ring_event *event;
+	const char *name;
+	char unknown[32];
+	size_t count;
+	size_t i;
+	int status;
+
+	count = trace_ring_get_event_count (ring);
+	for (i = 0; i < count; i++) {
+		event = trace_ring_get_event (ring, i);
+
+		if (event->point < TRACE_RING_NUM_POINTS) {
+			name = trace_ring_linux_point_names[event->point];
+		}
+		else {
+			snprintf (unknown, sizeof (unknown), "trace_point_%u", event->point);
+			name = unknown;
+		}
+
+		status = fprintf (out,
+			"%s\n{\"name\":\"%s\",\"cat\":\"cerberus\",\"ph\":\"%c\",\"ts\":%" PRIu64 ".%03u,"
+			"\"pid\":%d,\"tid\":%" PRIu32 ",", (*first) ? "" : ",", name,
+			(event->type == TRACE_RING_EVENT_END) ? 'E' : 'B', event->timestamp / 1000,
+			(unsigned int) (event->timestamp % 1000), pid, ring->thread_id);
+		if (status < 0) {
+			return TRACE_RING_EXPORT_FAILED;
+		}
+
+		if (event->type == TRACE_RING_EVENT_END) {
+			status = fprintf (out, "\"args\":{\"result\":\"0x%08" PRIx32 "\"}}", event->arg);
+		}
+		else {
+			status = fprintf (out, "\"args\":{\"arg\":%" PRIu32 "}}", event->arg);
+		}
+		if (status < 0) {
+			return TRACE_RING_EXPORT_FAILED;
+		}
+
+		*first = false;
+	}
+
+	return 0;
+}
+
+/**
+ * Export trace events as JSON in the Chrome trace event format.  The output can be loaded by trace
+ * viewers such as chrome://tracing or Perfetto to display a flame chart for each thread.
+ *
+ * Rings should not be actively recording events while they are being exported.
+ *
+ * @param rings The list of trace rings to export.  Null entries in the list will be skipped.
+ * @param count The number of trace rings in the list.
+ * @param out The file to write the trace to.
+ *
+ * @return 0 if the trace was exported successfully or an error code.
+ */
+int trace_ring_linux_export_chrome_trace (const struct trace_ring *const *rings, size_t count,
+	FILE *out)
+{
+	bool first = true;
+	int pid = getpid ();
+	size_t i;
+	int status;
+
+	if (((rings == NULL) && (count != 0)) || (out == NULL)) {
+		return TRACE_RING_INVALID_ARGUMENT;
+	}
+
+	if (fprintf (out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[") < 0) {
+		return TRACE_RING_EXPORT_FAILED;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (rings[i] != NULL) {
+			status = trace_ring_linux_export_ring (rings[i], pid, &first, out);
+			if (status != 0) {
+				return status;
+			}
+		}
+	}
+
+	if ((fprintf (out, "\n]}\n") < 0) || (fflush (out) != 0)) {
+		return TRACE_RING_EXPORT_FAILED;
+	}
+
+	return 0;
+}
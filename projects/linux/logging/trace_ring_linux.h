@@ -0,0 +1,20 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef TRACE_RING_LINUX_H_
+#define TRACE_RING_LINUX_H_
+
+#include <stddef.h>
+#include <stdio.h>
+#include "logging/trace_ring.h"
+
+
+int trace_ring_linux_init_thread (struct trace_ring *ring, struct trace_ring_event *events,
+	size_t count);
+void trace_ring_linux_release_thread (void);
+
+int trace_ring_linux_export_chrome_trace (const struct trace_ring *const *rings, size_t count,
+	FILE *out);
+
+
+#endif /* TRACE_RING_LINUX_H_ */
@@ -0,0 +1,334 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef _GNU_SOURCE
+#define	_GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include "event_task_linux.h"
+
+
+int event_task_linux_lock (const struct event_task *task)
+{
+	const struct event_task_linux *linux_task = (const struct event_task_linux*) task;
+
+	if (linux_task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	return platform_mutex_lock (&linux_task->state->lock);
+}
+
+int event_task_linux_unlock (const struct event_task *task)
+{
+	const struct event_task_linux *linux_task = (const struct event_task_linux*) task;
+
+	if (linux_task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	return platform_mutex_unlock (&linux_task->state->lock);
+}
+
+int event_task_linux_get_event_context (const struct event_task *task,
+	struct event_task_context **context)
+{
+	const struct event_task_linux *linux_task = (const struct event_task_linux*) task;
+	int status;
+
+	if ((linux_task == NULL) || (context == NULL)) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&linux_task->state->lock);
+	if (!linux_task->state->started) {
+		status = EVENT_TASK_NO_TASK;
+	}
+	else if (!linux_task->state->notifying && (linux_task->state->running < 0)) {
+		linux_task->state->notifying = true;
+		*context = &linux_task->state->context;
+
+		/* The lock is held until the event is triggered. */
+		return 0;
+	}
+	else {
+		status = EVENT_TASK_BUSY;
+	}
+
+	platform_mutex_unlock (&linux_task->state->lock);
+
+	return status;
+}
+
+int event_task_linux_notify (const struct event_task *task,
+	const struct event_task_handler *handler)
+{
+	const struct event_task_linux *linux_task = (const struct event_task_linux*) task;
+	uint64_t signal = 1;
+	int status;
+
+	if (task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	/* The notifying flag is only set while the caller holds the task lock for a started task, so
+	 * the running handler can be safely checked once the flag has been confirmed. */
+	if (linux_task->state->notifying) {
+		if (linux_task->state->running < 0) {
+			/* Make sure the requested handler is registered with the task. */
+			status = event_task_find_handler (handler, linux_task->handlers,
+				linux_task->num_handlers);
+			if (!ROT_IS_ERROR (status)) {
+				linux_task->state->running = status;
+				status = 0;
+			}
+		}
+		else {
+			status = EVENT_TASK_BUSY;
+		}
+
+		linux_task->state->notifying = false;
+		platform_mutex_unlock (&linux_task->state->lock);
+		if (status == 0) {
+			/* If the handler is valid, wake the thread to process the event. */
+			if (write (linux_task->state->event_fd, &signal, sizeof (signal)) != sizeof (signal)) {
+				status = EVENT_TASK_NOTIFY_FAILED;
+			}
+		}
+	}
+	else {
+		/* The caller doesn't hold the lock, so it must be taken to check the thread state. */
+		platform_mutex_lock (&linux_task->state->lock);
+		status = (linux_task->state->started) ? EVENT_TASK_NOT_READY : EVENT_TASK_NO_TASK;
+		platform_mutex_unlock (&linux_task->state->lock);
+	}
+
+	return status;
+}
+
+/**
+ * Initialize an event handler task.  The thread will not be created until a call to
+ * {@link event_task_linux_start}.
+ *
+ * @param task The event handler task to initialize.
+ * @param state Variable context for the task.  This must be uninitialized.
+ * @param system The manager for system operations.
+ * @param handlers The list of event handlers that can be used with this task instance.
+ * @param num_handlers The number of event handlers in the list.
+ *
+ * @return 0 if the task was initialized or an error code
+ */
+int event_task_linux_init (struct event_task_linux *task, struct event_task_linux_state *state,
+	struct system *system, const struct event_task_handler **handlers, size_t num_handlers)
+{
+	if (task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (task, 0, sizeof (struct event_task_linux));
+
+	task->base.lock = event_task_linux_lock;
+	task->base.unlock = event_task_linux_unlock;
+	task->base.get_event_context = event_task_linux_get_event_context;
+	task->base.notify = event_task_linux_notify;
+
+	task->state = state;
+	task->system = system;
+	task->handlers = handlers;
+	task->num_handlers = num_handlers;
+
+	return event_task_linux_init_state (task);
+}
+
+/**
+ * Initialize only the variable state for an event handler task.  The rest of the task instance is
+ * assumed to have already been initialized.  The thread will not be created until a call to
+ * {@link event_task_linux_start}.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param task The task instance that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int event_task_linux_init_state (const struct event_task_linux *task)
+{
+	int status;
+
+	if ((task == NULL) || (task->state == NULL) || (task->system == NULL) ||
+		(task->handlers == NULL) || (task->num_handlers == 0)) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (task->state, 0, sizeof (struct event_task_linux_state));
+
+	/* Leave the running handler set to 0 initially.  This will get cleared after the handlers have
+	 * been initialized for execution within the thread context. */
+
+	task->state->event_fd = eventfd (0, EFD_CLOEXEC);
+	if (task->state->event_fd < 0) {
+		return EVENT_TASK_NO_MEMORY;
+	}
+
+	status = platform_mutex_init (&task->state->lock);
+	if (status != 0) {
+		close (task->state->event_fd);
+	}
+
+	return status;
+}
+
+/**
+ * Stop the event task and release all resources used by the task.  No handlers will be released.
+ *
+ * If a handler is currently running, this will block until the handler has completed.
+ *
+ * @param task The task to release.
+ */
+void event_task_linux_release (const struct event_task_linux *task)
+{
+	uint64_t signal = 1;
+	bool started;
+
+	if (task) {
+		platform_mutex_lock (&task->state->lock);
+		started = task->state->started;
+		task->state->stop = started;
+		platform_mutex_unlock (&task->state->lock);
+
+		if (started) {
+			if (write (task->state->event_fd, &signal, sizeof (signal)) != sizeof (signal)) {
+				pthread_cancel (task->state->thread);
+			}
+
+			pthread_join (task->state->thread, NULL);
+
+			platform_mutex_lock (&task->state->lock);
+			task->state->started = false;
+			platform_mutex_unlock (&task->state->lock);
+		}
+
+		close (task->state->event_fd);
+		platform_mutex_free (&task->state->lock);
+	}
+}
+
+/**
+ * Thread routine to handle notifications for registered handlers.
+ *
+ * @param arg The task to process event notifications.
+ *
+ * @return Always null.
+ */
+static void* event_task_linux_process_notification (void *arg)
+{
+	const struct event_task_linux *task = arg;
+	uint64_t count;
+	bool reset = false;
+	int running;
+
+	event_task_prepare_handlers (task->handlers, task->num_handlers);
+
+	/* Indicate that the handlers have been initialized and the thread is ready to process
+	 * notifications. */
+	platform_mutex_lock (&task->state->lock);
+	task->state->running = -1;
+	platform_mutex_unlock (&task->state->lock);
+
+	while (1) {
+		/* Wait for notification that an event should be processed. */
+		if (read (task->state->event_fd, &count, sizeof (count)) != sizeof (count)) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			break;
+		}
+
+		platform_mutex_lock (&task->state->lock);
+		if (task->state->stop) {
+			platform_mutex_unlock (&task->state->lock);
+			break;
+		}
+
+		running = task->state->running;
+		platform_mutex_unlock (&task->state->lock);
+
+		/* Sanity check the handler index before using it. */
+		if ((running >= 0) && ((size_t) running < task->num_handlers)) {
+			/* Execute the selected handler for the event. */
+			task->handlers[running]->execute (task->handlers[running], &task->state->context,
+				&reset);
+		}
+
+		if (reset) {
+			/* If the event requires it, reset the system.  We need to wait a bit before triggering
+			 * the reset to allow time for any execution status to be reported. */
+			platform_msleep (5000);
+			system_reset (task->system);
+			reset = false;	/* We should never get here, but clear the flag if the reset fails. */
+		}
+
+		/* Clear the running handler to be ready for the next event notification. */
+		platform_mutex_lock (&task->state->lock);
+		task->state->running = -1;
+		platform_mutex_unlock (&task->state->lock);
+	}
+
+	return NULL;
+}
+
+/**
+ * Create and start running the event handler thread. No events can be handled until the task has
+ * been started.
+ *
+ * @param task The event task to start.
+ * @param task_name An identifying name to assign to the thread.  Names longer than 15 characters
+ * will be truncated.  This can be null to use the default name.
+ *
+ * @return 0 if the task was started or an error code.
+ */
+int event_task_linux_start (const struct event_task_linux *task, const char *task_name)
+{
+	char name[16];
+	int status;
+
+	if (task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	/* Hold the lock while creating the thread so the thread state is consistent for any tasks
+	 * checking it.  The new thread will wait for the lock before processing any events. */
+	platform_mutex_lock (&task->state->lock);
+	if (task->state->started) {
+		/* The task is already running. */
+		platform_mutex_unlock (&task->state->lock);
+
+		return 0;
+	}
+
+	status = pthread_create (&task->state->thread, NULL, event_task_linux_process_notification,
+		(void*) task);
+	if (status != 0) {
+		platform_mutex_unlock (&task->state->lock);
+
+		return EVENT_TASK_NO_MEMORY;
+	}
+
+	if (task_name != NULL) {
+		strncpy (name, task_name, sizeof (name) - 1);
+		name[sizeof (name) - 1] = '\0';
+		pthread_setname_np (task->state->thread, name);
+	}
+
+	task->state->started = true;
+	platform_mutex_unlock (&task->state->lock);
+
+	return 0;
+}
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef EVENT_TASK_LINUX_H_
+#define EVENT_TASK_LINUX_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "platform_api.h"
+#include "system/event_task.h"
+#include "system/system.h"
+
+
+/**
+ * Variable context for the task.
+ */
+struct event_task_linux_state {
+	struct event_task_context context;			/**< Context for handlers to use for event processing. */
+	pthread_t thread;							/**< The thread that will execute event handlers. */
+	bool started;								/**< Flag to indicate the thread is running.  Protected by the lock. */
+	platform_mutex lock;						/**< Synchronization with the execution thread. */
+	int event_fd;								/**< eventfd used to wake the execution thread. */
+	bool notifying;								/**< Flag to indicate when an event is being triggered. */
+	bool stop;									/**< Flag to indicate the execution thread should exit. */
+	int running;								/**< Index of the active handler for event processing. */
+};
+
+/**
+ * Linux implementation for a task to handle event processing.  Events are executed on a dedicated
+ * pthread that is woken through an eventfd.
+ */
+struct event_task_linux {
+	struct event_task base;						/**< Base interface to the task. */
+	struct event_task_linux_state *state;		/**< Variable context for the task. */
+	struct system *system;						/**< The system manager. */
+	const struct event_task_handler **handlers;	/**< List of registered event handlers. */
+	size_t num_handlers;						/**< Number of registered handlers in the list. */
+};
+
+
+int event_task_linux_init (struct event_task_linux *task, struct event_task_linux_state *state,
+	struct system *system, const struct event_task_handler **handlers, size_t num_handlers);
+int event_task_linux_init_state (const struct event_task_linux *task);
+void event_task_linux_release (const struct event_task_linux *task);
+
+int event_task_linux_start (const struct event_task_linux *task, const char *task_name);
+
+
+#endif /* EVENT_TASK_LINUX_H_ */
@@ -0,0 +1,293 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef _GNU_SOURCE
+#define	_GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include "periodic_task_linux.h"
+#include "system/system_logging.h"
+
+
+/**
+ * Initialize a periodic handler task.  The thread will not be created until a call to
+ * {@link periodic_task_linux_start}.
+ *
+ * @param task The periodic handler task to initialize.
+ * @param state Variable context for the task.  This must be uninitialized.
+ * @param scheduler The scheduler for the handlers that will be run by the task.
+ * @param log_id Identifier for this task in log messages.
+ *
+ * @return 0 if the task was initialized or an error code
+ */
+int periodic_task_linux_init (struct periodic_task_linux *task,
+	struct periodic_task_linux_state *state, const struct periodic_task_scheduler *scheduler,
+	int log_id)
+{
+	if (task == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (task, 0, sizeof (struct periodic_task_linux));
+
+	task->state = state;
+	task->scheduler = scheduler;
+	task->id = log_id;
+
+	return periodic_task_linux_init_state (task);
+}
+
+/**
+ * Initialize only the variable state for a periodic handler task.  The rest of the task instance is
+ * assumed to have already been initialized.  The thread will not be created until a call to
+ * {@link periodic_task_linux_start}.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param task The task instance that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int periodic_task_linux_init_state (const struct periodic_task_linux *task)
+{
+	struct periodic_task_linux_state *state;
+	struct epoll_event event;
+	int status = PERIODIC_TASK_NO_MEMORY;
+
+	if ((task == NULL) || (task->state == NULL) || (task->scheduler == NULL)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	state = task->state;
+	memset (state, 0, sizeof (struct periodic_task_linux_state));
+
+	state->stop_fd = eventfd (0, EFD_CLOEXEC);
+	if (state->stop_fd < 0) {
+		return PERIODIC_TASK_NO_MEMORY;
+	}
+
+	state->timer_fd = timerfd_create (CLOCK_MONOTONIC, TFD_CLOEXEC);
+	if (state->timer_fd < 0) {
+		goto close_stop;
+	}
+
+	state->epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+	if (state->epoll_fd < 0) {
+		goto close_timer;
+	}
+
+	memset (&event, 0, sizeof (event));
+	event.events = EPOLLIN;
+
+	event.data.fd = state->stop_fd;
+	if (epoll_ctl (state->epoll_fd, EPOLL_CTL_ADD, state->stop_fd, &event) != 0) {
+		goto close_epoll;
+	}
+
+	event.data.fd = state->timer_fd;
+	if (epoll_ctl (state->epoll_fd, EPOLL_CTL_ADD, state->timer_fd, &event) != 0) {
+		goto close_epoll;
+	}
+
+	status = platform_mutex_init (&state->lock);
+	if (status != 0) {
+		goto close_epoll;
+	}
+
+	return 0;
+
+close_epoll:
+	close (state->epoll_fd);
+close_timer:
+	close (state->timer_fd);
+close_stop:
+	close (state->stop_fd);
+	return status;
+}
+
+/**
+ * Stop the periodic task and release all resources used by the task.  No handlers will be released.
+ *
+ * If a handler is currently running, this will block until the handler has completed.
+ *
+ * @param task The task to release.
+ */
+void periodic_task_linux_release (const struct periodic_task_linux *task)
+{
+	uint64_t signal = 1;
+	bool started;
+
+	if (task) {
+		platform_mutex_lock (&task->state->lock);
+		started = task->state->started;
+		platform_mutex_unlock (&task->state->lock);
+
+		if (started) {
+			if (write (task->state->stop_fd, &signal, sizeof (signal)) != sizeof (signal)) {
+				pthread_cancel (task->state->thread);
+			}
+
+			pthread_join (task->state->thread, NULL);
+
+			platform_mutex_lock (&task->state->lock);
+			task->state->started = false;
+			platform_mutex_unlock (&task->state->lock);
+		}
+
+		close (task->state->epoll_fd);
+		close (task->state->timer_fd);
+		close (task->state->stop_fd);
+		platform_mutex_free (&task->state->lock);
+	}
+}
+
+/**
+ * Arm the task timer to expire after a specified amount of time.
+ *
+ * @param task The task that owns the timer.
+ * @param delay_ms The number of milliseconds until the timer expires.
+ *
+ * @return 0 if the timer was armed or -1 on error.
+ */
+static int periodic_task_linux_arm_timer (const struct periodic_task_linux *task,
+	uint32_t delay_ms)
+{
+	struct itimerspec timeout;
+
+	memset (&timeout, 0, sizeof (timeout));
+	timeout.it_value.tv_sec = delay_ms / 1000;
+	timeout.it_value.tv_nsec = (delay_ms % 1000) * 1000000;
+
+	return timerfd_settime (task->state->timer_fd, 0, &timeout, NULL);
+}
+
+/**
+ * Thread routine to call periodic actions for registered handlers.
+ *
+ * @param arg The task context for running the handlers.
+ *
+ * @return Always null.
+ */
+static void* periodic_task_linux_loop (void *arg)
+{
+	const struct periodic_task_linux *task = arg;
+	struct epoll_event events[2];
+	uint32_t delay;
+	int timeout;
+	int num_events;
+	int i;
+	int status;
+	int last_error = 0;
+
+	status = periodic_task_scheduler_prepare_handlers (task->scheduler);
+	if (status != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
+			SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
+		last_error = status;
+	}
+
+	while (1) {
+		status = periodic_task_scheduler_get_next_delay (task->scheduler, &delay);
+		if (status != 0) {
+			if (status != last_error) {
+				debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
+					SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
+			}
+
+			last_error = status;
+			delay = PERIODIC_TASK_LINUX_ERROR_DELAY_MS;
+		}
+
+		/* Don't block when a handler is ready, but still check for a request to stop. */
+		timeout = 0;
+		if (delay != 0) {
+			if (periodic_task_linux_arm_timer (task, delay) == 0) {
+				timeout = -1;
+			}
+			else {
+				timeout = delay;
+			}
+		}
+
+		num_events = epoll_wait (task->state->epoll_fd, events, 2, timeout);
+		if ((num_events < 0) && (errno != EINTR)) {
+			break;
+		}
+
+		/* There is no need to read the timer on expiration.  Arming the timer again will clear any
+		 * pending expiration. */
+		for (i = 0; i < num_events; i++) {
+			if (events[i].data.fd == task->state->stop_fd) {
+				return NULL;
+			}
+		}
+
+		if ((status == 0) && (delay == 0)) {
+			status = periodic_task_scheduler_execute_next_handler (task->scheduler);
+			if ((status != 0) && (status != last_error)) {
+				debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
+					SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
+			}
+
+			last_error = status;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Create and start running the periodic handler thread. No handlers will be called until the task
+ * has been started.
+ *
+ * @param task The periodic task to start.
+ * @param task_name An identifying name to assign to the thread.  Names longer than 15 characters
+ * will be truncated.  This can be null to use the default name.
+ *
+ * @return 0 if the task was started or an error code.
+ */
+int periodic_task_linux_start (const struct periodic_task_linux *task, const char *task_name)
+{
+	char name[16];
+	int status;
+
+	if (task == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	/* Hold the lock while creating the thread so the thread state is consistent for any tasks
+	 * checking it. */
+	platform_mutex_lock (&task->state->lock);
+	if (task->state->started) {
+		/* The task is already running. */
+		platform_mutex_unlock (&task->state->lock);
+
+		return 0;
+	}
+
+	status = pthread_create (&task->state->thread, NULL, periodic_task_linux_loop, (void*) task);
+	if (status != 0) {
+		platform_mutex_unlock (&task->state->lock);
+
+		return PERIODIC_TASK_NO_MEMORY;
+	}
+
+	if (task_name != NULL) {
+		strncpy (name, task_name, sizeof (name) - 1);
+		name[sizeof (name) - 1] = '\0';
+		pthread_setname_np (task->state->thread, name);
+	}
+
+	task->state->started = true;
+	platform_mutex_unlock (&task->state->lock);
+
+	return 0;
+}
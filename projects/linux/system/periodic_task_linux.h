@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef PERIODIC_TASK_LINUX_H_
+#define PERIODIC_TASK_LINUX_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "platform_api.h"
+#include "system/periodic_task.h"
+#include "system/periodic_task_scheduler.h"
+
+
+/**
+ * The number of milliseconds to wait before trying again when no handler could be scheduled.
+ */
+#ifndef PERIODIC_TASK_LINUX_ERROR_DELAY_MS
+#define	PERIODIC_TASK_LINUX_ERROR_DELAY_MS		1000
+#endif
+
+
+/**
+ * Variable context for the task.
+ */
+struct periodic_task_linux_state {
+	pthread_t thread;								/**< The thread that will execute periodic operations. */
+	bool started;									/**< Flag to indicate the thread is running.  Protected by the lock. */
+	platform_mutex lock;							/**< Synchronization for the thread state. */
+	int stop_fd;									/**< eventfd used to stop the execution thread. */
+	int timer_fd;									/**< timerfd used to wait for the next handler. */
+	int epoll_fd;									/**< epoll instance that waits on the stop and timer events. */
+};
+
+/**
+ * Linux implementation for a task to run periodic handlers.  Handlers are run on a dedicated
+ * pthread that uses a scheduler to determine the next handler to run and waits on a timerfd until
+ * that handler is ready.
+ */
+struct periodic_task_linux {
+	struct periodic_task_linux_state *state;		/**< Variable context for the task. */
+	const struct periodic_task_scheduler *scheduler;	/**< Scheduler for the periodic handlers. */
+	int id;											/**< Logging identifier. */
+};
+
+
+int periodic_task_linux_init (struct periodic_task_linux *task,
+	struct periodic_task_linux_state *state, const struct periodic_task_scheduler *scheduler,
+	int log_id);
+int periodic_task_linux_init_state (const struct periodic_task_linux *task);
+void periodic_task_linux_release (const struct periodic_task_linux *task);
+
+int periodic_task_linux_start (const struct periodic_task_linux *task, const char *task_name);
+
+
+#endif /* PERIODIC_TASK_LINUX_H_ */
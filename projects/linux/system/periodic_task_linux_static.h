@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef PERIODIC_TASK_LINUX_STATIC_H_
+#define PERIODIC_TASK_LINUX_STATIC_H_
+
+#include "periodic_task_linux.h"
+
+
+/**
+ * Initialize a static instance of a Linux periodic handler task.  The thread itself will still be
+ * dynamically allocated.  This does not initialize the task state.  This can be a constant
+ * instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the task.
+ * @param scheduler_ptr The scheduler for the periodic handlers.
+ * @param log_id Identifier for this task in log messages.
+ */
+#define	periodic_task_linux_static_init(state_ptr, scheduler_ptr, log_id)	{ \
+		.state = state_ptr, \
+		.scheduler = scheduler_ptr, \
+		.id = log_id \
+	}
+
+
+#endif /* PERIODIC_TASK_LINUX_STATIC_H_ */
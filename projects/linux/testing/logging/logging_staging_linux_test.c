@@ -0,0 +1,284 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "testing.h"
+#include "common/array_size.h"
+#include "common/unused.h"
+#include "logging/log_flush_handler.h"
+#include "logging/logging_staging.h"
+
+
+TEST_SUITE_LABEL ("logging_staging_linux");
+
+
+/**
+ * Number of threads concurrently adding entries to the shared log.  Each thread has its own staging
+ * log.
+ */
+#define	LOGGING_STAGING_LINUX_TESTING_PRODUCERS		4
+
+/**
+ * Number of entries added by each producer thread.
+ */
+#define	LOGGING_STAGING_LINUX_TESTING_ENTRIES		10000
+
+/**
+ * Maximum number of bytes of data in a single test entry.
+ */
+#define	LOGGING_STAGING_LINUX_TESTING_MAX_DATA		16
+
+
+/**
+ * Entry added to the staging log by a producer thread.  Only the used portion of the data is added
+ * to the log.
+ */
+struct logging_staging_linux_testing_entry {
+	uint32_t seq;										/**< Sequence number of the entry for the producer. */
+	uint8_t producer;									/**< The producer that generated the entry. */
+	uint8_t length;										/**< Number of bytes of data in the entry. */
+	uint8_t data[LOGGING_STAGING_LINUX_TESTING_MAX_DATA];	/**< Data for the entry. */
+};
+
+/**
+ * Shared log that saves each entry it receives from the staging log.
+ */
+struct logging_staging_linux_testing_log {
+	struct logging base;								/**< The base logging instance. */
+	struct logging_staging_linux_testing_entry entries[LOGGING_STAGING_LINUX_TESTING_PRODUCERS *
+		LOGGING_STAGING_LINUX_TESTING_ENTRIES];			/**< The entries added to the log. */
+	size_t count;										/**< Number of entries added to the log. */
+	size_t bad_length;									/**< Number of entries received with a bad length. */
+};
+
+/**
+ * Context for a thread adding entries to its staging log.
+ */
+struct logging_staging_linux_testing_producer {
+	struct logging_staging_state state;					/**< Variable context for the staging log. */
+	struct logging_staging staging;						/**< The staging log to add entries to. */
+	uint8_t ring[256];									/**< Buffer for the staging log. */
+	pthread_barrier_t *start;							/**< Barrier to start all producers together. */
+	uint8_t id;											/**< Identifier for the producer. */
+	int status;											/**< Result of adding the entries. */
+};
+
+/**
+ * Context for the thread draining the staging logs.
+ */
+struct logging_staging_linux_testing_consumer {
+	const struct log_flush_handler *flush;				/**< The handler that drains the staging logs. */
+	volatile bool done;									/**< Flag to indicate the producers have finished. */
+};
+
+
+/* The shared log is too large for the stack. */
+static struct logging_staging_linux_testing_log logging_staging_linux_testing_shared;
+
+
+static int logging_staging_linux_testing_create_entry (const struct logging *logging,
+	uint8_t *entry, size_t length)
+{
+	struct logging_staging_linux_testing_log *log =
+		(struct logging_staging_linux_testing_log*) logging;
+
+	if ((log->count >= ARRAY_SIZE (log->entries)) ||
+		(length > sizeof (struct logging_staging_linux_testing_entry))) {
+		log->bad_length++;
+
+		return LOGGING_BAD_ENTRY_LENGTH;
+	}
+
+	memcpy (&log->entries[log->count++], entry, length);
+
+	return 0;
+}
+
+static int logging_staging_linux_testing_flush (const struct logging *logging)
+{
+	UNUSED (logging);
+
+	return 0;
+}
+
+/**
+ * Thread that adds entries to its staging log.  Entries that don't fit in the ring are retried
+ * until they are accepted.
+ *
+ * @param arg The producer context.
+ *
+ * @return Always null.
+ */
+static void* logging_staging_linux_testing_producer (void *arg)
+{
+	struct logging_staging_linux_testing_producer *producer = arg;
+	struct logging_staging_linux_testing_entry entry;
+	uint32_t i;
+	size_t j;
+	int status;
+
+	producer->status = 0;
+	pthread_barrier_wait (producer->start);
+
+	for (i = 0; i < LOGGING_STAGING_LINUX_TESTING_ENTRIES; i++) {
+		entry.seq = i;
+		entry.producer = producer->id;
+		entry.length = (i % LOGGING_STAGING_LINUX_TESTING_MAX_DATA) + 1;
+
+		for (j = 0; j < entry.length; j++) {
+			entry.data[j] = producer->id ^ (i + j);
+		}
+
+		do {
+			status = producer->staging.base.create_entry (&producer->staging.base,
+				(uint8_t*) &entry,
+				offsetof (struct logging_staging_linux_testing_entry, data) + entry.length);
+			if (status == LOGGING_BUFFER_FULL) {
+				sched_yield ();
+			}
+		} while (status == LOGGING_BUFFER_FULL);
+
+		if (status != 0) {
+			producer->status = status;
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Thread that runs the log flush handler while the producers are running.
+ *
+ * @param arg The consumer context.
+ *
+ * @return Always null.
+ */
+static void* logging_staging_linux_testing_consumer (void *arg)
+{
+	struct logging_staging_linux_testing_consumer *consumer = arg;
+
+	while (!consumer->done) {
+		consumer->flush->base.execute (&consumer->flush->base);
+		sched_yield ();
+	}
+
+	return NULL;
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void logging_staging_linux_test_flush_handler_concurrent_producers (CuTest *test)
+{
+	struct logging_staging_linux_testing_log *shared = &logging_staging_linux_testing_shared;
+	struct logging_staging_linux_testing_producer producer[LOGGING_STAGING_LINUX_TESTING_PRODUCERS];
+	const struct logging_staging *staging_list[LOGGING_STAGING_LINUX_TESTING_PRODUCERS];
+	const struct logging *log_list[] = {&shared->base};
+	struct logging_staging_linux_testing_consumer consumer;
+	struct log_flush_handler_state flush_state;
+	struct log_flush_handler flush;
+	pthread_t producer_thread[LOGGING_STAGING_LINUX_TESTING_PRODUCERS];
+	pthread_t consumer_thread;
+	pthread_barrier_t start;
+	uint32_t next_seq[LOGGING_STAGING_LINUX_TESTING_PRODUCERS] = {0};
+	struct logging_staging_linux_testing_entry *entry;
+	size_t i;
+	size_t j;
+	int status;
+
+	TEST_START;
+
+	memset (shared, 0, sizeof (*shared));
+	shared->base.create_entry = logging_staging_linux_testing_create_entry;
+	shared->base.flush = logging_staging_linux_testing_flush;
+
+	for (i = 0; i < ARRAY_SIZE (producer); i++) {
+		status = logging_staging_init (&producer[i].staging, &producer[i].state, &shared->base,
+			producer[i].ring, sizeof (producer[i].ring));
+		CuAssertIntEquals (test, 0, status);
+
+		staging_list[i] = &producer[i].staging;
+	}
+
+	status = log_flush_handler_init_with_staging (&flush, &flush_state, staging_list,
+		ARRAY_SIZE (staging_list), log_list, ARRAY_SIZE (log_list), 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pthread_barrier_init (&start, NULL, LOGGING_STAGING_LINUX_TESTING_PRODUCERS);
+	CuAssertIntEquals (test, 0, status);
+
+	consumer.flush = &flush;
+	consumer.done = false;
+
+	status = pthread_create (&consumer_thread, NULL, logging_staging_linux_testing_consumer,
+		&consumer);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < ARRAY_SIZE (producer); i++) {
+		producer[i].start = &start;
+		producer[i].id = i;
+
+		status = pthread_create (&producer_thread[i], NULL, logging_staging_linux_testing_producer,
+			&producer[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	for (i = 0; i < ARRAY_SIZE (producer); i++) {
+		pthread_join (producer_thread[i], NULL);
+	}
+
+	consumer.done = true;
+	pthread_join (consumer_thread, NULL);
+	pthread_barrier_destroy (&start);
+
+	/* Pick up anything staged after the last execution of the handler. */
+	flush.base.execute (&flush.base);
+
+	for (i = 0; i < ARRAY_SIZE (producer); i++) {
+		CuAssertIntEquals (test, 0, producer[i].status);
+	}
+
+	CuAssertIntEquals (test, 0, shared->bad_length);
+	CuAssertIntEquals (test, ARRAY_SIZE (shared->entries), shared->count);
+
+	/* Every entry from each producer must be present, intact, and in the order it was added. */
+	for (i = 0; i < shared->count; i++) {
+		entry = &shared->entries[i];
+
+		CuAssertTrue (test, (entry->producer < LOGGING_STAGING_LINUX_TESTING_PRODUCERS));
+		CuAssertIntEquals (test, next_seq[entry->producer], entry->seq);
+		CuAssertIntEquals (test, (entry->seq % LOGGING_STAGING_LINUX_TESTING_MAX_DATA) + 1,
+			entry->length);
+
+		for (j = 0; j < entry->length; j++) {
+			CuAssertIntEquals (test, (uint8_t) (entry->producer ^ (entry->seq + j)),
+				entry->data[j]);
+		}
+
+		next_seq[entry->producer]++;
+	}
+
+	for (i = 0; i < ARRAY_SIZE (next_seq); i++) {
+		CuAssertIntEquals (test, LOGGING_STAGING_LINUX_TESTING_ENTRIES, next_seq[i]);
+	}
+
+	log_flush_handler_release (&flush);
+	for (i = 0; i < ARRAY_SIZE (producer); i++) {
+		logging_staging_release (&producer[i].staging);
+	}
+}
+
+
+TEST_SUITE_START (logging_staging_linux);
+
+TEST (logging_staging_linux_test_flush_handler_concurrent_producers);
+
+TEST_SUITE_END;
@@ -0,0 +1,425 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef _GNU_SOURCE
+#define	_GNU_SOURCE
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "testing.h"
+#include "common/array_size.h"
+#include "logging/trace_ring_linux.h"
+
+
+TEST_SUITE_LABEL ("trace_ring_linux");
+
+
+/* Trace rings registered with a thread use static storage so a failed test can't leave the thread
+ * pointing to stack memory that other tests will use. */
+static struct trace_ring trace_ring_linux_testing_ring;
+static struct trace_ring_event trace_ring_linux_testing_events[8];
+
+
+/**
+ * Context for a thread that records trace events in its own ring.
+ */
+struct trace_ring_linux_testing_thread {
+	struct trace_ring ring;					/**< Trace ring for the thread. */
+	struct trace_ring_event events[4];		/**< Storage for the thread trace ring. */
+	struct trace_ring *current;				/**< The ring for the thread after initialization. */
+	uint32_t thread_id;						/**< The ID of the thread. */
+	int status;								/**< Result of initializing the ring. */
+};
+
+/**
+ * Thread that records trace events in a dedicated ring.
+ *
+ * @param arg The thread context.
+ *
+ * @return Always null.
+ */
+static void* trace_ring_linux_testing_thread (void *arg)
+{
+	struct trace_ring_linux_testing_thread *context = arg;
+
+	context->thread_id = (uint32_t) syscall (SYS_gettid);
+	context->status = trace_ring_linux_init_thread (&context->ring, context->events,
+		ARRAY_SIZE (context->events));
+	context->current = trace_ring_get_current ();
+
+	trace_ring_record (context->current, TRACE_RING_POINT_HASH_UPDATE, TRACE_RING_EVENT_BEGIN, 1,
+		trace_ring_get_timestamp ());
+
+	trace_ring_linux_release_thread ();
+
+	return NULL;
+}
+
+/**
+ * Export trace rings and return the generated JSON.
+ *
+ * @param test The test framework.
+ * @param rings The rings to export.
+ * @param count The number of rings.
+ *
+ * @return The exported trace.  This must be freed by the caller.
+ */
+static char* trace_ring_linux_testing_export (CuTest *test, const struct trace_ring *const *rings,
+	size_t count)
+{
+	char *json = NULL;
+	size_t length = 0;
+	FILE *out;
+	int status;
+
+	out = open_memstream (&json, &length);
+	CuAssertPtrNotNull (test, out);
+
+	status = trace_ring_linux_export_chrome_trace (rings, count, out);
+	fclose (out);
+
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, json);
+	CuAssertIntEquals (test, strlen (json), length);
+
+	return json;
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void trace_ring_linux_test_init_thread (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	CuAssertPtrEquals (test, NULL, trace_ring_get_current ());
+
+	status = trace_ring_linux_init_thread (&trace_ring_linux_testing_ring,
+		trace_ring_linux_testing_events, ARRAY_SIZE (trace_ring_linux_testing_events));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, &trace_ring_linux_testing_ring, trace_ring_get_current ());
+	CuAssertIntEquals (test, (uint32_t) syscall (SYS_gettid),
+		trace_ring_linux_testing_ring.thread_id);
+	CuAssertIntEquals (test, 0, trace_ring_get_event_count (&trace_ring_linux_testing_ring));
+
+	trace_ring_linux_release_thread ();
+	CuAssertPtrEquals (test, NULL, trace_ring_get_current ());
+}
+
+static void trace_ring_linux_test_init_thread_invalid_arg (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_linux_init_thread (NULL, trace_ring_linux_testing_events,
+		ARRAY_SIZE (trace_ring_linux_testing_events));
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+	CuAssertPtrEquals (test, NULL, trace_ring_get_current ());
+
+	status = trace_ring_linux_init_thread (&trace_ring_linux_testing_ring, NULL,
+		ARRAY_SIZE (trace_ring_linux_testing_events));
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+	CuAssertPtrEquals (test, NULL, trace_ring_get_current ());
+
+	status = trace_ring_linux_init_thread (&trace_ring_linux_testing_ring,
+		trace_ring_linux_testing_events, 5);
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+	CuAssertPtrEquals (test, NULL, trace_ring_get_current ());
+}
+
+static void trace_ring_linux_test_get_timestamp (CuTest *test)
+{
+	uint64_t first;
+	uint64_t second;
+
+	TEST_START;
+
+	first = trace_ring_get_timestamp ();
+	CuAssertTrue (test, (first != 0));
+
+	usleep (1000);
+
+	second = trace_ring_get_timestamp ();
+	CuAssertTrue (test, (second >= (first + 1000000)));
+}
+
+static void trace_ring_linux_test_per_thread_rings (CuTest *test)
+{
+	struct trace_ring_linux_testing_thread context;
+	const struct trace_ring_event *event;
+	pthread_t thread;
+	int status;
+
+	TEST_START;
+
+	memset (&context, 0, sizeof (context));
+
+	status = trace_ring_linux_init_thread (&trace_ring_linux_testing_ring,
+		trace_ring_linux_testing_events, ARRAY_SIZE (trace_ring_linux_testing_events));
+	CuAssertIntEquals (test, 0, status);
+
+	status = pthread_create (&thread, NULL, trace_ring_linux_testing_thread, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	pthread_join (thread, NULL);
+
+	CuAssertIntEquals (test, 0, context.status);
+	CuAssertPtrEquals (test, &context.ring, context.current);
+	CuAssertIntEquals (test, context.thread_id, context.ring.thread_id);
+	CuAssertTrue (test, (context.ring.thread_id != trace_ring_linux_testing_ring.thread_id));
+	CuAssertIntEquals (test, 1, trace_ring_get_event_count (&context.ring));
+
+	event = trace_ring_get_event (&context.ring, 0);
+	CuAssertPtrNotNull (test, event);
+	CuAssertIntEquals (test, TRACE_RING_POINT_HASH_UPDATE, event->point);
+
+	CuAssertPtrEquals (test, &trace_ring_linux_testing_ring, trace_ring_get_current ());
+	CuAssertIntEquals (test, 0, trace_ring_get_event_count (&trace_ring_linux_testing_ring));
+
+	trace_ring_linux_release_thread ();
+}
+
+#ifdef LOGGING_ENABLE_TRACE_RING
+static void trace_ring_linux_test_begin_end (CuTest *test)
+{
+	const struct trace_ring_event *event;
+	uint64_t start;
+	uint64_t begin;
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_linux_init_thread (&trace_ring_linux_testing_ring,
+		trace_ring_linux_testing_events, ARRAY_SIZE (trace_ring_linux_testing_events));
+	CuAssertIntEquals (test, 0, status);
+
+	start = trace_ring_get_timestamp ();
+
+	TRACE_RING_BEGIN (TRACE_RING_POINT_CMD_PROCESS_REQUEST, 0x12);
+	TRACE_RING_END (TRACE_RING_POINT_CMD_PROCESS_REQUEST, 0x7f001234);
+
+	trace_ring_linux_release_thread ();
+
+	CuAssertIntEquals (test, 2, trace_ring_get_event_count (&trace_ring_linux_testing_ring));
+
+	event = trace_ring_get_event (&trace_ring_linux_testing_ring, 0);
+	CuAssertPtrNotNull (test, event);
+	CuAssertIntEquals (test, TRACE_RING_POINT_CMD_PROCESS_REQUEST, event->point);
+	CuAssertIntEquals (test, TRACE_RING_EVENT_BEGIN, event->type);
+	CuAssertIntEquals (test, 0x12, event->arg);
+	CuAssertTrue (test, (event->timestamp >= start));
+	begin = event->timestamp;
+
+	event = trace_ring_get_event (&trace_ring_linux_testing_ring, 1);
+	CuAssertPtrNotNull (test, event);
+	CuAssertIntEquals (test, TRACE_RING_POINT_CMD_PROCESS_REQUEST, event->point);
+	CuAssertIntEquals (test, TRACE_RING_EVENT_END, event->type);
+	CuAssertIntEquals (test, 0x7f001234, event->arg);
+	CuAssertTrue (test, (event->timestamp >= begin));
+}
+
+static void trace_ring_linux_test_begin_end_no_ring (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_linux_init_thread (&trace_ring_linux_testing_ring,
+		trace_ring_linux_testing_events, ARRAY_SIZE (trace_ring_linux_testing_events));
+	CuAssertIntEquals (test, 0, status);
+
+	trace_ring_linux_release_thread ();
+
+	TRACE_RING_BEGIN (TRACE_RING_POINT_CMD_PROCESS_REQUEST, 0x12);
+	TRACE_RING_END (TRACE_RING_POINT_CMD_PROCESS_REQUEST, 0);
+
+	CuAssertIntEquals (test, 0, trace_ring_get_event_count (&trace_ring_linux_testing_ring));
+}
+#endif
+
+static void trace_ring_linux_test_export_chrome_trace (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[4];
+	const struct trace_ring *rings[] = {&ring};
+	char expected[1024];
+	char *json;
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, ARRAY_SIZE (events), 100);
+	CuAssertIntEquals (test, 0, status);
+
+	trace_ring_record (&ring, TRACE_RING_POINT_MCTP_PROCESS_PACKET, TRACE_RING_EVENT_BEGIN, 64,
+		1000);
+	trace_ring_record (&ring, TRACE_RING_POINT_CMD_PROCESS_REQUEST, TRACE_RING_EVENT_BEGIN, 0x12,
+		2500);
+	trace_ring_record (&ring, TRACE_RING_POINT_CMD_PROCESS_REQUEST, TRACE_RING_EVENT_END, 0,
+		12345678);
+	trace_ring_record (&ring, TRACE_RING_POINT_MCTP_PROCESS_PACKET, TRACE_RING_EVENT_END,
+		0x7f001234, 12346001);
+
+	snprintf (expected, sizeof (expected),
+		"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["
+		"\n{\"name\":\"mctp_interface_process_packet\",\"cat\":\"cerberus\",\"ph\":\"B\","
+			"\"ts\":1.000,\"pid\":%d,\"tid\":100,\"args\":{\"arg\":64}},"
+		"\n{\"name\":\"cmd_interface_process_request\",\"cat\":\"cerberus\",\"ph\":\"B\","
+			"\"ts\":2.500,\"pid\":%d,\"tid\":100,\"args\":{\"arg\":18}},"
+		"\n{\"name\":\"cmd_interface_process_request\",\"cat\":\"cerberus\",\"ph\":\"E\","
+			"\"ts\":12345.678,\"pid\":%d,\"tid\":100,\"args\":{\"result\":\"0x00000000\"}},"
+		"\n{\"name\":\"mctp_interface_process_packet\",\"cat\":\"cerberus\",\"ph\":\"E\","
+			"\"ts\":12346.001,\"pid\":%d,\"tid\":100,\"args\":{\"result\":\"0x7f001234\"}}"
+		"\n]}\n", getpid (), getpid (), getpid (), getpid ());
+
+	json = trace_ring_linux_testing_export (test, rings, ARRAY_SIZE (rings));
+	CuAssertStrEquals (test, expected, json);
+
+	free (json);
+}
+
+static void trace_ring_linux_test_export_chrome_trace_multiple_rings (CuTest *test)
+{
+	struct trace_ring ring1;
+	struct trace_ring_event events1[2];
+	struct trace_ring ring2;
+	struct trace_ring_event events2[2];
+	struct trace_ring ring3;
+	struct trace_ring_event events3[2];
+	const struct trace_ring *rings[] = {&ring1, NULL, &ring2, &ring3};
+	char expected[1024];
+	char *json;
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring1, events1, ARRAY_SIZE (events1), 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = trace_ring_init (&ring2, events2, ARRAY_SIZE (events2), 200);
+	CuAssertIntEquals (test, 0, status);
+
+	status = trace_ring_init (&ring3, events3, ARRAY_SIZE (events3), 300);
+	CuAssertIntEquals (test, 0, status);
+
+	trace_ring_record (&ring1, TRACE_RING_POINT_FLASH_READ, TRACE_RING_EVENT_BEGIN, 256, 1000);
+	trace_ring_record (&ring1, TRACE_RING_POINT_FLASH_READ, TRACE_RING_EVENT_END, 0, 3000);
+
+	trace_ring_record (&ring3, TRACE_RING_POINT_HASH_UPDATE, TRACE_RING_EVENT_BEGIN, 128, 2000);
+
+	snprintf (expected, sizeof (expected),
+		"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["
+		"\n{\"name\":\"spi_flash_read\",\"cat\":\"cerberus\",\"ph\":\"B\","
+			"\"ts\":1.000,\"pid\":%d,\"tid\":100,\"args\":{\"arg\":256}},"
+		"\n{\"name\":\"spi_flash_read\",\"cat\":\"cerberus\",\"ph\":\"E\","
+			"\"ts\":3.000,\"pid\":%d,\"tid\":100,\"args\":{\"result\":\"0x00000000\"}},"
+		"\n{\"name\":\"hash_update\",\"cat\":\"cerberus\",\"ph\":\"B\","
+			"\"ts\":2.000,\"pid\":%d,\"tid\":300,\"args\":{\"arg\":128}}"
+		"\n]}\n", getpid (), getpid (), getpid ());
+
+	json = trace_ring_linux_testing_export (test, rings, ARRAY_SIZE (rings));
+	CuAssertStrEquals (test, expected, json);
+
+	free (json);
+}
+
+static void trace_ring_linux_test_export_chrome_trace_unknown_point (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[2];
+	const struct trace_ring *rings[] = {&ring};
+	char expected[1024];
+	char *json;
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, ARRAY_SIZE (events), 100);
+	CuAssertIntEquals (test, 0, status);
+
+	trace_ring_record (&ring, 0x1234, TRACE_RING_EVENT_BEGIN, 1, 1000);
+
+	snprintf (expected, sizeof (expected),
+		"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["
+		"\n{\"name\":\"trace_point_4660\",\"cat\":\"cerberus\",\"ph\":\"B\","
+			"\"ts\":1.000,\"pid\":%d,\"tid\":100,\"args\":{\"arg\":1}}"
+		"\n]}\n", getpid ());
+
+	json = trace_ring_linux_testing_export (test, rings, ARRAY_SIZE (rings));
+	CuAssertStrEquals (test, expected, json);
+
+	free (json);
+}
+
+static void trace_ring_linux_test_export_chrome_trace_no_events (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[2];
+	const struct trace_ring *rings[] = {&ring};
+	char *json;
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, ARRAY_SIZE (events), 100);
+	CuAssertIntEquals (test, 0, status);
+
+	json = trace_ring_linux_testing_export (test, rings, ARRAY_SIZE (rings));
+	CuAssertStrEquals (test, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n", json);
+	free (json);
+
+	json = trace_ring_linux_testing_export (test, NULL, 0);
+	CuAssertStrEquals (test, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n", json);
+	free (json);
+}
+
+static void trace_ring_linux_test_export_chrome_trace_null (CuTest *test)
+{
+	struct trace_ring ring;
+	struct trace_ring_event events[2];
+	const struct trace_ring *rings[] = {&ring};
+	int status;
+
+	TEST_START;
+
+	status = trace_ring_init (&ring, events, ARRAY_SIZE (events), 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = trace_ring_linux_export_chrome_trace (NULL, 1, stdout);
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+
+	status = trace_ring_linux_export_chrome_trace (rings, ARRAY_SIZE (rings), NULL);
+	CuAssertIntEquals (test, TRACE_RING_INVALID_ARGUMENT, status);
+}
+
+
+TEST_SUITE_START (trace_ring_linux);
+
+TEST (trace_ring_linux_test_init_thread);
+TEST (trace_ring_linux_test_init_thread_invalid_arg);
+TEST (trace_ring_linux_test_get_timestamp);
+TEST (trace_ring_linux_test_per_thread_rings);
+#ifdef LOGGING_ENABLE_TRACE_RING
+TEST (trace_ring_linux_test_begin_end);
+TEST (trace_ring_linux_test_begin_end_no_ring);
+#endif
+TEST (trace_ring_linux_test_export_chrome_trace);
+TEST (trace_ring_linux_test_export_chrome_trace_multiple_rings);
+TEST (trace_ring_linux_test_export_chrome_trace_unknown_point);
+TEST (trace_ring_linux_test_export_chrome_trace_no_events);
+TEST (trace_ring_linux_test_export_chrome_trace_null);
+
+TEST_SUITE_END;
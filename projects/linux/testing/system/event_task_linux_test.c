@@ -0,0 +1,653 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "system/event_task_linux.h"
+#include "system/event_task_linux_static.h"
+
+
+TEST_SUITE_LABEL ("event_task_linux");
+
+
+/**
+ * Event handler for testing that signals when events have been processed.
+ */
+struct event_task_linux_testing_handler {
+	struct event_task_handler base;		/**< The base handler instance. */
+	platform_semaphore done;			/**< Signal that an event has been processed. */
+	platform_semaphore release;			/**< Signal to allow the handler to complete. */
+	bool block;							/**< Flag to wait for a release signal before completing. */
+	int prepared;						/**< Number of times the handler was prepared. */
+	int executed;						/**< Number of times the handler was executed. */
+	uint32_t action;					/**< The last event action that was processed. */
+	uint8_t data;						/**< The first byte of event data that was processed. */
+};
+
+/**
+ * Dependencies for testing.
+ */
+struct event_task_linux_testing {
+	struct event_task_linux_testing_handler handler1;	/**< A test event handler. */
+	struct event_task_linux_testing_handler handler2;	/**< A test event handler. */
+	struct system system;								/**< Placeholder for the system manager. */
+	struct event_task_linux_state state;				/**< Variable context for the task. */
+	struct event_task_linux test;						/**< The event task under test. */
+};
+
+
+/**
+ * Test event handler preparation.
+ *
+ * @param handler The handler to prepare.
+ */
+static void event_task_linux_testing_prepare (const struct event_task_handler *handler)
+{
+	struct event_task_linux_testing_handler *test =
+		(struct event_task_linux_testing_handler*) handler;
+
+	test->prepared++;
+}
+
+/**
+ * Test event handler execution.
+ *
+ * @param handler The handler to execute.
+ * @param context The event context.
+ * @param reset Output for the reset flag.
+ */
+static void event_task_linux_testing_execute (const struct event_task_handler *handler,
+	struct event_task_context *context, bool *reset)
+{
+	struct event_task_linux_testing_handler *test =
+		(struct event_task_linux_testing_handler*) handler;
+
+	test->executed++;
+	test->action = context->action;
+	test->data = context->event_buffer[0];
+
+	if (test->block) {
+		platform_semaphore_wait (&test->release, 0);
+	}
+
+	platform_semaphore_post (&test->done);
+}
+
+/**
+ * Initialize a test event handler.
+ *
+ * @param test The testing framework.
+ * @param handler The handler to initialize.
+ */
+static void event_task_linux_testing_init_handler (CuTest *test,
+	struct event_task_linux_testing_handler *handler)
+{
+	int status;
+
+	memset (handler, 0, sizeof (*handler));
+
+	handler->base.prepare = event_task_linux_testing_prepare;
+	handler->base.execute = event_task_linux_testing_execute;
+
+	status = platform_semaphore_init (&handler->done);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_semaphore_init (&handler->release);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to initialize.
+ */
+static void event_task_linux_testing_init_dependencies (CuTest *test,
+	struct event_task_linux_testing *task)
+{
+	event_task_linux_testing_init_handler (test, &task->handler1);
+	event_task_linux_testing_init_handler (test, &task->handler2);
+
+	memset (&task->system, 0, sizeof (task->system));
+}
+
+/**
+ * Release test dependencies.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to release.
+ */
+static void event_task_linux_testing_release_dependencies (CuTest *test,
+	struct event_task_linux_testing *task)
+{
+	platform_semaphore_free (&task->handler1.done);
+	platform_semaphore_free (&task->handler1.release);
+	platform_semaphore_free (&task->handler2.done);
+	platform_semaphore_free (&task->handler2.release);
+}
+
+/**
+ * Initialize and start an event task for testing.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to initialize.
+ * @param handlers The list of handlers for the task.
+ * @param count The number of handlers in the list.
+ */
+static void event_task_linux_testing_init_and_start (CuTest *test,
+	struct event_task_linux_testing *task, const struct event_task_handler **handlers,
+	size_t count)
+{
+	int status;
+
+	event_task_linux_testing_init_dependencies (test, task);
+
+	status = event_task_linux_init (&task->test, &task->state, &task->system, handlers, count);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_linux_start (&task->test, "event_test");
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Get the event context for a task, waiting for the task to be ready to accept events.
+ *
+ * @param task The task to query.
+ * @param context Output for the event context.
+ *
+ * @return 0 if the context was retrieved or an error code.
+ */
+static int event_task_linux_testing_get_event_context (const struct event_task_linux *task,
+	struct event_task_context **context)
+{
+	int retries = 1000;
+	int status;
+
+	do {
+		status = task->base.get_event_context (&task->base, context);
+		if (status == EVENT_TASK_BUSY) {
+			platform_msleep (1);
+		}
+	} while ((status == EVENT_TASK_BUSY) && (--retries > 0));
+
+	return status;
+}
+
+/**
+ * Release a test instance.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to release.
+ */
+static void event_task_linux_testing_release (CuTest *test, struct event_task_linux_testing *task)
+{
+	event_task_linux_release (&task->test);
+	event_task_linux_testing_release_dependencies (test, task);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void event_task_linux_test_init (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, list, count);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, task.test.base.lock);
+	CuAssertPtrNotNull (test, task.test.base.unlock);
+	CuAssertPtrNotNull (test, task.test.base.get_event_context);
+	CuAssertPtrNotNull (test, task.test.base.notify);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_init_null (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init (NULL, &task.state, &task.system, list, count);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init (&task.test, NULL, &task.system, list, count);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init (&task.test, &task.state, NULL, list, count);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, NULL, count);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, list, 0);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	event_task_linux_testing_release_dependencies (test, &task);
+}
+
+static void event_task_linux_test_static_init (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_linux test_static = event_task_linux_static_init (&task.state, &task.system,
+		list, count);
+	int status;
+
+	TEST_START;
+
+	CuAssertPtrNotNull (test, test_static.base.lock);
+	CuAssertPtrNotNull (test, test_static.base.unlock);
+	CuAssertPtrNotNull (test, test_static.base.get_event_context);
+	CuAssertPtrNotNull (test, test_static.base.notify);
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_linux_release (&test_static);
+	event_task_linux_testing_release_dependencies (test, &task);
+}
+
+static void event_task_linux_test_static_init_null (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_linux null_state = event_task_linux_static_init (NULL, &task.system, list,
+		count);
+	struct event_task_linux null_system = event_task_linux_static_init (&task.state, NULL, list,
+		count);
+	struct event_task_linux null_handlers = event_task_linux_static_init (&task.state,
+		&task.system, NULL, count);
+	struct event_task_linux no_handlers = event_task_linux_static_init (&task.state, &task.system,
+		list, 0);
+	int status;
+
+	TEST_START;
+
+	status = event_task_linux_init_state (NULL);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init_state (&null_state);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init_state (&null_system);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init_state (&null_handlers);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init_state (&no_handlers);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+}
+
+static void event_task_linux_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	event_task_linux_release (NULL);
+}
+
+static void event_task_linux_test_start (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_and_start (test, &task, list, count);
+
+	/* Once an event can be submitted, the handlers have been prepared. */
+	status = event_task_linux_testing_get_event_context (&task.test, &context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, context);
+
+	CuAssertIntEquals (test, 1, task.handler1.prepared);
+	CuAssertIntEquals (test, 1, task.handler2.prepared);
+
+	status = task.test.base.unlock (&task.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_start_already_started (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_and_start (test, &task, list, count);
+
+	status = event_task_linux_start (&task.test, "event_test");
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_linux_testing_get_event_context (&task.test, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = task.test.base.unlock (&task.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 1, task.handler1.prepared);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_start_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = event_task_linux_start (NULL, "event_test");
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+}
+
+static void event_task_linux_test_lock_null (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, list, count);
+	CuAssertIntEquals (test, 0, status);
+
+	status = task.test.base.lock (NULL);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = task.test.base.unlock (NULL);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_notify (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_and_start (test, &task, list, count);
+
+	status = event_task_linux_testing_get_event_context (&task.test, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	context->action = 3;
+	context->event_buffer[0] = 0x55;
+
+	status = task.test.base.notify (&task.test.base, &task.handler2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_semaphore_wait (&task.handler2.done, 1000);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0, task.handler1.executed);
+	CuAssertIntEquals (test, 1, task.handler2.executed);
+	CuAssertIntEquals (test, 3, task.handler2.action);
+	CuAssertIntEquals (test, 0x55, task.handler2.data);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_notify_multiple_events (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_context *context;
+	int i;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_and_start (test, &task, list, count);
+
+	for (i = 0; i < 10; i++) {
+		status = event_task_linux_testing_get_event_context (&task.test, &context);
+		CuAssertIntEquals (test, 0, status);
+
+		context->action = i;
+
+		status = task.test.base.notify (&task.test.base, list[i % 2]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	for (i = 0; i < 5; i++) {
+		status = platform_semaphore_wait (&task.handler1.done, 1000);
+		CuAssertIntEquals (test, 0, status);
+
+		status = platform_semaphore_wait (&task.handler2.done, 1000);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	CuAssertIntEquals (test, 5, task.handler1.executed);
+	CuAssertIntEquals (test, 5, task.handler2.executed);
+	CuAssertIntEquals (test, 8, task.handler1.action);
+	CuAssertIntEquals (test, 9, task.handler2.action);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_notify_unknown_handler (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_and_start (test, &task, list, count);
+
+	status = event_task_linux_testing_get_event_context (&task.test, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = task.test.base.notify (&task.test.base, &task.handler2.base);
+	CuAssertIntEquals (test, EVENT_TASK_UNKNOWN_HANDLER, status);
+
+	/* The task is still available for other events. */
+	status = event_task_linux_testing_get_event_context (&task.test, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = task.test.base.notify (&task.test.base, &task.handler1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_semaphore_wait (&task.handler1.done, 1000);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 1, task.handler1.executed);
+	CuAssertIntEquals (test, 0, task.handler2.executed);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_notify_not_ready (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_and_start (test, &task, list, count);
+
+	status = task.test.base.notify (&task.test.base, &task.handler1.base);
+	CuAssertIntEquals (test, EVENT_TASK_NOT_READY, status);
+	CuAssertIntEquals (test, 0, task.handler1.executed);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_get_event_context_busy (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_and_start (test, &task, list, count);
+	task.handler1.block = true;
+
+	status = event_task_linux_testing_get_event_context (&task.test, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = task.test.base.notify (&task.test.base, &task.handler1.base);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The handler is running, so no new events can be submitted. */
+	status = task.test.base.get_event_context (&task.test.base, &context);
+	CuAssertIntEquals (test, EVENT_TASK_BUSY, status);
+
+	platform_semaphore_post (&task.handler1.release);
+
+	status = platform_semaphore_wait (&task.handler1.done, 1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_linux_testing_get_event_context (&task.test, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = task.test.base.unlock (&task.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_not_started (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, list, count);
+	CuAssertIntEquals (test, 0, status);
+
+	status = task.test.base.get_event_context (&task.test.base, &context);
+	CuAssertIntEquals (test, EVENT_TASK_NO_TASK, status);
+
+	status = task.test.base.notify (&task.test.base, &task.handler1.base);
+	CuAssertIntEquals (test, EVENT_TASK_NO_TASK, status);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+static void event_task_linux_test_get_event_context_null (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	const struct event_task_handler *list[] = {
+		&task.handler1.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_and_start (test, &task, list, count);
+
+	status = task.test.base.get_event_context (NULL, &context);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = task.test.base.get_event_context (&task.test.base, NULL);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = task.test.base.notify (NULL, &task.handler1.base);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	event_task_linux_testing_release (test, &task);
+}
+
+
+TEST_SUITE_START (event_task_linux);
+
+TEST (event_task_linux_test_init);
+TEST (event_task_linux_test_init_null);
+TEST (event_task_linux_test_static_init);
+TEST (event_task_linux_test_static_init_null);
+TEST (event_task_linux_test_release_null);
+TEST (event_task_linux_test_start);
+TEST (event_task_linux_test_start_already_started);
+TEST (event_task_linux_test_start_null);
+TEST (event_task_linux_test_lock_null);
+TEST (event_task_linux_test_notify);
+TEST (event_task_linux_test_notify_multiple_events);
+TEST (event_task_linux_test_notify_unknown_handler);
+TEST (event_task_linux_test_notify_not_ready);
+TEST (event_task_linux_test_get_event_context_busy);
+TEST (event_task_linux_test_not_started);
+TEST (event_task_linux_test_get_event_context_null);
+
+TEST_SUITE_END;
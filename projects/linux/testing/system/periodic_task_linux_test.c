@@ -0,0 +1,398 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "system/periodic_task_linux.h"
+#include "system/periodic_task_linux_static.h"
+
+
+TEST_SUITE_LABEL ("periodic_task_linux");
+
+
+/**
+ * Periodic handler for testing that signals each time it executes.
+ */
+struct periodic_task_linux_testing_handler {
+	struct periodic_task_handler base;	/**< The base handler instance. */
+	platform_semaphore done;			/**< Signal that the handler has executed. */
+	platform_clock next;				/**< The next execution time. */
+	uint32_t period_ms;					/**< Time between executions. */
+	int prepared;						/**< Number of times the handler was prepared. */
+	int executed;						/**< Number of times the handler was executed. */
+};
+
+/**
+ * Dependencies for testing.
+ */
+struct periodic_task_linux_testing {
+	struct periodic_task_linux_testing_handler handler1;	/**< A test periodic handler. */
+	struct periodic_task_linux_testing_handler handler2;	/**< A test periodic handler. */
+	struct periodic_task_scheduler_state scheduler_state;	/**< Variable context for the scheduler. */
+	struct periodic_task_scheduler_entry heap[2];			/**< Storage for the scheduler heap. */
+	struct periodic_task_handler_stats stats[2];			/**< Storage for handler statistics. */
+	struct periodic_task_scheduler scheduler;				/**< Scheduler for the handlers. */
+	struct periodic_task_linux_state state;					/**< Variable context for the task. */
+	struct periodic_task_linux test;						/**< The periodic task under test. */
+};
+
+
+/**
+ * Test periodic handler preparation.
+ *
+ * @param handler The handler to prepare.
+ */
+static void periodic_task_linux_testing_prepare (const struct periodic_task_handler *handler)
+{
+	struct periodic_task_linux_testing_handler *test =
+		(struct periodic_task_linux_testing_handler*) handler;
+
+	test->prepared++;
+	platform_init_timeout (test->period_ms, &test->next);
+}
+
+/**
+ * Get the next execution time for a test periodic handler.
+ *
+ * @param handler The handler to query.
+ *
+ * @return The next execution time.
+ */
+static const platform_clock* periodic_task_linux_testing_get_next_execution (
+	const struct periodic_task_handler *handler)
+{
+	struct periodic_task_linux_testing_handler *test =
+		(struct periodic_task_linux_testing_handler*) handler;
+
+	return &test->next;
+}
+
+/**
+ * Test periodic handler execution.
+ *
+ * @param handler The handler to execute.
+ */
+static void periodic_task_linux_testing_execute (const struct periodic_task_handler *handler)
+{
+	struct periodic_task_linux_testing_handler *test =
+		(struct periodic_task_linux_testing_handler*) handler;
+
+	test->executed++;
+	platform_init_timeout (test->period_ms, &test->next);
+
+	platform_semaphore_post (&test->done);
+}
+
+/**
+ * Initialize a test periodic handler.
+ *
+ * @param test The testing framework.
+ * @param handler The handler to initialize.
+ * @param period_ms The time between executions of the handler.
+ */
+static void periodic_task_linux_testing_init_handler (CuTest *test,
+	struct periodic_task_linux_testing_handler *handler, uint32_t period_ms)
+{
+	int status;
+
+	memset (handler, 0, sizeof (*handler));
+
+	handler->base.prepare = periodic_task_linux_testing_prepare;
+	handler->base.get_next_execution = periodic_task_linux_testing_get_next_execution;
+	handler->base.execute = periodic_task_linux_testing_execute;
+	handler->period_ms = period_ms;
+
+	status = platform_semaphore_init (&handler->done);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to initialize.
+ * @param handlers The list of handlers to schedule.
+ * @param count The number of handlers in the list.
+ * @param period1 The execution period for the first test handler.
+ * @param period2 The execution period for the second test handler.
+ */
+static void periodic_task_linux_testing_init_dependencies (CuTest *test,
+	struct periodic_task_linux_testing *task, const struct periodic_task_handler **handlers,
+	size_t count, uint32_t period1, uint32_t period2)
+{
+	int status;
+
+	periodic_task_linux_testing_init_handler (test, &task->handler1, period1);
+	periodic_task_linux_testing_init_handler (test, &task->handler2, period2);
+
+	status = periodic_task_scheduler_init (&task->scheduler, &task->scheduler_state, handlers,
+		count, task->heap, task->stats, PERIODIC_TASK_SCHEDULER_MISS_THRESHOLD_MS);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release test dependencies.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to release.
+ */
+static void periodic_task_linux_testing_release_dependencies (CuTest *test,
+	struct periodic_task_linux_testing *task)
+{
+	periodic_task_scheduler_release (&task->scheduler);
+
+	platform_semaphore_free (&task->handler1.done);
+	platform_semaphore_free (&task->handler2.done);
+}
+
+/**
+ * Release a test instance.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to release.
+ */
+static void periodic_task_linux_testing_release (CuTest *test,
+	struct periodic_task_linux_testing *task)
+{
+	periodic_task_linux_release (&task->test);
+	periodic_task_linux_testing_release_dependencies (test, task);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void periodic_task_linux_test_init (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	const struct periodic_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (test, &task, list, count, 10, 20);
+
+	status = periodic_task_linux_init (&task.test, &task.state, &task.scheduler, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_linux_testing_release (test, &task);
+}
+
+static void periodic_task_linux_test_init_null (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	const struct periodic_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (test, &task, list, count, 10, 20);
+
+	status = periodic_task_linux_init (NULL, &task.state, &task.scheduler, 1);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_linux_init (&task.test, NULL, &task.scheduler, 1);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_linux_init (&task.test, &task.state, NULL, 1);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	periodic_task_linux_testing_release_dependencies (test, &task);
+}
+
+static void periodic_task_linux_test_static_init (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	const struct periodic_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_linux test_static = periodic_task_linux_static_init (&task.state,
+		&task.scheduler, 1);
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (test, &task, list, count, 10, 20);
+
+	status = periodic_task_linux_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_linux_release (&test_static);
+	periodic_task_linux_testing_release_dependencies (test, &task);
+}
+
+static void periodic_task_linux_test_static_init_null (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	struct periodic_task_linux null_state = periodic_task_linux_static_init (NULL,
+		&task.scheduler, 1);
+	struct periodic_task_linux null_scheduler = periodic_task_linux_static_init (&task.state,
+		NULL, 1);
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_linux_init_state (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_linux_init_state (&null_state);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_linux_init_state (&null_scheduler);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_linux_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	periodic_task_linux_release (NULL);
+}
+
+static void periodic_task_linux_test_start_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_linux_start (NULL, "periodic_test");
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_linux_test_run_handlers (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	const struct periodic_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	struct periodic_task_handler_stats stats;
+	platform_clock start;
+	platform_clock end;
+	int i;
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (test, &task, list, count, 20, 1000);
+
+	status = periodic_task_linux_init (&task.test, &task.state, &task.scheduler, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&start);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_linux_start (&task.test, "periodic_test");
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 5; i++) {
+		status = platform_semaphore_wait (&task.handler1.done, 1000);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&start, &end) >= 100));
+
+	periodic_task_linux_release (&task.test);
+
+	CuAssertIntEquals (test, 1, task.handler1.prepared);
+	CuAssertIntEquals (test, 1, task.handler2.prepared);
+	CuAssertTrue (test, (task.handler1.executed >= 5));
+	CuAssertIntEquals (test, 0, task.handler2.executed);
+
+	status = periodic_task_scheduler_get_handler_stats (&task.scheduler, 0, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, task.handler1.executed, stats.executions);
+
+	periodic_task_linux_testing_release_dependencies (test, &task);
+}
+
+static void periodic_task_linux_test_release_while_waiting (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	const struct periodic_task_handler *list[] = {
+		&task.handler1.base, &task.handler2.base
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	platform_clock start;
+	platform_clock end;
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (test, &task, list, count, 10000, 20000);
+
+	status = periodic_task_linux_init (&task.test, &task.state, &task.scheduler, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_linux_start (&task.test, "periodic_test");
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (50);
+
+	/* Stopping the task does not wait for the next handler to be ready. */
+	status = platform_init_current_tick (&start);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_linux_release (&task.test);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&start, &end) < 1000));
+
+	CuAssertIntEquals (test, 0, task.handler1.executed);
+	CuAssertIntEquals (test, 0, task.handler2.executed);
+
+	periodic_task_linux_testing_release_dependencies (test, &task);
+}
+
+static void periodic_task_linux_test_no_handlers (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	const struct periodic_task_handler *list[] = {
+		NULL, NULL
+	};
+	const size_t count = sizeof (list) / sizeof (list[0]);
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (test, &task, list, count, 10, 20);
+
+	status = periodic_task_linux_init (&task.test, &task.state, &task.scheduler, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_linux_start (&task.test, "periodic_test");
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (50);
+
+	periodic_task_linux_testing_release (test, &task);
+}
+
+
+TEST_SUITE_START (periodic_task_linux);
+
+TEST (periodic_task_linux_test_init);
+TEST (periodic_task_linux_test_init_null);
+TEST (periodic_task_linux_test_static_init);
+TEST (periodic_task_linux_test_static_init_null);
+TEST (periodic_task_linux_test_release_null);
+TEST (periodic_task_linux_test_start_null);
+TEST (periodic_task_linux_test_run_handlers);
+TEST (periodic_task_linux_test_release_while_waiting);
+TEST (periodic_task_linux_test_no_handlers);
+
+TEST_SUITE_END;
@@ -19,6 +19,7 @@
 #include <linux/i2c-dev.h>
 #include "crypto/checksum.h"
 #include "logging/debug_log.h"
+#include "logging/debug_log_compact.h"
 
 
 /**
@@ -1501,15 +1502,37 @@ void parse_ocp_log (uint8_t *data, uint32_t length)
 }
 
 /**
- * Parse a device log using Cerberus log formatting.
+ * Print the contents of a Cerberus debug log entry.
+ *
+ * @param fd The output file or -1 for stdout.
+ * @param msg The log entry in the standard format.
+ * @param format The format identifier for the entry as it was stored in the log.
+ */
+void print_cerberus_log_entry (int fd, const struct debug_log_entry *msg, uint16_t format)
+{
+	print_message (fd, "\tEntry Format:  0x%02x\n", format);
+	print_message (fd, "\tSeverity: 0x%02x\n", msg->entry.severity);
+	print_message (fd, "\tComponent: 0x%02x\n", msg->entry.component);
+	print_message (fd, "\tMessage ID: 0x%02x\n", msg->entry.msg_index);
+	print_message (fd, "\tArg1: 0x%08x\n", msg->entry.arg1);
+	print_message (fd, "\tArg2: 0x%08x\n", msg->entry.arg2);
+	print_message (fd, "\tTimestamp: 0x%llx\n", msg->entry.time);
+}
+
+/**
+ * Parse a device log using Cerberus log formatting.  Entries stored using the compact encoding are
+ * expanded to the standard format.
  *
  * @param data The log data.
  * @param length The amount of log data.
  */
 void parse_cerberus_log (uint8_t *data, uint32_t length)
 {
-	struct debug_log_entry *msg;
+	struct logging_entry_header *header;
+	struct debug_log_entry msg;
+	const size_t header_len = sizeof (struct logging_entry_header);
 	int fd = -1;
+	int status;
 
 	if (file_name) {
 		fd = open (file_name, O_RDWR | O_CREAT,
@@ -1520,37 +1543,50 @@ void parse_cerberus_log (uint8_t *data, uint32_t length)
 		}
 	}
 
-	while (length >= sizeof (struct debug_log_entry)) {
-		msg = (struct debug_log_entry*) data;
+	/* Compact entries can be shorter than a standard entry, so parse everything that has a complete
+	 * entry header. */
+	while (length >= header_len) {
+		header = (struct logging_entry_header*) data;
 
-		if (!LOGGING_IS_ENTRY_START (msg->header.log_magic)) {
-			print_message (fd, "Invalid log entry marker 0x%02x\n", msg->header.log_magic);
+		if (!LOGGING_IS_ENTRY_START (header->log_magic)) {
+			print_message (fd, "Invalid log entry marker 0x%02x\n", header->log_magic);
 			exit (1);
 		}
 
-		if (length < msg->header.length) {
+		if ((header->length < header_len) || (length < header->length)) {
 			print_message (fd, "Malformed message length 0x%04x, remaining 0x%04x\n",
-				msg->header.length, length);
+				header->length, length);
 			exit (1);
 		}
 
-		print_message (fd, "Entry: 0x%08x\n", msg->header.entry_id);
-		print_message (fd, "\tHeader Format: 0x%02x\n", msg->header.log_magic);
-		print_message (fd, "\tEntry Format:  0x%02x\n", msg->entry.format);
-		print_message (fd, "\tSeverity: 0x%02x\n", msg->entry.severity);
-		print_message (fd, "\tComponent: 0x%02x\n", msg->entry.component);
-		print_message (fd, "\tMessage ID: 0x%02x\n", msg->entry.msg_index);
-		print_message (fd, "\tArg1: 0x%08x\n", msg->entry.arg1);
-		print_message (fd, "\tArg2: 0x%08x\n", msg->entry.arg2);
-		print_message (fd, "\tTimestamp: 0x%llx\n", msg->entry.time);
-
-		if (msg->header.length > sizeof (struct debug_log_entry)) {
-			output_array (fd, data, sizeof (struct debug_log_entry), msg->header.length - 1,
-				"Unknown Data", "\t");
+		print_message (fd, "Entry: 0x%08x\n", header->entry_id);
+		print_message (fd, "\tHeader Format: 0x%02x\n", header->log_magic);
+
+		if ((header->length > header_len) && (data[header_len] == DEBUG_LOG_ENTRY_FORMAT_COMPACT)) {
+			status = debug_log_compact_expand_entry (data, header->length, &msg);
+			if (ROT_IS_ERROR (status)) {
+				print_message (fd, "\tMalformed compact entry\n");
+				output_array (fd, data, header_len, header->length - 1, "Entry Data", "\t");
+			}
+			else {
+				print_cerberus_log_entry (fd, &msg, DEBUG_LOG_ENTRY_FORMAT_COMPACT);
+			}
+		}
+		else if (header->length >= sizeof (struct debug_log_entry)) {
+			memcpy (&msg, data, sizeof (msg));
+			print_cerberus_log_entry (fd, &msg, msg.entry.format);
+
+			if (header->length > sizeof (struct debug_log_entry)) {
+				output_array (fd, data, sizeof (struct debug_log_entry), header->length - 1,
+					"Unknown Data", "\t");
+			}
+		}
+		else if (header->length > header_len) {
+			output_array (fd, data, header_len, header->length - 1, "Unknown Data", "\t");
 		}
 
-		data += msg->header.length;
-		length -= msg->header.length;
+		data += header->length;
+		length -= header->length;
 	}
 
 	if (length != 0) {